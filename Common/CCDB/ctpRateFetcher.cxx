@@ -24,6 +24,7 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace o2
@@ -60,36 +61,55 @@ double ctpRateFetcher::fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStam
   return -1.;
 }
 
-double ctpRateFetcher::fetchCTPratesClasses(o2::ccdb::BasicCCDBManager* /*ccdb*/, uint64_t timeStamp, int /*runNumber*/, const std::string& className, int inputType)
+void ctpRateFetcher::fetch(o2::ccdb::BasicCCDBManager* ccdb, const std::vector<uint64_t>& timeStamps, int runNumber, const std::string& sourceName, std::vector<double>& rates, bool fCrashOnNull)
 {
-  std::vector<ctp::CTPClass> ctpcls = mConfig->getCTPClasses();
-  std::vector<int> clslist = mConfig->getTriggerClassList();
-  int classIndex = -1;
-  for (size_t i = 0; i < clslist.size(); i++) {
-    if (ctpcls[i].name.find(className) != std::string::npos) {
-      classIndex = i;
-      break;
+  rates.resize(timeStamps.size());
+  for (std::size_t iTimeStamp = 0; iTimeStamp < timeStamps.size(); ++iTimeStamp) {
+    rates[iTimeStamp] = fetch(ccdb, timeStamps[iTimeStamp], runNumber, sourceName, fCrashOnNull);
+  }
+}
+
+double ctpRateFetcher::fetchCTPratesClasses(o2::ccdb::BasicCCDBManager* /*ccdb*/, uint64_t timeStamp, int /*runNumber*/, std::string_view className, int inputType)
+{
+  auto classIndexIt = mClassIndices.find(className);
+  if (classIndexIt == mClassIndices.end()) {
+    const auto& ctpcls = mConfig->getCTPClasses();
+    const auto& clslist = mConfig->getTriggerClassList();
+    int classIndex = -1;
+    for (size_t i = 0; i < clslist.size(); i++) {
+      if (ctpcls[i].name.find(className) != std::string::npos) {
+        classIndex = i;
+        break;
+      }
     }
+    classIndexIt = mClassIndices.emplace(className, classIndex).first;
   }
-  if (classIndex == -1) {
+  if (classIndexIt->second == -1) {
     LOG(warn) << "Trigger class " << className << " not found in CTPConfiguration";
     return -1.;
   }
-  auto rate{mScalers->getRateGivenT(timeStamp * 1.e-3, classIndex, inputType, 1)};
-  return pileUpCorrection(rate.second);
+  return getRate(classIndexIt->second, inputType, timeStamp);
 }
 
 double ctpRateFetcher::fetchCTPratesInputs(o2::ccdb::BasicCCDBManager* /*ccdb*/, uint64_t timeStamp, int /*runNumber*/, int input)
 {
-  std::vector<ctp::CTPScalerRecordO2> recs = mScalers->getScalerRecordO2();
-  if (recs[0].scalersInps.size() == 48) {
-    return pileUpCorrection(mScalers->getRateGivenT(timeStamp * 1.e-3, input, 7, 1).second);
+  if (mInputsAvailable < 0) {
+    const auto& recs = mScalers->getScalerRecordO2();
+    mInputsAvailable = recs[0].scalersInps.size() == 48;
+  }
+  if (mInputsAvailable) {
+    return getRate(input, 7, timeStamp);
   } else {
     LOG(error) << "Inputs not available";
     return -1.;
   }
 }
 
+double ctpRateFetcher::getRate(int index, int type, uint64_t timeStamp)
+{
+  return pileUpCorrection(mScalers->getRateGivenT(timeStamp * 1.e-3, index, type, 1).second);
+}
+
 double ctpRateFetcher::pileUpCorrection(double triggerRate)
 {
   if (mLHCIFdata == nullptr) {
@@ -128,6 +148,9 @@ void ctpRateFetcher::setupRun(int runNumber, o2::ccdb::BasicCCDBManager* ccdb, u
     LOG(fatal) << "CTPRunScalers not in database, timestamp:" << timeStamp;
   }
   mScalers->convertRawToO2();
+
+  mClassIndices.clear();
+  mInputsAvailable = -1;
 }
 
 } // namespace o2
@@ -15,7 +15,11 @@
 #include <CCDB/BasicCCDBManager.h>
 
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace o2
 {
@@ -36,20 +40,27 @@ class ctpRateFetcher
  public:
   ctpRateFetcher() = default;
   double fetch(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, const std::string& sourceName, bool fCrashOnNull = true);
+  /// Fetch the rates for a set of time stamps of the same run, e.g. for all the collisions of a time frame
+  void fetch(o2::ccdb::BasicCCDBManager* ccdb, const std::vector<uint64_t>& timeStamps, int runNumber, const std::string& sourceName, std::vector<double>& rates, bool fCrashOnNull = true);
 
   void setManualCleanup(bool manualCleanup = true) { mManualCleanup = manualCleanup; }
 
  private:
   double fetchCTPratesInputs(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, int input);
-  double fetchCTPratesClasses(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, const std::string& className, int inputType = 1);
+  double fetchCTPratesClasses(o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp, int runNumber, std::string_view className, int inputType = 1);
   double pileUpCorrection(double rate);
   void setupRun(int runNumber, o2::ccdb::BasicCCDBManager* ccdb, uint64_t timeStamp);
+  double getRate(int index, int type, uint64_t timeStamp);
 
   bool mManualCleanup = false;
   int mRunNumber = -1;
   ctp::CTPConfiguration* mConfig = nullptr;
   ctp::CTPRunScalers* mScalers = nullptr;
   parameters::GRPLHCIFData* mLHCIFdata = nullptr;
+
+  // per-run caches, filled on first use
+  std::map<std::string, int, std::less<>> mClassIndices; // index of the trigger classes in the scalers, -1 if not found
+  int mInputsAvailable = -1;                             // whether the scalers of the inputs are available (-1: not checked yet)
 };
 } // namespace o2
 
@@ -27,7 +27,9 @@
 
 #include <Rtypes.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -139,6 +141,23 @@ class CollisionAssociation
                         Assoc& association,
                         RevIndices& reverseIndices)
   {
+    // index of the first ambiguous-track row of each track, to avoid scanning all the ambiguous tracks for each unassigned track
+    std::vector<int64_t> ambTrackRowPerTrack;
+    if (mIncludeUnassigned) {
+      ambTrackRowPerTrack.assign(tracksUnfiltered.size(), -1);
+      for (const auto& ambTrack : ambiguousTracks) {
+        int64_t trackId{-1};
+        if constexpr (isCentralBarrel) { // FIXME: to be removed as soon as it is possible to use getId<Table>() for joined tables
+          trackId = ambTrack.trackId();
+        } else {
+          trackId = ambTrack.template getId<TTracks>();
+        }
+        if (trackId >= 0 && trackId < static_cast<int64_t>(ambTrackRowPerTrack.size()) && ambTrackRowPerTrack[trackId] < 0) {
+          ambTrackRowPerTrack[trackId] = ambTrack.globalIndex();
+        }
+      }
+    }
+
     // cache globalBC and track time in BC for optimization
     std::vector<int64_t> globalBC;
     std::vector<int64_t> trackBCCache;
@@ -155,27 +174,16 @@ class CollisionAssociation
       int64_t trackBC = -1;
       if (track.has_collision()) {
         trackBC = track.collision().bc().globalBC();
-      } else if (mIncludeUnassigned) {
-        for (const auto& ambTrack : ambiguousTracks) {
-          if constexpr (isCentralBarrel) { // FIXME: to be removed as soon as it is possible to use getId<Table>() for joined tables
-            if (ambTrack.trackId() == track.globalIndex()) {
-              // special check to avoid crashes (in particular on some MC datasets)
-              // related to shifts in ambiguous tracks association to bc slices (off by 1) - see https://mattermost.web.cern.ch/alice/pl/g9yaaf3tn3g4pgn7c1yex9copy
-              if (ambTrack.bcIds()[0] >= bcs.size() || ambTrack.bcIds()[1] >= bcs.size()) {
-                break;
-              }
-              if (!ambTrack.has_bc() || ambTrack.bc().size() == 0) {
-                break;
-              }
-              trackBC = ambTrack.bc().begin().globalBC();
-              break;
-            }
-          } else {
-            if (ambTrack.template getId<TTracks>() == track.globalIndex()) {
-              trackBC = ambTrack.bc().begin().globalBC();
-              break;
-            }
+      } else if (mIncludeUnassigned && ambTrackRowPerTrack[track.globalIndex()] >= 0) {
+        const auto ambTrack = ambiguousTracks.rawIteratorAt(ambTrackRowPerTrack[track.globalIndex()]);
+        if constexpr (isCentralBarrel) {
+          // special check to avoid crashes (in particular on some MC datasets)
+          // related to shifts in ambiguous tracks association to bc slices (off by 1) - see https://mattermost.web.cern.ch/alice/pl/g9yaaf3tn3g4pgn7c1yex9copy
+          if (ambTrack.bcIds()[0] < bcs.size() && ambTrack.bcIds()[1] < bcs.size() && ambTrack.has_bc() && ambTrack.bc().size() > 0) {
+            trackBC = ambTrack.bc().begin().globalBC();
           }
+        } else {
+          trackBC = ambTrack.bc().begin().globalBC();
         }
       }
       globalBC.push_back(trackBC);
@@ -201,97 +209,153 @@ class CollisionAssociation
 
     // loop over collisions to find time-compatible tracks
     int64_t bcOffsetMax = mBcWindowForOneSigma * mNumSigmaForTimeCompat + mTimeMargin / o2::constants::lhc::LHCBunchSpacingNS;
+
+    // The blocks without the optimization on the globalBC ordering below (unassigned tracks, all blocks for non-central-barrel tracks) are sorted by track time in BC:
+    // the tracks within the BC window of each collision are then found with a sweep over the collisions (sorted by BC), instead of scanning the full block for each collision
+    const std::size_t nWindows = trackIterationWindows.size();
+    std::vector<bool> isSortedWindow(nWindows, false);
+    std::vector<std::vector<std::pair<int64_t, int64_t>>> windowTracksSortedByBC(nWindows); // track time in BC and filtered index of the tracks of each sorted block
+    std::vector<std::pair<std::size_t, std::size_t>> windowSweepRanges(nWindows, {0, 0});    // range of the sorted tracks in the BC window of the current collision
+    for (std::size_t iWindow = 0; iWindow < nWindows; ++iWindow) {
+      const auto& [windowBegin, windowEnd] = trackIterationWindows[iWindow];
+      const bool isAssignedTrackWindow = (windowBegin != windowEnd) ? windowBegin.has_collision() : false;
+      isSortedWindow[iWindow] = !(isCentralBarrel && isAssignedTrackWindow);
+      if (!isSortedWindow[iWindow]) {
+        continue;
+      }
+      for (auto trackInWindow = windowBegin; trackInWindow != windowEnd; ++trackInWindow) {
+        if (globalBC[trackInWindow.filteredIndex()] >= 0) {
+          windowTracksSortedByBC[iWindow].emplace_back(trackBCCache[trackInWindow.filteredIndex()], trackInWindow.filteredIndex());
+        }
+      }
+      std::sort(windowTracksSortedByBC[iWindow].begin(), windowTracksSortedByBC[iWindow].end());
+    }
+    std::vector<int64_t> tracksInBcWindow; // filtered indices of the tracks of a sorted block in the BC window of the collision
+    int64_t lastCollBC = -1;
+
     for (const auto& collision : collisions) {
       const float collTime = collision.collisionTime();
       const float collTimeRes2 = collision.collisionTimeRes() * collision.collisionTimeRes();
       uint64_t collBC = collision.bc().globalBC();
 
-      // This is done per block to allow optimization below. Within each block the globalBC increase continously
-      for (auto& iterationWindow : trackIterationWindows) { // o2-linter: disable=const-ref-in-for-loop (iterationWindow is modified)
-        bool iteratorMoved = false;
-        const bool isAssignedTrackWindow = (iterationWindow.first != iterationWindow.second) ? iterationWindow.first.has_collision() : false;
-        for (auto trackInWindow = iterationWindow.first; trackInWindow != iterationWindow.second; ++trackInWindow) {
-          int64_t trackBC = globalBC[trackInWindow.filteredIndex()];
-          if (trackBC < 0) {
-            continue;
-          }
-
-          // Optimization to avoid looping over the full track list each time. This builds on that tracks are sorted by BCs (which they should be because collisions are sorted by BCs)
-          const int64_t bcOffset = trackBC - static_cast<int64_t>(collBC);
-          if constexpr (isCentralBarrel) {
-            // only for blocks with collision association
-            if (isAssignedTrackWindow) {
-              constexpr int margin = 200;
-              if (!iteratorMoved && bcOffset > -bcOffsetMax - margin) {
-                iterationWindow.first.setCursor(trackInWindow.filteredIndex());
-                iteratorMoved = true;
-                LOGP(debug, "Moving iterator begin {}", trackInWindow.filteredIndex());
-              } else if (bcOffset > bcOffsetMax + margin) {
-                LOGP(debug, "Stopping iterator {}", trackInWindow.filteredIndex());
-                break;
-              }
-            }
-          }
-
-          int64_t bcOffsetWindow = trackBCCache[trackInWindow.filteredIndex()] - static_cast<int64_t>(collBC);
-          if (std::abs(bcOffsetWindow) > bcOffsetMax) {
-            continue;
-          }
+      // check the time compatibility of a track with the collision and fill the association
+      auto associateIfTimeCompatible = [&](auto const& trackInWindow) {
+        const int64_t trackBC = globalBC[trackInWindow.filteredIndex()];
+        const int64_t bcOffset = trackBC - static_cast<int64_t>(collBC);
+        int64_t bcOffsetWindow = trackBCCache[trackInWindow.filteredIndex()] - static_cast<int64_t>(collBC);
+        if (std::abs(bcOffsetWindow) > bcOffsetMax) {
+          return;
+        }
 
-          float trackTime = 0;
-          float trackTimeRes = 0;
-          if constexpr (isCentralBarrel) {
-            if ((mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::OnlySameBc && trackInWindow.isPVContributor()) || (mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::SameBcAndLowMult && trackInWindow.isPVContributor() && trackInWindow.collision().numContrib() > mMaxPvContributorsForLowMultReassoc)) {
-              trackTime = trackInWindow.collision().collisionTime(); // if PV contributor, we assume the time to be the one of the collision
-              trackTimeRes = o2::constants::lhc::LHCBunchSpacingNS;  // 1 BC
-            } else {
-              trackTime = trackInWindow.trackTime();
-              trackTimeRes = trackInWindow.trackTimeRes();
-            }
+        float trackTime = 0;
+        float trackTimeRes = 0;
+        if constexpr (isCentralBarrel) {
+          if ((mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::OnlySameBc && trackInWindow.isPVContributor()) || (mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::SameBcAndLowMult && trackInWindow.isPVContributor() && trackInWindow.collision().numContrib() > mMaxPvContributorsForLowMultReassoc)) {
+            trackTime = trackInWindow.collision().collisionTime(); // if PV contributor, we assume the time to be the one of the collision
+            trackTimeRes = o2::constants::lhc::LHCBunchSpacingNS;  // 1 BC
           } else {
             trackTime = trackInWindow.trackTime();
             trackTimeRes = trackInWindow.trackTimeRes();
           }
+        } else {
+          trackTime = trackInWindow.trackTime();
+          trackTimeRes = trackInWindow.trackTimeRes();
+        }
 
-          const float deltaTime = trackTime - collTime + bcOffset * o2::constants::lhc::LHCBunchSpacingNS;
-          float sigmaTimeRes2 = collTimeRes2 + trackTimeRes * trackTimeRes;
-          LOGP(debug, "collision time={}, collision time res={}, track time={}, track time res={}, bc collision={}, bc track={}, delta time={}", collTime, collision.collisionTimeRes(), trackInWindow.trackTime(), trackInWindow.trackTimeRes(), collBC, trackBC, deltaTime);
+        const float deltaTime = trackTime - collTime + bcOffset * o2::constants::lhc::LHCBunchSpacingNS;
+        float sigmaTimeRes2 = collTimeRes2 + trackTimeRes * trackTimeRes;
+        LOGP(debug, "collision time={}, collision time res={}, track time={}, track time res={}, bc collision={}, bc track={}, delta time={}", collTime, collision.collisionTimeRes(), trackInWindow.trackTime(), trackInWindow.trackTimeRes(), collBC, trackBC, deltaTime);
 
-          float thresholdTime = 0.;
-          if constexpr (isCentralBarrel) {
-            if ((mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::OnlySameBc && trackInWindow.isPVContributor()) || (mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::SameBcAndLowMult && trackInWindow.isPVContributor() && trackInWindow.collision().numContrib() > mMaxPvContributorsForLowMultReassoc)) {
-              thresholdTime = trackTimeRes;
-            } else if (TESTBIT(trackInWindow.flags(), o2::aod::track::TrackTimeResIsRange)) {
-              // the track time resolution is a range, not a gaussian resolution
-              thresholdTime = trackTimeRes + mNumSigmaForTimeCompat * std::sqrt(collTimeRes2) + mTimeMargin;
-            } else {
-              thresholdTime = mNumSigmaForTimeCompat * std::sqrt(sigmaTimeRes2) + mTimeMargin;
-            }
+        float thresholdTime = 0.;
+        if constexpr (isCentralBarrel) {
+          if ((mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::OnlySameBc && trackInWindow.isPVContributor()) || (mUsePvAssociation == o2::aod::track_association::PVContrReassocOpt::SameBcAndLowMult && trackInWindow.isPVContributor() && trackInWindow.collision().numContrib() > mMaxPvContributorsForLowMultReassoc)) {
+            thresholdTime = trackTimeRes;
+          } else if (TESTBIT(trackInWindow.flags(), o2::aod::track::TrackTimeResIsRange)) {
+            // the track time resolution is a range, not a gaussian resolution
+            thresholdTime = trackTimeRes + mNumSigmaForTimeCompat * std::sqrt(collTimeRes2) + mTimeMargin;
           } else {
-            // the track is not a central track
-            if constexpr (TTracks::template contains<o2::aod::MFTTracks>()) {
-              // then the track is an MFT track, or an MFT track with additionnal joined info
-              // in this case TrackTimeResIsRange
-              thresholdTime = trackTimeRes + mNumSigmaForTimeCompat * std::sqrt(collTimeRes2) + mTimeMargin;
-            } else if constexpr (TTracks::template contains<o2::aod::FwdTracks>()) {
-              // the track is a fwd track, with a gaussian time resolution
-              thresholdTime = mNumSigmaForTimeCompat * std::sqrt(sigmaTimeRes2) + mTimeMargin;
-            }
+            thresholdTime = mNumSigmaForTimeCompat * std::sqrt(sigmaTimeRes2) + mTimeMargin;
           }
+        } else {
+          // the track is not a central track
+          if constexpr (TTracks::template contains<o2::aod::MFTTracks>()) {
+            // then the track is an MFT track, or an MFT track with additionnal joined info
+            // in this case TrackTimeResIsRange
+            thresholdTime = trackTimeRes + mNumSigmaForTimeCompat * std::sqrt(collTimeRes2) + mTimeMargin;
+          } else if constexpr (TTracks::template contains<o2::aod::FwdTracks>()) {
+            // the track is a fwd track, with a gaussian time resolution
+            thresholdTime = mNumSigmaForTimeCompat * std::sqrt(sigmaTimeRes2) + mTimeMargin;
+          }
+        }
 
-          if (std::abs(deltaTime) < thresholdTime) {
-            const auto collIdx = collision.globalIndex();
-            const auto trackIdx = trackInWindow.globalIndex();
-            LOGP(debug, "Filling track id {} for coll id {}", trackIdx, collIdx);
-            association(collIdx, trackIdx);
-            if (mFillTableOfCollIdsPerTrack) {
-              if (collsPerTrack[trackIdx] == nullptr) {
-                collsPerTrack[trackIdx] = std::make_unique<std::vector<int>>();
-              }
-              collsPerTrack[trackIdx].get()->push_back(collIdx);
+        if (std::abs(deltaTime) < thresholdTime) {
+          const auto collIdx = collision.globalIndex();
+          const auto trackIdx = trackInWindow.globalIndex();
+          LOGP(debug, "Filling track id {} for coll id {}", trackIdx, collIdx);
+          association(collIdx, trackIdx);
+          if (mFillTableOfCollIdsPerTrack) {
+            if (collsPerTrack[trackIdx] == nullptr) {
+              collsPerTrack[trackIdx] = std::make_unique<std::vector<int>>();
             }
+            collsPerTrack[trackIdx].get()->push_back(collIdx);
           }
         }
+      };
+
+      // restart the sweep if the collisions are not sorted by BC
+      if (static_cast<int64_t>(collBC) < lastCollBC) {
+        std::fill(windowSweepRanges.begin(), windowSweepRanges.end(), std::pair<std::size_t, std::size_t>{0, 0});
+      }
+      lastCollBC = static_cast<int64_t>(collBC);
+
+      // This is done per block to allow optimization below. Within each block the globalBC increase continously
+      for (std::size_t iWindow = 0; iWindow < nWindows; ++iWindow) {
+        auto& iterationWindow = trackIterationWindows[iWindow];
+        if (isSortedWindow[iWindow]) {
+          const auto& sortedTracks = windowTracksSortedByBC[iWindow];
+          auto& [firstTrack, lastTrack] = windowSweepRanges[iWindow];
+          while (firstTrack < sortedTracks.size() && sortedTracks[firstTrack].first < static_cast<int64_t>(collBC) - bcOffsetMax) {
+            ++firstTrack;
+          }
+          lastTrack = std::max(firstTrack, lastTrack);
+          while (lastTrack < sortedTracks.size() && sortedTracks[lastTrack].first <= static_cast<int64_t>(collBC) + bcOffsetMax) {
+            ++lastTrack;
+          }
+          // tracks processed in the table order, as for the other blocks
+          tracksInBcWindow.clear();
+          for (auto iTrack = firstTrack; iTrack < lastTrack; ++iTrack) {
+            tracksInBcWindow.push_back(sortedTracks[iTrack].second);
+          }
+          std::sort(tracksInBcWindow.begin(), tracksInBcWindow.end());
+          auto trackInWindow = iterationWindow.first;
+          for (const auto& filteredIndex : tracksInBcWindow) {
+            trackInWindow.setCursor(filteredIndex);
+            associateIfTimeCompatible(trackInWindow);
+          }
+          continue;
+        }
+
+        bool iteratorMoved = false;
+        for (auto trackInWindow = iterationWindow.first; trackInWindow != iterationWindow.second; ++trackInWindow) {
+          int64_t trackBC = globalBC[trackInWindow.filteredIndex()];
+          if (trackBC < 0) {
+            continue;
+          }
+
+          // Optimization to avoid looping over the full track list each time. This builds on that tracks are sorted by BCs (which they should be because collisions are sorted by BCs)
+          const int64_t bcOffset = trackBC - static_cast<int64_t>(collBC);
+          constexpr int margin = 200;
+          if (!iteratorMoved && bcOffset > -bcOffsetMax - margin) {
+            iterationWindow.first.setCursor(trackInWindow.filteredIndex());
+            iteratorMoved = true;
+            LOGP(debug, "Moving iterator begin {}", trackInWindow.filteredIndex());
+          } else if (bcOffset > bcOffsetMax + margin) {
+            LOGP(debug, "Stopping iterator {}", trackInWindow.filteredIndex());
+            break;
+          }
+
+          associateIfTimeCompatible(trackInWindow);
+        }
       }
     }
     // create reverse index track to collisions if enabled
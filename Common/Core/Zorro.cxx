@@ -30,10 +30,13 @@
 #include <RtypesCore.h>
 
 #include <algorithm>
+#include <bit>
 #include <bitset>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -190,8 +193,6 @@ std::vector<int> Zorro::initCCDB(o2::ccdb::BasicCCDBManager* ccdb, int runNumber
   mSelections = mCCDB->getForRun<TH1D>(mBaseCCDBPath + "SelectionCounters", runNumber, true);
   mInspectedTVX = mCCDB->getForRun<TH1D>(mBaseCCDBPath + "InspectedTVX", runNumber, true);
   setupHelpers(timestamp);
-  mLastBCglobalId = 0;
-  mLastSelectedIdx = 0;
   mTOIs.clear();
   mTOIidx.clear();
   std::vector<std::string> tokens = o2::utils::Str::tokenize(tois, ','); // tokens are trimmed
@@ -219,46 +220,58 @@ std::vector<int> Zorro::initCCDB(o2::ccdb::BasicCCDBManager* ccdb, int runNumber
 std::bitset<128> Zorro::fetch(uint64_t bcGlobalId, uint64_t tolerance)
 {
   mLastResult.reset();
+  mLastSelectedBCranges.clear();
   if (bcGlobalId < mBCranges.front().getMin().toLong() - tolerance || bcGlobalId > mBCranges.back().getMax().toLong() + tolerance) {
     setupHelpers((mOrbitResetTimestamp + static_cast<int64_t>(bcGlobalId * o2::constants::lhc::LHCBunchSpacingNS * 1e-3)) / 1000);
   }
 
   o2::dataformats::IRFrame bcFrame{InteractionRecord::long2IR(bcGlobalId) - tolerance, InteractionRecord::long2IR(bcGlobalId) + tolerance};
-  if (bcGlobalId < mLastBCglobalId) { /// Handle the possible discontinuity in the BC processed by the analyses
-    mLastSelectedIdx = 0;
-  }
-  uint64_t lastSelectedIdx = mLastSelectedIdx;
-  mLastBCglobalId = bcGlobalId;
-  for (size_t i = mLastSelectedIdx; i < mBCranges.size(); i++) {
-    if (!mBCranges[i].isOutside(bcFrame)) {
+  const uint64_t bcFrameMin = bcFrame.getMin().toLong();
+  const uint64_t bcFrameMax = bcFrame.getMax().toLong();
+  /// The overlapping BC ranges start before the end of the BC frame (upper bound in the ranges sorted by start)
+  /// and end after its start (lower bound from the cumulative maximum of the range ends), independently of the previously fetched BCs
+  const std::size_t rangesEnd = std::distance(mBCrangesMin.begin(), std::upper_bound(mBCrangesMin.begin(), mBCrangesMin.end(), bcFrameMax));
+  const std::size_t rangesBegin = std::distance(mBCrangesMaxCum.begin(), std::lower_bound(mBCrangesMaxCum.begin(), mBCrangesMaxCum.begin() + rangesEnd, bcFrameMin));
+  for (std::size_t i = rangesBegin; i < rangesEnd; i++) {
+    if (mBCrangesMax[i] < bcFrameMin) {
+      continue;
+    }
+    mLastResult |= getSelection(i);
+    mLastSelectedBCranges.push_back(i);
+    if (!mAccountedBCranges[i]) {
       for (int iMask{0}; iMask < 2; ++iMask) {
-        for (int iTOI{0}; iTOI < 64; ++iTOI) {
-          if (mZorroHelpers->at(i).selMask[iMask] & (1ull << iTOI)) {
-            mLastResult.set(iMask * 64 + iTOI, 1);
-            if (!mAccountedBCranges[i]) {
-              mATcounts[iMask * 64 + iTOI]++;
-              if (mAnalysedTriggers) {
-                mAnalysedTriggers->Fill(iMask * 64 + iTOI);
-              }
-            }
+        for (uint64_t selMask = mZorroHelpers->at(i).selMask[iMask]; selMask; selMask &= selMask - 1) { /// Loop over the set bits only
+          const int iTOI = std::countr_zero(selMask);
+          mATcounts[iMask * 64 + iTOI]++;
+          if (mAnalysedTriggers) {
+            mAnalysedTriggers->Fill(iMask * 64 + iTOI);
           }
         }
       }
       mAccountedBCranges[i] = true;
-      mLastSelectedIdx = mLastSelectedIdx == lastSelectedIdx-- ? i : mLastSelectedIdx; /// Decrease lastSelectedIdx to make sure this check is valid only in its first instance
-    } else if (mBCranges[i].getMax() < bcFrame.getMin()) {
-      mLastSelectedIdx = i;
-    } else if (mBCranges[i].getMin() > bcFrame.getMax()) {
-      break;
     }
   }
   return mLastResult;
 }
 
+void Zorro::fetch(std::span<const uint64_t> bcGlobalIds, std::vector<std::bitset<128>>& results, uint64_t tolerance)
+{
+  results.resize(bcGlobalIds.size());
+  for (size_t i{0}; i < bcGlobalIds.size(); ++i) {
+    results[i] = fetch(bcGlobalIds[i], tolerance);
+  }
+}
+
 bool Zorro::isSelected(uint64_t bcGlobalId, uint64_t tolerance, TH2* ToiHisto)
 {
-  uint64_t lastSelectedIdx = mLastSelectedIdx;
   fetch(bcGlobalId, tolerance);
+  std::bitset<128> newSelections; /// Selections of the matching BC ranges not yet accounted for the triggers of interest, to avoid double counting
+  for (const auto& iRange : mLastSelectedBCranges) {
+    if (!mAccountedBCrangesTOI[iRange]) {
+      newSelections |= getSelection(iRange);
+      mAccountedBCrangesTOI[iRange] = true;
+    }
+  }
   bool retVal{false};
   for (size_t i{0}; i < mTOIidx.size(); ++i) {
     if (mTOIidx[i] < 0) {
@@ -269,12 +282,13 @@ bool Zorro::isSelected(uint64_t bcGlobalId, uint64_t tolerance, TH2* ToiHisto)
         int binY = ToiHisto->GetYaxis()->FindBin(Form("%s AnalysedTriggers", mTOIs[i].data()));
         ToiHisto->SetBinContent(binX, binY, mAnalysedTriggers->GetBinContent(mAnalysedTriggers->GetXaxis()->FindBin(mTOIs[i].data())));
       }
-      mTOIcounts[i] += (lastSelectedIdx != mLastSelectedIdx); /// Avoid double counting
-      if (mAnalysedTriggersOfInterest && lastSelectedIdx != mLastSelectedIdx) {
+      const bool isNewSelection = newSelections.test(mTOIidx[i]);
+      mTOIcounts[i] += isNewSelection;
+      if (mAnalysedTriggersOfInterest && isNewSelection) {
         mAnalysedTriggersOfInterest->Fill(i);
         mZorroSummary.increaseTOIcounter(mRunNumber, i);
       }
-      if (ToiHisto && lastSelectedIdx != mLastSelectedIdx) {
+      if (ToiHisto && isNewSelection) {
         ToiHisto->Fill(Form("%d", mRunNumber), Form("%s", mTOIs[i].data()), 1);
       }
       retVal = true;
@@ -316,9 +330,23 @@ void Zorro::setupHelpers(int64_t timestamp)
   mZorroHelpers = mCCDB->getSpecific<std::vector<ZorroHelper>>(mBaseCCDBPath + "ZorroHelpers", timestamp, {{"runNumber", std::to_string(mRunNumber)}});
   std::sort(mZorroHelpers->begin(), mZorroHelpers->end(), [](const auto& a, const auto& b) { return std::min(a.bcAOD, a.bcEvSel) < std::min(b.bcAOD, b.bcEvSel); });
   mBCranges.clear();
+  mBCrangesMin.clear();
+  mBCrangesMax.clear();
+  mBCrangesMaxCum.clear();
   mAccountedBCranges.clear();
+  mAccountedBCrangesTOI.clear();
   for (const auto& helper : *mZorroHelpers) {
     mBCranges.emplace_back(InteractionRecord::long2IR(std::min(helper.bcAOD, helper.bcEvSel)), InteractionRecord::long2IR(std::max(helper.bcAOD, helper.bcEvSel)));
+    mBCrangesMin.push_back(mBCranges.back().getMin().toLong());
+    mBCrangesMax.push_back(mBCranges.back().getMax().toLong());
+    mBCrangesMaxCum.push_back(mBCrangesMaxCum.empty() ? mBCrangesMax.back() : std::max(mBCrangesMaxCum.back(), mBCrangesMax.back()));
   }
   mAccountedBCranges.resize(mBCranges.size(), false);
+  mAccountedBCrangesTOI.resize(mBCranges.size(), false);
+}
+
+std::bitset<128> Zorro::getSelection(std::size_t iRange) const
+{
+  const auto& helper = mZorroHelpers->at(iRange);
+  return (std::bitset<128>(helper.selMask[1]) << 64) | std::bitset<128>(helper.selMask[0]);
 }
@@ -29,7 +29,9 @@
 #include <TH2.h>
 
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,6 +50,7 @@ class Zorro
   Zorro() = default;
   std::vector<int> initCCDB(o2::ccdb::BasicCCDBManager* ccdb, int runNumber, uint64_t timestamp, std::string tois, int bcTolerance = 500);
   std::bitset<128> fetch(uint64_t bcGlobalId, uint64_t tolerance = 100);
+  void fetch(std::span<const uint64_t> bcGlobalIds, std::vector<std::bitset<128>>& results, uint64_t tolerance = 100);
   bool isSelected(uint64_t bcGlobalId, uint64_t tolerance = 100, TH2* toiHisto = nullptr);
   bool isNotSelectedByAny(uint64_t bcGlobalId, uint64_t tolerance = 100);
 
@@ -72,6 +75,7 @@ class Zorro
 
  private:
   void setupHelpers(int64_t timestamp);
+  std::bitset<128> getSelection(std::size_t iRange) const;
 
   ZorroSummary mZorroSummary{"ZorroSummary", "ZorroSummary"};
 
@@ -87,14 +91,17 @@ class Zorro
   std::vector<TH1*> mAnalysedTriggersOfInterestList; /// Per run histograms
 
   int mBCtolerance = 100;
-  uint64_t mLastBCglobalId = 0;
-  uint64_t mLastSelectedIdx = 0;
   TH1D* mScalers = nullptr;
   TH1D* mSelections = nullptr;
   TH1D* mInspectedTVX = nullptr;
   std::bitset<128> mLastResult;
-  std::vector<bool> mAccountedBCranges; /// Avoid double accounting of inspected BC ranges
+  std::vector<std::size_t> mLastSelectedBCranges; /// BC ranges matching the last fetched BC
+  std::vector<bool> mAccountedBCranges;           /// Avoid double accounting of inspected BC ranges
+  std::vector<bool> mAccountedBCrangesTOI;        /// Avoid double accounting of inspected BC ranges for the triggers of interest
   std::vector<o2::dataformats::IRFrame> mBCranges;
+  std::vector<uint64_t> mBCrangesMin;    /// First BC of the BC ranges, sorted
+  std::vector<uint64_t> mBCrangesMax;    /// Last BC of the BC ranges
+  std::vector<uint64_t> mBCrangesMaxCum; /// Largest last BC of the BC ranges up to each range, for the binary search of the overlapping ranges
   std::vector<ZorroHelper>* mZorroHelpers = nullptr;
   std::vector<std::string> mTOIs;
   std::vector<int> mTOIidx;
@@ -314,13 +314,13 @@ struct OccupancyTableProducer {
     const int n = sizeof...(Vecs);                             // Number of vectors
     const int size = std::get<0>(std::tie(vectors...)).size(); // Size of the first vector
 
+    std::array<std::array<double, 2>, sizeof...(Vecs)> data; // first element is entry, second is index, reused for all the bins
     for (int i = 0; i < size; i++) {
-      std::vector<std::array<double, 2>> data; // first element is entry, second is index
       int iEntry = 0;
 
       // Lambda to iterate over all vectors
       auto collect = [&](const auto& vec) {
-        data.push_back({vec[i], static_cast<double>(iEntry)});
+        data[iEntry] = {vec[i], static_cast<double>(iEntry)};
         iEntry++;
       };
       (collect(vectors), ...); // Unpack variadic arguments and apply lambda
@@ -1625,9 +1625,33 @@ struct TrackMeanOccTableProducer {
     bcInTF = (bc.globalBC() - bcSOR) % nBCsPerTF;
   }
 
-  float getMeanOccupancy(int bcBegin, int bcEnd, const std::vector<float>& OccVector)
+  // prefix sums of the occupancy vectors of the current TF, in the order of OccNamesEnum
+  std::array<std::vector<double>, std::size(OccNames)> occPrefixSums;
+
+  void fillOccPrefixSums()
+  {
+    const std::array<const std::vector<float>*, std::size(OccNames)> occVectors{
+      &occPrimUnfm80,
+      &occFV0AUnfm80, &occFV0CUnfm80, &occFT0AUnfm80, &occFT0CUnfm80,
+      &occFDDAUnfm80, &occFDDCUnfm80,
+      &occNTrackITSUnfm80, &occNTrackTPCUnfm80, &occNTrackTRDUnfm80, &occNTrackTOFUnfm80, &occNTrackSizeUnfm80,
+      &occNTrackTPCAUnfm80, &occNTrackTPCCUnfm80, &occNTrackITSTPCUnfm80, &occNTrackITSTPCAUnfm80, &occNTrackITSTPCCUnfm80,
+      &occMultNTracksHasITSUnfm80, &occMultNTracksHasTPCUnfm80, &occMultNTracksHasTOFUnfm80, &occMultNTracksHasTRDUnfm80,
+      &occMultNTracksITSOnlyUnfm80, &occMultNTracksTPCOnlyUnfm80, &occMultNTracksITSTPCUnfm80, &occMultAllTracksTPCOnlyUnfm80,
+      &occRobustT0V0PrimUnfm80, &occRobustFDDT0V0PrimUnfm80, &occRobustNtrackDetUnfm80, &occRobustMultTableUnfm80};
+    for (uint i = 0; i < occVectors.size(); i++) {
+      const auto& occVector = *occVectors[i];
+      auto& prefixSum = occPrefixSums[i];
+      prefixSum.resize(occVector.size() + 1);
+      prefixSum[0] = 0.;
+      for (uint iBin = 0; iBin < occVector.size(); iBin++) {
+        prefixSum[iBin + 1] = prefixSum[iBin] + occVector[iBin];
+      }
+    }
+  }
+
+  float getMeanOccupancy(int bcBegin, int bcEnd, const std::vector<double>& occPrefixSum)
   {
-    float sumOfBins = 0;
     int binStart, binEnd;
     if (bcBegin <= bcEnd) {
       binStart = bcBegin;
@@ -1636,16 +1660,24 @@ struct TrackMeanOccTableProducer {
       binStart = bcEnd;
       binEnd = bcBegin;
     }
-    for (int i = binStart; i <= binEnd; i++) {
-      sumOfBins += OccVector[i];
-    }
-    float meanOccupancy = sumOfBins / static_cast<double>(binEnd - binStart + 1);
+    float meanOccupancy = (occPrefixSum[binEnd + 1] - occPrefixSum[binStart]) / static_cast<double>(binEnd - binStart + 1);
     return meanOccupancy;
   }
 
-  float getWeightedMeanOccupancy(int bcBegin, int bcEnd, const std::vector<float>& OccVector)
+  // weights of the bins of the time window of the current track, shared by all the occupancy estimators
+  int weightBCBegin = 0;
+  int weightBCEnd = -1;
+  float weightSum = 0;
+  std::vector<float> binWeights;
+
+  void setWeights(int bcBegin, int bcEnd)
   {
-    float sumOfBins = 0;
+    if (bcBegin == weightBCBegin && bcEnd == weightBCEnd) {
+      return;
+    }
+    weightBCBegin = bcBegin;
+    weightBCEnd = bcEnd;
+
     int binStart, binEnd;
     // Assuming linear dependence of R on bins
     float m;      // slope of the equation
@@ -1670,7 +1702,8 @@ struct TrackMeanOccTableProducer {
       m = (245. - 90.) / (x2 - x1);
     }
     c = 245. - m * x2;
-    float weightSum = 0;
+    binWeights.resize(binEnd - binStart + 1);
+    weightSum = 0;
     float wr = 0;
     float r = 0;
     for (int i = binStart; i <= binEnd; i++) {
@@ -1679,9 +1712,20 @@ struct TrackMeanOccTableProducer {
       if (x2 == x1) {
         wr = 1.0;
       }
-      sumOfBins += OccVector[i] * wr;
+      binWeights[i - binStart] = wr;
       weightSum += wr;
     }
+  }
+
+  float getWeightedMeanOccupancy(int bcBegin, int bcEnd, const std::vector<float>& OccVector)
+  {
+    setWeights(bcBegin, bcEnd);
+    const int binStart = std::min(bcBegin, bcEnd);
+    const int binEnd = std::max(bcBegin, bcEnd);
+    float sumOfBins = 0;
+    for (int i = binStart; i <= binEnd; i++) {
+      sumOfBins += OccVector[i] * binWeights[i - binStart];
+    }
     float meanOccupancy = sumOfBins / weightSum;
     return meanOccupancy;
   }
@@ -2017,6 +2061,9 @@ struct TrackMeanOccTableProducer {
           if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyRobustMultExtra) {
             std::copy(occsList.occRobustMultExtraTableUnfm80().begin(), occsList.occRobustMultExtraTableUnfm80().end(), occRobustMultTableUnfm80.begin());
           }
+          if constexpr (meanTableMode == fillMeanOccTable) {
+            fillOccPrefixSums();
+          }
         }
 
         // Timebc = TGlobalBC+ΔTdrift
@@ -2060,7 +2107,7 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (qaMode == fillOccRobustT0V0dependentQA) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccRobustT0V0PrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occRobustT0V0PrimUnfm80);
+            meanOccRobustT0V0PrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccRobustT0V0PrimUnfm80]);
           }
           if constexpr (weightMeanTableMode == fillWeightMeanOccTable) {
             weightMeanOccRobustT0V0PrimUnfm80 = getWeightedMeanOccupancy(binBCbegin, binBCend, occRobustT0V0PrimUnfm80);
@@ -2069,7 +2116,7 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccPrim) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccPrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrimUnfm80);
+            meanOccPrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccPrimUnfm80]);
             genTmoPrim(meanOccPrimUnfm80);
             fillQAInfo<kMean, kRobustT0V0Prim, kOccPrimUnfm80>(meanOccPrimUnfm80, meanOccRobustT0V0PrimUnfm80);
           }
@@ -2083,10 +2130,10 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccT0V0) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccFV0AUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occFV0AUnfm80);
-            meanOccFV0CUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occFV0CUnfm80);
-            meanOccFT0AUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occFT0AUnfm80);
-            meanOccFT0CUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occFT0CUnfm80);
+            meanOccFV0AUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccFV0AUnfm80]);
+            meanOccFV0CUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccFV0CUnfm80]);
+            meanOccFT0AUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccFT0AUnfm80]);
+            meanOccFT0CUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccFT0CUnfm80]);
             genTmoT0V0(meanOccFV0AUnfm80,
                        meanOccFV0CUnfm80,
                        meanOccFT0AUnfm80,
@@ -2119,8 +2166,8 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccFDD) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccFDDAUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occFDDAUnfm80);
-            meanOccFDDCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occFDDCUnfm80);
+            meanOccFDDAUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccFDDAUnfm80]);
+            meanOccFDDCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccFDDCUnfm80]);
             genTmoFDD(meanOccFDDAUnfm80,
                       meanOccFDDCUnfm80);
             fillQAInfo<kMean, kRobustT0V0Prim, kOccFDDAUnfm80>(meanOccFDDAUnfm80, meanOccRobustT0V0PrimUnfm80);
@@ -2141,16 +2188,16 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccNtrackDet) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccNTrackITSUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackITSUnfm80);
-            meanOccNTrackTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackTPCUnfm80);
-            meanOccNTrackTRDUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackTRDUnfm80);
-            meanOccNTrackTOFUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackTOFUnfm80);
-            meanOccNTrackSizeUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackSizeUnfm80);
-            meanOccNTrackTPCAUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackTPCAUnfm80);
-            meanOccNTrackTPCCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackTPCCUnfm80);
-            meanOccNTrackITSTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackITSTPCUnfm80);
-            meanOccNTrackITSTPCAUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackITSTPCAUnfm80);
-            meanOccNTrackITSTPCCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occNTrackITSTPCCUnfm80);
+            meanOccNTrackITSUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackITSUnfm80]);
+            meanOccNTrackTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackTPCUnfm80]);
+            meanOccNTrackTRDUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackTRDUnfm80]);
+            meanOccNTrackTOFUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackTOFUnfm80]);
+            meanOccNTrackSizeUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackSizeUnfm80]);
+            meanOccNTrackTPCAUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackTPCAUnfm80]);
+            meanOccNTrackTPCCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackTPCCUnfm80]);
+            meanOccNTrackITSTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackITSTPCUnfm80]);
+            meanOccNTrackITSTPCAUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackITSTPCAUnfm80]);
+            meanOccNTrackITSTPCCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccNTrackITSTPCCUnfm80]);
             genTmoNTrackDet(meanOccNTrackITSUnfm80,
                             meanOccNTrackTPCUnfm80,
                             meanOccNTrackTRDUnfm80,
@@ -2221,14 +2268,14 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyOccMultExtra) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccMultNTracksHasITSUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultNTracksHasITSUnfm80);
-            meanOccMultNTracksHasTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultNTracksHasTPCUnfm80);
-            meanOccMultNTracksHasTOFUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultNTracksHasTOFUnfm80);
-            meanOccMultNTracksHasTRDUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultNTracksHasTRDUnfm80);
-            meanOccMultNTracksITSOnlyUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultNTracksITSOnlyUnfm80);
-            meanOccMultNTracksTPCOnlyUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultNTracksTPCOnlyUnfm80);
-            meanOccMultNTracksITSTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultNTracksITSTPCUnfm80);
-            meanOccMultAllTracksTPCOnlyUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occMultAllTracksTPCOnlyUnfm80);
+            meanOccMultNTracksHasITSUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultNTracksHasITSUnfm80]);
+            meanOccMultNTracksHasTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultNTracksHasTPCUnfm80]);
+            meanOccMultNTracksHasTOFUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultNTracksHasTOFUnfm80]);
+            meanOccMultNTracksHasTRDUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultNTracksHasTRDUnfm80]);
+            meanOccMultNTracksITSOnlyUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultNTracksITSOnlyUnfm80]);
+            meanOccMultNTracksTPCOnlyUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultNTracksTPCOnlyUnfm80]);
+            meanOccMultNTracksITSTPCUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultNTracksITSTPCUnfm80]);
+            meanOccMultAllTracksTPCOnlyUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccMultAllTracksTPCOnlyUnfm80]);
             genTmoMultExtra(meanOccMultNTracksHasITSUnfm80,
                             meanOccMultNTracksHasTPCUnfm80,
                             meanOccMultNTracksHasTOFUnfm80,
@@ -2287,7 +2334,7 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyRobustT0V0Prim) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccRobustT0V0PrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occRobustT0V0PrimUnfm80);
+            meanOccRobustT0V0PrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccRobustT0V0PrimUnfm80]);
             genTmoRT0V0Prim(meanOccRobustT0V0PrimUnfm80);
             fillQAInfo<kMean, kRobustT0V0Prim, kOccRobustT0V0PrimUnfm80>(meanOccRobustT0V0PrimUnfm80, meanOccRobustT0V0PrimUnfm80);
           }
@@ -2301,7 +2348,7 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyRobustFDDT0V0Prim) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccRobustFDDT0V0PrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occRobustFDDT0V0PrimUnfm80);
+            meanOccRobustFDDT0V0PrimUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccRobustFDDT0V0PrimUnfm80]);
             genTmoRFDDT0V0Prim(meanOccRobustFDDT0V0PrimUnfm80);
             fillQAInfo<kMean, kRobustT0V0Prim, kOccRobustFDDT0V0PrimUnfm80>(meanOccRobustFDDT0V0PrimUnfm80, meanOccRobustT0V0PrimUnfm80);
           }
@@ -2315,7 +2362,7 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyRobustNtrackDet) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccRobustNtrackDetUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occRobustNtrackDetUnfm80);
+            meanOccRobustNtrackDetUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccRobustNtrackDetUnfm80]);
             genTmoRNtrackDet(meanOccRobustNtrackDetUnfm80);
             fillQAInfo<kMean, kRobustT0V0Prim, kOccRobustNtrackDetUnfm80>(meanOccRobustNtrackDetUnfm80, meanOccRobustT0V0PrimUnfm80);
           }
@@ -2329,7 +2376,7 @@ struct TrackMeanOccTableProducer {
 
         if constexpr (processMode == kProcessFullOccTableProducer || processMode == kProcessOnlyRobustMultExtra) {
           if constexpr (meanTableMode == fillMeanOccTable) {
-            meanOccRobustMultTableUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occRobustMultTableUnfm80);
+            meanOccRobustMultTableUnfm80 = getMeanOccupancy(binBCbegin, binBCend, occPrefixSums[kOccRobustMultTableUnfm80]);
             genTmoRMultExtra(meanOccRobustMultTableUnfm80);
             fillQAInfo<kMean, kRobustT0V0Prim, kOccRobustMultTableUnfm80>(meanOccRobustMultTableUnfm80, meanOccRobustT0V0PrimUnfm80);
           }
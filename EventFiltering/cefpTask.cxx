@@ -39,11 +39,12 @@
 
 #include <Rtypes.h>
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <cstdio>
 #include <memory>
-#include <random>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -85,6 +86,43 @@ bool readJsonFile(std::string& config, Document& d)
   return true;
 }
 
+/// Read nBits (<= 64) consecutive bits of an Arrow bitmap starting at bitOffset
+uint64_t readBitmapWord(const uint8_t* bitmap, int64_t bitOffset, int nBits)
+{
+  const uint8_t* bytes{bitmap + bitOffset / 8};
+  const int shift{static_cast<int>(bitOffset % 8)};
+  const int nBytes{(shift + nBits + 7) / 8};
+  uint64_t word{0};
+  for (int iB{0}; iB < std::min(nBytes, 8); ++iB) {
+    word |= static_cast<uint64_t>(bytes[iB]) << (8 * iB);
+  }
+  word >>= shift;
+  if (nBytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  return nBits < 64 ? word & ((1ull << nBits) - 1) : word;
+}
+
+/// OR nBits (<= 64) bits into a bitmap made of 64-bit words, starting at bitOffset
+void orBitmapWord(uint64_t* bitmap, int64_t bitOffset, uint64_t word, int nBits)
+{
+  const int shift{static_cast<int>(bitOffset % 64)};
+  bitmap[bitOffset / 64] |= word << shift;
+  if (shift && nBits > 64 - shift) {
+    bitmap[bitOffset / 64 + 1] |= word >> (64 - shift);
+  }
+}
+
+/// Counter-based uniform random number in [0, 1) (SplitMix64 finalizer), the same counter always gives the same number
+double uniformFromCounter(uint64_t counter)
+{
+  uint64_t z{counter + 0x9e3779b97f4a7c15ull};
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  z ^= z >> 31;
+  return static_cast<double>(z >> 11) * 0x1.0p-53;
+}
+
 std::unordered_map<std::string, std::unordered_map<std::string, float>> mDownscaling;
 static const std::vector<std::string> downscalingName{"Downscaling"};
 static const float defaultDownscaling[128][1]{
@@ -254,6 +292,7 @@ struct centralEventFilterTask {
       nCols += table.second.size();
     }
     LOG(debug) << "Middle init, total number of columns " << nCols;
+    mNColumns = nCols;
 
     auto mScalers = std::get<std::shared_ptr<TH1>>(scalers.add("mScalers", ";;Number of events", HistType::kTH1D, {{nCols + 2, -0.5, 1.5 + nCols}}));
     auto mFiltered = std::get<std::shared_ptr<TH1>>(scalers.add("mFiltered", ";;Number of filtered events", HistType::kTH1D, {{nCols + 2, -0.5, 1.5 + nCols}}));
@@ -326,7 +365,20 @@ struct centralEventFilterTask {
     auto mFiltered{scalers.get<TH1>(HIST("mFiltered"))};
     auto mCovariance{scalers.get<TH2>(HIST("mCovariance"))};
 
+    // the counters of the downscaling random numbers restart at each run
+    if (bcTabPtr->num_rows() > 0) {
+      auto runNumberArray = std::static_pointer_cast<arrow::NumericArray<arrow::Int32Type>>(bcTabPtr->GetColumnByName(aod::BC::RunNumber::mLabel)->chunk(0));
+      if (runNumberArray->Value(0) != mRunNumber) {
+        mRunNumber = runNumberArray->Value(0);
+        mNProcessedEvents = 0;
+      }
+    }
+
     int64_t nEvents{collTabPtr->num_rows()};
+    const int64_t nWords{(nEvents + 63) / 64};
+    // one bitmap over the events of the TF per trigger column
+    mTriggerBits.assign(mNColumns * nWords, 0ull);
+    mDecisionBits.assign(mNColumns * nWords, 0ull);
     std::vector<std::array<uint64_t, 2>> outTrigger, outDecision;
     for (auto& tableName : mDownscaling) {
       if (!pc.inputs().isValid(tableName.first)) {
@@ -344,65 +396,88 @@ struct centralEventFilterTask {
         outTrigger.resize(nEvents, {0ull, 0ull});
       }
 
-      auto schema{tablePtr->schema()};
       for (auto& colName : tableName.second) {
-        uint64_t bin{static_cast<uint64_t>(mScalers->GetXaxis()->FindBin(colName.first.data()))};
-        double binCenter{mScalers->GetXaxis()->GetBinCenter(bin)};
-        uint64_t decisionBin{(bin - 2) / 64};
-        uint64_t triggerBit{BIT((bin - 2) % 64)};
+        int64_t triggerIndex{mScalers->GetXaxis()->FindBin(colName.first.data()) - 2};
         auto column{tablePtr->GetColumnByName(colName.first)};
         double downscaling{cfgDisableDownscalings.value ? 1. : colName.second};
-        if (column) {
-          int entry = 0;
-          for (int64_t iC{0}; iC < column->num_chunks(); ++iC) {
-            auto chunk{column->chunk(iC)};
-            auto boolArray = std::static_pointer_cast<arrow::BooleanArray>(chunk);
-            for (int64_t iS{startCollision}; iS < chunk->length(); ++iS) {
-              if (boolArray->Value(iS)) {
-                mScalers->Fill(binCenter);
-                outTrigger[entry][decisionBin] |= triggerBit;
-                if (mUniformGenerator(mGeneratorEngine) < downscaling) {
-                  mFiltered->Fill(binCenter);
-                  outDecision[entry][decisionBin] |= triggerBit;
-                }
-              }
-              entry++;
+        if (!column) {
+          continue;
+        }
+        uint64_t* triggerBits{mTriggerBits.data() + triggerIndex * nWords};
+        uint64_t* decisionBits{mDecisionBits.data() + triggerIndex * nWords};
+        int64_t entry{0};
+        for (int64_t iC{0}; iC < column->num_chunks(); ++iC) {
+          auto boolArray = std::static_pointer_cast<arrow::BooleanArray>(column->chunk(iC));
+          const uint8_t* values{boolArray->values()->data()}; // the validity bitmap is ignored, as in BooleanArray::Value()
+          for (int64_t iS{startCollision}; iS < boolArray->length(); iS += 64) {
+            const int nBits{static_cast<int>(std::min<int64_t>(64, boolArray->length() - iS))};
+            const uint64_t word{readBitmapWord(values, boolArray->offset() + iS, nBits)};
+            orBitmapWord(triggerBits, entry, word, nBits);
+            entry += nBits;
+          }
+        }
+        if (downscaling >= 1.) {
+          std::copy(triggerBits, triggerBits + nWords, decisionBits);
+          continue;
+        }
+        for (int64_t iW{0}; iW < nWords; ++iW) {
+          for (uint64_t word{triggerBits[iW]}; word; word &= word - 1) {
+            const uint64_t event{static_cast<uint64_t>(iW * 64 + std::countr_zero(word))};
+            if (uniformFromCounter(((mNProcessedEvents + event) << 7) | triggerIndex) < downscaling) {
+              decisionBits[iW] |= BIT(event % 64);
             }
           }
         }
       }
     }
-    mScalers->SetBinContent(1, mScalers->GetBinContent(1) + nEvents - startCollision);
-    mFiltered->SetBinContent(1, mFiltered->GetBinContent(1) + nEvents - startCollision);
 
-    for (uint64_t iE{0}; iE < outTrigger.size(); ++iE) {
-      const auto& triggerWord{outTrigger[iE]};
-      bool triggered{false}, selected{false};
-      for (uint64_t iD{0}; iD < triggerWord.size(); ++iD) {
-        for (int iB{0}; iB < 64; ++iB) {
-          if (!(triggerWord[iD] & BIT(iB))) {
-            continue;
-          }
-          uint64_t xIndex{iD * 64 + iB};
-          for (uint64_t jD{0}; jD < triggerWord.size(); ++jD) {
-            for (int jB{0}; jB < 64; ++jB) {
-              uint64_t yIndex{jD * 64 + jB};
-              if (xIndex <= yIndex && triggerWord[jD] & BIT(jB)) {
-                mCovariance->Fill(iD * 64 + iB, jD * 64 + jB);
-              }
-            }
-          }
+    // scalers and covariance are accumulated on the bitmaps and added to the histograms once per TF
+    std::vector<uint64_t> anyTrigger(nWords, 0ull), anyDecision(nWords, 0ull);
+    uint64_t nCovarianceEntries{0};
+    for (int iT{0}; iT < mNColumns; ++iT) {
+      const uint64_t* triggerBits{mTriggerBits.data() + iT * nWords};
+      const uint64_t* decisionBits{mDecisionBits.data() + iT * nWords};
+      uint64_t nTriggered{0}, nSelected{0};
+      for (int64_t iW{0}; iW < nWords; ++iW) {
+        nTriggered += std::popcount(triggerBits[iW]);
+        nSelected += std::popcount(decisionBits[iW]);
+        anyTrigger[iW] |= triggerBits[iW];
+        anyDecision[iW] |= decisionBits[iW];
+        for (uint64_t word{triggerBits[iW]}; word; word &= word - 1) {
+          outTrigger[iW * 64 + std::countr_zero(word)][iT / 64] |= BIT(iT % 64);
+        }
+        for (uint64_t word{decisionBits[iW]}; word; word &= word - 1) {
+          outDecision[iW * 64 + std::countr_zero(word)][iT / 64] |= BIT(iT % 64);
         }
-        triggered = triggered || triggerWord[iD];
-        selected = selected || outDecision[iE][iD];
       }
-      if (triggered) {
-        mScalers->Fill(mScalers->GetNbinsX() - 1);
+      addToBin(mScalers, iT + 2, nTriggered);
+      addToBin(mFiltered, iT + 2, nSelected);
+      if (!nTriggered) {
+        continue;
       }
-      if (selected) {
-        mFiltered->Fill(mFiltered->GetNbinsX() - 1);
+      for (int jT{iT}; jT < mNColumns; ++jT) {
+        const uint64_t* otherTriggerBits{mTriggerBits.data() + jT * nWords};
+        uint64_t count{0};
+        for (int64_t iW{0}; iW < nWords; ++iW) {
+          count += std::popcount(triggerBits[iW] & otherTriggerBits[iW]);
+        }
+        if (count) {
+          mCovariance->AddBinContent(mCovariance->GetBin(iT + 1, jT + 1), count);
+          nCovarianceEntries += count;
+        }
       }
     }
+    mCovariance->SetEntries(mCovariance->GetEntries() + nCovarianceEntries);
+    mScalers->SetBinContent(1, mScalers->GetBinContent(1) + nEvents - startCollision);
+    mFiltered->SetBinContent(1, mFiltered->GetBinContent(1) + nEvents - startCollision);
+    uint64_t nTriggeredEvents{0}, nSelectedEvents{0};
+    for (int64_t iW{0}; iW < nWords; ++iW) {
+      nTriggeredEvents += std::popcount(anyTrigger[iW]);
+      nSelectedEvents += std::popcount(anyDecision[iW]);
+    }
+    addToBin(mScalers, mScalers->GetNbinsX(), nTriggeredEvents);
+    addToBin(mFiltered, mFiltered->GetNbinsX(), nSelectedEvents);
+    mNProcessedEvents += nEvents;
 
     if (outDecision.size() != static_cast<uint64_t>(nEvents)) {
       LOGF(fatal, "Inconsistent number of rows across Collision table and CEFP decision vector.");
@@ -427,8 +502,20 @@ struct centralEventFilterTask {
   {
   }
 
-  std::mt19937_64 mGeneratorEngine;
-  std::uniform_real_distribution<double> mUniformGenerator = std::uniform_real_distribution<double>(0., 1.);
+  /// Equivalent to count calls to Fill for the center of the bin
+  static void addToBin(std::shared_ptr<TH1> const& histo, int bin, uint64_t count)
+  {
+    if (count) {
+      histo->AddBinContent(bin, count);
+      histo->SetEntries(histo->GetEntries() + count);
+    }
+  }
+
+  int mNColumns{0};
+  int mRunNumber{-1};                  // run of the last processed TF
+  uint64_t mNProcessedEvents{0};       // events of the run processed so far, offset of the counters of the downscaling random numbers
+  std::vector<uint64_t> mTriggerBits;  // trigger bitmaps of the current TF, one per column
+  std::vector<uint64_t> mDecisionBits; // decision bitmaps of the current TF, one per column
 };
 
 WorkflowSpec defineDataProcessing(ConfigContext const& cfg)
@@ -20,6 +20,7 @@
 #include <RtypesCore.h>
 
 #include <cmath>
+#include <vector>
 
 // Functions which cut on particle pairs (decays, conversions, two-track cuts)
 //
@@ -52,6 +53,13 @@ class PairCuts
     mTwoTrackDistance = distance;
     mTwoTrackRadius = radius;
 
+    // radii at which phi* is evaluated: the scan from mTwoTrackRadius to 2.5 m, followed by the outer boundary 2.5 m
+    mPhiStarRadii.clear();
+    for (Double_t rad = mTwoTrackRadius; rad < 2.51; rad += 0.01) {
+      mPhiStarRadii.push_back(rad);
+    }
+    mPhiStarRadii.push_back(2.5);
+
     if (histogramRegistry != nullptr && histogramRegistry->contains(HIST("TwoTrackDistancePt_0")) == false) {
       histogramRegistry->add("TwoTrackDistancePt_0", "", {o2::framework::HistType::kTH3F, {{100, -0.15, 0.15, "#Delta#eta"}, {100, -0.05, 0.05, "#Delta#varphi^{*}_{min}"}, {20, 0, 10, "#Delta p_{T}"}}});
       histogramRegistry->addClone("TwoTrackDistancePt_0", "TwoTrackDistancePt_1");
@@ -64,10 +72,17 @@ class PairCuts
   template <typename T>
   bool twoTrackCut(T const& track1, T const& track2, int magField);
 
+  // Two-track cut with phi* of both tracks precomputed by getPhiStar, e.g. once per track and event instead of once per pair
+  int getNPhiStar() const { return mPhiStarRadii.size(); }
+  template <typename T>
+  void getPhiStar(T const& track, int magField, float* phiStar) const;
+  bool twoTrackCut(float deta, float dpt, const float* phiStar1, const float* phiStar2);
+
  protected:
   float mCuts[ParticlesLastEntry] = {-1};
   float mTwoTrackDistance = -1; // distance below which the pair is flagged as to be removed
   float mTwoTrackRadius = 0.8f; // radius at which the two track cuts are applied
+  std::vector<float> mPhiStarRadii; // radii for the precomputed phi*, see SetTwoTrackCuts
 
   o2::framework::HistogramRegistry* histogramRegistry = nullptr; // if set, control histograms are stored here
 
@@ -82,6 +97,20 @@ class PairCuts
 
   template <typename T>
   float getDPhiStar(T const& track1, T const& track2, float radius, int magField);
+
+  static float foldDPhiStar(float dphistar)
+  {
+    if (dphistar > o2::constants::math::PI) {
+      dphistar = o2::constants::math::TwoPI - dphistar;
+    }
+    if (dphistar < -o2::constants::math::PI) {
+      dphistar = -o2::constants::math::TwoPI - dphistar;
+    }
+    if (dphistar > o2::constants::math::PI) { // might look funny but is needed
+      dphistar = o2::constants::math::TwoPI - dphistar;
+    }
+    return dphistar;
+  }
 };
 
 template <typename T>
@@ -308,6 +337,59 @@ double PairCuts::getInvMassSquaredFast(T const& track1, double m0_1, T const& tr
   return mass2;
 }
 
+template <typename T>
+void PairCuts::getPhiStar(T const& track, int magField, float* phiStar) const
+{
+  // phi* of a single track at the radii of mPhiStarRadii; the difference of the phi* of two tracks is what getDPhiStar returns
+  auto phi = track.phi();
+  auto pt = track.pt();
+  auto charge = track.sign();
+  for (size_t i = 0; i < mPhiStarRadii.size(); i++) {
+    phiStar[i] = phi - charge * std::asin(0.015 * magField * mPhiStarRadii[i] / pt);
+  }
+}
+
+inline bool PairCuts::twoTrackCut(float deta, float dpt, const float* phiStar1, const float* phiStar2)
+{
+  // same as twoTrackCut(track1, track2, magField) with precomputed phi*
+  // deta = eta1 - eta2, dpt = |pt1 - pt2| (only used for the control histograms)
+
+  if (std::fabs(deta) < mTwoTrackDistance * 2.5 * 3) {
+    const int nScan = mPhiStarRadii.size() - 1; // last entry is the outer boundary
+    float dphistar1 = foldDPhiStar(phiStar1[0] - phiStar2[0]);
+    float dphistar2 = foldDPhiStar(phiStar1[nScan] - phiStar2[nScan]);
+
+    const float kLimit = mTwoTrackDistance * 3;
+
+    if (std::fabs(dphistar1) < kLimit || std::fabs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0) {
+      float dphistarminabs = 1e5;
+      float dphistarmin = 1e5;
+      for (int i = 0; i < nScan; i++) {
+        float dphistar = foldDPhiStar(phiStar1[i] - phiStar2[i]);
+        float dphistarabs = std::fabs(dphistar);
+        if (dphistarabs < dphistarminabs) {
+          dphistarmin = dphistar;
+          dphistarminabs = dphistarabs;
+        }
+      }
+
+      if (histogramRegistry != nullptr) {
+        histogramRegistry->fill(HIST("TwoTrackDistancePt_0"), deta, dphistarmin, dpt);
+      }
+
+      if (dphistarminabs < mTwoTrackDistance && std::fabs(deta) < mTwoTrackDistance) {
+        return true;
+      }
+
+      if (histogramRegistry != nullptr) {
+        histogramRegistry->fill(HIST("TwoTrackDistancePt_1"), deta, dphistarmin, dpt);
+      }
+    }
+  }
+
+  return false;
+}
+
 template <typename T>
 float PairCuts::getDPhiStar(T const& track1, T const& track2, float radius, int magField)
 {
@@ -325,17 +407,7 @@ float PairCuts::getDPhiStar(T const& track1, T const& track2, float radius, int
 
   float dphistar = phi1 - phi2 - charge1 * std::asin(0.015 * magField * radius / pt1) + charge2 * std::asin(0.015 * magField * radius / pt2);
 
-  if (dphistar > o2::constants::math::PI) {
-    dphistar = o2::constants::math::TwoPI - dphistar;
-  }
-  if (dphistar < -o2::constants::math::PI) {
-    dphistar = -o2::constants::math::TwoPI - dphistar;
-  }
-  if (dphistar > o2::constants::math::PI) { // might look funny but is needed
-    dphistar = o2::constants::math::TwoPI - dphistar;
-  }
-
-  return dphistar;
+  return foldDPhiStar(dphistar);
 }
 
 #endif // PWGCF_CORE_PAIRCUTS_H_
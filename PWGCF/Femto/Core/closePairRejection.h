@@ -228,6 +228,11 @@ class CloseTrackRejection
     // check if we need to apply any cut a plot is requested
     mIsActivated = mCutAverage || mCutAnyRadius || mPlotAverage || mPlotAllRadii;
 
+    if (mIsActivated) {
+      mPhiStarCache1.assign(NPhiStarCache, PhiStarEntry{});
+      mPhiStarCache2.assign(NPhiStarCache, PhiStarEntry{});
+    }
+
     mHistogramRegistry = registry;
 
     if (mPlotAverage) {
@@ -276,12 +281,13 @@ class CloseTrackRejection
 
     mDeta = t1.eta() - t2.eta();
 
+    // phi* only depends on the single track, so it is taken from the per-track cache
+    auto const& phistar1 = getPhiStar(mPhiStarCache1, t1, mChargeAbsTrack1);
+    auto const& phistar2 = getPhiStar(mPhiStarCache2, t2, mChargeAbsTrack2);
     for (size_t i = 0; i < TpcRadii.size(); i++) {
-      auto phistar1 = phistar(mMagField, TpcRadii[i], mChargeAbsTrack1 * t1.signedPt(), t1.phi());
-      auto phistar2 = phistar(mMagField, TpcRadii[i], mChargeAbsTrack2 * t2.signedPt(), t2.phi());
-      if (phistar1 && phistar2) {
-        mDphistar.at(i) = RecoDecay::constrainAngle(phistar1.value() - phistar2.value(), -o2::constants::math::PI); // constrain angular difference between -pi and pi
-        mDphistarMask.at(i) = true;
+      if (phistar1.valid[i] && phistar2.valid[i]) {
+        mDphistar[i] = RecoDecay::constrainAngle(phistar1.phistar[i] - phistar2.phistar[i], -o2::constants::math::PI); // constrain angular difference between -pi and pi
+        mDphistarMask[i] = true;
         count++;
       }
     }
@@ -384,6 +390,40 @@ class CloseTrackRejection
   [[nodiscard]] bool isActivated() const { return mIsActivated; }
 
  private:
+  // phi* of one track at all TPC radii. Entries are stored in a direct-mapped cache indexed by the global index of the track,
+  // so that the phi* of a track is computed once and reused for all its pairs in same and mixed events. An entry is only
+  // reused if all inputs of the calculation are identical, hence entries of previous time frames can never be picked up.
+  struct PhiStarEntry {
+    int64_t index = -1;
+    float signedPt = 0.f;
+    float phi = 0.f;
+    float magField = 0.f;
+    std::array<float, Nradii> phistar = {0.f};
+    std::array<bool, Nradii> valid = {false};
+  };
+  static constexpr size_t NPhiStarCache = 4096; // must be a power of 2
+
+  template <typename T>
+  PhiStarEntry const& getPhiStar(std::vector<PhiStarEntry>& cache, T const& track, int chargeAbs)
+  {
+    const int64_t index = track.globalIndex();
+    const float signedPt = chargeAbs * track.signedPt();
+    const float phi = track.phi();
+    auto& entry = cache[static_cast<uint64_t>(index) & (NPhiStarCache - 1)];
+    if (entry.index != index || entry.signedPt != signedPt || entry.phi != phi || entry.magField != mMagField) {
+      entry.index = index;
+      entry.signedPt = signedPt;
+      entry.phi = phi;
+      entry.magField = mMagField;
+      for (size_t i = 0; i < TpcRadii.size(); i++) {
+        auto value = phistar(mMagField, TpcRadii[i], signedPt, phi);
+        entry.valid[i] = value.has_value();
+        entry.phistar[i] = value.value_or(0.f);
+      }
+    }
+    return entry;
+  }
+
   std::optional<float> phistar(float magfield, float radius, float signedPt, float phi)
   {
     double arg = 0.3 * (0.1 * magfield) * (0.01 * radius) / (2. * signedPt);
@@ -426,6 +466,9 @@ class CloseTrackRejection
   std::array<float, Nradii> mDphistar = {0.f};
   std::array<bool, Nradii> mDphistarMask = {false};
 
+  std::vector<PhiStarEntry> mPhiStarCache1; // for the first track of the pairs
+  std::vector<PhiStarEntry> mPhiStarCache2; // for the second track of the pairs
+
   bool mRandomizeTracks = false;
   std::mt19937 mRng;
   std::uniform_int_distribution<int> mSwapDist{0, 1};
@@ -13,9 +13,11 @@
 
 #include "PWGCF/GenericFramework/Core/GFWPowerArray.h"
 
+#include <algorithm>
 #include <complex>
 #include <cstdio>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -77,6 +79,14 @@ void GFW::AddRegion(string refName, int lNhar, int* lNparVec, double lEtaMin, do
     tVec.push_back(lNparVec[i]);
   AddRegion(refName, tVec, lEtaMin, lEtaMax, lNpT, BitMask);
 };
+void GFW::AddRegion(Region inreg)
+{
+  fRegions.push_back(inreg);
+  if (inreg.NpT > fNPtSlots) {
+    fNPtSlots = inreg.NpT;
+    ResetCorrNodes(); // values of the pt-dependent nodes need more pT bins, compile them again
+  }
+};
 int GFW::CreateRegions()
 {
   for (auto pItr = fCumulants.begin(); pItr != fCumulants.end(); ++pItr)
@@ -89,13 +99,13 @@ int GFW::CreateRegions()
   }
   int nRegions = 0;
   for (auto pItr = fRegions.begin(); pItr != fRegions.end(); pItr++) {
-    GFWCumulant* lCumulant = new GFWCumulant();
-    lCumulant->CreateComplexVectorArrayVarPower(pItr->Nhar, pItr->NparVec, pItr->NpT);
-    fCumulants.push_back(*lCumulant);
+    fCumulants.emplace_back();
+    fCumulants.back().CreateComplexVectorArrayVarPower(pItr->Nhar, pItr->NparVec, pItr->NpT);
     ++nRegions;
   }
   if (nRegions)
     fInitialized = true;
+  fEventStamp++;
   return nRegions;
 };
 void GFW::Fill(double eta, int ptin, double phi, double weight, int mask, double SecondWeight)
@@ -105,62 +115,171 @@ void GFW::Fill(double eta, int ptin, double phi, double weight, int mask, double
     if (fRegions.at(i).EtaMin < eta && fRegions.at(i).EtaMax > eta && (fRegions.at(i).BitMask & mask))
       fCumulants.at(i).FillArray(ptin, phi, weight, SecondWeight);
   }
+  fEventStamp++; // Q-vectors changed, values of the correlators have to be recomputed
 };
-complex<double> GFW::TwoRec(int n1, int n2, int p1, int p2, int ptbin, GFWCumulant* r1, GFWCumulant* r2, GFWCumulant* r3)
+void GFW::Fill(int nTracks, const double* eta, const int* ptin, const double* phi, const double* weight, const int* mask, const double* secondWeight)
 {
-  complex<double> part1 = r1->Vec(n1, p1, ptbin);
-  complex<double> part2 = r2->Vec(n2, p2, ptbin);
-  complex<double> part3 = r3 ? r3->Vec(n1 + n2, p1 + p2, ptbin) : complex<double>(0., 0.);
-  complex<double> formula = part1 * part2 - part3;
-  return formula;
+  for (int i = 0; i < static_cast<int>(fRegions.size()); ++i) {
+    const Region& reg = fRegions[i];
+    // collect the tracks of this region, then fill them all at once
+    fFillPt.clear();
+    fFillPhi.clear();
+    fFillWeight.clear();
+    fFillSecondWeight.clear();
+    for (int j = 0; j < nTracks; ++j) {
+      if (reg.EtaMin < eta[j] && reg.EtaMax > eta[j] && (reg.BitMask & mask[j])) {
+        fFillPt.push_back(ptin[j]);
+        fFillPhi.push_back(phi[j]);
+        fFillWeight.push_back(weight[j]);
+        fFillSecondWeight.push_back(secondWeight ? secondWeight[j] : -1);
+      }
+    }
+    if (!fFillPt.empty())
+      fCumulants[i].FillArray(fFillPt.size(), fFillPt.data(), fFillPhi.data(), fFillWeight.data(), fFillSecondWeight.data());
+  }
+  fEventStamp++;
 };
-complex<double> GFW::RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, vector<int>& hars)
+int GFW::CompileCorr(int poi, int ref, int ol, const vector<int>& hars)
 {
-  vector<int> pows;
-  for (int i = 0; i < static_cast<int>(hars.size()); i++)
-    pows.push_back(1);
-  return RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows);
+  vector<int> lHars = hars;
+  vector<int> pows(hars.size(), 1);
+  return CompileCorr(poi, ref, ol, lHars, pows);
 };
-
-complex<double> GFW::RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, vector<int>& hars, vector<int>& pows)
+int GFW::FindCorrRoot(int poi, int ref, int ol, const vector<int>& hars)
+{
+  // Compiled once per set of regions and harmonics, the lookup does not copy the harmonics
+  auto found = fCorrRootIndex.find(std::forward_as_tuple(poi, ref, ol, hars));
+  if (found != fCorrRootIndex.end())
+    return found->second;
+  int root = CompileCorr(poi, ref, ol, hars);
+  fCorrRootIndex.emplace(std::make_tuple(poi, ref, ol, hars), root);
+  return root;
+};
+int GFW::CompileCorr(int poi, int ref, int ol, vector<int>& hars, vector<int>& pows)
 {
-  if ((pows.at(0) != 1) && qol)
-    qpoi = qol; // if the power of POI is not unity, then always use overlap (if defined).
+  // Same recursion as for the explicit calculation of the correlators, but each unique sub-correlator is added only once, as a node
+  if ((pows.at(0) != 1) && ol > -1)
+    poi = ol; // if the power of POI is not unity, then always use overlap (if defined).
   // Only valid for 1 particle of interest though!
-  if (hars.size() < 2)
-    return qpoi->Vec(hars.at(0), pows.at(0), ptbin);
-  if (hars.size() < 3)
-    return TwoRec(hars.at(0), hars.at(1), pows.at(0), pows.at(1), ptbin, qpoi, qref, qol);
-  int harlast = hars.at(hars.size() - 1);
-  int powlast = pows.at(pows.size() - 1);
-  hars.erase(hars.end() - 1);
-  pows.erase(pows.end() - 1);
-  complex<double> formula = RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows) * qref->Vec(harlast, powlast);
-  int lDegeneracy = 1;
-  int harSize = static_cast<int>(hars.size());
-  for (int i = harSize - 1; i >= 0; i--) {
-    // checking if current configuration is a permutation of the next one.
-    // Need to have more than 2 harmonics though, otherwise it doesn't make sense.
-    if (i > 2) {                                                          // only makes sense when we have more than two harmonics remaining
-      if (hars.at(i) == hars.at(i - 1) && pows.at(i) == pows.at(i - 1)) { // if it is a permutation, then increase degeneracy and continue;
-        lDegeneracy++;
-        continue;
+  vector<int> key = {poi, ref, ol};
+  key.insert(key.end(), hars.begin(), hars.end());
+  key.insert(key.end(), pows.begin(), pows.end());
+  auto found = fCorrNodeIndex.find(key);
+  if (found != fCorrNodeIndex.end())
+    return found->second;
+  CorrNode node;
+  node.poi = poi;
+  node.ref = ref;
+  node.ol = ol;
+  node.n1 = hars.at(0);
+  node.p1 = pows.at(0);
+  node.n2 = 0;
+  node.p2 = 0;
+  node.firstTerm = 0;
+  node.nTerms = 0;
+  vector<int> children;
+  if (hars.size() < 2) {
+    node.type = kNodeQ;
+    node.ptDependent = (fRegions.at(poi).NpT > 1);
+  } else if (hars.size() < 3) {
+    node.type = kNodeTwo;
+    node.n2 = hars.at(1);
+    node.p2 = pows.at(1);
+    node.ptDependent = (fRegions.at(poi).NpT > 1) || (fRegions.at(ref).NpT > 1) || (ol > -1 && fRegions.at(ol).NpT > 1);
+  } else {
+    node.type = kNodeRec;
+    int harlast = hars.at(hars.size() - 1);
+    int powlast = pows.at(pows.size() - 1);
+    node.n2 = harlast;
+    node.p2 = powlast;
+    hars.erase(hars.end() - 1);
+    pows.erase(pows.end() - 1);
+    node.prefix = CompileCorr(poi, ref, ol, hars, pows);
+    children.push_back(node.prefix);
+    vector<CorrTerm> terms;
+    int lDegeneracy = 1;
+    int harSize = static_cast<int>(hars.size());
+    for (int i = harSize - 1; i >= 0; i--) {
+      // checking if current configuration is a permutation of the next one.
+      // Need to have more than 2 harmonics though, otherwise it doesn't make sense.
+      if (i > 2) {                                                          // only makes sense when we have more than two harmonics remaining
+        if (hars.at(i) == hars.at(i - 1) && pows.at(i) == pows.at(i - 1)) { // if it is a permutation, then increase degeneracy and continue;
+          lDegeneracy++;
+          continue;
+        }
       }
-    }
-    hars.at(i) += harlast;
-    pows.at(i) += powlast;
-    complex<double> subtractVal = RecursiveCorr(qpoi, qref, qol, ptbin, hars, pows);
-    if (lDegeneracy > 1) {
-      subtractVal *= lDegeneracy;
+      hars.at(i) += harlast;
+      pows.at(i) += powlast;
+      terms.push_back({CompileCorr(poi, ref, ol, hars, pows), lDegeneracy});
+      children.push_back(terms.back().node);
       lDegeneracy = 1;
+      hars.at(i) -= harlast;
+      pows.at(i) -= powlast;
+    }
+    hars.push_back(harlast);
+    pows.push_back(powlast);
+    node.firstTerm = static_cast<int>(fCorrTerms.size());
+    node.nTerms = static_cast<int>(terms.size());
+    fCorrTerms.insert(fCorrTerms.end(), terms.begin(), terms.end());
+  }
+  // Nodes needed for the evaluation: all the dependencies of the children, in evaluation order, then the node itself
+  vector<int> deps;
+  for (auto child : children) {
+    node.ptDependent |= fCorrNodes.at(child).ptDependent;
+    for (int k = 0; k < fCorrNodes.at(child).nDeps; k++) {
+      int dep = fCorrDeps.at(fCorrNodes.at(child).firstDep + k);
+      if (std::find(deps.begin(), deps.end(), dep) == deps.end())
+        deps.push_back(dep);
+    }
+  }
+  std::sort(deps.begin(), deps.end()); // children are always added before their parents
+  int index = static_cast<int>(fCorrNodes.size());
+  deps.push_back(index);
+  node.firstDep = static_cast<int>(fCorrDeps.size());
+  node.nDeps = static_cast<int>(deps.size());
+  fCorrDeps.insert(fCorrDeps.end(), deps.begin(), deps.end());
+  node.valueIndex = static_cast<int>(fCorrValues.size());
+  int nValues = node.ptDependent ? fNPtSlots : 1;
+  fCorrValues.resize(fCorrValues.size() + nValues);
+  fCorrValueStamps.resize(fCorrValueStamps.size() + nValues, 0);
+  fCorrNodes.push_back(node);
+  fCorrNodeIndex[key] = index;
+  return index;
+};
+complex<double> GFW::EvaluateCorr(int root, int ptbin)
+{
+  // Evaluate the nodes needed for the root node which were not yet computed for this event and pT bin. No memory allocation here.
+  if (ptbin < 0 || ptbin >= fNPtSlots)
+    ptbin = 0; // Q-vector getter falls back to the first pT bin as well
+  const CorrNode& rootNode = fCorrNodes[root];
+  for (int k = 0; k < rootNode.nDeps; k++) {
+    const CorrNode& node = fCorrNodes[fCorrDeps[rootNode.firstDep + k]];
+    int valInd = node.valueIndex + (node.ptDependent ? ptbin : 0);
+    if (fCorrValueStamps[valInd] == fEventStamp)
+      continue;
+    complex<double> formula;
+    if (node.type == kNodeQ) {
+      formula = fCumulants[node.poi].Vec(node.n1, node.p1, ptbin);
+    } else if (node.type == kNodeTwo) {
+      complex<double> part1 = fCumulants[node.poi].Vec(node.n1, node.p1, ptbin);
+      complex<double> part2 = fCumulants[node.ref].Vec(node.n2, node.p2, ptbin);
+      complex<double> part3 = (node.ol > -1) ? fCumulants[node.ol].Vec(node.n1 + node.n2, node.p1 + node.p2, ptbin) : complex<double>(0., 0.);
+      formula = part1 * part2 - part3;
+    } else {
+      const CorrNode& prefix = fCorrNodes[node.prefix];
+      formula = fCorrValues[prefix.valueIndex + (prefix.ptDependent ? ptbin : 0)] * fCumulants[node.ref].Vec(node.n2, node.p2);
+      for (int t = node.firstTerm; t < node.firstTerm + node.nTerms; t++) {
+        const CorrNode& term = fCorrNodes[fCorrTerms[t].node];
+        complex<double> subtractVal = fCorrValues[term.valueIndex + (term.ptDependent ? ptbin : 0)];
+        if (fCorrTerms[t].degeneracy > 1)
+          subtractVal *= fCorrTerms[t].degeneracy;
+        formula -= subtractVal;
+      }
     }
-    formula -= subtractVal;
-    hars.at(i) -= harlast;
-    pows.at(i) -= powlast;
+    fCorrValues[valInd] = formula;
+    fCorrValueStamps[valInd] = fEventStamp;
   }
-  hars.push_back(harlast);
-  pows.push_back(powlast);
-  return formula;
+  return fCorrValues[rootNode.valueIndex + (rootNode.ptDependent ? ptbin : 0)];
 };
 void GFW::Clear()
 {
@@ -168,6 +287,7 @@ void GFW::Clear()
     CreateRegions();
   for (auto ptr = fCumulants.begin(); ptr != fCumulants.end(); ++ptr)
     ptr->ResetQs();
+  fEventStamp++;
 };
 GFW::CorrConfig GFW::GetCorrelatorConfig(string config, string head, bool ptdif)
 {
@@ -249,22 +369,50 @@ GFW::CorrConfig GFW::GetCorrelatorConfig(string config, string head, bool ptdif)
   ReturnConfig.Head = head;
   ReturnConfig.pTDif = ptdif;
   // ReturnConfig.pTbin = ptbin;
-  fListOfCFGs.push_back(ReturnConfig);
+  FindCompiledConfig(ReturnConfig);
   return ReturnConfig;
 };
 
-complex<double> GFW::Calculate(int poi, int ref, vector<int> hars, int ptbin)
+complex<double> GFW::Calculate(int poi, int ref, const vector<int>& hars, int ptbin)
 {
-  GFWCumulant* qref = &fCumulants.at(ref);
-  GFWCumulant* qpoi = &fCumulants.at(poi);
-  GFWCumulant* qovl = qpoi;
-  return RecursiveCorr(qpoi, qref, qovl, ptbin, hars);
+  return EvaluateCorr(FindCorrRoot(poi, ref, poi, hars), ptbin);
 };
-complex<double> GFW::Calculate(CorrConfig corconf, int ptbin, bool SetHarmsToZero)
+void GFW::ResetCorrNodes()
+{
+  fCorrNodes.clear();
+  fCorrTerms.clear();
+  fCorrDeps.clear();
+  fCorrNodeIndex.clear();
+  fCorrValues.clear();
+  fCorrValueStamps.clear();
+  fCorrRootIndex.clear();
+  for (auto& lCompiled : fCompiledCFGs) {
+    lCompiled.roots.clear();
+    lCompiled.rootsZeroHars.clear();
+  }
+};
+int GFW::FindCompiledConfig(const CorrConfig& corconf)
+{
+  // Find the configuration in the list of configurations (added with GetCorrelatorConfig), or add it if not there
+  auto found = fCFGIndex.find(std::tie(corconf.Regs, corconf.Hars, corconf.Overlap));
+  if (found != fCFGIndex.end())
+    return found->second;
+  int index = static_cast<int>(fListOfCFGs.size());
+  fListOfCFGs.push_back(corconf);
+  fCompiledCFGs.push_back(CompiledConfig{});
+  fCFGIndex.emplace(std::make_tuple(corconf.Regs, corconf.Hars, corconf.Overlap), index);
+  return index;
+};
+complex<double> GFW::Calculate(const CorrConfig& corconf, int ptbin, bool SetHarmsToZero)
 {
   // if(!fInitialized) return complex<double>(0,0); //First check if initialised, if not -- initialize, and if it fails, return
   if (corconf.Regs.size() == 0)
     return complex<double>(0, 0); // Check if we have any regions at all
+  // Root nodes of the subevents, compiled at the first call
+  CompiledConfig& lCompiled = fCompiledCFGs[FindCompiledConfig(corconf)];
+  std::vector<int>& roots = SetHarmsToZero ? lCompiled.rootsZeroHars : lCompiled.roots;
+  if (roots.empty())
+    roots.resize(corconf.Regs.size(), -1);
   complex<double> retval(1, 0);
   int ptInd;
   for (int i = 0; i < static_cast<int>(corconf.Regs.size()); i++) { // looping over all regions
@@ -284,24 +432,22 @@ complex<double> GFW::Calculate(CorrConfig corconf, int ptbin, bool SetHarmsToZer
       return complex<double>(0, 0); // if REF is not filled, don't even continue. Could be redundant, but should save little CPU time
     if (!qpoi->IsPtBinFilled(ptInd))
       return complex<double>(0, 0); // if POI is not filled, don't even continue. Could be redundant, but should save little CPU time
-    GFWCumulant* qovl = 0;
     // Check if in the ref. region we have enough particles (no. of particles in the region >= no of harmonics for subevent)
     int sz1 = corconf.Hars.at(i).size();
     if (poi != ref)
       sz1--;
     if (qref->GetN() < sz1)
       return complex<double>(0, 0);
-    // Then, figure the overlap
-    if (ovl > -1) // if overlap is defined, then (unless it's explicitly disabled)
-      qovl = &fCumulants.at(ovl);
-    else if (ref == poi)
-      qovl = qref; // If ref and poi are the same, then the same is for overlap. Only, when OL not explicitly defined
-    if (SetHarmsToZero) {
-      for (int j = 0; j < static_cast<int>(corconf.Hars.at(i).size()); j++) {
-        corconf.Hars.at(i).at(j) = 0;
-      }
+    if (roots[i] < 0) {
+      // Then, figure the overlap
+      if (ovl < 0 && ref == poi)
+        ovl = ref; // If ref and poi are the same, then the same is for overlap. Only, when OL not explicitly defined
+      vector<int> hars = corconf.Hars.at(i);
+      if (SetHarmsToZero)
+        std::fill(hars.begin(), hars.end(), 0);
+      roots[i] = CompileCorr(poi, ref, ovl, hars);
     }
-    retval *= RecursiveCorr(qpoi, qref, qovl, ptInd, corconf.Hars.at(i));
+    retval *= EvaluateCorr(roots[i], ptInd);
   }
   return retval;
 };
@@ -338,10 +484,9 @@ void GFW::InitializePowerArrays()
     fRegions[i].powsDefined = true;
   }
 };
-complex<double> GFW::Calculate(int poi, vector<int> hars)
+complex<double> GFW::Calculate(int poi, const vector<int>& hars)
 {
-  GFWCumulant* qpoi = &fCumulants.at(poi);
-  return RecursiveCorr(qpoi, qpoi, qpoi, 0, hars);
+  return EvaluateCorr(FindCorrRoot(poi, poi, poi, hars), 0);
 };
 int GFW::FindRegionByName(string refName)
 {
@@ -19,8 +19,12 @@
 #include "GFWCumulant.h"
 
 #include <complex>
+#include <cstdint>
 #include <cstdio>
+#include <functional>
+#include <map>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -59,25 +63,71 @@ class GFW
   void AddRegion(std::string refName, int lNhar, int* lNparVec, double lEtaMin, double lEtaMax, int lNpT, int BitMask);  // Legacy support, array instead of a vector
   int CreateRegions();
   void Fill(double eta, int ptin, double phi, double weight, int mask, double secondWeight = -1);
+  // Batch version of Fill for nTracks tracks; secondWeight can be a nullptr if no second weights are used
+  void Fill(int nTracks, const double* eta, const int* ptin, const double* phi, const double* weight, const int* mask, const double* secondWeight = nullptr);
   void Clear();
-  GFWCumulant GetCumulant(int index) { return fCumulants.at(index); }
+  const GFWCumulant& GetCumulant(int index) const { return fCumulants.at(index); }
   CorrConfig GetCorrelatorConfig(std::string config, std::string head = "", bool ptdif = false);
-  std::complex<double> Calculate(CorrConfig corconf, int ptbin, bool SetHarmsToZero);
+  std::complex<double> Calculate(const CorrConfig& corconf, int ptbin, bool SetHarmsToZero);
   void InitializePowerArrays();
 
  protected:
+  // Node of the correlator evaluation plan. Each unique sub-correlator (regions, harmonics and powers) appearing in the recursive
+  // expansion of the correlators is a node, evaluated at most once per event (and pT bin) and shared between configurations.
+  enum CorrNodeType { kNodeQ,     // single Q-vector
+                      kNodeTwo,   // two-particle correlator
+                      kNodeRec }; // n-particle correlator, from the (n-1)-particle correlators
+  struct CorrNode {
+    CorrNodeType type;
+    int poi, ref, ol;         // regions (ol = -1 if no overlap)
+    int n1, p1, n2, p2;       // harmonics and powers of the Q-vectors; for kNodeRec, n2 and p2 are the last harmonic and power
+    int prefix = -1;          // kNodeRec: node without the last harmonic
+    int firstTerm, nTerms;    // kNodeRec: subtracted terms, in fCorrTerms
+    int firstDep, nDeps;      // nodes needed to evaluate this node (itself included), in evaluation order, in fCorrDeps
+    bool ptDependent = false; // value depends on the pT bin
+    int valueIndex;           // index of the value in fCorrValues (first pT bin for pt-dependent nodes)
+  };
+  struct CorrTerm {
+    int node;
+    int degeneracy;
+  };
+  // compiled configuration: root node of each subevent, with and without harmonics set to zero
+  struct CompiledConfig {
+    std::vector<int> roots;
+    std::vector<int> rootsZeroHars;
+  };
   bool fInitialized;
   std::vector<CorrConfig> fListOfCFGs;
-  std::complex<double> TwoRec(int n1, int n2, int p1, int p2, int ptbin, GFWCumulant*, GFWCumulant*, GFWCumulant*);
-  std::complex<double> RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, std::vector<int>& hars, std::vector<int>& pows); // POI, Ref. flow, overlapping region
-  std::complex<double> RecursiveCorr(GFWCumulant* qpoi, GFWCumulant* qref, GFWCumulant* qol, int ptbin, std::vector<int>& hars);                         // POI, Ref. flow, overlapping region
-  void AddRegion(Region inreg) { fRegions.push_back(inreg); }
+  std::vector<CompiledConfig> fCompiledCFGs;      //! parallel to fListOfCFGs
+  std::vector<CorrNode> fCorrNodes;               //!
+  std::vector<CorrTerm> fCorrTerms;               //!
+  std::vector<int> fCorrDeps;                     //!
+  std::map<std::vector<int>, int> fCorrNodeIndex; //! key: poi, ref, ol, harmonics and powers
+  std::vector<std::complex<double>> fCorrValues;  //! values of the nodes for the current event
+  std::vector<uint64_t> fCorrValueStamps;         //! event stamp at which the values were computed
+  uint64_t fEventStamp = 1;                       //! incremented whenever the Q-vectors change
+  int fNPtSlots = 1;                              //! number of pT bins for pt-dependent node values
+  std::vector<int> fFillPt;                       //! tracks of one region in the batch Fill
+  std::vector<double> fFillPhi;                   //!
+  std::vector<double> fFillWeight;                //!
+  std::vector<double> fFillSecondWeight;          //!
+  // root node of the correlators with unit powers, key: poi, ref, ol, harmonics
+  std::map<std::tuple<int, int, int, std::vector<int>>, int, std::less<>> fCorrRootIndex; //!
+  // index in fListOfCFGs, key: regions, harmonics, overlaps
+  std::map<std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>, std::vector<int>>, int, std::less<>> fCFGIndex; //!
+  int CompileCorr(int poi, int ref, int ol, std::vector<int>& hars, std::vector<int>& pows); // POI, Ref. flow, overlapping region
+  int CompileCorr(int poi, int ref, int ol, const std::vector<int>& hars);
+  int FindCorrRoot(int poi, int ref, int ol, const std::vector<int>& hars);
+  int FindCompiledConfig(const CorrConfig& corconf);
+  void ResetCorrNodes();
+  std::complex<double> EvaluateCorr(int root, int ptbin);
+  void AddRegion(Region inreg);
   Region GetRegion(int index) { return fRegions.at(index); }
   int FindRegionByName(std::string refName);
   std::vector<std::pair<int, std::vector<int>>> GetHarmonicsSingleConfig(const CorrConfig&);
   // Calculating functions:
-  std::complex<double> Calculate(int poi, int ref, std::vector<int> hars, int ptbin = 0); // For differential, need POI and reference
-  std::complex<double> Calculate(int poi, std::vector<int> hars);                         // For integrated case
+  std::complex<double> Calculate(int poi, int ref, const std::vector<int>& hars, int ptbin = 0); // For differential, need POI and reference
+  std::complex<double> Calculate(int poi, const std::vector<int>& hars);                         // For integrated case
   // Operations on strings. Equivalent to TString operations, but one to rid of root dependence
   int s_index(std::string& instr, const std::string& pattern, const int& spos = 0);
   bool s_contains(std::string& instr, const std::string& pattern);
@@ -11,6 +11,7 @@
 
 #include "GFWCumulant.h"
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <vector>
@@ -18,72 +19,105 @@
 using std::complex;
 using std::vector;
 
-GFWCumulant::GFWCumulant() : fQvector(0),
-                             fUsed(kBlank),
+GFWCumulant::GFWCumulant() : fUsed(kBlank),
                              fNEntries(-1),
                              fN(1),
                              fPow(1),
+                             fPowMax(1),
                              fPt(1),
-                             fFilledPts(0),
                              fInitialized(false) {}
 
 GFWCumulant::~GFWCumulant() {}
 void GFWCumulant::FillArray(int ptin, double phi, double weight, double SecondWeight)
+{
+  FillArray(1, &ptin, &phi, &weight, &SecondWeight);
+};
+void GFWCumulant::FillArray(int nTracks, const int* ptin, const double* phi, const double* weight, const double* SecondWeight)
 {
   if (!fInitialized)
     CreateComplexVectorArray(1, 1, 1);
-  if (fPt == 1)
-    ptin = 0; // If one bin, then just fill it straight; otherwise, if ptin is out-of-range, do not fill
-  else if (ptin < 0 || ptin >= fPt)
-    return;
-  fFilledPts[ptin] = true;
-  for (int lN = 0; lN < fN; lN++) {
-    double lSin = sin(lN * phi); // No need to recalculate for each power
-    double lCos = cos(lN * phi); // No need to recalculate for each power
-    for (int lPow = 0; lPow < PW(lN); lPow++) {
-      double lPrefactor = 0;
-      // Dont calculate it twice; multiplication is cheaper that power
-      // Also, if second weight is specified, then keep the first weight with power no more than 1, and us the other weight otherwise
+  // Tracks are processed in batches, with all per-track quantities in small arrays, such that the loops over tracks can be vectorized.
+  // cos(n*phi) and sin(n*phi) are obtained from the angle addition formulas, so only one cos and sin are calculated per track.
+  // Powers of the weights are obtained as running products.
+  double lCos1[kBatchSize], lSin1[kBatchSize]; // cos(phi), sin(phi)
+  double lCos[kBatchSize], lSin[kBatchSize];   // cos(n*phi), sin(n*phi)
+  double lW1[kBatchSize], lW2[kBatchSize];     // weight used for the first power and for the higher powers
+  double lPrefactor[kBatchSize];
+  int lOffset[kBatchSize]; // offset of the pT bin in the Q-vector arrays
+  for (int first = 0; first < nTracks; first += kBatchSize) {
+    int last = std::min(first + kBatchSize, nTracks);
+    int nSel = 0;
+    for (int i = first; i < last; i++) {
+      int lPt = (fPt == 1) ? 0 : ptin[i]; // If one bin, then just fill it straight; otherwise, if ptin is out-of-range, do not fill
+      if (lPt < 0 || lPt >= fPt)
+        continue;
+      fFilledPts[lPt] = true;
+      lOffset[nSel] = QIndex(lPt, 0, 0);
+      lCos1[nSel] = cos(phi[i]);
+      lSin1[nSel] = sin(phi[i]);
+      // If second weight is specified, then keep the first weight with power no more than 1, and use the other weight otherwise
       // this is important when POIs are a subset of REFs and have different weights than REFs
-      if (SecondWeight > 0 && lPow > 1)
-        lPrefactor = pow(SecondWeight, lPow - 1) * weight;
-      else
-        lPrefactor = pow(weight, lPow);
-      double qsin = lPrefactor * lSin;
-      double qcos = lPrefactor * lCos;
-      fQvector[ptin][lN][lPow] += complex<double>(qcos, qsin);
+      lW1[nSel] = weight[i];
+      lW2[nSel] = (SecondWeight && SecondWeight[i] > 0) ? SecondWeight[i] : weight[i];
+      nSel++;
+    }
+    for (int t = 0; t < nSel; t++) {
+      lCos[t] = 1.;
+      lSin[t] = 0.;
+    }
+    for (int lN = 0; lN < fN; lN++) {
+      if (lN > 0) {
+        for (int t = 0; t < nSel; t++) {
+          double c = lCos[t] * lCos1[t] - lSin[t] * lSin1[t];
+          double s = lSin[t] * lCos1[t] + lCos[t] * lSin1[t];
+          lCos[t] = c;
+          lSin[t] = s;
+        }
+      }
+      for (int lPow = 0; lPow < PW(lN); lPow++) {
+        if (lPow == 0)
+          std::fill(lPrefactor, lPrefactor + nSel, 1.);
+        else if (lPow == 1)
+          std::copy(lW1, lW1 + nSel, lPrefactor);
+        else
+          for (int t = 0; t < nSel; t++)
+            lPrefactor[t] *= lW2[t];
+        if (fPt == 1) { // all tracks in the same bin, sum over the batch first
+          double qcos = 0, qsin = 0;
+          for (int t = 0; t < nSel; t++) {
+            qcos += lPrefactor[t] * lCos[t];
+            qsin += lPrefactor[t] * lSin[t];
+          }
+          fQRe[QIndex(0, lN, lPow)] += qcos;
+          fQIm[QIndex(0, lN, lPow)] += qsin;
+        } else {
+          int lInd = QIndex(0, lN, lPow);
+          for (int t = 0; t < nSel; t++) {
+            fQRe[lOffset[t] + lInd] += lPrefactor[t] * lCos[t];
+            fQIm[lOffset[t] + lInd] += lPrefactor[t] * lSin[t];
+          }
+        }
+      }
     }
+    Inc(nSel);
   }
-  Inc();
 };
 void GFWCumulant::ResetQs()
 {
   if (!fNEntries)
     return; // If 0 entries, then no need to reset. Otherwise, if -1, then just initialized and need to set to 0.
-  for (int i = 0; i < fPt; i++) {
-    fFilledPts[i] = false;
-    for (int lN = 0; lN < fN; lN++) {
-      for (int lPow = 0; lPow < PW(lN); lPow++) {
-        fQvector[i][lN][lPow] = fNullQ;
-      }
-    }
-  }
+  std::fill(fFilledPts.begin(), fFilledPts.end(), false);
+  std::fill(fQRe.begin(), fQRe.end(), 0.);
+  std::fill(fQIm.begin(), fQIm.end(), 0.);
   fNEntries = 0;
 };
 void GFWCumulant::DestroyComplexVectorArray()
 {
   if (!fInitialized)
     return;
-  for (int l_n = 0; l_n < fN; l_n++) {
-    for (int i = 0; i < fPt; i++) {
-      delete[] fQvector[i][l_n];
-    }
-  }
-  for (int i = 0; i < fPt; i++) {
-    delete[] fQvector[i];
-  }
-  delete[] fQvector;
-  delete[] fFilledPts;
+  fQRe.clear();
+  fQIm.clear();
+  fFilledPts.clear();
   fInitialized = false;
   fNEntries = -1;
 };
@@ -102,33 +136,29 @@ void GFWCumulant::CreateComplexVectorArrayVarPower(int N, vector<int> PowVec, in
   fN = N;
   fPow = 0;
   fPt = Pt;
-  fFilledPts = new bool[Pt];
   fPowVec = PowVec;
-  fQvector = new complex<double>**[fPt];
-  for (int i = 0; i < fPt; i++) {
-    fQvector[i] = new complex<double>*[fN];
-  }
-  for (int l_n = 0; l_n < fN; l_n++) {
-    for (int i = 0; i < fPt; i++) {
-      fQvector[i][l_n] = new complex<double>[PW(l_n)];
-    }
-  }
+  fPowMax = 1;
+  for (int l_n = 0; l_n < fN; l_n++)
+    fPowMax = std::max(fPowMax, PW(l_n));
+  fFilledPts.assign(fPt, false);
+  fQRe.assign(fPt * fN * fPowMax, 0.);
+  fQIm.assign(fPt * fN * fPowMax, 0.);
   ResetQs();
   fInitialized = true;
 };
-complex<double> GFWCumulant::Vec(int n, int p, int ptbin)
+complex<double> GFWCumulant::Vec(int n, int p, int ptbin) const
 {
   if (!fInitialized)
     return 0;
   if (ptbin >= fPt || ptbin < 0)
     ptbin = 0;
   if (n >= 0)
-    return fQvector[ptbin][n][p];
-  return conj(fQvector[ptbin][-n][p]);
+    return complex<double>(fQRe[QIndex(ptbin, n, p)], fQIm[QIndex(ptbin, n, p)]);
+  return complex<double>(fQRe[QIndex(ptbin, -n, p)], -fQIm[QIndex(ptbin, -n, p)]);
 };
-bool GFWCumulant::IsPtBinFilled(int ptb)
+bool GFWCumulant::IsPtBinFilled(int ptb) const
 {
-  if (!fFilledPts)
+  if (fFilledPts.empty())
     return false;
   if (ptb > 0) {
     if (fPt == 1)
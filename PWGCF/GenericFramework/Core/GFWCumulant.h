@@ -29,6 +29,8 @@ class GFWCumulant
   ~GFWCumulant();
   void ResetQs();
   void FillArray(int ptin, double phi, double weight = 1, double SecondWeight = -1);
+  // Batch version: fills nTracks tracks at once. SecondWeight can be a nullptr if no second weights are used
+  void FillArray(int nTracks, const int* ptin, const double* phi, const double* weight, const double* SecondWeight = nullptr);
   enum UsedFlags_t { kBlank = 0,
                      kFull = 1,
                      kPt = 2 };
@@ -37,26 +39,30 @@ class GFWCumulant
     DestroyComplexVectorArray();
     fUsed = infl;
   };
-  void Inc() { fNEntries++; }
-  int GetN() { return fNEntries; }
-  bool IsPtBinFilled(int ptb);
+  void Inc(int n = 1) { fNEntries += n; }
+  int GetN() const { return fNEntries; }
+  bool IsPtBinFilled(int ptb) const;
   void CreateComplexVectorArray(int N = 1, int P = 1, int Pt = 1);
   void CreateComplexVectorArrayVarPower(int N = 1, std::vector<int> Pvec = {1}, int Pt = 1);
-  int PW(int ind) { return fPowVec.at(ind); }; // No checks to speed up, be carefull!!!
+  int PW(int ind) const { return fPowVec.at(ind); }; // No checks to speed up, be carefull!!!
   void DestroyComplexVectorArray();
-  std::complex<double> Vec(int, int, int ptbin = 0); // envelope class to summarize pt-dif. Q-vec getter
+  std::complex<double> Vec(int, int, int ptbin = 0) const; // envelope class to summarize pt-dif. Q-vec getter
  protected:
-  std::complex<double>*** fQvector;
+  static constexpr int kBatchSize = 64; // number of tracks processed together in the batch fill
+  int QIndex(int ptbin, int n, int p) const { return (ptbin * fN + n) * fPowMax + p; }
+  // Q-vectors stored contiguously as [pt][harmonic][power], with real and imaginary parts in separate arrays
+  std::vector<double> fQRe;
+  std::vector<double> fQIm;
   uint fUsed;
   int fNEntries;
   // Q-vectors. Could be done recursively, but maybe defining each one of them explicitly is easier to read
   int fN;                   //! Harmonics
   int fPow;                 //! Power
   std::vector<int> fPowVec; //! Powers array
+  int fPowMax;              //! Maximum number of powers, stride of the harmonics in the Q-vector arrays
   int fPt;                  //! fPt bins
-  bool* fFilledPts;
+  std::vector<char> fFilledPts;
   bool fInitialized; // Arrays are initialized
-  std::complex<double> fNullQ = 0;
 };
 
 #endif // PWGCF_GENERICFRAMEWORK_CORE_GFWCUMULANT_H_
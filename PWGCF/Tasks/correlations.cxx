@@ -172,6 +172,29 @@ struct CorrelationTask {
   std::vector<float> efficiencyAssociatedCache;
   std::vector<int> p2indexCache;
 
+  // associated particles of the current event which passed the single-particle selections, sorted in pT (see fillAssociatedCache)
+  struct AssociatedParticle {
+    float pt;
+    float eta;
+    float phi;
+    float weight;
+    int64_t globalIndex;
+    int8_t sign;
+    int row; // row in unsortedPhiStar
+  };
+  struct AssociatedCache {
+    std::vector<AssociatedParticle> unsorted;
+    std::vector<float> unsortedPhiStar;
+    std::vector<float> pt;
+    std::vector<float> eta;
+    std::vector<float> phi;
+    std::vector<float> weight;
+    std::vector<int64_t> globalIndex;
+    std::vector<int8_t> sign;
+    std::vector<float> phiStar; // [particle][radius], for the two-track cut
+  } associatedCache;
+  std::vector<float> triggerPhiStar;
+
   std::unique_ptr<TFormula> multCutFormula;
   std::array<uint, aod::cfmultset::NMultiplicityEstimators> multCutFormulaParamIndex;
 
@@ -564,6 +587,116 @@ struct CorrelationTask {
     return {true, 0.5f * std::log((E + pz) / (E - pz))};
   }
 
+  // particles for which no per-pair checks other than charge and pT ordering are needed (no decay, daughters or ML scores)
+  template <typename TTrack>
+  static constexpr bool isPlainParticle()
+  {
+    return !std::experimental::is_detected<HasDecay, TTrack>::value && !std::experimental::is_detected<HasMcDecay, TTrack>::value &&
+           !std::experimental::is_detected<HasProng0Id, TTrack>::value && !std::experimental::is_detected<HasProng1Id, TTrack>::value &&
+           !std::experimental::is_detected<HasPartDaugh0Id, TTrack>::value && !std::experimental::is_detected<HasPartDaugh1Id, TTrack>::value &&
+           !std::experimental::is_detected<HasMlProbD0, TTrack>::value && !std::experimental::is_detected<HasInvMass, TTrack>::value;
+  }
+
+  // Applies the single-particle selections of the associated particles once per event and stores the accepted ones
+  // in contiguous arrays sorted in pT, such that the pT ordering of the pairs becomes a range of the arrays
+  // If the two-track cut is used, phi* of the associated particles is computed here as well, once per particle instead of once per pair
+  template <CorrelationContainer::CFStep step, typename TTracks>
+  void fillAssociatedCache(TTracks& tracks, bool twoTrackCut, int magField)
+  {
+    auto& cache = associatedCache;
+    const int nPhiStar = twoTrackCut ? mPairCuts.getNPhiStar() : 0;
+    cache.unsorted.clear();
+    cache.unsortedPhiStar.clear();
+    for (const auto& track : tracks) {
+      if constexpr (std::experimental::is_detected<HasPDGCode, typename TTracks::iterator>::value) { // skip those that are specifically chosen to be triggers
+        if (!cfgMcTriggerPDGs->empty() && std::find(cfgMcTriggerPDGs->begin(), cfgMcTriggerPDGs->end(), track.pdgCode()) != cfgMcTriggerPDGs->end())
+          continue;
+      }
+      if constexpr (step <= CorrelationContainer::kCFStepTracked) {
+        if (!checkObject<step>(track))
+          continue;
+      }
+      int8_t sign = 0;
+      if constexpr (std::experimental::is_detected<HasSign, typename TTracks::iterator>::value) {
+        if (cfgAssociatedCharge != 0) {
+          if (cfgAssociatedCharge * track.sign() < 0)
+            continue;
+        } else if (track.sign() == 0) { // mc particles come in neutrals, need to check explicitly
+          continue;
+        }
+        sign = track.sign();
+      }
+      float weight = 1.0f;
+      if constexpr (step == CorrelationContainer::kCFStepCorrected) {
+        if (cfg.mEfficiencyAssociated)
+          weight = efficiencyAssociatedCache[track.filteredIndex()];
+      }
+      const int row = cache.unsorted.size();
+      cache.unsorted.push_back({track.pt(), track.eta(), track.phi(), weight, track.globalIndex(), sign, row});
+      if (nPhiStar > 0) {
+        cache.unsortedPhiStar.resize((row + 1) * nPhiStar);
+        mPairCuts.getPhiStar(track, magField, &cache.unsortedPhiStar[row * nPhiStar]);
+      }
+    }
+
+    std::stable_sort(cache.unsorted.begin(), cache.unsorted.end(), [](const AssociatedParticle& a, const AssociatedParticle& b) { return a.pt < b.pt; });
+    const auto n = cache.unsorted.size();
+    cache.pt.resize(n);
+    cache.eta.resize(n);
+    cache.phi.resize(n);
+    cache.weight.resize(n);
+    cache.globalIndex.resize(n);
+    cache.sign.resize(n);
+    cache.phiStar.resize(n * nPhiStar);
+    for (size_t i = 0; i < n; i++) {
+      const auto& particle = cache.unsorted[i];
+      cache.pt[i] = particle.pt;
+      cache.eta[i] = particle.eta;
+      cache.phi[i] = particle.phi;
+      cache.weight[i] = particle.weight;
+      cache.globalIndex[i] = particle.globalIndex;
+      cache.sign[i] = particle.sign;
+      std::copy_n(cache.unsortedPhiStar.data() + particle.row * nPhiStar, nPhiStar, cache.phiStar.data() + i * nPhiStar);
+    }
+  }
+
+  // Fills the pairs of one trigger particle with the associated particles stored by fillAssociatedCache
+  template <CorrelationContainer::CFStep step, bool sameTracks, typename TTrack>
+  void fillPairsSorted(StepTHn* pairHist, const TTrack& track1, float triggerWeight, float multiplicity, float posZ, bool twoTrackCut, int magField)
+  {
+    const auto& cache = associatedCache;
+    const float pt1 = track1.pt();
+    const float eta1 = track1.eta();
+    const float phi1 = track1.phi();
+    int sign1 = 0;
+    if constexpr (std::experimental::is_detected<HasSign, TTrack>::value) {
+      sign1 = track1.sign();
+    }
+    // with pT ordering, only the associated particles before the first one with pT >= pT,1 are paired
+    size_t end = cache.pt.size();
+    if (cfgPtOrder != 0) {
+      end = std::distance(cache.pt.begin(), std::lower_bound(cache.pt.begin(), cache.pt.end(), pt1));
+    }
+    const int nPhiStar = twoTrackCut ? mPairCuts.getNPhiStar() : 0;
+    if (twoTrackCut) {
+      triggerPhiStar.resize(nPhiStar);
+      mPairCuts.getPhiStar(track1, magField, triggerPhiStar.data());
+    }
+    const int pairCharge = cfgPairCharge;
+    for (size_t i = 0; i < end; i++) {
+      if constexpr (sameTracks) {
+        if (cache.globalIndex[i] == track1.globalIndex())
+          continue;
+      }
+      if (pairCharge != 0 && pairCharge * sign1 * cache.sign[i] < 0)
+        continue;
+      if (twoTrackCut && mPairCuts.twoTrackCut(eta1 - cache.eta[i], std::fabs(pt1 - cache.pt[i]), triggerPhiStar.data(), cache.phiStar.data() + i * nPhiStar))
+        continue;
+      float deltaPhi = RecoDecay::constrainAngle(phi1 - cache.phi[i], -o2::constants::math::PIHalf);
+      pairHist->Fill(step, eta1 - cache.eta[i], cache.pt[i], pt1, multiplicity, deltaPhi, posZ, triggerWeight * cache.weight[i]);
+    }
+  }
+
   template <CorrelationContainer::CFStep step, typename TTarget, typename TTracks1, typename TTracks2>
   void fillCorrelations(TTarget target, TTracks1& tracks1, TTracks2& tracks2, float multiplicity, float posZ, int magField, float eventWeight)
   {
@@ -578,6 +711,19 @@ struct CorrelationTask {
       }
     }
 
+    // Pairs of plain particles are filled from the pT-sorted cache of the associated particles, unless conversion cuts or the mass axis are used
+    constexpr bool sortedPairs = isPlainParticle<typename TTracks1::iterator>() && isPlainParticle<typename TTracks2::iterator>();
+    [[maybe_unused]] bool useSortedPairs = false;
+    [[maybe_unused]] bool useTwoTrackCut = false;
+    if constexpr (sortedPairs) {
+      constexpr bool pairCutsApplicable = std::is_same<TTracks1, TTracks2>::value && step >= CorrelationContainer::kCFStepReconstructed && std::experimental::is_detected<HasSign, typename TTracks1::iterator>::value;
+      useSortedPairs = !cfgMassAxis && !(pairCutsApplicable && cfg.mPairCuts);
+      useTwoTrackCut = pairCutsApplicable && cfgTwoTrackCut > 0;
+      if (useSortedPairs) {
+        fillAssociatedCache<step>(tracks2, useTwoTrackCut, magField);
+      }
+    }
+
     for (const auto& track1 : tracks1) {
       // LOGF(info, "Track %f | %f | %f  %d %d", track1.eta(), track1.phi(), track1.pt(), track1.isGlobalTrack(), track1.isGlobalTrackSDD());
 
@@ -653,6 +799,13 @@ struct CorrelationTask {
         target->getTriggerHist()->Fill(step, track1.pt(), multiplicity, posZ, triggerWeight);
       }
 
+      if constexpr (sortedPairs) {
+        if (useSortedPairs) {
+          fillPairsSorted<step, std::is_same<TTracks1, TTracks2>::value>(target->getPairHist(), track1, triggerWeight, multiplicity, posZ, useTwoTrackCut, magField);
+          continue;
+        }
+      }
+
       for (const auto& track2 : tracks2) {
         if constexpr (std::is_same<TTracks1, TTracks2>::value) {
           if (track1.globalIndex() == track2.globalIndex()) {
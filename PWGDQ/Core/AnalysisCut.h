@@ -70,6 +70,8 @@ class AnalysisCut : public TNamed
     std::shared_ptr<TF1> fFuncHigh; // function for the upper limit cut
   };
 
+  const std::vector<CutContainer>& GetCuts() const { return fCuts; }
+
  protected:
   std::vector<CutContainer> fCuts;
 };
@@ -0,0 +1,323 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "PWGDQ/Core/AnalysisCutProgram.h"
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+
+#include <Framework/Logger.h>
+
+#include <TF1.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+//____________________________________________________________________________
+void AnalysisCutProgram::Compile(const std::vector<AnalysisCut*>& cuts)
+{
+  //
+  // flatten the cut trees into a linear program of range tests and AND/OR operations
+  //
+  fNCuts = 0;
+  fNCandidates = 0;
+  fCapacity = 0;
+  fMaxDepth = 0;
+  fUsedVars.clear();
+  fVarToColumn.clear();
+  fColumns.clear();
+  fTests.clear();
+  fLimits.clear();
+  fProgram.clear();
+
+  if (cuts.size() > kMaxCuts) {
+    LOG(warn) << "AnalysisCutProgram::Compile(): " << cuts.size() << " cuts requested, only the first " << kMaxCuts << " are compiled";
+  }
+  for (auto* cut : cuts) {
+    if (fNCuts == kMaxCuts) {
+      break;
+    }
+    int depth = 0;
+    CompileCut(cut, depth);
+    fProgram.push_back({kOpStore, fNCuts});
+    fNCuts++;
+  }
+}
+
+//____________________________________________________________________________
+void AnalysisCutProgram::CompileCut(const AnalysisCut* cut, int& depth)
+{
+  //
+  // compile a simple or composite cut; the result is left on top of the evaluation stack
+  //
+  if (const auto* composite = dynamic_cast<const AnalysisCompositeCut*>(cut)) {
+    CompileComposite(composite, depth);
+  } else {
+    CompileCutContainers(cut->GetCuts(), depth);
+  }
+}
+
+//____________________________________________________________________________
+void AnalysisCutProgram::CompileCutContainers(const std::vector<AnalysisCut::CutContainer>& containers, int& depth)
+{
+  //
+  // a simple cut is the AND of all its range tests
+  //
+  if (containers.empty()) {
+    fProgram.push_back({kOpTrue, 0});
+    fMaxDepth = std::max(fMaxDepth, ++depth);
+    return;
+  }
+  for (auto const& container : containers) {
+    RangeTest test;
+    test.fColumn = GetColumn(container.fVar);
+    test.fLow = container.fLow;
+    test.fHigh = container.fHigh;
+    test.fExclude = container.fExclude;
+    if (container.fDepVar != -1) {
+      test.fDepColumn = GetColumn(container.fDepVar);
+      test.fDepLow = container.fDepLow;
+      test.fDepHigh = container.fDepHigh;
+      test.fDepExclude = container.fDepExclude;
+    }
+    if (container.fDepVar2 != -1) {
+      test.fDep2Column = GetColumn(container.fDepVar2);
+      test.fDep2Low = container.fDep2Low;
+      test.fDep2High = container.fDep2High;
+      test.fDep2Exclude = container.fDep2Exclude;
+    }
+    if (container.fFuncLow) {
+      test.fLowLimit = AddLimit(container.fFuncLow, test.fDepColumn);
+    }
+    if (container.fFuncHigh) {
+      test.fHighLimit = AddLimit(container.fFuncHigh, test.fDepColumn);
+    }
+    fTests.push_back(test);
+    fProgram.push_back({kOpTest, static_cast<int>(fTests.size()) - 1});
+    fMaxDepth = std::max(fMaxDepth, ++depth);
+  }
+  if (containers.size() > 1) {
+    fProgram.push_back({kOpAnd, static_cast<int>(containers.size())});
+    depth -= containers.size() - 1;
+  }
+}
+
+//____________________________________________________________________________
+void AnalysisCutProgram::CompileComposite(const AnalysisCompositeCut* cut, int& depth)
+{
+  //
+  // a composite cut is the AND (or OR) of its simple and composite cuts
+  //
+  int nChildren = cut->GetNCuts();
+  if (nChildren == 0) {
+    // same as AnalysisCompositeCut::IsSelected() for an empty list
+    fProgram.push_back({cut->GetUseAND() ? kOpTrue : kOpFalse, 0});
+    fMaxDepth = std::max(fMaxDepth, ++depth);
+    return;
+  }
+  for (auto const& child : cut->GetCutList()) {
+    CompileCutContainers(child.GetCuts(), depth);
+  }
+  for (auto const& child : cut->GetCompositeCutList()) {
+    CompileComposite(&child, depth);
+  }
+  if (nChildren > 1) {
+    fProgram.push_back({cut->GetUseAND() ? kOpAnd : kOpOr, nChildren});
+    depth -= nChildren - 1;
+  }
+}
+
+//____________________________________________________________________________
+int AnalysisCutProgram::GetColumn(int var)
+{
+  //
+  // get the batch column of a variable, adding a new column if needed
+  //
+  if (var >= static_cast<int>(fVarToColumn.size())) {
+    fVarToColumn.resize(var + 1, -1);
+  }
+  if (fVarToColumn[var] < 0) {
+    fVarToColumn[var] = fUsedVars.size();
+    fUsedVars.push_back(var);
+  }
+  return fVarToColumn[var];
+}
+
+//____________________________________________________________________________
+int AnalysisCutProgram::AddLimit(const std::shared_ptr<TF1>& func, int depColumn)
+{
+  //
+  // add a function cut limit, shared by the range tests using the same function of the same variable
+  //
+  for (std::size_t i = 0; i < fLimits.size(); ++i) {
+    if (fLimits[i].fFunc == func && fLimits[i].fDepColumn == depColumn) {
+      return static_cast<int>(i);
+    }
+  }
+  fLimits.push_back({func, depColumn});
+  return static_cast<int>(fLimits.size()) - 1;
+}
+
+//____________________________________________________________________________
+void AnalysisCutProgram::Reserve(int nCandidates)
+{
+  //
+  // make space for nCandidates in each column, keeping the already stored candidates
+  //
+  if (nCandidates <= fCapacity) {
+    return;
+  }
+  std::size_t nColumns = fUsedVars.size();
+  std::vector<float> columns(nColumns * nCandidates);
+  for (std::size_t col = 0; col < nColumns; ++col) {
+    std::copy_n(fColumns.begin() + col * fCapacity, fNCandidates, columns.begin() + col * nCandidates);
+  }
+  fColumns.swap(columns);
+  fCapacity = nCandidates;
+}
+
+//____________________________________________________________________________
+void AnalysisCutProgram::AddCandidate(const float* values)
+{
+  //
+  // copy the used variables of one candidate into the columns
+  //
+  if (fNCandidates == fCapacity) {
+    Reserve(std::max(2 * fCapacity, 64));
+  }
+  std::size_t nColumns = fUsedVars.size();
+  for (std::size_t col = 0; col < nColumns; ++col) {
+    fColumns[col * fCapacity + fNCandidates] = values[fUsedVars[col]];
+  }
+  fNCandidates++;
+}
+
+//____________________________________________________________________________
+void AnalysisCutProgram::EvaluateTest(const RangeTest& test, uint8_t* result) const
+{
+  //
+  // evaluate a range test on all candidates
+  //   NOTE: the loops are branch-free, with the same comparison semantics as in AnalysisCut::IsSelected()
+  //
+  const int n = fNCandidates;
+  const float* var = fColumns.data() + test.fColumn * fCapacity;
+  const uint8_t exclude = test.fExclude;
+
+  if (test.fLowLimit < 0 && test.fHighLimit < 0) {
+    const float low = test.fLow;
+    const float high = test.fHigh;
+    for (int i = 0; i < n; ++i) {
+      uint8_t inRange = (var[i] >= low) & (var[i] <= high);
+      result[i] = inRange ^ exclude;
+    }
+  } else {
+    // function limits, evaluated on the first dependent variable at the beginning of Evaluate()
+    const float* lowValues = test.fLowLimit < 0 ? nullptr : fLimitValues.data() + static_cast<std::size_t>(test.fLowLimit) * n;
+    const float* highValues = test.fHighLimit < 0 ? nullptr : fLimitValues.data() + static_cast<std::size_t>(test.fHighLimit) * n;
+    for (int i = 0; i < n; ++i) {
+      const float low = lowValues ? lowValues[i] : test.fLow;
+      const float high = highValues ? highValues[i] : test.fHigh;
+      uint8_t inRange = (var[i] >= low) & (var[i] <= high);
+      result[i] = inRange ^ exclude;
+    }
+  }
+
+  // the cut is applied only if the dependent variables are in (or outside, if excluded) their ranges
+  if (test.fDepColumn >= 0) {
+    const float* dep = fColumns.data() + test.fDepColumn * fCapacity;
+    const float low = test.fDepLow;
+    const float high = test.fDepHigh;
+    const uint8_t depExclude = test.fDepExclude;
+    for (int i = 0; i < n; ++i) {
+      uint8_t apply = ((dep[i] > low) & (dep[i] <= high)) ^ depExclude;
+      result[i] |= apply ^ 1;
+    }
+  }
+  if (test.fDep2Column >= 0) {
+    const float* dep = fColumns.data() + test.fDep2Column * fCapacity;
+    const float low = test.fDep2Low;
+    const float high = test.fDep2High;
+    const uint8_t depExclude = test.fDep2Exclude;
+    for (int i = 0; i < n; ++i) {
+      uint8_t apply = ((dep[i] > low) & (dep[i] <= high)) ^ depExclude;
+      result[i] |= apply ^ 1;
+    }
+  }
+}
+
+//____________________________________________________________________________
+void AnalysisCutProgram::Evaluate(uint64_t* masks)
+{
+  //
+  // run the program on the accumulated candidates
+  //
+  const int n = fNCandidates;
+  std::fill(masks, masks + n, 0);
+  if (n == 0) {
+    return;
+  }
+  fRegisters.resize(static_cast<std::size_t>(fMaxDepth) * n);
+  auto reg = [&](int level) { return fRegisters.data() + static_cast<std::size_t>(level) * n; };
+
+  // evaluate each function limit once per candidate, with the float conversion of AnalysisCut::IsSelected()
+  fLimitValues.resize(fLimits.size() * n);
+  for (std::size_t iLimit = 0; iLimit < fLimits.size(); ++iLimit) {
+    const TF1& func = *fLimits[iLimit].fFunc;
+    const float* dep = fColumns.data() + fLimits[iLimit].fDepColumn * fCapacity;
+    float* values = fLimitValues.data() + iLimit * n;
+    for (int i = 0; i < n; ++i) {
+      values[i] = func.Eval(dep[i]);
+    }
+  }
+
+  int top = 0; // number of registers on the stack
+  for (auto const& op : fProgram) {
+    switch (op.fType) {
+      case kOpTest:
+        EvaluateTest(fTests[op.fArg], reg(top++));
+        break;
+      case kOpTrue:
+        std::fill_n(reg(top++), n, 1);
+        break;
+      case kOpFalse:
+        std::fill_n(reg(top++), n, 0);
+        break;
+      case kOpAnd:
+      case kOpOr: {
+        uint8_t* dst = reg(top - op.fArg);
+        for (int k = 1; k < op.fArg; ++k) {
+          const uint8_t* src = reg(top - op.fArg + k);
+          if (op.fType == kOpAnd) {
+            for (int i = 0; i < n; ++i) {
+              dst[i] &= src[i];
+            }
+          } else {
+            for (int i = 0; i < n; ++i) {
+              dst[i] |= src[i];
+            }
+          }
+        }
+        top -= op.fArg - 1;
+        break;
+      }
+      case kOpStore: {
+        const uint8_t* src = reg(--top);
+        for (int i = 0; i < n; ++i) {
+          masks[i] |= static_cast<uint64_t>(src[i]) << op.fArg;
+        }
+        break;
+      }
+    }
+  }
+}
@@ -0,0 +1,129 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file AnalysisCutProgram.h
+/// \brief Flattened, batched evaluation of a list of AnalysisCut / AnalysisCompositeCut objects
+//
+// The cut trees are compiled once into a linear program of range tests combined with AND/OR operations.
+// Candidates are accumulated as columns (one contiguous array per used variable) and the program is then
+// evaluated on the whole batch at once, with branch-free loops over candidates which the compiler can vectorize.
+// Cut limits given as TF1 functions are evaluated once per function and candidate at the beginning of Evaluate(),
+// converted to float as in AnalysisCut::IsSelected(), such that the decisions are the same as with IsSelected().
+// The result is a selection bit map per candidate, with bit i corresponding to the i-th compiled cut.
+//
+// Usage:
+//   AnalysisCutProgram program;
+//   program.Compile(cuts);                    // e.g. the list of track cuts of a task, at most 64
+//   for (auto& track : tracks) {
+//     VarManager::FillTrack<fillMap>(track);
+//     program.AddCandidate(VarManager::fgValues);
+//   }
+//   program.Evaluate(masks);                  // masks[i] holds the decisions of all cuts for candidate i
+//   program.Clear();
+//
+
+#ifndef PWGDQ_CORE_ANALYSISCUTPROGRAM_H_
+#define PWGDQ_CORE_ANALYSISCUTPROGRAM_H_
+
+#include "PWGDQ/Core/AnalysisCut.h"
+
+#include <TF1.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class AnalysisCompositeCut;
+
+//_________________________________________________________________________
+class AnalysisCutProgram
+{
+ public:
+  AnalysisCutProgram() = default;
+  ~AnalysisCutProgram() = default;
+
+  static constexpr int kMaxCuts = 64; // maximum number of cuts handled by one program (bits in the selection mask)
+
+  // compile the list of cuts; cut i will be stored in bit i of the selection masks
+  void Compile(const std::vector<AnalysisCut*>& cuts);
+
+  // variables which need to be available for each candidate
+  const std::vector<int>& GetUsedVars() const { return fUsedVars; }
+  int GetNCuts() const { return fNCuts; }
+  int GetNCandidates() const { return fNCandidates; }
+
+  void Reserve(int nCandidates);
+  // copy the used variables of one candidate from a VarManager style values array into the column batch
+  void AddCandidate(const float* values);
+  void Clear() { fNCandidates = 0; }
+  // evaluate all cuts on all accumulated candidates; masks must have space for GetNCandidates() elements
+  void Evaluate(uint64_t* masks);
+
+ private:
+  // cut limit given as a function of the first dependent variable of a range test
+  struct FunctionLimit {
+    std::shared_ptr<TF1> fFunc;
+    int fDepColumn = -1;
+  };
+
+  // one range test, i.e. a flattened AnalysisCut::CutContainer; variables are column indices in the batch
+  struct RangeTest {
+    int fColumn = -1;
+    float fLow = 0.0;
+    float fHigh = 0.0;
+    bool fExclude = false;
+    int fDepColumn = -1;
+    float fDepLow = 0.0;
+    float fDepHigh = 0.0;
+    bool fDepExclude = false;
+    int fDep2Column = -1;
+    float fDep2Low = 0.0;
+    float fDep2High = 0.0;
+    bool fDep2Exclude = false;
+    int fLowLimit = -1;  // index in fLimits, if the low limit is a function
+    int fHighLimit = -1; // index in fLimits, if the high limit is a function
+  };
+
+  enum OpType {
+    kOpTest = 0, // push the result of the range test fArg
+    kOpTrue,     // push an all-true register
+    kOpFalse,    // push an all-false register
+    kOpAnd,      // pop fArg registers and push their AND
+    kOpOr,       // pop fArg registers and push their OR
+    kOpStore     // pop a register and store it in bit fArg of the output masks
+  };
+  struct Op {
+    OpType fType;
+    int fArg;
+  };
+
+  void CompileCut(const AnalysisCut* cut, int& depth);
+  void CompileCutContainers(const std::vector<AnalysisCut::CutContainer>& containers, int& depth);
+  void CompileComposite(const AnalysisCompositeCut* cut, int& depth);
+  int GetColumn(int var);
+  int AddLimit(const std::shared_ptr<TF1>& func, int depColumn);
+  void EvaluateTest(const RangeTest& test, uint8_t* result) const;
+
+  int fNCuts = 0;
+  int fNCandidates = 0;
+  int fCapacity = 0;
+  int fMaxDepth = 0;
+  std::vector<int> fUsedVars;         // variables stored in the columns, in column order
+  std::vector<int> fVarToColumn;      // map from variable index to column index (-1 if not used)
+  std::vector<float> fColumns;        // SoA storage of the candidates, [column][candidate]
+  std::vector<RangeTest> fTests;      // flattened range tests
+  std::vector<FunctionLimit> fLimits; // distinct function limits
+  std::vector<float> fLimitValues;    // values of the function limits for the evaluated batch, [limit][candidate]
+  std::vector<Op> fProgram;           // linear program in post-order
+  std::vector<uint8_t> fRegisters;    // evaluation stack, [depth][candidate]
+};
+
+#endif // PWGDQ_CORE_ANALYSISCUTPROGRAM_H_
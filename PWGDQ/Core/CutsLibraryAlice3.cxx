@@ -0,0 +1,453 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file CutsLibraryAlice3.cxx
+/// \brief Library of ALICE 3 cuts with fixed names, registered for the lookup in CutsLibrary.cxx
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/CutsLibrary.h"
+#include "PWGDQ/Core/CutsLibraryRegistry.h"
+#include "PWGDQ/Core/VarManager.h"
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterAlice3AnalysisCuts(AnalysisCutRegistry& analysisCuts)
+{
+  analysisCuts.emplace("alice3KineSkim", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.05, 1000.0);
+    cut->AddCut(VarManager::kEta, -4.0, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3StandardKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.1, 1000.0);
+    cut->AddCut(VarManager::kEta, -2.5, 2.5); // Total tracker acceptance in v3b geomety
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3KineTOFAcceptance", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.1, 1000.0);
+    cut->AddCut(VarManager::kEta, -2.0, 2.0); // TOF acceptance in v3b geomety
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3KineRICHAcceptance", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.1, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.8, 0.8); // RICH acceptance in v3b geomety
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3LambdaCKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.2, 1000.0);
+    cut->AddCut(VarManager::kEta, -2.0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3JpsiKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -2.5, 2.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3JpsiKineTOFAcceptance", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -2.0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3JpsiKineRICHAcceptance", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3TrackQuality", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsReconstructed, 0.5, 1.5);
+    cut->AddCut(VarManager::kNSiliconHits, 5.0, 12.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3TrackQualityTightDCA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsReconstructed, 0.5, 1.5);
+    cut->AddCut(VarManager::kNSiliconHits, 6.0, 12.0);
+    cut->AddCut(VarManager::kTrackDCAxy, -1.0, 1.0);
+    cut->AddCut(VarManager::kTrackDCAz, -1.0, 1.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3OTPIDEl", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOTnSigmaEl, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3OTPIDPi", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOTnSigmaPi, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3OTPIDKa", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOTnSigmaKa, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3OTPIDPr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOTnSigmaPr, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3iTOFPIDEl", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kInnerTOFnSigmaEl, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3iTOFPIDPi", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kInnerTOFnSigmaPi, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3iTOFPIDKa", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kInnerTOFnSigmaKa, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3iTOFPIDPr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kInnerTOFnSigmaPr, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3oTOFPIDEl", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOuterTOFnSigmaEl, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3oTOFPIDPi", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOuterTOFnSigmaPi, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3oTOFPIDKa", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOuterTOFnSigmaKa, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3oTOFPIDPr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOuterTOFnSigmaPr, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3CharmoniumPID", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOuterTOFnSigmaEl, -2.0, 3.0, false, VarManager::kP, 0.0, 1.2);
+    cut->AddCut(VarManager::kRICHnSigmaEl, -2.0, 3.0, false, VarManager::kHasRICHSigEl, 0.5, 1.5, false, VarManager::kP, 0.7, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3RICHPIDEl", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kRICHnSigmaEl, -3.0, 3.0, false, VarManager::kP, 0.7, 1000.0, false, VarManager::kHasRICHSigEl, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3RICHPIDPi", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kRICHnSigmaPi, -3.0, 3.0, false, VarManager::kP, 0.57, 1000.0, false, VarManager::kHasRICHSigPi, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3RICHPIDKa", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kRICHnSigmaKa, -3.0, 3.0, false, VarManager::kP, 2.0, 1000.0, false, VarManager::kHasRICHSigKa, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("alice3RICHPIDPr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kRICHnSigmaPr, -3.0, 3.0, false, VarManager::kP, 3.8, 1000.0, false, VarManager::kHasRICHSigPr, 0.5, 1.5);
+    return cut;
+  });
+}
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterAlice3CompositeCuts(CompositeCutRegistry& compositeCuts)
+{
+  compositeCuts.emplace("alice3StandardKine", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3StandardKine"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3KineSkim", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3KineSkim"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3TrackQuality", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3TrackQualityTightDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3StandardTrack", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3StandardKine"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3StandardTrackTOFAcceptance", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3KineTOFAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3StandardTrackRICHAcceptance", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3KineRICHAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3TightDCATrack", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3StandardKine"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQualityTightDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3TightDCATrackTOFAcceptance", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3KineTOFAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQualityTightDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3TightDCATrackRICHAcceptance", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3KineRICHAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQualityTightDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3iTOFPIDEl", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3iTOFPIDPi", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDPi"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3iTOFPIDKa", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDKa"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3iTOFPIDPr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDPr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3oTOFPIDEl", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3oTOFPIDPi", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDPi"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3oTOFPIDKa", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDKa"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3oTOFPIDPr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDPr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3FullTOFPIDEl", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3FullTOFPIDPi", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDPi"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDPi"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3FullTOFPIDKa", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDKa"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDKa"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3FullTOFPIDPr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDPr"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDPr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHPIDEl", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHPIDPi", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDPi"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHPIDKa", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDKa"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHPIDPr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDPr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHTOFPIDEl", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHTOFPIDPi", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDPi"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDPi"));
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDPi"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHTOFPIDKa", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDKa"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDKa"));
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDKa"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3RICHTOFPIDPr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDPr"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDPr"));
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDPr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3DielectronPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3JpsiKine"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    cut->AddCut(GetAnalysisCut("alice3CharmoniumPID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3DielectronPIDTOFOnly", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3JpsiKineTOFAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3DielectronPIDRICHOnly", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3JpsiKineTOFAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3DielectronPIDTOFAcceptance", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3JpsiKineTOFAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3DielectronPIDRICHAcceptance", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3JpsiKineRICHAcceptance"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    cut->AddCut(GetAnalysisCut("alice3iTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3oTOFPIDEl"));
+    cut->AddCut(GetAnalysisCut("alice3RICHPIDEl"));
+    return cut;
+  });
+
+  compositeCuts.emplace("alice3LambdaCQualityCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("alice3LambdaCKine"));
+    cut->AddCut(GetAnalysisCut("alice3TrackQuality"));
+    return cut;
+  });
+}
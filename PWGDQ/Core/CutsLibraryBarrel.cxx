@@ -0,0 +1,2951 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file CutsLibraryBarrel.cxx
+/// \brief Library of barrel track cuts with fixed names, registered for the lookup in CutsLibrary.cxx
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/CutsLibrary.h"
+#include "PWGDQ/Core/CutsLibraryRegistry.h"
+#include "PWGDQ/Core/VarManager.h"
+
+#include <TF1.h>
+
+#include <RtypesCore.h>
+
+#include <memory>
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterBarrelAnalysisCuts(AnalysisCutRegistry& analysisCuts)
+{
+  // ---------------------------------------------------
+  // Barrel track kine cuts
+  analysisCuts.emplace("negTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kCharge, -99., 0.);
+    return cut;
+  });
+
+  analysisCuts.emplace("posTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kCharge, 0., 99.);
+    return cut;
+  });
+
+  analysisCuts.emplace("posEtaSel", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, 0., 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("negEtaSel", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.8, 0.);
+    return cut;
+  });
+
+  analysisCuts.emplace("etaSel", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("pt02Sel", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.2, 20.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pt04Sel", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.4, 20.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("openEtaSel", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("insideTPCsector", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackIsInsideTPCModule, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("rho0Kine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.1, 1000.0);
+    cut->AddCut(VarManager::kEta, -1.1, 1.1);
+    return cut;
+  });
+
+  analysisCuts.emplace("pionQuality", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCncls, 50.0, 1000.);
+    return cut;
+  });
+
+  analysisCuts.emplace("primaryVertexContributor", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPVContributor, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiStandardKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiStandardKine2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.9, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiStandardKine3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kP, 1.2, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiPIDcalibKine_posEta", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPin, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, 0.0, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiPIDcalibKine_negEta", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPin, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiStandardKine4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kP, 1.5, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiStandardKine5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kP, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsiKineSkimmed", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.7, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmeePrefilterKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0., 20.0);
+    cut->AddCut(VarManager::kEta, -1.2, 1.2);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmeeStandardKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.2, 20.0);
+    cut->AddCut(VarManager::kEta, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmeeStandardKine_pt04", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.4, 20.0);
+    cut->AddCut(VarManager::kEta, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmeeLowBKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.075, 20.0);
+    cut->AddCut(VarManager::kEta, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("dalitzStandardKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.15, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("PIDStandardKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("PIDStandardKine2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kPt, 0.1, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("PIDStandardKine3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kPt, 0.5, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pTLow04", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.4, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pTLow03", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.3, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pTLow02", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.2, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("rapidity08", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMCY, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("rapidity09", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMCY, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("acceptance_pp13600", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMCY, -0.8, 0.8);
+    cut->AddCut(VarManager::kMCPt1, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCPt2, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCEta1, -0.8, 0.8);
+    cut->AddCut(VarManager::kMCEta2, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("acceptance_pp5360", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMCY, -0.9, 0.9);
+    cut->AddCut(VarManager::kMCPt1, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCPt2, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCEta1, -0.9, 0.9);
+    cut->AddCut(VarManager::kMCEta2, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("acceptance_PbPb5360", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMCY, -0.9, 0.9);
+    cut->AddCut(VarManager::kMCP1, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCP2, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCEta1, -0.9, 0.9);
+    cut->AddCut(VarManager::kMCEta2, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("acceptance_PbPb5360_y08", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMCY, -0.8, 0.8);
+    cut->AddCut(VarManager::kMCP1, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCP2, 1.0, 1000.0);
+    cut->AddCut(VarManager::kMCEta1, -0.8, 0.8);
+    cut->AddCut(VarManager::kMCEta2, -0.8, 0.8);
+    return cut;
+  });
+
+  analysisCuts.emplace("highPtHadron", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 4.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
+    cut->AddCut(VarManager::kTPCncls, 70.0, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("TightGlobalTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCnclsCR, 80.0, 161.);
+    cut->AddCut(VarManager::kTPCncls, 60.0, 170.);
+    cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQuality", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
+    cut->AddCut(VarManager::kTPCncls, 100.0, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityBenchmark", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
+    cut->AddCut(VarManager::kTPCncls, 70.0, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_trackCut_debug", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 90., 159);
+    cut->AddCut(VarManager::kITSncls, 2.5, 7.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_trackCut_noITSCuts_debug", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 90., 159);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_trackCut_debug2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 90., 159);
+    cut->AddCut(VarManager::kITSncls, 2.5, 7.5);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    cut->AddCut(VarManager::kTrackDCAxy, -1, 1);
+    cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_trackCut_debug3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 90., 159);
+    cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCnclsCR, 70., 159);
+    cut->AddCut(VarManager::kITSncls, 2.5, 7.5);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kTrackDCAxy, -0.05, 0.05);
+    cut->AddCut(VarManager::kTrackDCAz, -1.0, 1.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_trackCut_debug4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 90., 159);
+    cut->AddCut(VarManager::kITSncls, 2.5, 7.5);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kTrackDCAxy, -1, 1);
+    cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_trackCut_debug5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 70., 159);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_trackCut_debug6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 120., 159);
+    cut->AddCut(VarManager::kTPCnclsCR, 140., 159);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmee_trackCut_debug", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 80., 159);
+    cut->AddCut(VarManager::kITSncls, 0.0, 7.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmee_skimming_cuts", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCnclsCR, 60.0, 161.);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -5.0, 5.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("trackQuality_compareDQEMframework", [](const char* cutName) -> AnalysisCut* { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kITSncls, 4.5, 7.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCnclsCR, 80.0, 161.);
+    cut->AddCut(VarManager::kTPCnCRoverFindCls, 0.8, 1e+10);
+    cut->AddCut(VarManager::kTPCncls, 90.0, 170.);
+    return cut;
+  });
+
+  analysisCuts.emplace("LooseGlobalTrackRun3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 6.0);
+    cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
+    cut->AddCut(VarManager::kTPCncls, 70.0, 170.);
+    return cut;
+  });
+
+  analysisCuts.emplace("TightGlobalTrackRun3_strongTPC", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kITSncls, 4.5, 7.5);
+    cut->AddCut(VarManager::kTPCnclsCR, 140.0, 161.);
+    cut->AddCut(VarManager::kTPCncls, 120.0, 170.);
+    return cut;
+  });
+
+  analysisCuts.emplace("TightTPCTrackRun3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCnclsCR, 80.0, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("TightTPCTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCnclsCR, 80.0, 161.);
+    cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("SPDfirst", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDfirst, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("noTPC", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kHasTPC, -0.5, 0.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("SPDany", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("ITSiball", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAll, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("ITSibany", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityForO2MCdebug", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 70, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityForO2MCdebug2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 100.0, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityForO2MCdebug3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kITSncls, 0.5, 10);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 70, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityForO2MCdebug4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 70, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityITSOnly", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualitybAnyITSOnly", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kITSncls, 3.5, 7.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityTPCOnly", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 70, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityTPCOnly2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 100, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityTPCOnly3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 120, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("NoelectronStandardQualityTPCOnly", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0, true, VarManager::kTPCncls, 70, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronTrackQualitySkimmed", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCncls, 60, 161);
+    cut->AddCut(VarManager::kTrackDCAxy, -1.5, 1.5);
+    cut->AddCut(VarManager::kTrackDCAz, -1.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronTrackQualitySkimmed2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCncls, 60, 161);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronTrackQualitySkimmed3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCnclsCR, 70, 161);
+    cut->AddCut(VarManager::kTPCncls, 70, 161);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronTrackQuality_Maolin", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 15.0);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 70, 161.);
+    cut->AddCut(VarManager::kTPCnclsCR, 70, 161);
+    cut->AddCut(VarManager::kTrackDCAxy, -2.0, 2.0);
+    cut->AddCut(VarManager::kTrackDCAz, -2.0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pionQualityCut1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.15, 1000.0);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCncls, 70, 161);
+    return cut;
+  });
+
+  analysisCuts.emplace("pionQualityCut2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.15, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCncls, 90, 161);
+    cut->AddCut(VarManager::kTPCnclsCR, 70, 161);
+    return cut;
+  });
+
+  analysisCuts.emplace("protonPVcut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAxy, -0.1, 0.1);
+    cut->AddCut(VarManager::kTrackDCAz, -0.15, 0.15);
+    cut->AddCut(VarManager::kPt, 0.4, 3);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCncls, 80, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidbasic", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    cut->AddCut(VarManager::kTPCncls, 60, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("standardPrimaryTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAxy, -1.0, 1.0);
+    cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("trackDCA1cm", [](const char* cutName) -> AnalysisCut* { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAxy, -1.0, 1.0);
+    cut->AddCut(VarManager::kTrackDCAz, -1.0, 1.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("dcaCut1_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAxy, -0.5, 0.5);
+    cut->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("trackQuality_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCncls, 70, 161);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("trackQualityTight_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCncls, 100, 161);
+    cut->AddCut(VarManager::kITSchi2, 0.0, 3.0);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 2.0);
+    cut->AddCut(VarManager::kITSncls, 5.0, 8.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("kineJpsiEle_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kP, 1.0, 15.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle0_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0, false, VarManager::kPin, 1.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0, false, VarManager::kPin, 4.0, 150.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, 98.1, 98.11, false, VarManager::kPin, 0.0, 1.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle1_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0, false, VarManager::kPin, 1.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0, false, VarManager::kPin, 4.0, 150.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, 98.1, 98.11, false, VarManager::kPin, 0.0, 1.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle2_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle3_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -0.5, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle4_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, 0.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle5_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, 0.5, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle6_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -1.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -4.0, 4.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle7_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -3.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle8_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -3.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsiEle9_ionut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -3.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_TPCpion0", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 4.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_noTOF_prot", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 1000.0, false, VarManager::kHasTOF, -0.5, 0.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_beta", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFbeta, 0.98, 1.02, false, VarManager::kHasTOF, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_magnus_ele1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_magnus_ele2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_magnus_ele3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_magnus_prot1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_magnus_prot2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_magnus_pion1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidJpsi_magnus_pion2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("standardPrimaryTrackDCAz", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAxy, -3.0, 3.0);
+    cut->AddCut(VarManager::kTrackDCAz, -1.0, 1.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("standardPrimaryTrackDCA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAxy, -0.1, 0.1);
+    cut->AddCut(VarManager::kTrackDCAz, -0.15, 0.15);
+    return cut;
+  });
+
+  analysisCuts.emplace("PrimaryTrack_looseDCA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAxy, -3.0, 3.0);
+    cut->AddCut(VarManager::kTrackDCAz, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("tightPrimaryTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAsigXY, -3.0, 3.0);
+    cut->AddCut(VarManager::kTrackDCAsigZ, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("PrimaryTrack_DCA05", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAsigXY, -0.5, 0.5);
+    cut->AddCut(VarManager::kTrackDCAsigZ, -0.5, 0.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("PrimaryTrack_DCAz", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAz, -0.3, 0.3);
+    return cut;
+  });
+
+  analysisCuts.emplace("hasTOF", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kHasTOF, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("noTOF", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kHasTOF, -0.5, 0.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidcalib_ele", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsLegFromGamma, 0.5, 1.5, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidcalib_pion", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsLegFromK0S, 0.5, 1.5, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidcalib_proton", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsProtonFromLambdaAndAntiLambda, 0.5, 1.5, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidcalib_kaon", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFnSigmaKa, -2.0, 2.0);
+    cut->AddCut(VarManager::kTOFnSigmaPi, -2.0, 2.0, true);
+    cut->AddCut(VarManager::kITSncls, 1.5, 7.5);
+    return cut;
+  });
+}
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterBarrelCompositeCuts(CompositeCutRegistry& compositeCuts)
+{
+  // ///////////////////////////////////////////////
+  //   These are the Cuts used in the CEFP Task   //
+  //   to select tracks in the event selection    //
+  //                                              //
+  //    see CutsLubrary.h for the description     //
+  // ///////////////////////////////////////////////
+  compositeCuts.emplace("Electron2022", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Electron2023", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5_noCorr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Electron2025_1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* kineCut = new AnalysisCut("kineCut", "kine cut");
+    kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
+    kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
+
+    auto* qualityCuts = new AnalysisCut("qualityCuts", "quality cuts");
+    qualityCuts->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    qualityCuts->AddCut(VarManager::kTPCncls, 70, 161.);
+    qualityCuts->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
+
+    auto* pidCuts = new AnalysisCut("pidCuts", "pid cuts");
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -3.0, 4.0, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0, false, VarManager::kPin, 5.0, 1000.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999, false, VarManager::kPin, 0.0, 5.0);
+
+    cut->AddCut(kineCut);
+    cut->AddCut(qualityCuts);
+    cut->AddCut(pidCuts);
+    return cut;
+  });
+
+  compositeCuts.emplace("Electron2025_2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* kineCut = new AnalysisCut("kineCut", "kine cut");
+    kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
+    kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
+
+    auto* qualityCuts = new AnalysisCut("qualityCuts", "quality cuts");
+    qualityCuts->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    qualityCuts->AddCut(VarManager::kTPCncls, 70, 161.);
+    qualityCuts->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
+
+    auto* pidCuts = new AnalysisCut("pidCuts", "pid cuts");
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -3.0, 4.0, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0, false, VarManager::kPin, 5.0, 1000.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPi, 2.0, 999, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999, false, VarManager::kPin, 0.0, 5.0);
+
+    cut->AddCut(kineCut);
+    cut->AddCut(qualityCuts);
+    cut->AddCut(pidCuts);
+    return cut;
+  });
+
+  compositeCuts.emplace("Electron2025_3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* kineCut = new AnalysisCut("kineCut", "kine cut");
+    kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
+    kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
+
+    auto* qualityCuts = new AnalysisCut("qualityCuts", "quality cuts");
+    qualityCuts->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    qualityCuts->AddCut(VarManager::kTPCncls, 70, 161.);
+    qualityCuts->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
+
+    auto* pidCuts = new AnalysisCut("pidCuts", "pid cuts");
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -2.5, 4.0, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -2.0, 4.0, false, VarManager::kPin, 5.0, 1000.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999, false, VarManager::kPin, 0.0, 5.0);
+
+    cut->AddCut(kineCut);
+    cut->AddCut(qualityCuts);
+    cut->AddCut(pidCuts);
+    return cut;
+  });
+
+  compositeCuts.emplace("Electron2025_4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* kineCut = new AnalysisCut("kineCut", "kine cut");
+    kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
+    kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
+
+    auto* qualityCuts = new AnalysisCut("qualityCuts", "quality cuts");
+    qualityCuts->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    qualityCuts->AddCut(VarManager::kTPCncls, 70, 161.);
+    qualityCuts->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
+
+    auto* pidCuts = new AnalysisCut("pidCuts", "pid cuts");
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -2.5, 4.0, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0, false, VarManager::kPin, 5.0, 1000.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999, false, VarManager::kPin, 0.0, 5.0);
+
+    cut->AddCut(kineCut);
+    cut->AddCut(qualityCuts);
+    cut->AddCut(pidCuts);
+    return cut;
+  });
+
+  compositeCuts.emplace("Electron2025_5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* kineCut = new AnalysisCut("kineCut", "kine cut");
+    kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
+    kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
+
+    auto* qualityCuts = new AnalysisCut("qualityCuts", "quality cuts");
+    qualityCuts->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    qualityCuts->AddCut(VarManager::kTPCncls, 70, 161.);
+    qualityCuts->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
+
+    auto* pidCuts = new AnalysisCut("pidCuts", "pid cuts");
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -2.25, 4.0, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0, false, VarManager::kPin, 5.0, 1000.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999, false, VarManager::kPin, 0.0, 5.0);
+
+    cut->AddCut(kineCut);
+    cut->AddCut(qualityCuts);
+    cut->AddCut(pidCuts);
+    return cut;
+  });
+
+  compositeCuts.emplace("Electron2025_4_ldong", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* kineCut = new AnalysisCut("kineCut", "kine cut");
+    kineCut->AddCut(VarManager::kP, 1.0, 1000.0);
+    kineCut->AddCut(VarManager::kEta, -0.9, 0.9);
+
+    auto* qualityCuts = new AnalysisCut("qualityCuts", "quality cuts");
+    qualityCuts->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kITSchi2, 0.0, 5.0);
+    qualityCuts->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    qualityCuts->AddCut(VarManager::kTPCncls, 70, 161.);
+    qualityCuts->AddCut(VarManager::kTrackDCAz, -0.5, 0.5);
+    qualityCuts->AddCut(VarManager::kTrackDCAxy, -0.5, 0.5);
+
+    auto* pidCuts = new AnalysisCut("pidCuts", "pid cuts");
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -2.5, 4.0, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaEl, -1.5, 4.0, false, VarManager::kPin, 5.0, 1000.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPi, 2.7, 999, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPi, 2.7, 999, false, VarManager::kPin, 5.0, 1000.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999, false, VarManager::kPin, 0.0, 5.0);
+    pidCuts->AddCut(VarManager::kTPCnSigmaPr, 2.7, 999, false, VarManager::kPin, 5.0, 1000.0);
+
+    cut->AddCut(kineCut);
+    cut->AddCut(qualityCuts);
+    cut->AddCut(pidCuts);
+    return cut;
+  });
+
+  compositeCuts.emplace("LowMassElectron2023", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("LooseGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TOFloose_pionrej"));
+    return cut;
+  });
+
+  compositeCuts.emplace("MuonLow2022", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("MuonHigh2022", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("MuonLow2023", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("MuonHigh2023", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt6"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("ElectronForEMu", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaLoose"));
+    return cut;
+  });
+
+  compositeCuts.emplace("MuonForEMu", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt5"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPID1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiBenchmarkCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityBenchmark"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts2_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts2_prefiltered1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
+    cut->AddCut(GetAnalysisCut("notDalitzLeg1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaLoose"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection1_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiKineDcaQualitynoPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiKineDcaQualitynoPID2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection1_ionut_withTOFPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium_withLargeTOFPID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection1_idstoreh", [](const char* cutName) -> AnalysisCompositeCut* { // same as electronSelection1_ionut, but with kIsSPDAny -> kIsITSibAny
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection1pos_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection1neg_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection2_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    cut->AddCut(GetAnalysisCut("insideTPCsector"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection2pos_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    cut->AddCut(GetAnalysisCut("insideTPCsector"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronSelection2neg_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaMedium"));
+    cut->AddCut(GetAnalysisCut("insideTPCsector"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts4_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaVeryLoose"));
+
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaVeryVeryLoose"));
+
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts7", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
+
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts7_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
+
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts7_noCorr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5_noCorr"));
+
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts7_Corr_2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine2"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
+
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts7_Corr_3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine3"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
+
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts8", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPID1shiftUp"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts9", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPID1shiftDown"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts10_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts10_Corr_Amb", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    cut->AddCut(GetAnalysisCut("ambiguousTrack")); // IsAmbiguous
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts11_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug3")); // cut on 1 ITS cluster
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts12", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaVeryLoose"));     // with 3 sigma El TOF
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts_Pdependent_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("pidCut_lowP_Corr"));
+
+    auto* pidCut_highP = new AnalysisCompositeCut("pidCut_highP", "pidCut_highP", kFALSE);
+    pidCut_highP->AddCut(GetAnalysisCut("EleInclusion_highP_Corr"));
+    pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP_Corr"));
+    cut->AddCut(pidCut_highP);
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts_Pdependent", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("pidCut_lowP"));
+
+    auto* pidCut_highP = new AnalysisCompositeCut("pidCut_highP", "pidCut_highP", kFALSE);
+    pidCut_highP->AddCut(GetAnalysisCut("EleInclusion_highP"));
+    pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP"));
+    cut->AddCut(pidCut_highP);
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts_Pdependent2_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("pidCut_lowP_Corr"));
+
+    auto* pidCut_highP = new AnalysisCompositeCut("pidCut_highP", "pidCut_highP", kFALSE);
+    pidCut_highP->AddCut(GetAnalysisCut("EleInclusion_highP2_Corr"));
+    pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP_Corr"));
+    cut->AddCut(pidCut_highP);
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts_Pdependent2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine4"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("pidCut_lowP"));
+
+    auto* pidCut_highP = new AnalysisCompositeCut("pidCut_highP", "pidCut_highP", kFALSE);
+    pidCut_highP->AddCut(GetAnalysisCut("EleInclusion_highP2"));
+    pidCut_highP->AddCut(GetAnalysisCut("PionExclusion_highP"));
+    cut->AddCut(pidCut_highP);
+    return cut;
+  });
+
+  compositeCuts.emplace("JpsiPWGSkimmedCuts1", [](const char* cutName) -> AnalysisCompositeCut* { // please do not remove or modify, this is used for the common Skimmed tree production, (Xiaozhi Bai)
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed"));
+    cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed"));
+    return cut;
+  });
+
+  compositeCuts.emplace("JpsiPWGSkimmedCuts2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed"));
+    cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("JpsiPWGSkimmedCuts3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed2"));
+    cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("JpsiPWGSkimmedCuts4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed2"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug9")); // loose cut
+    return cut;
+  });
+
+  compositeCuts.emplace("JpsiPWGSkimmedCuts5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("electronTrackQualitySkimmed3"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug8"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pidElectron_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_ele"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pidElectron_ionut_posEta", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_ele"));
+    cut->AddCut(GetAnalysisCut("jpsiPIDcalibKine_posEta"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pidElectron_ionut_negEta", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_ele"));
+    cut->AddCut(GetAnalysisCut("jpsiPIDcalibKine_negEta"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pidPion_ionut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_pion"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts13_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly")); // no cut on ITS clusters
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA")); // with DCA cut
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts14", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2MCdebugCuts14andDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
+    return cut;
+  });
+
+  compositeCuts.emplace("emu_electronCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
+    return cut;
+  });
+
+  compositeCuts.emplace("emu_electronCuts_tof", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed"));
+    cut->AddCut(GetAnalysisCut("tof_electron_sigma_2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("emu_electronCuts_tightTPC", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed_2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("emu_electronCuts_tof_tightTPC", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaSkewed_2"));
+    cut->AddCut(GetAnalysisCut("tof_electron_sigma_2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiKineAndQuality", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiPID1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine")); // standard kine cuts usually are applied via Filter in the task
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPID1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiPID2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPID2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiPIDnsigma", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionPIDCut1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionQualityCut1"));
+    cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionPIDCut2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionQualityCut2"));
+    cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDCalibElectron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_ele"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDCalibPion", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_pion"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDCalibKaon", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_kaon"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDCalibProton", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidcalib_proton"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDCalib_basic", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pidbasic"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDefficiency_wPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("pidcalib_ele"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDefficiency_woPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("pidcalib_ele"));
+    return cut;
+  });
+
+  compositeCuts.emplace("highPtHadron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("highPtHadron"));
+    return cut;
+  });
+
+  compositeCuts.emplace("rho0Cuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("rho0Kine"));
+    cut->AddCut(GetAnalysisCut("pionQuality"));
+    cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("rho0Kine", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("rho0Kine"));
+    return cut;
+  });
+
+  compositeCuts.emplace("openEtaSel", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("openEtaSel"));
+    return cut;
+  });
+
+  compositeCuts.emplace("hasTOF", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("hasTOF"));
+    return cut;
+  });
+
+  compositeCuts.emplace("singleGapTrackCuts1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("SPDany"));
+    cut->AddCut(GetAnalysisCut("openEtaSel"));
+    cut->AddCut(GetAnalysisCut("pionQuality"));
+    return cut;
+  });
+
+  compositeCuts.emplace("singleGapTrackCuts2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt3"));
+    cut->AddCut(GetAnalysisCut("ITSiball"));
+    cut->AddCut(GetAnalysisCut("openEtaSel"));
+    cut->AddCut(GetAnalysisCut("pionQuality"));
+    return cut;
+  });
+
+  compositeCuts.emplace("singleGapTrackCuts3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine2"));
+    cut->AddCut(GetAnalysisCut("SPDany"));
+
+    auto* cut_notpc = new AnalysisCompositeCut("NoTPC", "NoTPC", kTRUE);
+    cut_notpc->AddCut(GetAnalysisCut("noTPC"));
+
+    auto* cut_tpcpid = new AnalysisCompositeCut("pid_TPC", "pid_TPC", kTRUE);
+    cut_tpcpid->AddCut(GetAnalysisCut("pionQuality"));
+
+    auto* cut_OR = new AnalysisCompositeCut("OR", "OR", kFALSE);
+    cut_OR->AddCut(cut_notpc);
+    cut_OR->AddCut(cut_tpcpid);
+    cut->AddCut(cut_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("singleGapTrackCuts4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine2"));
+    cut->AddCut(GetAnalysisCut("ITSibany"));
+
+    auto* cut_notpc = new AnalysisCompositeCut("NoTPC", "NoTPC", kTRUE);
+    cut_notpc->AddCut(GetAnalysisCut("noTPC"));
+
+    auto* cut_tpcpid = new AnalysisCompositeCut("pid_TPC", "pid_TPC", kTRUE);
+    cut_tpcpid->AddCut(GetAnalysisCut("pionQuality"));
+
+    auto* cut_OR = new AnalysisCompositeCut("OR", "OR", kFALSE);
+    cut_OR->AddCut(cut_notpc);
+    cut_OR->AddCut(cut_tpcpid);
+    cut->AddCut(cut_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("PIDCalib", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("pidcalib_ele"));
+    return cut;
+  });
+
+  compositeCuts.emplace("NoPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine2")); // standard kine cuts usually are applied via Filter in the task
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly2"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    return cut;
+  });
+
+  compositeCuts.emplace("KineCutOnly", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
+    return cut;
+  });
+
+  compositeCuts.emplace("KineCutOnly2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine2")); // standard kine cuts usually are applied via Filter in the task
+    return cut;
+  });
+
+  compositeCuts.emplace("KineCutOnly3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine3")); // standard kine cuts usually are applied via Filter in the task
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("kaonPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPID2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PIDStandardKine")); // standard kine cuts usually are applied via Filter in the task
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("kaonPIDnsigma2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPID3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("AssocKine")); // standard kine cuts usually are applied via Filter in the task
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPID3_withDCA", [](const char* cutName) -> AnalysisCompositeCut* { // same as kaonPID3 but with cut on DCA and SPDAny->ITSAny
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("AssocKine")); // standard kine cuts usually are applied via Filter in the task
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug4"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPID4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPID5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("kaonPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPID6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("kaonPIDnsigma700"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPIDTPCTOForTPC", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* cut_tpctof_nSigma = new AnalysisCompositeCut("pid_TPCTOFnSigma", "pid_TPCTOFnSigma", kTRUE);
+    cut_tpctof_nSigma->AddCut(GetAnalysisCut("hasTOF"));
+    cut_tpctof_nSigma->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+
+    auto* cut_tpc_nSigma = new AnalysisCompositeCut("pid_TPCnSigma", "pid_TPCnSigma", kTRUE);
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("noTOF"));
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("kaonPIDnsigma"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("kaon_nsigma", "kaon_nsigma", kFALSE);
+    cut_pid_OR->AddCut(cut_tpctof_nSigma);
+    cut_pid_OR->AddCut(cut_tpc_nSigma);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPIDTPCTOForTPC700", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* cut_tpctof_nSigma = new AnalysisCompositeCut("pid_TPCTOFnSigma", "pid_TPCTOFnSigma", kTRUE);
+    cut_tpctof_nSigma->AddCut(GetAnalysisCut("hasTOF"));
+    cut_tpctof_nSigma->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+
+    auto* cut_tpc_nSigma = new AnalysisCompositeCut("pid_TPCnSigma", "pid_TPCnSigma", kTRUE);
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("noTOF"));
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("kaonPIDnsigma700"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("kaon_nsigma", "kaon_nsigma", kFALSE);
+    cut_pid_OR->AddCut(cut_tpctof_nSigma);
+    cut_pid_OR->AddCut(cut_tpc_nSigma);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPosPID4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonPosPID4Pt05", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonNegPID4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("kaonNegPID4Pt05", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("kaonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionPID2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionPIDTPCTOForTPC", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* cut_tpctof_nSigma = new AnalysisCompositeCut("pid_TPCTOFnSigma", "pid_TPCTOFnSigma", kTRUE);
+    cut_tpctof_nSigma->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
+
+    auto* cut_tpc_nSigma = new AnalysisCompositeCut("pid_TPCnSigma", "pid_TPCnSigma", kTRUE);
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("pionPIDnsigma"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("pion_nsigma", "pion_nsigma", kFALSE);
+    cut_pid_OR->AddCut(cut_tpctof_nSigma);
+    cut_pid_OR->AddCut(cut_tpc_nSigma);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("pionPosPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionPosPID2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionNegPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pionNegPID2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pionPIDnsigma"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("protonPosPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("protonPosPIDPt05", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    return cut;
+  });
+
+  compositeCuts.emplace("protonNegPID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("protonNegPIDPt05", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    return cut;
+  });
+
+  compositeCuts.emplace("protonPIDPV", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF2"));
+    cut->AddCut(GetAnalysisCut("protonPVcut"));
+    return cut;
+  });
+
+  compositeCuts.emplace("protonPIDPV2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("protonPID_TPCnTOF2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("PrimaryTrack_DCAz", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
+    return cut;
+  });
+
+  compositeCuts.emplace("posPrimaryTrack_DCAz", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("negPrimaryTrack_DCAz", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("posStandardPrimaryTrackDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("negStandardPrimaryTrackDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("posTrack", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("negTrack", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("posTrackKaonRej", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    cut->AddCut(GetAnalysisCut("kaonRejNsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("negTrackKaonRej", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    cut->AddCut(GetAnalysisCut("kaonRejNsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pTLow05", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pTLow04", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pTLow04"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pTLow03", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pTLow03"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pTLow02", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pTLow02"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pTLow05DCAzHigh03", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pTLow04DCAzHigh03", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pTLow04"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pTLow03DCAzHigh03", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pTLow03"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_DCAz"));
+    return cut;
+  });
+
+  // NOTE Below there are several TPC pid cuts used for studies of the Run3 TPC post PID calib.
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_noITSCuts_debug2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_noITSCuts_debug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_noITSCuts_debug4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_noITSCuts_debug"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug2"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug6"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug7", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug2"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug7"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug8", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug5"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug8"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug9", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug4"));
+    cut->AddCut(GetAnalysisCut("electronPIDLooseSkimmed3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Jpsi_TPCPost_calib_debug10", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiKineSkimmed"));
+    cut->AddCut(GetAnalysisCut("jpsi_trackCut_debug6"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug10"));
+    return cut;
+  });
+
+  compositeCuts.emplace("LMee_TPCPost_calib_debug1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmee_trackCut_debug"));
+    cut->AddCut(GetAnalysisCut("lmee_TPCPID_debug1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("ITSalone_prefilter", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("ITSalonebAny_prefilter", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualitybAnyITSOnly"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("TPCalone_prefilter", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("ITSTPC_prefilter", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeePrefilterKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization111", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID111 = new AnalysisCompositeCut("magnus_PID111", "");
+    magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID111->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID111);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization211", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID211 = new AnalysisCompositeCut("magnus_PID211", "");
+    magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID211->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID211);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization311", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID311 = new AnalysisCompositeCut("magnus_PID311", "");
+    magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
+    magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID311->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID311);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization121", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID121 = new AnalysisCompositeCut("magnus_PID121", "");
+    magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID121->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID121);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization112", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID112 = new AnalysisCompositeCut("magnus_PID112", "");
+    magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID112->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID112);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization122", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID122 = new AnalysisCompositeCut("magnus_PID122", "");
+    magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID122->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID122);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization222", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID222 = new AnalysisCompositeCut("magnus_PID222", "");
+    magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID222->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID222);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization212", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID212 = new AnalysisCompositeCut("magnus_PID212", "");
+    magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID212->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID212);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization221", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID221 = new AnalysisCompositeCut("magnus_PID221", "");
+    magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_ele2"));
+    magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID221->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID221);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization321", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID321 = new AnalysisCompositeCut("magnus_PID321", "");
+    magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
+    magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID321->AddCut(GetAnalysisCut("pidJpsi_magnus_prot1"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID321);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization312", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID312 = new AnalysisCompositeCut("magnus_PID312", "");
+    magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_ele3"));
+    magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_pion1"));
+    magnus_PID312->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID312);
+    return cut;
+  });
+
+  compositeCuts.emplace("MagnussOptimization322", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* magnus_PID322 = new AnalysisCompositeCut("magnus_PID322", "");
+    magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_ele1"));
+    magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_pion2"));
+    magnus_PID322->AddCut(GetAnalysisCut("pidJpsi_magnus_prot2"));
+    cut->AddCut(GetAnalysisCut("kineJpsiEle_ionut"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("trackQuality_ionut"));
+    cut->AddCut(magnus_PID322);
+    return cut;
+  });
+
+  //---------------------------------------------------------------
+  // Cuts for the selection of legs from dalitz decay
+  //
+  compositeCuts.emplace("DalitzCut1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("electronPIDOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut2_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej_Corr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut3_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose_Corr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut1SPDfirst", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+    cut->AddCut(GetAnalysisCut("electronPIDOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut1SPDfirst_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+    cut->AddCut(GetAnalysisCut("electronPIDOnly_Corr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut2SPDfirst", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut2SPDfirst_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRej_Corr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut3SPDfirst", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DalitzCut3SPDfirst_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+    cut->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose_Corr"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Dalitz_WithTOF_SPDfirst", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+
+    auto* cut_tpc_nSigma = new AnalysisCompositeCut("pid_TPCnSigma", "pid_TPCnSigma", kTRUE);
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose"));
+
+    auto* cut_tof_nSigma = new AnalysisCompositeCut("pid_TOFnSigma", "pid_TOFnSigma", kTRUE);
+    cut_tof_nSigma->AddCut(GetAnalysisCut("electronPID_TOFnsigma"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("e_NSigma", "e_NSigma", kFALSE);
+    cut_pid_OR->AddCut(cut_tpc_nSigma);
+    cut_pid_OR->AddCut(cut_tof_nSigma);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("Dalitz_WithTOF_SPDfirst_Corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("dalitzStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityITSOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+
+    auto* cut_tpc_nSigma = new AnalysisCompositeCut("pid_TPCnSigma", "pid_TPCnSigma", kTRUE);
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("electronPIDPrKaPiRejLoose_Corr"));
+
+    auto* cut_tof_nSigma = new AnalysisCompositeCut("pid_TOFnSigma", "pid_TOFnSigma", kTRUE);
+    cut_tof_nSigma->AddCut(GetAnalysisCut("electronPID_TOFnsigma_Corr"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("e_NSigma", "e_NSigma", kFALSE);
+    cut_pid_OR->AddCut(cut_tpc_nSigma);
+    cut_pid_OR->AddCut(cut_tof_nSigma);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("electronPrimaryTag0", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    // with tight 3 sigma DCA cut for selecting primary electrons
+    cut->AddCut(GetAnalysisCut("electronPID_TPCnsigma_loose")); // 3 sigma inclusion, 3sigma rejection
+    cut->AddCut(GetAnalysisCut("electronPrimary_dca3sigma"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronPrimaryTag1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    // with 7 sigma DCA cut for selecting primary electrons
+    cut->AddCut(GetAnalysisCut("electronPID_TPCnsigma_loose")); // 3 sigma inclusion, 3sigma rejection
+    cut->AddCut(GetAnalysisCut("electronPrimary_dca7sigma"));
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronPrimaryProbe_TPC", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronPrimaryProbe_ITS", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("electronStandardQualitybAnyITSOnly"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA"));
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    return cut;
+  });
+
+  compositeCuts.emplace("electronPrimaryProbe_ITSTPC", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualitybAnyITSOnly"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCA"));
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiPIDworseRes", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPIDworseRes"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiPIDshift", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPIDshift"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiPID1shiftUp", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPID1shiftUp"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiPID1shiftDown", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQuality"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    cut->AddCut(GetAnalysisCut("electronPID1shiftDown"));
+    return cut;
+  });
+
+  // -------------------------------------------------------------------------------------------------
+  //
+  // Q vector contributor cut
+  // NOTE: this cut used to be built without being returned, ending in the fatal for unknown cuts
+  //
+  compositeCuts.emplace("selTPCCentral", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* kineCut = new AnalysisCut("kineCut", "kine cut");
+    kineCut->AddCut(VarManager::kEta, -0.8, 0.8);
+    kineCut->AddCut(VarManager::kPt, 0.15, 5);
+
+    auto* qualityCuts = new AnalysisCut("qualityCuts", "quality cuts");
+    qualityCuts->AddCut(VarManager::kTPCchi2, 0., 4.);
+    qualityCuts->AddCut(VarManager::kTPCnCRoverFindCls, 0.8, 1.);
+    qualityCuts->AddCut(VarManager::kIsITSibAny, 0.5, 1.5);
+    qualityCuts->AddCut(VarManager::kITSchi2, 0., 36.);
+
+    auto* dcaCuts = new AnalysisCut("dcaCuts", "DCA cuts");
+    std::shared_ptr<TF1> f1dcaxyHigh = std::make_shared<TF1>("f1dcaxy", "[0]+[1]/pow(x,[2])", 0., 10.);
+    f1dcaxyHigh->SetParameters(0.0105, 0.035, 1.1);
+    std::shared_ptr<TF1> f1dcaxyLow = std::make_shared<TF1>("f1dcaxy_low", "[0]+[1]/pow(x,[2])", 0., 10.);
+    f1dcaxyLow->SetParameters(-0.0105, -0.035, 1.1);
+    dcaCuts->AddCut(VarManager::kTrackDCAxy, f1dcaxyLow, f1dcaxyHigh);
+    dcaCuts->AddCut(VarManager::kTrackDCAz, -2., 2.);
+
+    cut->AddCut(kineCut);
+    cut->AddCut(qualityCuts);
+    cut->AddCut(dcaCuts);
+    return cut;
+  });
+
+  // -------------------------------------------------------------------------------------------------
+  //
+  // LMee cuts
+  // List of cuts used for low mass dielectron analyses
+  //
+  // Skimming cuts:
+  compositeCuts.emplace("lmee_skimming", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmee_skimming_cuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmeePID_TPChadrejTOFrec", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+
+    auto* cut_tpc_hadrej = new AnalysisCompositeCut("pid_TPChadrej", "pid_TPChadrej", kTRUE);
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_electron"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_pion_rejection"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_kaon_rejection"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_proton_rejection"));
+
+    auto* cut_tof_rec = new AnalysisCompositeCut("pid_tof_rec", "pid_tof_rec", kTRUE);
+    cut_tof_rec->AddCut(GetAnalysisCut("tpc_electron"));
+    cut_tof_rec->AddCut(GetAnalysisCut("tof_electron"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("pid_TPChadrejTOFrec", "pid_TPChadrejTOFrec", kFALSE);
+    cut_pid_OR->AddCut(cut_tpc_hadrej);
+    cut_pid_OR->AddCut(cut_tof_rec);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("lmeePID_TPChadrej", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+
+    auto* cut_tpc_hadrej = new AnalysisCompositeCut("pid_TPChadrej", "pid_TPChadrej", kTRUE);
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_electron"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_pion_rejection"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_kaon_rejection"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_proton_rejection"));
+    cut->AddCut(cut_tpc_hadrej);
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_eNSigmaRun2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+
+    auto* cut_tpc_nSigma = new AnalysisCompositeCut("pid_TPCnSigma", "pid_TPCnSigma", kTRUE);
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("electronPID_TPCnsigma"));
+
+    auto* cut_tof_nSigma = new AnalysisCompositeCut("pid_TOFnSigma", "pid_TOFnSigma", kTRUE);
+    cut_tof_nSigma->AddCut(GetAnalysisCut("electronPID_TOFnsigma"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("e_NSigma", "e_NSigma", kFALSE);
+    cut_pid_OR->AddCut(cut_tpc_nSigma);
+    cut_pid_OR->AddCut(cut_tof_nSigma);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("lmeePID_TOFrec", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+
+    auto* cut_tof_rec = new AnalysisCompositeCut("pid_tof_rec", "pid_tof_rec", kTRUE);
+    cut_tof_rec->AddCut(GetAnalysisCut("tpc_electron"));
+    cut_tof_rec->AddCut(GetAnalysisCut("tof_electron"));
+
+    cut->AddCut(cut_tof_rec);
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_GlobalTrackRun2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_GlobalTrackRun2_lowPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_TPCTrackRun2_lowPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
+    cut->AddCut(GetAnalysisCut("TightTPCTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_TPCTrackRun2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightTPCTrack"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmeePID_TPChadrejTOFrecRun3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+
+    auto* cut_tpc_hadrej = new AnalysisCompositeCut("pid_TPChadrej", "pid_TPChadrej", kTRUE);
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_electron"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_pion_muon_band_rejection"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_pion_rejection_highp"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_kaon_rejection"));
+    cut_tpc_hadrej->AddCut(GetAnalysisCut("tpc_proton_rejection"));
+
+    auto* cut_tof_rec = new AnalysisCompositeCut("pid_tof_rec", "pid_tof_rec", kTRUE);
+    cut_tof_rec->AddCut(GetAnalysisCut("tpc_electron"));
+    cut_tof_rec->AddCut(GetAnalysisCut("tof_electron_loose"));
+    cut_tof_rec->AddCut(GetAnalysisCut("tpc_pion_rejection_highp"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("pid_TPChadrejTOFrec", "pid_TPChadrejTOFrec", kFALSE);
+    cut_pid_OR->AddCut(cut_tpc_hadrej);
+    cut_pid_OR->AddCut(cut_tof_rec);
+    cut->AddCut(cut_pid_OR);
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_Run3_TPCelectron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
+    cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TPCPbPbnopkrej"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_Run3_TOFelectron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
+    cut->AddCut(GetAnalysisCut("tof_electron_sigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_Run3_posTrack_TPCelectron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
+    cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TPCPbPbnopkrej"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_Run3_posTrack_TOFelectron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("posTrack"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
+    cut->AddCut(GetAnalysisCut("tof_electron_sigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_Run3_negTrack_TPCelectron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
+    cut->AddCut(GetAnalysisCut("lmee_pp_502TeV_TPCPbPbnopkrej"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_Run3_negTrack_TOFelectron", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("negTrack"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("standardPrimaryTrackDCAz"));
+    cut->AddCut(GetAnalysisCut("tof_electron_sigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("testCut_chic", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine5"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityForO2MCdebug"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_GlobalTrackRun3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_GlobalTrackRun3_lowPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
+    cut->AddCut(GetAnalysisCut("TightGlobalTrackRun3"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_TPCTrackRun3_lowPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeLowBKine"));
+    cut->AddCut(GetAnalysisCut("TightTPCTrackRun3"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("lmee_TPCTrackRun3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("TightTPCTrackRun3"));
+    cut->AddCut(GetAnalysisCut("PrimaryTrack_looseDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("trackCut_compareDQEMframework", [](const char* cutName) -> AnalysisCompositeCut* { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("lmeeStandardKine"));
+    cut->AddCut(GetAnalysisCut("trackQuality_compareDQEMframework"));
+    cut->AddCut(GetAnalysisCut("trackDCA1cm"));
+    auto* cut_tpc_nSigma = new AnalysisCompositeCut("pid_TPCnSigma", "pid_TPCnSigma", kTRUE);
+    cut_tpc_nSigma->AddCut(GetAnalysisCut("lmee_commonDQEM_PID_TPC"));
+
+    auto* cut_tof_nSigma = new AnalysisCompositeCut("pid_TOFnSigma", "pid_TOFnSigma", kTRUE);
+    cut_tof_nSigma->AddCut(GetAnalysisCut("lmee_commonDQEM_PID_TOF"));
+
+    auto* cut_pid_OR = new AnalysisCompositeCut("e_NSigma", "e_NSigma", kFALSE);
+    cut_pid_OR->AddCut(cut_tpc_nSigma);
+    cut_pid_OR->AddCut(cut_tof_nSigma);
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsi_debug_TPCTOF3_rejBadTOF", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine5"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTPCOnly3"));
+    cut->AddCut(GetAnalysisCut("SPDfirst"));
+    cut->AddCut(GetAnalysisCut("dcaCut1_ionut"));
+    cut->AddCut(GetAnalysisCut("pidJpsi_TPCpion0"));
+    cut->AddCut(GetAnalysisCut("pidJpsi_beta"));
+    cut->AddCut(GetAnalysisCut("pidJpsi_noTOF_prot"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairPhiV", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* cut_pairPhiV = new AnalysisCompositeCut("cut_pairPhiV", "cut_pairPhiV", kTRUE);
+    cut_pairPhiV->AddCut(GetAnalysisCut("pairLowMass"));
+    cut_pairPhiV->AddCut(GetAnalysisCut("pairPhiV"));
+    cut->AddCut(cut_pairPhiV);
+    return cut;
+  });
+
+  compositeCuts.emplace("excludePairPhiV", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    auto* cut_pairlowPhiV = new AnalysisCompositeCut("cut_pairlowPhiV", "cut_pairlowPhiV", kFALSE);
+    cut_pairlowPhiV->AddCut(GetAnalysisCut("excludePairLowMass"));
+    cut_pairlowPhiV->AddCut(GetAnalysisCut("excludePairPhiV"));
+    cut->AddCut(cut_pairlowPhiV);
+    return cut;
+  });
+}
@@ -0,0 +1,508 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file CutsLibraryBarrelPID.cxx
+/// \brief Library of barrel track PID cuts with fixed names, registered for the lookup in CutsLibrary.cxx
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/CutsLibrary.h"
+#include "PWGDQ/Core/CutsLibraryRegistry.h"
+#include "PWGDQ/Core/VarManager.h"
+
+#include <TF1.h>
+
+#include <memory>
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterBarrelPIDAnalysisCuts(AnalysisCutRegistry& analysisCuts)
+{
+  // ------------------------------------------------
+  // Barrel PID cuts
+  analysisCuts.emplace("jpsi_TPCPID_debug1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.0, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.5, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.5, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -4.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug5_noCorr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDLooseSkimmed", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDLooseSkimmed2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 999, false, VarManager::kPin, 0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 1.5, 999, false, VarManager::kPin, 3.0, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999, false, VarManager::kPin, 0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 1.5, 999, false, VarManager::kPin, 3.0, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDLooseSkimmed3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999, false, VarManager::kPin, 0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999, false, VarManager::kPin, 0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug7", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug8", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0, false, VarManager::kPin, 0.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0, false, VarManager::kPin, 3.0, 999.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999, false, VarManager::kPin, 0.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 999, false, VarManager::kPin, 5.0, 999.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 999, false, VarManager::kPin, 3.0, 999.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug9", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.5, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 1.0, 999, false, VarManager::kPin, 3.0, 999.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.0, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_debug10", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.5, 2.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 4.0, 999);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 999);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidCut_lowP_Corr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0, false, VarManager::kP, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999, false, VarManager::kP, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999, false, VarManager::kP, 0.0, 5.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("EleInclusion_highP_Corr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -1.0, 4.0, false, VarManager::kP, 5.0, 999.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("EleInclusion_highP2_Corr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -0.5, 4.0, false, VarManager::kP, 5.0, 999.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("PionExclusion_highP_Corr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.0, 999, false, VarManager::kP, 5.0, 999.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pidCut_lowP", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0, false, VarManager::kP, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 999, false, VarManager::kP, 0.0, 5.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 999, false, VarManager::kP, 0.0, 5.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("EleInclusion_highP", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 4.0, false, VarManager::kP, 5.0, 999.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("EleInclusion_highP2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -0.5, 4.0, false, VarManager::kP, 5.0, 999.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("PionExclusion_highP", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 999, false, VarManager::kP, 5.0, 999.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmee_TPCPID_debug1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -5.0, 5.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigma", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmee_commonDQEM_PID_TPC", [](const char* cutName) -> AnalysisCut* { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.5, 3., false, VarManager::kPin, 0.0, 1e+10, false);
+    cut->AddCut(VarManager::kTPCnSigmaPi, -1e12, 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3., 3., true, VarManager::kPin, 0.0, 1e+10, false);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -3., 3., true, VarManager::kPin, 0.0, 1e+10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("lmee_commonDQEM_PID_TOF", [](const char* cutName) -> AnalysisCut* { // cut setting to check least common factor between reduced data sets of PWGEM and PWGDQ
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.5, 3., false, VarManager::kPin, 0.0, 1e+10, false);
+    cut->AddCut(VarManager::kTPCnSigmaPi, -3., 3.5, true, VarManager::kPin, 0.0, 1e+10, false);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.3, 1e+10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaOpen", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.0, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaVeryVeryLoose", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.0, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaVeryLoose", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -4.0, 4.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 3000.0);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3., false, VarManager::kPin, 0.4, 1e+10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaLoose", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.5, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.5, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaMedium", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.7, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.7, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaMedium_withLargeTOFPID", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 2.7, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 2.7, 3000.0);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -5.0, 5.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaSkewed", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -2.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaSkewed_2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -0.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDPrKaPiRej", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -3.0, 3.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDPrKaPiRej_Corr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -3.0, 3.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -3.0, 3.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDPrKaPiRejLoose", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -2.0, 2.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0, true, VarManager::kPin, 0.0, 1.0, false);
+    cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 2.0, true, VarManager::kPin, 0.0, 1.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDPrKaPiRejLoose_Corr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, -2.0, 2.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -3.0, 3.0, true, VarManager::kPin, 0.0, 1.0, false);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, -3.0, 2.0, true, VarManager::kPin, 0.0, 1.0, true);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDnsigmaEMu", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -1.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.5, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.5, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaKa, 3.5, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("kaonPIDnsigma", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("kaonRejNsigma", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("kaonPIDnsigma2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -2.0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("kaonPID_TPCnTOF", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0);
+    cut->AddCut(VarManager::kTOFnSigmaKa, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("kaonPIDnsigma700", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaKa, -3.0, 3.0);
+    cut->AddCut(VarManager::kPin, 0.0, 0.7);
+    return cut;
+  });
+
+  analysisCuts.emplace("AssocKine", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    cut->AddCut(VarManager::kEta, -0.9, 0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDworseRes", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0 * 0.8, 3000.0); // emulates a 20% degradation in PID resolution
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0 * 0.8, 3000.0); // proton and pion rejections are effectively relaxed by 20%
+    return cut;
+  });
+
+  analysisCuts.emplace("electronPIDshift", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl, -3.0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr, 3.0 - 0.2, 3000.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi, 3.0 - 0.2, 3000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pionPIDnsigma", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pionPID_TPCnTOF", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPi, -3.0, 3.0);
+    cut->AddCut(VarManager::kTOFnSigmaPi, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("protonPID_TPCnTOF", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -3.0, 3.0);
+    cut->AddCut(VarManager::kTOFnSigmaPr, -3.0, 3.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("protonPID_TPCnTOF2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaPr, -2.5, 2.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("tpc_pion_rejection", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> f1maxPi = std::make_shared<TF1>("f1maxPi", "[0]+[1]*x", 0, 10);
+    f1maxPi->SetParameters(85, -50);
+    cut->AddCut(VarManager::kTPCsignal, 70, f1maxPi, true, VarManager::kPin, 0.0, 0.4, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tpc_pion_band_rejection", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> f1minPi = std::make_shared<TF1>("f1minPi", "[0]+[1]*log(x)", 0, 10);
+    f1minPi->SetParameters(-115, -90);
+    std::shared_ptr<TF1> f1maxPi = std::make_shared<TF1>("f1maxPi", "[0]+[1]*log(x)", 0, 10);
+    f1maxPi->SetParameters(-70, -90);
+    cut->AddCut(VarManager::kTPCsignal, f1minPi, f1maxPi, true, VarManager::kPin, 0.05, 0.3, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tpc_pion_muon_band_rejection", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> f1minPi = std::make_shared<TF1>("f1minPi", "[0]+exp([1]*x+[2])", 0, 10);
+    f1minPi->SetParameters(37, -18, 5.5);
+    std::shared_ptr<TF1> f1maxPi = std::make_shared<TF1>("f1maxPi", "[0]+exp([1]*x+[2])", 0, 10);
+    f1maxPi->SetParameters(67, -17, 5.9);
+    cut->AddCut(VarManager::kTPCsignal, f1minPi, f1maxPi, true, VarManager::kPin, 0.0, 10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tpc_pion_rejection_highp", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> f1minPi = std::make_shared<TF1>("f1minPi", "[0]+[1]*x", 0, 10);
+    f1minPi->SetParameters(65, 4.);
+    cut->AddCut(VarManager::kTPCsignal, f1minPi, 110., false, VarManager::kPin, 0.0, 10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tpc_kaon_rejection", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> f1minKa = std::make_shared<TF1>("f1minKa", "[0]+exp([1]*x+[2])", 0, 10);
+    f1minKa->SetParameters(37, -4, 5.6);
+    std::shared_ptr<TF1> f1maxKa = std::make_shared<TF1>("f1maxKa", "[0]+exp([1]*x+[2])", 0, 10);
+    f1maxKa->SetParameters(60, -4.1, 6.);
+    cut->AddCut(VarManager::kTPCsignal, f1minKa, f1maxKa, true, VarManager::kPin, 0.0, 10.0, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tpc_proton_rejection", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> f1minPr = std::make_shared<TF1>("f1minPr", "[0]+exp([1]*x+[2])", 0, 10);
+    f1minPr->SetParameters(37, -2.6, 6.1);
+    std::shared_ptr<TF1> f1maxPr = std::make_shared<TF1>("f1maxPr", "[0]+exp([1]*x+[2])", 0, 10);
+    f1maxPr->SetParameters(60, -2.4, 6.2);
+    cut->AddCut(VarManager::kTPCsignal, f1minPr, f1maxPr, true, VarManager::kPin, 0.0, 10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tpc_electron", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCsignal, 60, 110, false, VarManager::kPin, 0.0, 1e+10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tof_electron", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFbeta, 0.99, 1.01, false, VarManager::kPin, 0.0, 1e+10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tof_electron_sigma", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -2., 2., false, VarManager::kPin, 0.0, 1e+10, false);
+    return cut;
+  });
+
+  analysisCuts.emplace("tof_electron_sigma_2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFnSigmaEl, -3., 3.);
+    return cut;
+  });
+
+  analysisCuts.emplace("tof_electron_loose", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTOFbeta, 0.95, 1.05, false, VarManager::kPin, 0.0, 1e+10, false);
+    return cut;
+  });
+}
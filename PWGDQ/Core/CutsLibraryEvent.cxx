@@ -0,0 +1,500 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file CutsLibraryEvent.cxx
+/// \brief Library of event cuts with fixed names, registered for the lookup in CutsLibrary.cxx
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/CutsLibrary.h"
+#include "PWGDQ/Core/CutsLibraryRegistry.h"
+#include "PWGDQ/Core/VarManager.h"
+
+#include <TF1.h>
+
+#include <RtypesCore.h>
+
+#include <memory>
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterEventAnalysisCuts(AnalysisCutRegistry& analysisCuts)
+{
+  // ---------------------------------------------------------------
+  // Event cuts
+  analysisCuts.emplace("noEventCut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventNoTFBorder", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventIsTVXTriggered", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsTVXTriggered, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandard", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsINT7, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardNoINT7", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardtest", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -30.0, 30.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSel8", [](const char* cutName) -> AnalysisCut* { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8", [](const char* cutName) -> AnalysisCut* { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8WithITSROFRecomputedCut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorderRecomputed, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8NoTFBorder", [](const char* cutName) -> AnalysisCut* { // Redundant w.r.t. eventStandardSel8, to be removed
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8NoTFBNoITSROFB", [](const char* cutName) -> AnalysisCut* { // Redundant w.r.t. eventStandardSel8, to be removed
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8NoTFBNoITSROFBrecomp", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorderRecomputed, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSel8NoSameBunch", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSel8TriggerZNAZNC", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsTriggerZNAZNC, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSel8TriggerZNAZNCNoPileUp", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsTriggerZNAZNC, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSel8NoSameBunchGoodZvtx", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbQuality", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8NoPileup", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kNoCollInTimeRangeStandard, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbQualityCent90", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbQualityGoodITSLayersAll", [](const char* cutName) -> AnalysisCut* { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodITSLayersAll, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbQualityTightTrackOccupancy", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
+    cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0., 1000);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbQualityFirmTrackOccupancy", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
+    cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0., 2000);
+
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbQualityLooseTrackOccupancy", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
+    cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0., 5000);
+
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbQualityTightTrackOccupancyCollInTime", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
+    cut->AddCut(VarManager::kTrackOccupancyInTimeRange, 0., 500);
+    cut->AddCut(VarManager::kNoCollInTimeRangeStandard, 0.5, 1.5);
+
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8ppQuality", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsVertexTOFmatched, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8ppQualityNoVtxZ", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsVertexTOFmatched, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8multAnalysis", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoTFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoITSROFBorder, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8VtxQuality1", [](const char* cutName) -> AnalysisCut* { // kIsSel8 = kIsTriggerTVX && kNoITSROFrameBorder && kNoTimeFrameBorder
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsVertexITSTPC, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsVertexTOFmatched, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardSel8PbPbMultCorr", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> fMultPVCutLow = std::make_shared<TF1>("fMultPVCutLow", "[0]+[1]*x+[2]*x*x+[3]*x*x*x+[4]*x*x*x*x - 3.5*([5]+[6]*x+[7]*x*x+[8]*x*x*x+[9]*x*x*x*x)", 0, 100);
+    fMultPVCutLow->SetParameters(3257.29, -121.848, 1.98492, -0.0172128, 6.47528e-05, 154.756, -1.86072, -0.0274713, 0.000633499, -3.37757e-06);
+    std::shared_ptr<TF1> fMultPVCutHigh = std::make_shared<TF1>("fMultPVCutHigh", "[0]+[1]*x+[2]*x*x+[3]*x*x*x+[4]*x*x*x*x + 3.5*([5]+[6]*x+[7]*x*x+[8]*x*x*x+[9]*x*x*x*x)", 0, 100);
+    fMultPVCutHigh->SetParameters(3257.29, -121.848, 1.98492, -0.0172128, 6.47528e-05, 154.756, -1.86072, -0.0274713, 0.000633499, -3.37757e-06);
+
+    std::shared_ptr<TF1> fMultCutLow = std::make_shared<TF1>("fMultCutLow", "[0]+[1]*x+[2]*x*x+[3]*x*x*x - 2.*([4]+[5]*x+[6]*x*x+[7]*x*x*x+[8]*x*x*x*x)", 0, 100);
+    fMultCutLow->SetParameters(1654.46, -47.2379, 0.449833, -0.0014125, 150.773, -3.67334, 0.0530503, -0.000614061, 3.15956e-06);
+    std::shared_ptr<TF1> fMultCutHigh = std::make_shared<TF1>("fMultCutHigh", "[0]+[1]*x+[2]*x*x+[3]*x*x*x + 3.*([4]+[5]*x+[6]*x*x+[7]*x*x*x+[8]*x*x*x*x)", 0, 100);
+    fMultCutHigh->SetParameters(1654.46, -47.2379, 0.449833, -0.0014125, 150.773, -3.67334, 0.0530503, -0.000614061, 3.15956e-06);
+    cut->AddCut(VarManager::kVtxNcontribReal, fMultPVCutLow, fMultPVCutHigh, false, VarManager::kCentFT0C, 0.0, 100.0, false);
+    cut->AddCut(VarManager::kMultA, fMultCutLow, fMultCutHigh, false, VarManager::kCentFT0C, 0.0, 100.0, false);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kIsSel8, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsNoSameBunch, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsGoodZvtxFT0vsPV, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventDimuonStandard", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsMuonUnlikeLowPt7, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventMuonStandard", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsMuonSingleLowPt7, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventTPCMultLow", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMultTPC, 0, 50);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventExclusivePair", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxNcontrib, 2, 2);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventVtxNContrib", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxNcontrib, 0, 10);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventTPCMult3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMultTPC, 3, 3);
+    return cut;
+  });
+
+  analysisCuts.emplace("int7vtxZ5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -5.0, 5.0);
+    cut->AddCut(VarManager::kIsINT7, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventDoubleGap", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsDoubleGap, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSingleGap", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSingleGap, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSingleGapA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSingleGapA, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSingleGapAZDC", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSingleGapA, 0.5, 1.5);
+    cut->AddCut(VarManager::kEnergyCommonZNA, -1000., 1.);
+    cut->AddCut(VarManager::kEnergyCommonZNC, 1., 1000.);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSingleGapC", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSingleGapC, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSingleGapCZDC", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSingleGapC, 0.5, 1.5);
+    cut->AddCut(VarManager::kEnergyCommonZNC, -1000., 1.);
+    cut->AddCut(VarManager::kEnergyCommonZNA, 1., 1000.);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSingleGapACZDC", [](const char*) -> AnalysisCut* {
+    auto* cutA = new AnalysisCompositeCut("singleGapAZDC", "singleGapAZDC", kTRUE);
+    cutA->AddCut(GetAnalysisCut("eventSingleGapAZDC"));
+
+    auto* cutC = new AnalysisCompositeCut("singleGapCZDC", "singleGapCZDC", kTRUE);
+    cutC->AddCut(GetAnalysisCut("eventSingleGapCZDC"));
+
+    auto* cutAorC = new AnalysisCompositeCut("singleGapACZDC", "singleGapACZDC", kFALSE);
+    cutAorC->AddCut(cutA);
+    cutAorC->AddCut(cutC);
+    return cutAorC;
+  });
+
+  analysisCuts.emplace("eventUPCMode", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsITSUPCMode, 0.5, 1.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventSingleGapACZDC_UPCMode", [](const char*) -> AnalysisCut* {
+    auto* cutA = new AnalysisCompositeCut("singleGapAZDC", "singleGapAZDC", kTRUE);
+    cutA->AddCut(GetAnalysisCut("eventSingleGapAZDC"));
+    cutA->AddCut(GetAnalysisCut("eventUPCMode"));
+
+    auto* cutC = new AnalysisCompositeCut("singleGapCZDC", "singleGapCZDC", kTRUE);
+    cutC->AddCut(GetAnalysisCut("eventSingleGapCZDC"));
+    cutC->AddCut(GetAnalysisCut("eventUPCMode"));
+
+    auto* cutAorC = new AnalysisCompositeCut("singleGapACZDC", "singleGapACZDC", kFALSE);
+    cutAorC->AddCut(cutA);
+    cutAorC->AddCut(cutC);
+    return cutAorC;
+  });
+
+  analysisCuts.emplace("eventXn0nTime", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTimeZNA, -2.0, 2.0);
+    cut->AddCut(VarManager::kTimeZNC, -2.0, 2.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("event0nXnTime", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTimeZNA, -2.0, 2.0, true);
+    cut->AddCut(VarManager::kTimeZNC, -2.0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("event0n0nTime", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTimeZNA, -2.0, 2.0, true);
+    cut->AddCut(VarManager::kTimeZNC, -2.0, 2.0, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventXnXnTime", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTimeZNA, -2.0, 2.0);
+    cut->AddCut(VarManager::kTimeZNC, -2.0, 2.0);
+    return cut;
+  });
+
+  // Event cuts based on centrality
+  analysisCuts.emplace("eventStandardNoINT7Cent090", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kCentFT0C, 0.0, 90.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardNoINT7Cent7090", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kCentFT0C, 70.0, 90.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardNoINT7Cent5070", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kCentFT0C, 50.0, 70.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardNoINT7Cent3050", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kCentFT0C, 30.0, 50.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardNoINT7Cent1030", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kCentFT0C, 10.0, 30.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("eventStandardNoINT7Cent010", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVtxZ, -10.0, 10.0);
+    cut->AddCut(VarManager::kCentFT0C, 0.0, 10.0);
+    return cut;
+  });
+}
@@ -0,0 +1,563 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file CutsLibraryMuon.cxx
+/// \brief Library of muon cuts with fixed names, registered for the lookup in CutsLibrary.cxx
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/CutsLibrary.h"
+#include "PWGDQ/Core/CutsLibraryRegistry.h"
+#include "PWGDQ/Core/VarManager.h"
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterMuonAnalysisCuts(AnalysisCutRegistry& analysisCuts)
+{
+  // -------------------------------------------------------------------------------------------------
+  // Muon cuts
+  analysisCuts.emplace("GlobalMuonTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, -0.5, 0.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("MFTMCH", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, 1.5, 2.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("MCHMID", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, 2.5, 3.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("MCHStandalone", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, 3.5, 4.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonMinimalCuts", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 324.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonMinimalCuts10SigmaPDCA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 990.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 540.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonQualityCuts", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 324.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    return cut;
+  });
+
+  analysisCuts.emplace("muonQualityCuts5SigmaPDCA_Run3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 500.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 335.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    return cut;
+  });
+
+  analysisCuts.emplace("muonQualityCuts10SigmaPDCA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 990.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 540.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    return cut;
+  });
+
+  analysisCuts.emplace("matchedQualityCuts", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 324.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0.0, 1e6); // matching MFT-MCH
+    return cut;
+  });
+
+  analysisCuts.emplace("matchedQualityCutsMFTeta", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -3.6, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 17.6, 89.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 324.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0.0, 1e6); // matching MFT-MCH
+    return cut;
+  });
+
+  analysisCuts.emplace("muonQualityCutsMatchingOnly", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    return cut;
+  });
+
+  analysisCuts.emplace("muonLowPt", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.5, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonLowPt2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.7, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonLowPt3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.8, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonLowPt4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.9, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonLowPt5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 1.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonLowPt6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 2.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonHighPt", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 3.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonHighPt2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 4.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonHighPt3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 6.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonHighPt4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 8.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonHighPt5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 10.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonHighPt6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 20.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonTightQualityCutsForTests", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.0, -2.5);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 20.0, 60.0);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 594.0, false, VarManager::kMuonRAtAbsorberEnd, 17.6, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 324.0, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 89.5);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    return cut;
+  });
+
+  analysisCuts.emplace("mchTrack", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, 3.5, 4.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("matchedMchMid", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, 2.5, 3.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("matchedFwd", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, 1.5, 2.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("matchedGlobal", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonTrackType, -0.5, 0.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("Chi2MCHMFTCut1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 30);
+    return cut;
+  });
+
+  analysisCuts.emplace("Chi2MCHMFTCut2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 40);
+    return cut;
+  });
+
+  analysisCuts.emplace("Chi2MCHMFTCut3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 50);
+    return cut;
+  });
+
+  analysisCuts.emplace("Chi2MCHMFTCut4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0, 60);
+    return cut;
+  });
+}
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterMuonCompositeCuts(CompositeCutRegistry& compositeCuts)
+{
+  compositeCuts.emplace("muonQualityCutsMatchingOnly", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonMinimalCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonMinimalCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonMinimalCuts10SigmaPDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonMinimalCuts10SigmaPDCA"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonQualityCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("matchedQualityCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("matchedQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("matchedQualityCutsMFTeta", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("matchedQualityCutsMFTeta"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonQualityCuts5SigmaPDCA_Run3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonQualityCuts5SigmaPDCA_Run3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt5SigmaPDCA_Run3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts5SigmaPDCA_Run3"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonQualityCuts10SigmaPDCA_MCHMID", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt10SigmaPDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt210SigmaPDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt510SigmaPDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt5"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt610SigmaPDCA", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt6"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts10SigmaPDCA"));
+    cut->AddCut(GetAnalysisCut("MCHMID"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt3"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt4"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt5"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPt6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt6"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPtMatchingOnly", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPtMatchingOnly2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPtMatchingOnly3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt3"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPtMatchingOnly4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt4"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPtMatchingOnly5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt5"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLowPtMatchingOnly6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt6"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPt2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPt3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt3"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPt4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt4"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPt5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt5"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPt6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt6"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPtMatchingOnly2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt2"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonHighPtMatchingOnly3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt3"));
+    cut->AddCut(GetAnalysisCut("muonQualityCutsMatchingOnly"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonTightQualityCutsForTests", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonTightQualityCutsForTests"));
+    return cut;
+  });
+
+  compositeCuts.emplace("mchTrack", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("mchTrack"));
+    return cut;
+  });
+
+  compositeCuts.emplace("matchedMchMid", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("matchedMchMid"));
+    return cut;
+  });
+
+  compositeCuts.emplace("matchedFwd", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("matchedFwd"));
+    return cut;
+  });
+
+  compositeCuts.emplace("matchedGlobal", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("matchedGlobal"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Chi2MCHMFTCut1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Chi2MCHMFTCut2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Chi2MCHMFTCut3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("Chi2MCHMFTCut4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("Chi2MCHMFTCut4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonQualityCutsMUONStandalone", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("matchedMchMid"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonQualityCutsGlobal", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("matchedGlobal"));
+    cut->AddCut(GetAnalysisCut("muonQualityCuts"));
+    return cut;
+  });
+}
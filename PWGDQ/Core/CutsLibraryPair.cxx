@@ -0,0 +1,1228 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file CutsLibraryPair.cxx
+/// \brief Library of pair and trigger cuts with fixed names, registered for the lookup in CutsLibrary.cxx
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/CutsLibrary.h"
+#include "PWGDQ/Core/CutsLibraryRegistry.h"
+#include "PWGDQ/Core/VarManager.h"
+
+#include <TF1.h>
+
+#include <memory>
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterPairAnalysisCuts(AnalysisCutRegistry& analysisCuts)
+{
+  // -----------------------------------------------------------------------------------------------
+  // Pair cuts
+  analysisCuts.emplace("pairDalitz1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.015, false, VarManager::kPt, 0., 1.);
+    cut->AddCut(VarManager::kMass, 0.0, 0.035, false, VarManager::kPt, 0., 1., true);
+    std::shared_ptr<TF1> fcutHigh = std::make_shared<TF1>("f1", "[0] - [0]/[1]*x", -1.5, 1.5);
+    fcutHigh->SetParameters(0.6, 0.12);
+    std::shared_ptr<TF1> fcutLow = std::make_shared<TF1>("f2", "-[0] + [0]/[1]*x", -1.5, 1.5);
+    fcutLow->SetParameters(0.6, 0.12);
+    cut->AddCut(VarManager::kPsiPair, fcutLow, fcutHigh, true, VarManager::kDeltaPhiPair, 0, 0.12);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairDalitz1Strong", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.015, false, VarManager::kPt, 0., 1.);
+    cut->AddCut(VarManager::kMass, 0.0, 0.035, false, VarManager::kPt, 0., 1., true);
+    cut->AddCut(VarManager::kDeltaPhiPair, -1., 0.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairDalitz2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.015, false, VarManager::kPt, 0., 1.);
+    cut->AddCut(VarManager::kMass, 0.0, 0.035, false, VarManager::kPt, 0., 1., true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairDalitz3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.15);
+    return cut;
+  });
+
+  analysisCuts.emplace("paira_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.06);
+    return cut;
+  });
+
+  analysisCuts.emplace("paira_prefilter2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.06);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
+    return cut;
+  });
+
+  analysisCuts.emplace("paira_prefilter3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.06);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
+    return cut;
+  });
+
+  analysisCuts.emplace("paira_prefilter4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.06);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
+    return cut;
+  });
+
+  analysisCuts.emplace("paira_prefilter5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.06);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
+    return cut;
+  });
+
+  analysisCuts.emplace("paira_prefilter6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.06);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
+    return cut;
+  });
+
+  analysisCuts.emplace("paira_prefilter7", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.06);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairb_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.05);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairb_prefilter2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.05);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairb_prefilter3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.05);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairb_prefilter4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.05);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairb_prefilter5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.05);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairb_prefilter6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.05);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairb_prefilter7", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.05);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairc_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.04);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairc_prefilter2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.04);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairc_prefilter3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.04);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairc_prefilter4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.04);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairc_prefilter5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.04);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairc_prefilter6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.04);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairc_prefilter7", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 0.04);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
+    return cut;
+  });
+
+  analysisCuts.emplace("paird_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.025);
+    return cut;
+  });
+
+  analysisCuts.emplace("paire_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.05);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairf_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.075);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairg_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.1);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairh_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.125);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairi_prefilter1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kOpeningAngle, 0.0, 0.15);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairNoCut", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("DipionMassCut1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.5, 1.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("DipionMassCut2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0.0, 1.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.5, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.6, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.7, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.8, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow6", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.85, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow7", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.9, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow8", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 2.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow9", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 2.2, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow10", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 2.5, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow11", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 3.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassLow12", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 3.5, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMass1to2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1., 2.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMassIMR", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.1, 2.7);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMass1_5to2_7", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.5, 2.7);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMass1_3to3_5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.3, 3.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMass1_3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.3, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairMass1_5to3_5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.5, 3.5);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairD0", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 1.814, 1.914);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairJpsi", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 2.8, 3.3);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairJpsi2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 2.72, 3.2);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairJpsi3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 2.92, 3.14);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairPsi2S", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 3.4, 3.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairUpsilon", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 8.0, 11.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairX3872", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kQ, 0.0, 0.3);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairX3872_2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kQuadDefaultDileptonMass, 3.0, 5.0);
+    cut->AddCut(VarManager::kQ, 0.0, 0.5);
+    cut->AddCut(VarManager::kDeltaR, 0.0, 5.0);
+    cut->AddCut(VarManager::kQuadPt, 5.0, 40.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairX3872_3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kQuadDefaultDileptonMass, 3.0, 5.0);
+    cut->AddCut(VarManager::kQ, 0.0, 0.5);
+    cut->AddCut(VarManager::kDeltaR, 0.0, 5.0);
+    cut->AddCut(VarManager::kQuadPt, 0.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairPtLow1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 2.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairPtLow2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 5.0, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairPtLow3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0, 0.15);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairPtLow4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0, 10.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairPtLow5", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPt, 0.8, 1000.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairRapidityForward", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kRap, 2.5, 4.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairDCA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kQuadDCAabsXY, .0, .50);
+    return cut;
+  });
+
+  analysisCuts.emplace("singleDCA", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTrackDCAsigXY, 0.0, 5.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairPhiV", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPairPhiv, 2., 3.2);
+    return cut;
+  });
+
+  analysisCuts.emplace("excludePairPhiV", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kPairPhiv, 2., 3.2, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairLowMass", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0., 0.1);
+    return cut;
+  });
+
+  analysisCuts.emplace("excludePairLowMass", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kMass, 0., 0.1, true);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairLxyzProjected3sigma", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVertexingLxyzProjected, 0.015, 10.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairTauxyzProjected1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVertexingTauxyzProjected, 0.0005, 10.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairTauxyzProjected1sigma", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVertexingTauxyzProjected, 0.003, 10.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairLxyProjected3sigmaLambdacCand", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    std::shared_ptr<TF1> f1minLxyProjected = std::make_shared<TF1>("f1minLxyProjected", "[0]+[1]*x", 0., 20.);
+    f1minLxyProjected->SetParameters(0.0065, -0.00023);
+    cut->AddCut(VarManager::kVertexingLxyProjected, f1minLxyProjected, 1., false, VarManager::kPt, 0., 20.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairLxyProjected3sigmaDplusCand", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kVertexingLxyProjected, 0.009, 10.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairCosPointingPos", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kCosPointingAngle, 0.9, 1000.);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairCosPointingNeg90", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kCosPointingAngle, -1000., -0.9);
+    return cut;
+  });
+
+  analysisCuts.emplace("pairCosPointingNeg85", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kCosPointingAngle, -1000., -0.85);
+    return cut;
+  });
+
+  analysisCuts.emplace("electronStandardQualityTriggerTest", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kIsSPDany, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsITSrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kIsTPCrefit, 0.5, 1.5);
+    cut->AddCut(VarManager::kTPCchi2, 0.0, 4.0);
+    cut->AddCut(VarManager::kITSchi2, 0.1, 36.0);
+    cut->AddCut(VarManager::kTPCncls, 50.0, 161.);
+    return cut;
+  });
+
+  analysisCuts.emplace("muonLooseTriggerTestCuts", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.5, -2.0);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 10, 100);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 1500, false, VarManager::kMuonRAtAbsorberEnd, 10, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 800, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 100);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    return cut;
+  });
+
+  analysisCuts.emplace("muonMatchingMFTMCHTriggerTestCuts", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kEta, -4.5, -2.0);
+    cut->AddCut(VarManager::kMuonRAtAbsorberEnd, 10, 100);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 1500, false, VarManager::kMuonRAtAbsorberEnd, 10, 26.5);
+    cut->AddCut(VarManager::kMuonPDca, 0.0, 800, false, VarManager::kMuonRAtAbsorberEnd, 26.5, 100);
+    cut->AddCut(VarManager::kMuonChi2, 0.0, 1e6);
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMID, 0.0, 1e6); // matching MCH-MID
+    cut->AddCut(VarManager::kMuonChi2MatchMCHMFT, 0.0, 1e6); // matching MFT-MCH
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_TriggerTest1", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 2.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 2.0, 9999.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_TriggerTest2", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 2.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 2.0, 9999.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_TriggerTest3", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 3.0, 9999.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 3.0, 999, false, VarManager::kPin, 0, 2.0);
+    return cut;
+  });
+
+  analysisCuts.emplace("jpsi_TPCPID_TriggerTest4", [](const char* cutName) -> AnalysisCut* {
+    auto* cut = new AnalysisCut(cutName, cutName);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -3.0, 4.0, false, VarManager::kPin, 0, 3.0);
+    cut->AddCut(VarManager::kTPCnSigmaEl_Corr, -2.0, 4.0, false, VarManager::kPin, 3.0, 9999.0);
+    cut->AddCut(VarManager::kTPCnSigmaPi_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
+    cut->AddCut(VarManager::kTPCnSigmaPr_Corr, 2.5, 999, false, VarManager::kPin, 0, 2.0);
+    return cut;
+  });
+}
+
+//________________________________________________________________________________________________
+void o2::aod::dqcuts::RegisterPairCompositeCuts(CompositeCutRegistry& compositeCuts)
+{
+  // -----------------------------------------------------------
+  // Pair cuts
+  compositeCuts.emplace("pairNoCut", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairNoCut"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairPtLow3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairPtLow3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairPtLow4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairPtLow4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairPtLow5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairPtLow5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow6"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow7", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow7"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow8", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow8"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow9", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow9"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow10", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow10"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow11", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow11"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassLow12", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassLow12"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMass1to2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMass1to2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMassIMR", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMassIMR"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMass1_5to2_7", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMass1_5to2_7"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMass1_3to3_5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMass1_3to3_5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMass1_3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMass1_3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairMass1_5to3_5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairMass1_5to3_5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairDalitz1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairDalitz1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairDalitz1Strong", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairDalitz1Strong"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairDalitz2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairDalitz2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairDalitz3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairDalitz3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paira_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paira_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paira_prefilter2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paira_prefilter2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paira_prefilter3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paira_prefilter3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paira_prefilter4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paira_prefilter4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paira_prefilter5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paira_prefilter5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paira_prefilter6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paira_prefilter6"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paira_prefilter7", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paira_prefilter7"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairb_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairb_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairb_prefilter2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairb_prefilter2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairb_prefilter3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairb_prefilter3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairb_prefilter4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairb_prefilter4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairb_prefilter5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairb_prefilter5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairb_prefilter6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairb_prefilter6"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairb_prefilter7", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairb_prefilter7"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairc_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairc_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairc_prefilter2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairc_prefilter2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairc_prefilter3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairc_prefilter3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairc_prefilter4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairc_prefilter4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairc_prefilter5", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairc_prefilter5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairc_prefilter6", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairc_prefilter6"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairc_prefilter7", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairc_prefilter7"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paird_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paird_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("paire_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("paire_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairf_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairf_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairg_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairg_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairh_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairh_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairi_prefilter1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairi_prefilter1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairJpsi", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairJpsi"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairJpsi2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairJpsi2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairJpsi3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairJpsi3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairPsi2S", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairPsi2S"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairUpsilon", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairUpsilon"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairX3872Cut1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairX3872"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairX3872Cut2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairX3872_2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairX3872Cut3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairX3872_3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DipionPairCut1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("DipionMassCut1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("DipionPairCut2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("DipionMassCut2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairRapidityForward", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairRapidityForward"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairJpsiLowPt1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairJpsi"));
+    cut->AddCut(GetAnalysisCut("pairPtLow1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairJpsiLowPt2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairJpsi"));
+    cut->AddCut(GetAnalysisCut("pairPtLow2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairCoherentRho0", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairPtLow3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairD0", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairD0"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairD0HighPt1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairLxyzProjected3sigma"));
+    cut->AddCut(GetAnalysisCut("pairPtLow5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairD0HighPt2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairTauxyzProjected1"));
+    cut->AddCut(GetAnalysisCut("pairPtLow5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairD0HighPt3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairTauxyzProjected1sigma"));
+    cut->AddCut(GetAnalysisCut("pairPtLow5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairTauxyzProjected1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairTauxyzProjected1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairLxyProjected3sigmaLambdacCand", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairLxyProjected3sigmaLambdacCand"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairLxyProjected3sigmaDplusCand", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairLxyProjected3sigmaDplusCand"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairCosPointingPos", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairCosPointingPos"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairCosPointingNeg90", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairCosPointingNeg90"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairCosPointingNeg85", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairCosPointingNeg85"));
+    return cut;
+  });
+
+  compositeCuts.emplace("pairTauxyzProjectedCosPointing1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("pairCosPointingNeg"));
+    cut->AddCut(GetAnalysisCut("pairTauxyzProjected1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_LooseNsigma", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_LooseNsigma_corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug5"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_MediumNsigma", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaOpen"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_MediumNsigma_corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_TightNsigma", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigma"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_TightNsigma_corr", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_debug2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_TPCPID1", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest1"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_TPCPID2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest2"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_TPCPID3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest3"));
+    return cut;
+  });
+
+  compositeCuts.emplace("jpsiO2TriggerTestCuts_TPCPID4", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronStandardQualityTriggerTest"));
+    cut->AddCut(GetAnalysisCut("jpsi_TPCPID_TriggerTest4"));
+    return cut;
+  });
+
+  compositeCuts.emplace("emu_electron_test", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("jpsiStandardKine"));
+    cut->AddCut(GetAnalysisCut("electronTrackQuality_Maolin"));
+    cut->AddCut(GetAnalysisCut("electronPIDnsigmaEMu"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLooseTriggerTestCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLooseTriggerTestCuts_LowPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLooseTriggerTestCuts_HighPt2", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt2"));
+    cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonLooseTriggerTestCuts_HighPt3", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonHighPt3"));
+    cut->AddCut(GetAnalysisCut("muonLooseTriggerTestCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonMatchingMFTMCHTriggerTestCuts", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonMatchingMFTMCHTriggerTestCuts"));
+    return cut;
+  });
+
+  compositeCuts.emplace("muonMatchingMFTMCHTriggerTestCuts_LowPt", [](const char* cutName) -> AnalysisCompositeCut* {
+    auto* cut = new AnalysisCompositeCut(cutName, cutName);
+    cut->AddCut(GetAnalysisCut("muonLowPt"));
+    cut->AddCut(GetAnalysisCut("muonMatchingMFTMCHTriggerTestCuts"));
+    return cut;
+  });
+}
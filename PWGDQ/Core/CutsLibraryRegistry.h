@@ -0,0 +1,52 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file CutsLibraryRegistry.h
+/// \brief Name to factory maps for the cuts with fixed names defined in the CutsLibrary*.cxx files
+//
+// The cuts with fixed names are defined in one registration function per family (event, barrel, muon, ...),
+// each in its own translation unit. The registries are filled once, at the first call of GetAnalysisCut()
+// or GetCompositeCut(), and the lookup by name is then a single hash map access.
+// Cuts with names generated in loops (e.g. cut variations) are still handled in CutsLibrary.cxx.
+// To add a new cut with a fixed name, add an emplace() call to the registration function of its family.
+//
+
+#ifndef PWGDQ_CORE_CUTSLIBRARYREGISTRY_H_
+#define PWGDQ_CORE_CUTSLIBRARYREGISTRY_H_
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace o2::aod::dqcuts
+{
+// factories receive the requested name, which is used as name and title of the created cut
+using AnalysisCutFactory = AnalysisCut* (*)(const char* cutName);
+using CompositeCutFactory = AnalysisCompositeCut* (*)(const char* cutName);
+using AnalysisCutRegistry = std::unordered_map<std::string, AnalysisCutFactory>;
+using CompositeCutRegistry = std::unordered_map<std::string, CompositeCutFactory>;
+
+void RegisterEventAnalysisCuts(AnalysisCutRegistry& analysisCuts);
+void RegisterBarrelAnalysisCuts(AnalysisCutRegistry& analysisCuts);
+void RegisterBarrelPIDAnalysisCuts(AnalysisCutRegistry& analysisCuts);
+void RegisterMuonAnalysisCuts(AnalysisCutRegistry& analysisCuts);
+void RegisterPairAnalysisCuts(AnalysisCutRegistry& analysisCuts);
+void RegisterAlice3AnalysisCuts(AnalysisCutRegistry& analysisCuts);
+
+void RegisterBarrelCompositeCuts(CompositeCutRegistry& compositeCuts);
+void RegisterMuonCompositeCuts(CompositeCutRegistry& compositeCuts);
+void RegisterPairCompositeCuts(CompositeCutRegistry& compositeCuts);
+void RegisterAlice3CompositeCuts(CompositeCutRegistry& compositeCuts);
+} // namespace o2::aod::dqcuts
+
+#endif // PWGDQ_CORE_CUTSLIBRARYREGISTRY_H_
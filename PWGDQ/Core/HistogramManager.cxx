@@ -36,11 +36,15 @@
 #include <RtypesCore.h>
 
 #include <array>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
 #include <span>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 //_______________________________________________________________________________
@@ -341,6 +345,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
                 << " for histogram " << hname;
       return;
   } // end switch
+  UpdateFillPlan(histClass);
 }
 
 //_________________________________________________________________
@@ -558,6 +563,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
                 << " for histogram " << hname;
       return;
   } // end switch(dimension)
+  UpdateFillPlan(histClass);
 }
 
 //_________________________________________________________________
@@ -667,6 +673,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
   }
 
   fBinsAllocated += nbins;
+  UpdateFillPlan(histClass);
 }
 
 //_________________________________________________________________
@@ -785,6 +792,7 @@ void HistogramManager::AddHistogram(const char* histClass, const char* hname, co
     }
   }
   fBinsAllocated += bins;
+  UpdateFillPlan(histClass);
 }
 
 //__________________________________________________________________
@@ -792,177 +800,212 @@ void HistogramManager::FillHistClass(const char* className, float* values)
 {
   //
   //  fill a class of histograms
+  //  NOTE: the histogram class is resolved into its fill plan on the first call; in hot loops,
+  //        it is preferable to obtain the handle once via GetHistClassHandle() and fill using the handle
   //
+  FillHistClass(GetHistClassHandle(className), values);
+}
+
+//__________________________________________________________________
+int HistogramManager::GetHistClassHandle(const char* className)
+{
+  //
+  // get the handle of the fill plan for a histogram class, compiling the plan if not done already
+  //
+  if (auto it = fFillPlanHandles.find(std::string_view(className)); it != fFillPlanHandles.end()) {
+    return it->second;
+  }
+  if (!fMainList || !fMainList->FindObject(className)) {
+    return kNothing;
+  }
+  FillPlan plan;
+  plan.fClassName = className;
+  CompileFillPlan(plan);
+  fFillPlans.push_back(std::move(plan));
+  int handle = static_cast<int>(fFillPlans.size()) - 1;
+  fFillPlanHandles.emplace(className, handle);
+  return handle;
+}
+
+//__________________________________________________________________
+void HistogramManager::UpdateFillPlan(const char* histClass)
+{
+  //
+  // recompile the fill plan of a histogram class if one was already requested
+  //
+  if (auto it = fFillPlanHandles.find(std::string_view(histClass)); it != fFillPlanHandles.end()) {
+    CompileFillPlan(fFillPlans[it->second]);
+  }
+}
+
+//__________________________________________________________________
+void HistogramManager::CompileFillPlan(FillPlan& plan)
+{
+  //
+  // decode the variable identifiers and resolve the histogram types for all histograms of a class
+  //
+  plan.fRecords.clear();
+  plan.fTHnVars.clear();
 
-  // get the needed histogram list
-  auto* hList = dynamic_cast<TList*>(fMainList->FindObject(className));
+  auto* hList = dynamic_cast<TList*>(fMainList->FindObject(plan.fClassName.c_str()));
   if (!hList) {
-    // TODO: add some meaningfull error message
-    /*LOG(warn) << "HistogramManager::FillHistClass(): Histogram list " << className << " not found!";
-    LOG(warn) << "         Histogram list not filled" << endl; */
     return;
   }
+  auto const& varList = fVariablesMap[plan.fClassName];
 
-  // get the corresponding std::list containng identifiers to the needed variables to be filled
-  auto const& varList = fVariablesMap[className];
-
+  // NOTE: the histogram list and the std::list with variables are synchronized, see FillHistClass()
   TIter next(hList);
-
-  TObject* h = nullptr;
-  bool isProfile = false;
-  bool isTHn = false;
-  int dimension = 0;
-  bool isFillLabelx = kFALSE;
-  // TODO: At the moment, maximum 20 dimensions are foreseen for the THn histograms. We should make this more dynamic
-  //       But maybe its better to have it like to avoid dynamically allocating this array in the histogram loop
-  std::array<double, 20> fillValues{};
-  int varX = -1, varY = -1, varZ = -1, varT = -1, varW = -1;
-
-  // loop over the histogram and std::list
-  // NOTE: these two should contain the same number of elements and be synchronized, otherwise its a mess
-  for (auto varIter = varList.begin(); varIter != varList.end(); varIter++) {
-    h = next(); // get the histogram
-    // decode information from the vector of indices
-    isProfile = ((*varIter)[0] == 1);
-    isTHn = ((*varIter)[1] > 0);
-    if (isTHn) {
-      dimension = (*varIter)[1];
-    } else if (auto* h1 = dynamic_cast<TH1*>(h)) {
-      dimension = h1->GetDimension();
-    } else {
-      continue;
+  for (auto const& vars : varList) {
+    TObject* h = next();
+    if (!h) {
+      break;
     }
-
-    // get the various variable indices
-    varW = (*varIter)[2];
-    if (isTHn) {
-      for (int i = 0; i < dimension; i++) {
-        fillValues[i] = values[(*varIter)[3 + i]];
+    FillRecord rec;
+    rec.fHist = h;
+    rec.fVarW = vars[2];
+    bool isProfile = (vars[0] == 1);
+    if (vars[1] > 0) { // THn
+      if (!dynamic_cast<THnBase*>(h)) {
+        continue;
       }
-    } else {
-      varX = (*varIter)[3];
-      varY = (*varIter)[4];
-      varZ = (*varIter)[5];
-      varT = (*varIter)[6];
-      isFillLabelx = ((*varIter)[7] == 1);
+      rec.fType = kFillTHn;
+      rec.fNDims = vars[1];
+      rec.fTHnVarsIdx = static_cast<int>(plan.fTHnVars.size());
+      for (int i = 0; i < rec.fNDims; i++) {
+        plan.fTHnVars.push_back(vars[3 + i]);
+      }
+      plan.fRecords.push_back(rec);
+      continue;
     }
+    auto* h1 = dynamic_cast<TH1*>(h);
+    if (!h1) {
+      continue;
+    }
+    rec.fVarX = vars[3];
+    rec.fVarY = vars[4];
+    rec.fVarZ = vars[5];
+    rec.fVarT = vars[6];
+    rec.fFillLabelX = (vars[7] == 1);
+    switch (h1->GetDimension()) {
+      case 1:
+        if (isProfile && !dynamic_cast<TProfile*>(h)) {
+          continue;
+        }
+        rec.fType = (isProfile ? kFillTProfile : kFillTH1);
+        break;
+      case 2:
+        if (isProfile ? !dynamic_cast<TProfile2D*>(h) : !dynamic_cast<TH2*>(h)) {
+          continue;
+        }
+        rec.fType = (isProfile ? kFillTProfile2D : kFillTH2);
+        break;
+      case 3:
+        if (isProfile ? !dynamic_cast<TProfile3D*>(h) : !dynamic_cast<TH3*>(h)) {
+          continue;
+        }
+        rec.fType = (isProfile ? kFillTProfile3D : kFillTH3);
+        break;
+      default:
+        continue;
+    }
+    plan.fRecords.push_back(rec);
+  }
+}
 
-    if (!isTHn) {
-      switch (dimension) {
-        case 1:
-          if (isProfile) {
-            auto* profile = dynamic_cast<TProfile*>(h);
-            if (!profile) {
-              break;
-            }
-            if (varW > kNothing) {
-              if (isFillLabelx) {
-                profile->Fill(Form("%d", static_cast<int>(values[varX])), values[varY], values[varW]);
-              } else {
-                profile->Fill(values[varX], values[varY], values[varW]);
-              }
-            } else {
-              if (isFillLabelx) {
-                profile->Fill(Form("%d", static_cast<int>(values[varX])), values[varY]);
-              } else {
-                profile->Fill(values[varX], values[varY]);
-              }
-            }
-          } else {
-            auto* h1 = dynamic_cast<TH1*>(h);
-            if (!h1) {
-              break;
-            }
-            if (varW > kNothing) {
-              if (isFillLabelx) {
-                h1->Fill(Form("%d", static_cast<int>(values[varX])), values[varW]);
-              } else {
-                h1->Fill(values[varX], values[varW]);
-              }
-            } else {
-              if (isFillLabelx) {
-                h1->Fill(Form("%d", static_cast<int>(values[varX])), 1.);
-              } else {
-                h1->Fill(values[varX]);
-              }
-            }
-          }
-          break;
-        case 2:
-          if (isProfile) {
-            auto* profile = dynamic_cast<TProfile2D*>(h);
-            if (!profile) {
-              break;
-            }
-            if (varW > kNothing) {
-              profile->Fill(values[varX], values[varY], values[varZ], values[varW]);
-            } else {
-              profile->Fill(values[varX], values[varY], values[varZ]);
-            }
-          } else {
-            auto* h2 = dynamic_cast<TH2*>(h);
-            if (!h2) {
-              break;
-            }
-            if (varW > kNothing) {
-              if (isFillLabelx) {
-                h2->Fill(Form("%d", static_cast<int>(values[varX])), values[varY], values[varW]);
-              } else {
-                h2->Fill(values[varX], values[varY], values[varW]);
-              }
-            } else {
-              if (isFillLabelx) {
-                h2->Fill(Form("%d", static_cast<int>(values[varX])), values[varY], 1.);
-              } else {
-                h2->Fill(values[varX], values[varY]);
-              }
-            }
-          }
-          break;
-        case 3:
-          if (isProfile) {
-            auto* profile = dynamic_cast<TProfile3D*>(h);
-            if (!profile) {
-              break;
-            }
-            if (varW > kNothing) {
-              profile->Fill(values[varX], values[varY], values[varZ], values[varT], values[varW]);
-            } else {
-              profile->Fill(values[varX], values[varY], values[varZ], values[varT]);
-            }
-          } else {
-            auto* h3 = dynamic_cast<TH3*>(h);
-            if (!h3) {
-              break;
-            }
-            if (varW > kNothing) {
-              h3->Fill(values[varX], values[varY], values[varZ], values[varW]);
-            } else {
-              h3->Fill(values[varX], values[varY], values[varZ]);
-            }
-          }
-          break;
+//__________________________________________________________________
+void HistogramManager::FillHistClass(int handle, float* values)
+{
+  //
+  //  fill a class of histograms using its compiled fill plan
+  //
+  if (handle < 0 || handle >= static_cast<int>(fFillPlans.size())) {
+    return;
+  }
+  const FillPlan& plan = fFillPlans[handle];
 
-        default:
-          break;
-      } // end switch
-      // end if(!isTHn)
-    } else {
-      if (varW > kNothing) {
-        if (auto* hn = dynamic_cast<THnSparse*>(h)) {
-          hn->Fill(fillValues.data(), values[varW]);
-        } else if (auto* hn = dynamic_cast<THn*>(h)) {
-          hn->Fill(fillValues.data(), values[varW]);
+  std::array<double, 20> fillValues{};
+  std::array<char, 16> label{};
+  // the x-axis label is the integer value of the x variable, formatted without any allocation
+  auto makeLabel = [&label](float value) {
+    auto res = std::to_chars(label.data(), label.data() + label.size() - 1, static_cast<int>(value));
+    *res.ptr = '\0';
+    return label.data();
+  };
+
+  for (const auto& rec : plan.fRecords) {
+    const bool hasWeight = rec.fVarW > kNothing;
+    const double w = hasWeight ? values[rec.fVarW] : 1.;
+    switch (rec.fType) {
+      case kFillTH1: {
+        auto* h = static_cast<TH1*>(rec.fHist);
+        if (rec.fFillLabelX) {
+          h->Fill(makeLabel(values[rec.fVarX]), w);
+        } else if (hasWeight) {
+          h->Fill(values[rec.fVarX], w);
+        } else {
+          h->Fill(values[rec.fVarX]);
         }
-      } else {
-        if (auto* hn = dynamic_cast<THnSparse*>(h)) {
-          hn->Fill(fillValues.data());
-        } else if (auto* hn = dynamic_cast<THn*>(h)) {
-          hn->Fill(fillValues.data());
+        break;
+      }
+      case kFillTProfile: {
+        auto* h = static_cast<TProfile*>(rec.fHist);
+        if (rec.fFillLabelX) {
+          h->Fill(makeLabel(values[rec.fVarX]), values[rec.fVarY], w);
+        } else if (hasWeight) {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], w);
+        } else {
+          h->Fill(values[rec.fVarX], values[rec.fVarY]);
+        }
+        break;
+      }
+      case kFillTH2: {
+        auto* h = static_cast<TH2*>(rec.fHist);
+        if (rec.fFillLabelX) {
+          h->Fill(makeLabel(values[rec.fVarX]), values[rec.fVarY], w);
+        } else if (hasWeight) {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], w);
+        } else {
+          h->Fill(values[rec.fVarX], values[rec.fVarY]);
+        }
+        break;
+      }
+      case kFillTProfile2D: {
+        auto* h = static_cast<TProfile2D*>(rec.fHist);
+        if (hasWeight) {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], values[rec.fVarZ], w);
+        } else {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], values[rec.fVarZ]);
         }
+        break;
       }
-    } // end else
-  } // end loop over histograms
+      case kFillTH3: {
+        auto* h = static_cast<TH3*>(rec.fHist);
+        if (hasWeight) {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], values[rec.fVarZ], w);
+        } else {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], values[rec.fVarZ]);
+        }
+        break;
+      }
+      case kFillTProfile3D: {
+        auto* h = static_cast<TProfile3D*>(rec.fHist);
+        if (hasWeight) {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], values[rec.fVarZ], values[rec.fVarT], w);
+        } else {
+          h->Fill(values[rec.fVarX], values[rec.fVarY], values[rec.fVarZ], values[rec.fVarT]);
+        }
+        break;
+      }
+      case kFillTHn: {
+        const int* vars = plan.fTHnVars.data() + rec.fTHnVarsIdx;
+        for (int i = 0; i < rec.fNDims; i++) {
+          fillValues[i] = values[vars[i]];
+        }
+        static_cast<THnBase*>(rec.fHist)->Fill(fillValues.data(), w);
+        break;
+      }
+    }
+  }
 }
 
 //____________________________________________________________________________________
@@ -27,6 +27,7 @@
 #include <RtypesCore.h>
 
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <map>
 #include <string>
@@ -86,6 +87,13 @@ class HistogramManager : public TNamed
                     TString* axLabels = nullptr, int varW = -1, bool useSparse = kFALSE, bool isdouble = false);
 
   void FillHistClass(const char* className, float* values);
+  // Fill plans: the histogram class is resolved once into an integer handle which holds a flat list
+  //   of typed fill records (histogram pointer, type, variable indices, weight index).
+  //   Filling via the handle avoids any string lookup, map access or dynamic_cast in the event loop.
+  //   Returns kNothing if the histogram class does not exist.
+  //   Histograms added to the class after the handle was obtained are included in the plan automatically.
+  int GetHistClassHandle(const char* className);
+  void FillHistClass(int handle, float* values);
 
   void SetUseDefaultVariableNames(bool flag) { fUseDefaultVariableNames = flag; }
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -97,11 +105,44 @@ class HistogramManager : public TNamed
   void Print(Option_t*) const override;
 
  private:
+  // type of the histogram in a fill record, decided once when compiling the fill plan
+  enum FillType {
+    kFillTH1 = 0,
+    kFillTH2,
+    kFillTH3,
+    kFillTProfile,
+    kFillTProfile2D,
+    kFillTProfile3D,
+    kFillTHn
+  };
+  struct FillRecord {
+    TObject* fHist = nullptr; // the histogram, cast to the type given by fType only in the fill loop
+    FillType fType = kFillTH1;
+    int fVarX = kNothing;
+    int fVarY = kNothing;
+    int fVarZ = kNothing;
+    int fVarT = kNothing;
+    int fVarW = kNothing;
+    bool fFillLabelX = false;
+    int fNDims = 0;       // number of dimensions for THn histograms
+    int fTHnVarsIdx = 0;  // position of the THn axes variables in the plan fTHnVars vector
+  };
+  struct FillPlan {
+    std::string fClassName;
+    std::vector<FillRecord> fRecords;
+    std::vector<int> fTHnVars; // flat array of THn axes variables for all THn records of this plan
+  };
+
+  void CompileFillPlan(FillPlan& plan);
+  void UpdateFillPlan(const char* histClass);
+
   THashList* fMainList; // master histogram list
   int fNVars;           // number of variables handled (tipically from the Variable Manager)
 
   bool* fUsedVars;                                                  //! flags of used variables
   std::map<std::string, std::list<std::vector<int>>> fVariablesMap; //!  map holding identifiers for all variables needed by histograms
+  std::vector<FillPlan> fFillPlans;                                 //! compiled fill plans, indexed by the histogram class handle
+  std::map<std::string, int, std::less<>> fFillPlanHandles;         //! map from histogram class name to fill plan handle
 
   // various
   bool fUseDefaultVariableNames; //! toggle the usage of default variable names and units
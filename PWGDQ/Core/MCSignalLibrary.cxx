@@ -28,854 +28,859 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace o2::constants::physics;
 // using std::cout;
 // using std::endl;
 
-MCSignal* o2::aod::dqmcsignals::GetMCSignal(const char* name)
+namespace
+{
+using MCSignalFactory = MCSignal* (*)(const char* name);
+using MCSignalRegistry = std::unordered_map<std::string, MCSignalFactory>;
+
+//_______________________________________________________________________________________________
+void RegisterMCSignals(MCSignalRegistry& signals)
 {
-  std::string nameStr = name;
-  MCSignal* signal = nullptr;
   // 1-prong signals
-  if (nameStr == "alicePrimary") {
-    MCProng prong(1);                                  // 1-generation prong
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);  // set source to be ALICE primary particles
-    signal = new MCSignal(1, name, "ALICE primaries"); // define a signal with one prong
-    signal->AddProng(prong);                           // add the previously defined prong to the signal
-    return signal;
-  }
-  if (nameStr == "electron") {
-    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});        // define 1-generation prong using the full constructor
-    signal = new MCSignal(name, "Inclusive electrons", {prong}, {-1}); // define the signal using the full constructor
-    return signal;
-  }
-  if (nameStr == "electronPrimary") {
-    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});      // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary electrons", {prong}, {-1}); // define the signal using the full constructor
-    return signal;
-  }
-  if (nameStr == "pionPrimary") {
-    MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);            // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary pions", {prong}, {-1}); // define the signal using the full constructor
-    return signal;
-  }
-  if (nameStr == "pionPrimaryFromHc") {
+  signals.emplace("alicePrimary", [](const char* name) -> MCSignal* {
+    MCProng prong(1);                                        // 1-generation prong
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);        // set source to be ALICE primary particles
+    auto* signal = new MCSignal(1, name, "ALICE primaries"); // define a signal with one prong
+    signal->AddProng(prong);                                 // add the previously defined prong to the signal
+    return signal;
+  });
+  signals.emplace("electron", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});              // define 1-generation prong using the full constructor
+    auto* signal = new MCSignal(name, "Inclusive electrons", {prong}, {-1}); // define the signal using the full constructor
+    return signal;
+  });
+  signals.emplace("electronPrimary", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});            // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                      // set source to be ALICE primary particles
+    auto* signal = new MCSignal(name, "Primary electrons", {prong}, {-1}); // define the signal using the full constructor
+    return signal;
+  });
+  signals.emplace("pionPrimary", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false});       // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                  // set source to be ALICE primary particles
+    auto* signal = new MCSignal(name, "Primary pions", {prong}, {-1}); // define the signal using the full constructor
+    return signal;
+  });
+  signals.emplace("pionPrimaryFromHc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {211, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Primary pions from open charmed hadron decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Primary pions from open charmed hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "pionPrimaryFromHb") {
+  });
+  signals.emplace("pionPrimaryFromHb", [](const char* name) -> MCSignal* {
     MCProng prong(2, {211, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Primary pions from open beauty hadron decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Primary pions from open beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "photon") {
+  });
+  signals.emplace("photon", [](const char* name) -> MCSignal* {
     MCProng prong(1, {22}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    signal = new MCSignal(name, "Photon", {prong}, {-1});       // define the signal using the full constructor
+    auto* signal = new MCSignal(name, "Photon", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (nameStr == "muonPrimary") {
-    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});  // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);            // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary Muons", {prong}, {-1}); // define the signal using the full constructor
+  });
+  signals.emplace("muonPrimary", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});        // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                  // set source to be ALICE primary particles
+    auto* signal = new MCSignal(name, "Primary Muons", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (nameStr == "kaonFromPhi") {
+  });
+  signals.emplace("kaonFromPhi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {321, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}); // define 2-generation prong using the full constructor
-    signal = new MCSignal(name, "Kaons from phi-mesons", {prong}, {-1});                        // define the signal using the full constructor
+    auto* signal = new MCSignal(name, "Kaons from phi-mesons", {prong}, {-1});                  // define the signal using the full constructor
     return signal;
-  }
-  if (nameStr == "kaonPrimary") {
-    MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);            // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary Kaons", {prong}, {-1}); // define the signal using the full constructor
+  });
+  signals.emplace("kaonPrimary", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false});       // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                  // set source to be ALICE primary particles
+    auto* signal = new MCSignal(name, "Primary Kaons", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (nameStr == "Lambda0Baryon") {
+  });
+  signals.emplace("Lambda0Baryon", [](const char* name) -> MCSignal* {
     MCProng prong(1, {3122}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Lambda0 Baryon", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Lambda0 Baryon", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "SigmaPlusBaryon") {
+  });
+  signals.emplace("SigmaPlusBaryon", [](const char* name) -> MCSignal* {
     MCProng prong(1, {3222}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "SigmaPlus Baryon", {prong}, {-1});
+    auto* signal = new MCSignal(name, "SigmaPlus Baryon", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "proton") {
+  });
+  signals.emplace("proton", [](const char* name) -> MCSignal* {
     MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "proton", {prong}, {-1});
+    auto* signal = new MCSignal(name, "proton", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "protonPrimary") {
-    MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);             // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Primary Proton", {prong}, {-1}); // define the signal using the full constructor
+  });
+  signals.emplace("protonPrimary", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false});       // define 1-generation prong using the full constructor
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);                   // set source to be ALICE primary particles
+    auto* signal = new MCSignal(name, "Primary Proton", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (nameStr == "protonFromTransport") {
+  });
+  signals.emplace("protonFromTransport", [](const char* name) -> MCSignal* {
     MCProng prong(1, {2212}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kProducedInTransport);
-    signal = new MCSignal(name, "ProtonFromTransport", {prong}, {-1});
+    auto* signal = new MCSignal(name, "ProtonFromTransport", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "protonFromLambda0") {
+  });
+  signals.emplace("protonFromLambda0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {2212, 3122}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Proton from Lambda0 decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Proton from Lambda0 decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "protonFromSigmaPlus") {
+  });
+  signals.emplace("protonFromSigmaPlus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {2212, 3222}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Proton from Sigma+ decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Proton from Sigma+ decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "phiMeson") {
-    MCProng prong(1, {333}, {true}, {false}, {0}, {0}, {false}); // define 1-generation prong using the full constructor
-    signal = new MCSignal(name, "phi meson", {prong}, {-1});     // define the signal using the full constructor
+  });
+  signals.emplace("phiMeson", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {333}, {true}, {false}, {0}, {0}, {false});   // define 1-generation prong using the full constructor
+    auto* signal = new MCSignal(name, "phi meson", {prong}, {-1}); // define the signal using the full constructor
     return signal;
-  }
-  if (nameStr == "muon") {
+  });
+  signals.emplace("muon", [](const char* name) -> MCSignal* {
     MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive muons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive muons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "electronNOTfromTransport") {
+  });
+  signals.emplace("electronNOTfromTransport", [](const char* name) -> MCSignal* {
     MCProng prong(1);
     prong.SetPDGcode(0, 11, true);
     prong.SetSourceBit(0, MCProng::kProducedInTransport, true); // exclude particles produces in transport
-    signal = new MCSignal(name, "Electrons which are not produced during transport in detector", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons which are not produced during transport in detector", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromNonpromptJpsi") {
+  });
+  signals.emplace("eFromNonpromptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "ePrimaryFromPromptJpsi") {
+  });
+  signals.emplace("ePrimaryFromPromptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from prompt jpsi decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from prompt jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "ePrimaryFromNonpromptJpsi") {
+  });
+  signals.emplace("ePrimaryFromNonpromptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from non-prompt jpsi decays with beauty in decay chain", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Jpsi") {
+  });
+  signals.emplace("Jpsi", [](const char* name) -> MCSignal* {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive jpsi", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive jpsi", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Helium3") {
+  });
+  signals.emplace("Helium3", [](const char* name) -> MCSignal* {
     MCProng prong(1, {1000020030}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Helium3", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Helium3", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Helium3Primary") {
+  });
+  signals.emplace("Helium3Primary", [](const char* name) -> MCSignal* {
     MCProng prong(1, {1000020030}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Helium3Primary", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Helium3Primary", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Helium3FromTransport") {
+  });
+  signals.emplace("Helium3FromTransport", [](const char* name) -> MCSignal* {
     MCProng prong(1, {1000020030}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kProducedInTransport);
-    signal = new MCSignal(name, "Helium3FromTransport", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Helium3FromTransport", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "promptJpsi") {
+  });
+  signals.emplace("promptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {true});
-    signal = new MCSignal(name, "Prompt jpsi (not from beauty)", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Prompt jpsi (not from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "nonPromptJpsi") {
+  });
+  signals.emplace("nonPromptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {false});
-    signal = new MCSignal(name, "Non-prompt jpsi (from beauty)", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Non-prompt jpsi (from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "nonPromptJpsiFromBeauty") {
+  });
+  signals.emplace("nonPromptJpsiFromBeauty", [](const char* name) -> MCSignal* {
     MCProng prong(2, {503, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true);
-    signal = new MCSignal(name, "Non-prompt jpsi directly from beauty", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Non-prompt jpsi directly from beauty", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "nonPromptJpsiNotDirectlyFromBeauty") {
+  });
+  signals.emplace("nonPromptJpsiNotDirectlyFromBeauty", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 503}, {true, true}, {false, true}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Non-prompt jpsi from other but with beauty in decay chain", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Non-prompt jpsi from other but with beauty in decay chain", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "AnythingDecayToJpsi") {
+  });
+  signals.emplace("AnythingDecayToJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {MCProng::kPDGCodeNotAssigned, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true);
-    signal = new MCSignal(name, "Decay of anything into J/psi", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Decay of anything into J/psi", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eeFromNonpromptPsi2S") {
+  });
+  signals.emplace("eeFromNonpromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "ee pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromPromptPsi2S") {
+  });
+  signals.emplace("eeFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "ee pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eFromNonpromptPsi2S") {
+  });
+  signals.emplace("eFromNonpromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electrons from beauty psi2s decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from beauty psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPromptPsi2S") {
+  });
+  signals.emplace("eFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electrons from prompt psi2s decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from prompt psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Psi2S") {
+  });
+  signals.emplace("Psi2S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {100443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive psi2s", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive psi2s", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "nonPromptPsi2S") {
+  });
+  signals.emplace("nonPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {100443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {false});
-    signal = new MCSignal(name, "Non-prompt psi2s", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Non-prompt psi2s", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "promptPsi2S") {
+  });
+  signals.emplace("promptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {100443}, {true}, {false}, {0}, {0}, {false}, false, {503}, {true});
-    signal = new MCSignal(name, "Prompt psi2s (not from beauty)", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Prompt psi2s (not from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Chic0") {
+  });
+  signals.emplace("Chic0", [](const char* name) -> MCSignal* {
     MCProng prong(1, {10441}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic0", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive Chic0", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Chic1") {
+  });
+  signals.emplace("Chic1", [](const char* name) -> MCSignal* {
     MCProng prong(1, {20443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic1", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive Chic1", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Chic2") {
+  });
+  signals.emplace("Chic2", [](const char* name) -> MCSignal* {
     MCProng prong(1, {445}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic2", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive Chic2", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Chic012") {
+  });
+  signals.emplace("Chic012", [](const char* name) -> MCSignal* {
     MCProng prong(1, {904}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Chic0, Chic1 and Chic2", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive Chic0, Chic1 and Chic2", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Upsilon1S") {
+  });
+  signals.emplace("Upsilon1S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {553}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Upsilon1S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive Upsilon1S", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Upsilon2S") {
+  });
+  signals.emplace("Upsilon2S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {100553}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Upsilon2S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive Upsilon2S", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Upsilon3S") {
+  });
+  signals.emplace("Upsilon3S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {200553}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive Upsilon3S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive Upsilon3S", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allBeautyHadrons") {
+  });
+  signals.emplace("allBeautyHadrons", [](const char* name) -> MCSignal* {
     MCProng prong(1, {503}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allBeautyHadronsFS") {
+  });
+  signals.emplace("allBeautyHadronsFS", [](const char* name) -> MCSignal* {
     MCProng prong(1, {503}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allOpenBeautyHadrons") {
+  });
+  signals.emplace("allOpenBeautyHadrons", [](const char* name) -> MCSignal* {
     MCProng prong(1, {502}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allOpenBeautyHadronsFS") {
+  });
+  signals.emplace("allOpenBeautyHadronsFS", [](const char* name) -> MCSignal* {
     MCProng prong(1, {502}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All open beauty hadrons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Bc") {
+  });
+  signals.emplace("Bc", [](const char* name) -> MCSignal* {
     MCProng prong(1, {541}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Bc", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Bc", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "mumuFromJpsiFromBc") {
+  });
+  signals.emplace("mumuFromJpsiFromBc", [](const char* name) -> MCSignal* {
     MCProng prong(3, {13, 443, 541}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Muon pair from jpsi from Bc decays", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Muon pair from jpsi from Bc decays", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (nameStr == "muFromBc") {
+  });
+  signals.emplace("muFromBc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 541}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Muon from Bc decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Muon from Bc decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "mumumuFromBc") {
+  });
+  signals.emplace("mumumuFromBc", [](const char* name) -> MCSignal* {
     MCProng prongMuFromJpsi(3, {13, 443, 541}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongMuFromBc(2, {13, 541}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Trimuon from Bc decays", {prongMuFromJpsi, prongMuFromJpsi, prongMuFromBc}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Trimuon from Bc decays", {prongMuFromJpsi, prongMuFromJpsi, prongMuFromBc}, {2, 2, 1});
     return signal;
-  }
-  if (nameStr == "everythingFromBeauty") {
+  });
+  signals.emplace("everythingFromBeauty", [](const char* name) -> MCSignal* {
     MCProng prong(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "everythingFromBeautyFS") {
+  });
+  signals.emplace("everythingFromBeautyFS", [](const char* name) -> MCSignal* {
     MCProng prong(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(1, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "everythingFromEverythingFromBeauty") {
+  });
+  signals.emplace("everythingFromEverythingFromBeauty", [](const char* name) -> MCSignal* {
     MCProng prong(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "everythingFromEverythingFromBeautyFS") {
+  });
+  signals.emplace("everythingFromEverythingFromBeautyFS", [](const char* name) -> MCSignal* {
     MCProng prong(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(2, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Everything from everything from beauty", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allCharmHadrons") {
+  });
+  signals.emplace("allCharmHadrons", [](const char* name) -> MCSignal* {
     MCProng prong(1, {403}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All charm hadrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All charm hadrons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allOpenCharmHadrons") {
+  });
+  signals.emplace("allOpenCharmHadrons", [](const char* name) -> MCSignal* {
     MCProng prong(1, {402}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "All open charm hadrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All open charm hadrons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allCharmFromBeauty") {
+  });
+  signals.emplace("allCharmFromBeauty", [](const char* name) -> MCSignal* {
     MCProng prong(2, {403, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "All charm hadrons from beauty", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All charm hadrons from beauty", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "allPromptCharm") {
+  });
+  signals.emplace("allPromptCharm", [](const char* name) -> MCSignal* {
     MCProng prong(2, {403, 503}, {true, true}, {false, true}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "All prompt charm hadrons (not from beauty)", {prong}, {-1});
+    auto* signal = new MCSignal(name, "All prompt charm hadrons (not from beauty)", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Pi0DecayToe") {
+  });
+  signals.emplace("Pi0DecayToe", [](const char* name) -> MCSignal* {
     MCProng prong(2, {111, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Pi0DecayTog") {
+  });
+  signals.emplace("Pi0DecayTog", [](const char* name) -> MCSignal* {
     MCProng prong(2, {111, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an gamma", {prong}, {1});
+    auto* signal = new MCSignal(name, "Pi0 decays into an gamma", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "Pi0DecayTogg") {
+  });
+  signals.emplace("Pi0DecayTogg", [](const char* name) -> MCSignal* {
     MCProng prong(2, {111, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an gamma, gamma", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Pi0 decays into an gamma, gamma", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (nameStr == "PromptPi0DecayToe") {
+  });
+  signals.emplace("PromptPi0DecayToe", [](const char* name) -> MCSignal* {
     MCProng prong(2, {111, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, true, {403, 503}, {true, true});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Pi0 decays into an electron", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Pi0") {
+  });
+  signals.emplace("Pi0", [](const char* name) -> MCSignal* {
     MCProng prong(1, {111}, {true}, {false}, {0}, {0}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Pi0", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Pi0", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "LMeeLFQ") {
+  });
+  signals.emplace("LMeeLFQ", [](const char* name) -> MCSignal* {
     MCProng prong(1, {900}, {true}, {false}, {0}, {0}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    signal = new MCSignal(name, "light flavor mesons + quarkonia", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s
+    auto* signal = new MCSignal(name, "light flavor mesons + quarkonia", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s
     return signal;
-  }
-  if (nameStr == "LMeeLF") {
+  });
+  signals.emplace("LMeeLF", [](const char* name) -> MCSignal* {
     MCProng prong(1, {901}, {true}, {false}, {0}, {0}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    signal = new MCSignal(name, "ligh flavor mesons", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi
+    auto* signal = new MCSignal(name, "ligh flavor mesons", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi
     return signal;
-  }
-  if (nameStr == "PromptJpsiDecayToe") {
+  });
+  signals.emplace("PromptJpsiDecayToe", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, true, {503}, {true});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Prompt jpsi (not from beauty) decay to electron", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Prompt jpsi (not from beauty) decay to electron", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "electronFromDs") {
+  });
+  signals.emplace("electronFromDs", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 431}, {true, true}, {false, false}, {0, 0}, {0, 0}, {true, true});
-    signal = new MCSignal(name, "Electrons from Ds decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Ds decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "dsMeson") {
+  });
+  signals.emplace("dsMeson", [](const char* name) -> MCSignal* {
     MCProng prong(1, {431}, {true}, {false}, {0}, {0}, {true});
-    signal = new MCSignal(name, "Ds mesons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Ds mesons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "electronFromPC") {
+  });
+  signals.emplace("electronFromPC", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "electron from a photon conversion", {prong}, {-1});
+    auto* signal = new MCSignal(name, "electron from a photon conversion", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "PowhegDYMuon1") {
-    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});        // selecting muons
-    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                   // set source to be Muon from POWHEG
-    signal = new MCSignal(name, "POWHEG Muon singles", {prong}, {-1}); // define a signal with 1-prong
+  });
+  signals.emplace("PowhegDYMuon1", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});              // selecting muons
+    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                         // set source to be Muon from POWHEG
+    auto* signal = new MCSignal(name, "POWHEG Muon singles", {prong}, {-1}); // define a signal with 1-prong
     return signal;
-  }
+  });
 
   // 2-prong signals
-  if (nameStr == "dielectron") {
+  signals.emplace("dielectron", [](const char* name) -> MCSignal* {
     MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Electron pair", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "Electron pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "dimuon") {
+  });
+  signals.emplace("dimuon", [](const char* name) -> MCSignal* {
     MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Muon pair", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "Muon pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "electronMuonPair") {
+  });
+  signals.emplace("electronMuonPair", [](const char* name) -> MCSignal* {
     MCProng electron(1, {11}, {true}, {false}, {0}, {0}, {false});
     MCProng muon(1, {13}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Electron-muon pair", {electron, muon}, {-1, -1});
+    auto* signal = new MCSignal(name, "Electron-muon pair", {electron, muon}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "emuFromOpenHFhadron") {
+  });
+  signals.emplace("emuFromOpenHFhadron", [](const char* name) -> MCSignal* {
     MCProng electron(2, {11, 902}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     electron.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng muon(2, {13, 902}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     muon.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "e and mu each from an open charm or beauty hadron decay", {electron, muon}, {-1, -1});
+    auto* signal = new MCSignal(name, "e and mu each from an open charm or beauty hadron decay", {electron, muon}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "emuFromOpenCharmHadron") {
+  });
+  signals.emplace("emuFromOpenCharmHadron", [](const char* name) -> MCSignal* {
     MCProng electron(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     electron.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng muon(2, {13, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     muon.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "e and mu each from an open charm hadron decay", {electron, muon}, {-1, -1});
+    auto* signal = new MCSignal(name, "e and mu each from an open charm hadron decay", {electron, muon}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "emuFromOpenBeautyHadron") {
+  });
+  signals.emplace("emuFromOpenBeautyHadron", [](const char* name) -> MCSignal* {
     MCProng electron(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     electron.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng muon(2, {13, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     muon.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "e and mu each from an open beauty hadron decay", {electron, muon}, {-1, -1});
+    auto* signal = new MCSignal(name, "e and mu each from an open beauty hadron decay", {electron, muon}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "dielectronFromPC") {
+  });
+  signals.emplace("dielectronFromPC", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (nameStr == "dielectronFromAllPC") {
+  });
+  signals.emplace("dielectronFromAllPC", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "dielectron from a photon conversion", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "dielectronPCPi0") {
+  });
+  signals.emplace("dielectronPCPi0", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 22, 111}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "dielectron from a photon conversion from a pi0", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "dielectron from a photon conversion from a pi0", {prong, prong}, {1, 1});
     return signal;
-  }
-  if (nameStr == "PowhegDYMuon2") {
-    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});                // selecting muons
-    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                           // set source to be Muon from POWHEG
-    signal = new MCSignal(name, "POWHEG Muon pair", {prong, prong}, {-1, -1}); // define a signal with 2-prong
+  });
+  signals.emplace("PowhegDYMuon2", [](const char* name) -> MCSignal* {
+    MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});                      // selecting muons
+    prong.SetSourceBit(0, MCProng::kIsPowhegDYMuon);                                 // set source to be Muon from POWHEG
+    auto* signal = new MCSignal(name, "POWHEG Muon pair", {prong, prong}, {-1, -1}); // define a signal with 2-prong
     return signal;
-  }
+  });
 
   // LMEE single signals
   // electron signals with mother X: e from mother X
-  if (nameStr == "eFromAnything") {
+  signals.emplace("eFromAnything", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, MCProng::kPDGCodeNotAssigned}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from any mother", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from any mother", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPhoton") {
+  });
+  signals.emplace("eFromPhoton", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 22}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from photon conversion", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from photon conversion", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPi0") {
+  });
+  signals.emplace("eFromPi0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from pi0 decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from pi0 decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "ePrimaryFromPromptPi0") {
+  });
+  signals.emplace("ePrimaryFromPromptPi0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from prompt pi0 decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from prompt pi0 decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromEta") {
+  });
+  signals.emplace("eFromEta", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 221}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from eta decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from eta decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromEtaPrime") {
+  });
+  signals.emplace("eFromEtaPrime", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 331}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from eta' decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from eta' decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromRho") {
+  });
+  signals.emplace("eFromRho", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 113}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from rho decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from rho decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromOmega") {
+  });
+  signals.emplace("eFromOmega", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 223}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from omega decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from omega decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPhi") {
+  });
+  signals.emplace("eFromPhi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from phi decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from phi decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromJpsi") {
+  });
+  signals.emplace("eFromJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "anythingFromJpsi") {
+  });
+  signals.emplace("anythingFromJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {MCProng::kPDGCodeNotAssigned, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Anything from jpsi decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Anything from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPromptJpsi") {
+  });
+  signals.emplace("eFromPromptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPsi2S") {
+  });
+  signals.emplace("eFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from psi2s decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromLMeeLF") {
+  });
+  signals.emplace("eFromLMeeLF", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
+    auto* signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
     return signal;
-  }
-  if (nameStr == "ePrimaryFromLMeeLF") {
+  });
+  signals.emplace("ePrimaryFromLMeeLF", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                      // set source to be ALICE primary particles
-    signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                            // set source to be ALICE primary particles
+    auto* signal = new MCSignal(name, "Electrons from LF meson decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi mesons
     return signal;
-  }
-  if (nameStr == "eFromLMeeLFQ") {
+  });
+  signals.emplace("eFromLMeeLFQ", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    prong.SetSignalInTime(false);                                                             // set direction to check generation in time (true) or back in time (false)
-    signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSignalInTime(false);                                                                   // set direction to check generation in time (true) or back in time (false)
+    auto* signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (nameStr == "ePrimaryFromLMeeLFQ") {
+  });
+  signals.emplace("ePrimaryFromLMeeLFQ", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                                  // set source to be ALICE primary particles
-    prong.SetSignalInTime(false);                                                             // set direction to check generation in time (true) or back in time (false)
-    signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);                                        // set source to be ALICE primary particles
+    prong.SetSignalInTime(false);                                                                   // set direction to check generation in time (true) or back in time (false)
+    auto* signal = new MCSignal(name, "Electrons from LF meson + quarkonia decays", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (nameStr == "eFromHc") {
+  });
+  signals.emplace("eFromHc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed hadron decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open charmed hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromAnyHc") {
+  });
+  signals.emplace("eFromAnyHc", [](const char* name) -> MCSignal* {
     MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false}, false, {402}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Electrons from any open charm hadron decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from any open charm hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromD0") {
+  });
+  signals.emplace("eFromD0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from D0 decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from D0 decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromChargedD") {
+  });
+  signals.emplace("eFromChargedD", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from D+/- decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from D+/- decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromDs") {
+  });
+  signals.emplace("eFromDs", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, Pdg::kDS}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Ds +/- decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Ds +/- decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromLambdaC") {
+  });
+  signals.emplace("eFromLambdaC", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Lambda_c decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Lambda_c decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromXiC0") {
+  });
+  signals.emplace("eFromXiC0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Xi_c_0 decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Xi_c_0 decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromXiCPlus") {
+  });
+  signals.emplace("eFromXiCPlus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Xi_c_+ decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Xi_c_+ decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromXiCPlusPlus") {
+  });
+  signals.emplace("eFromXiCPlusPlus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, Pdg::kXiCCPlusPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Xi_c_++ decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Xi_c_++ decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromHb") {
+  });
+  signals.emplace("eFromHb", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open beauty hadron decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromAnyHb") {
+  });
+  signals.emplace("eFromAnyHb", [](const char* name) -> MCSignal* {
     MCProng prong(1, {11}, {true}, {false}, {0}, {0}, {false}, false, {502}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);
-    signal = new MCSignal(name, "Electrons from any open beauty hadron decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from any open beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromHbc") {
+  });
+  signals.emplace("eFromHbc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 902}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charm or beauty hadron decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open charm or beauty hadron decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromMc") {
+  });
+  signals.emplace("eFromMc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 401}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed meson decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open charmed meson decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromMb") {
+  });
+  signals.emplace("eFromMb", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 501}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open beauty meson decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open beauty meson decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromBc") {
+  });
+  signals.emplace("eFromBc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 4001}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed baryon decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open charmed baryon decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromBb") {
+  });
+  signals.emplace("eFromBb", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 5001}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open beauty baryon decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open beauty baryon decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPromptHc") {
+  });
+  signals.emplace("eFromPromptHc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed hadron decays without beauty in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open charmed hadron decays without beauty in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromHbtoHc") {
+  });
+  signals.emplace("eFromHbtoHc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from open charmed hadron decays with b hadron in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from open charmed hadron decays with b hadron in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromPromptLM") {
+  });
+  signals.emplace("eFromPromptLM", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
-    signal = new MCSignal(name, "Electrons from light mesons without B/D in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from light mesons without B/D in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromHbtoLM") {
+  });
+  signals.emplace("eFromHbtoLM", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false});
-    signal = new MCSignal(name, "Electrons from light mesons with B hadron in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from light mesons with B hadron in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromHctoLM") {
+  });
+  signals.emplace("eFromHctoLM", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 101, 402}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {502}, {true});
-    signal = new MCSignal(name, "Electrons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromUpsilon1S") {
+  });
+  signals.emplace("eFromUpsilon1S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from Upsilon1S decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Upsilon1S decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromUpsilon2S") {
+  });
+  signals.emplace("eFromUpsilon2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 100553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from Upsilon2S decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Upsilon2S decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "eFromUpsilon3S") {
+  });
+  signals.emplace("eFromUpsilon3S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 200553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electrons from Upsilon3S decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Electrons from Upsilon3S decays", {prong}, {-1});
     return signal;
-  }
+  });
 
   // muon signals with mother X: mu from mother X
-  if (nameStr == "muFromJpsi") {
+  signals.emplace("muFromJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from jpsi decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from jpsi decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromPsi2S") {
+  });
+  signals.emplace("muFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from psi2s decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from psi2s decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromHb") {
+  });
+  signals.emplace("muFromHb", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from b->mu", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from b->mu", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromPromptHc") {
+  });
+  signals.emplace("muFromPromptHc", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
-    signal = new MCSignal(name, "muons from c->mu, without beauty in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from c->mu, without beauty in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromHbtoHc") {
+  });
+  signals.emplace("muFromHbtoHc", [](const char* name) -> MCSignal* {
     MCProng prong(3, {13, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "muons from b->c->mu", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from b->c->mu", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "secondaryMuon") {
+  });
+  signals.emplace("secondaryMuon", [](const char* name) -> MCSignal* {
     MCProng prong(1, {13}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kProducedInTransport);
-    signal = new MCSignal(name, "muons produced during transport in detector", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons produced during transport in detector", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromPromptLM") {
+  });
+  signals.emplace("muFromPromptLM", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
-    signal = new MCSignal(name, "muons from light mesons without B/D in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from light mesons without B/D in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromHbtoLM") {
+  });
+  signals.emplace("muFromHbtoLM", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 101}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false});
-    signal = new MCSignal(name, "muons from light mesons with B hadron in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from light mesons with B hadron in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromHctoLM") {
+  });
+  signals.emplace("muFromHctoLM", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 101, 402}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {502}, {true});
-    signal = new MCSignal(name, "muons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from light mesons from D hadron decays and no B in decay history", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromUpsilon1S") {
+  });
+  signals.emplace("muFromUpsilon1S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from Upsilon1S decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from Upsilon1S decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromUpsilon2S") {
+  });
+  signals.emplace("muFromUpsilon2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 100553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from Upsilon2S decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from Upsilon2S decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "muFromUpsilon3S") {
+  });
+  signals.emplace("muFromUpsilon3S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 200553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "muons from Upsilon3S decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "muons from Upsilon3S decays", {prong}, {-1});
     return signal;
-  }
+  });
 
   // Decay signal: Mother to electron: X -> e
-  if (nameStr == "AnythingToE") {
+  signals.emplace("AnythingToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {MCProng::kPDGCodeNotAssigned, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    prong.SetSignalInTime(true);                                            // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Decay of anything into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSignalInTime(true);                                                  // set direction to check for daughters (true, in time) or for mothers (false, back in time)
+    auto* signal = new MCSignal(name, "Decay of anything into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (nameStr == "LFQdecayToE") {
+  });
+  signals.emplace("LFQdecayToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {900, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
-    prong.SetSignalInTime(true);                                                       // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "LF meson  + quarkonia decays into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
+    prong.SetSignalInTime(true);                                                             // set direction to check for daughters (true, in time) or for mothers (false, back in time)
+    auto* signal = new MCSignal(name, "LF meson  + quarkonia decays into e", {prong}, {-1}); // pi0,eta,eta',rho,omega,phi,jpsi,psi2s mesons
     return signal;
-  }
-  if (nameStr == "HcToE") {
+  });
+  signals.emplace("HcToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {402, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "HbToE") {
+  });
+  signals.emplace("HbToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {502, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open beauty hadron decays into e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open beauty hadron decays into e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "McToE") {
+  });
+  signals.emplace("McToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {401, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed meson decays into e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open charmed meson decays into e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "MbToE") {
+  });
+  signals.emplace("MbToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {501, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open beauty meson decays into e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open beauty meson decays into e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "BcToE") {
+  });
+  signals.emplace("BcToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {4001, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed baryon decays into e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open charmed baryon decays into e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "BbToE") {
+  });
+  signals.emplace("BbToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {5001, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open beauty baryon decay into e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open beauty baryon decay into e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "PromptHcToE") {
+  });
+  signals.emplace("PromptHcToE", [](const char* name) -> MCSignal* {
     MCProng prong(3, {502, 402, 11}, {true, true, true}, {true, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open charmed hadron decays into e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "NonPromptHcToE") {
+  });
+  signals.emplace("NonPromptHcToE", [](const char* name) -> MCSignal* {
     MCProng prong(3, {502, 402, 11}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "b hadron decays to open charmed hadron decays to e", {prong}, {-1});
+    auto* signal = new MCSignal(name, "b hadron decays to open charmed hadron decays to e", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "HFdecayToE") {
+  });
+  signals.emplace("HFdecayToE", [](const char* name) -> MCSignal* {
     MCProng prong(2, {902, 11}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "AnyHFdecayToE") {
+  });
+  signals.emplace("AnyHFdecayToE", [](const char* name) -> MCSignal* {
     MCProng prong(1, {902}, {true}, {false}, {0}, {0}, {false}, true, {11}, {false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary, false);  // set source to be ALICE primary particles
     prong.SetSignalInTime(true); // set direction to check for daughters (true, in time) or for mothers (false, back in time)
-    signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Open charm and beauty to electrons", {prong}, {-1});
     return signal;
-  }
+  });
   //   if (nameStr == "LFQtoPC") {
   //   MCProng prong(3, {900, 22, 11}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
   //   prong.SetSignalInTime(true);  // set direction to check for daughters (true, in time) or for mothers (false, back in time)
@@ -885,1158 +890,1169 @@ MCSignal* o2::aod::dqmcsignals::GetMCSignal(const char* name)
 
   //_________________________________________________________________________________________________________________________
   // LMEE pair signals for LF, same mother
-  if (nameStr == "eeFromAnything") {
+  signals.emplace("eeFromAnything", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, MCProng::kPDGCodeNotAssigned}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from any decay", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from any decay", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromPi0") {
+  });
+  signals.emplace("eeFromPi0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eePrimaryFromPromptPi0") {
+  });
+  signals.emplace("eePrimaryFromPromptPi0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from prompt pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from prompt pi0 decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromEta") {
+  });
+  signals.emplace("eeFromEta", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 221}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from eta decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from eta decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromEtaprime") {
+  });
+  signals.emplace("eeFromEtaprime", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 331}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from eta' decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from eta' decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromRho") {
+  });
+  signals.emplace("eeFromRho", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 113}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from rho decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from rho decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromOmega") {
+  });
+  signals.emplace("eeFromOmega", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 223}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from omega decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from omega decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromPhi") {
+  });
+  signals.emplace("eeFromPhi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromJpsi") {
+  });
+  signals.emplace("eeFromJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromJpsiExclusive") {
+  });
+  signals.emplace("eeFromJpsiExclusive", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     signal->SetDecayChannelIsExclusive(2, true);
     return signal;
-  }
-  if (nameStr == "eeFromJpsiNotExclusive") {
+  });
+  signals.emplace("eeFromJpsiNotExclusive", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     signal->SetDecayChannelIsNotExclusive(2, true);
     return signal;
-  }
-  if (nameStr == "eePrimaryFromPromptJPsi") {
+  });
+  signals.emplace("eePrimaryFromPromptJPsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eePrimaryFromNonPromptJPsi") {
+  });
+  signals.emplace("eePrimaryFromNonPromptJPsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromPhi") {
+  });
+  signals.emplace("mumuFromPhi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 333}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from phi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromJpsi") {
+  });
+  signals.emplace("mumuFromJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromPromptJpsi") {
+  });
+  signals.emplace("mumuFromPromptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromNonPromptJpsi") {
+  });
+  signals.emplace("mumuFromNonPromptJpsi", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from non-prompt j/psi decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromPsi2S") {
+  });
+  signals.emplace("eeFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromPsi2S") {
+  });
+  signals.emplace("mumuFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromPromptPsi2S") {
+  });
+  signals.emplace("mumuFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromNonPromptPsi2S") {
+  });
+  signals.emplace("mumuFromNonPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "mumu pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from non-prompt psi2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromUpsilon1S") {
+  });
+  signals.emplace("mumuFromUpsilon1S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from upsilon1s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from upsilon1s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromUpsilon2S") {
+  });
+  signals.emplace("mumuFromUpsilon2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 100553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from upsilon2s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from upsilon2s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "mumuFromUpsilon3S") {
+  });
+  signals.emplace("mumuFromUpsilon3S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {13, 200553}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "mumu pairs from upsilon3s decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "mumu pairs from upsilon3s decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromLMeeLFQ") {
+  });
+  signals.emplace("eeFromLMeeLFQ", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromLMeeLF") {
+  });
+  signals.emplace("eeFromLMeeLF", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from light flavor meson decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromLMeeNoHFLFQ") {
+  });
+  signals.emplace("eeFromLMeeNoHFLFQ", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 900}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from light flavor meson + quarkonia decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
-  if (nameStr == "eeFromLMeeNoHFLF") {
+  });
+  signals.emplace("eeFromLMeeNoHFLF", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 901}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502, 402}, {true, true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from light flavor meson decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from light flavor meson decays not from open-HF decays", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
+  });
 
   // LMEE pair signals for HF
   // D0->e and D0->e
-  if (nameStr == "eeFromD0") {
+  signals.emplace("eeFromD0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from D0 decays, no beauty in history", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "ee pairs from D0 decays, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // D0->e and D0->e
-  if (nameStr == "eeFromPi0FromD0") {
+  signals.emplace("eeFromPi0FromD0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, kPi0, Pdg::kD0}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from D0 to Pi0 decays, no beauty in history", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "ee pairs from D0 to Pi0 decays, no beauty in history", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
   // D+/- -> e and D+/- -> e
-  if (nameStr == "eeFromChargedD") {
+  signals.emplace("eeFromChargedD", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from D+/- decays, no beauty in history", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "ee pairs from D+/- decays, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // D0 -> e and D+/- -> e
-  if (nameStr == "eeFromD0andChargedD") {
+  signals.emplace("eeFromD0andChargedD", [](const char* name) -> MCSignal* {
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from D0 and one e from D+/- decays, no beauty in history", {prongD0, prongDch}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from D0 and one e from D+/- decays, no beauty in history", {prongD0, prongDch}, {-1, -1});
     return signal;
-  }
+  });
 
   // D+/- -> e and D0 -> e
-  if (nameStr == "eeFromD0andChargedDBis") {
+  signals.emplace("eeFromD0andChargedDBis", [](const char* name) -> MCSignal* {
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from D+/- and one e from D0 decays, no beauty in history (inverse signal)", {prongDch, prongD0}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from D+/- and one e from D0 decays, no beauty in history (inverse signal)", {prongDch, prongD0}, {-1, -1});
     return signal;
-  }
+  });
 
   // D_s->e and D_s->e
-  if (nameStr == "eeFromDs") {
+  signals.emplace("eeFromDs", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, Pdg::kDS}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Ds +/- decays, no beauty in history", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "ee pairs from Ds +/- decays, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Lambda_c->e and Lambda_c->e
-  if (nameStr == "eeFromLambdaC") {
+  signals.emplace("eeFromLambdaC", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Lambda_c, no beauty in history", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "ee pairs from Lambda_c, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Lambda_c->e and D0->e
-  if (nameStr == "eeFromLambdaCandD0") {
+  signals.emplace("eeFromLambdaCandD0", [](const char* name) -> MCSignal* {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history", {prongLc, prongD0}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history", {prongLc, prongD0}, {-1, -1});
     return signal;
-  }
+  });
 
   // D0->e and Lambda_c->e
-  if (nameStr == "eeFromLambdaCandD0Bis") {
+  signals.emplace("eeFromLambdaCandD0Bis", [](const char* name) -> MCSignal* {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongD0(2, {kElectron, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongD0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history (inverse signal)", {prongD0, prongLc}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from Lambda_c and one e from D0 decays, no beauty in history (inverse signal)", {prongD0, prongLc}, {-1, -1});
     return signal;
-  }
+  });
 
   // Lambda_c->e and D+/- -> e
-  if (nameStr == "eeFromLambdaCandChargedD") {
+  signals.emplace("eeFromLambdaCandChargedD", [](const char* name) -> MCSignal* {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history", {prongLc, prongDch}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history", {prongLc, prongDch}, {-1, -1});
     return signal;
-  }
+  });
 
   // D+/- -> e and Lambda_c->e
-  if (nameStr == "eeFromLambdaCandChargedDBis") {
+  signals.emplace("eeFromLambdaCandChargedDBis", [](const char* name) -> MCSignal* {
     MCProng prongLc(2, {kElectron, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongDch(2, {kElectron, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongLc.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongDch.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history (inverse signal)", {prongDch, prongLc}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from Lambda_c and one e from D+/- decays, no beauty in history (inverse signal)", {prongDch, prongLc}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xic0 ->e and Xic0 ->e
-  if (nameStr == "eeFromXiC0") {
+  signals.emplace("eeFromXiC0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Xi_c0, no beauty in history", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "ee pairs from Xi_c0, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_c+ ->e and Xi_c+ ->e
-  if (nameStr == "eeFromXiCPlus") {
+  signals.emplace("eeFromXiCPlus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Xi_c+, no beauty in history", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "ee pairs from Xi_c+, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_c0 ->e and Xi_c+ ->e
-  if (nameStr == "eeFromXiC0andXiCPlus") {
+  signals.emplace("eeFromXiC0andXiCPlus", [](const char* name) -> MCSignal* {
     MCProng prongXiCPlus(2, {kElectron, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongXiC0(2, {kElectron, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongXiCPlus.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongXiC0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history", {prongXiCPlus, prongXiC0}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history", {prongXiCPlus, prongXiC0}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_c+ ->e and Xi_c0 ->e
-  if (nameStr == "eeFromXiC0andXiCPlusBis") {
+  signals.emplace("eeFromXiC0andXiCPlusBis", [](const char* name) -> MCSignal* {
     MCProng prongXiCPlus(2, {kElectron, Pdg::kXiCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     MCProng prongXiC0(2, {kElectron, Pdg::kXiC0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prongXiCPlus.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongXiC0.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history (inverse signal)", {prongXiC0, prongXiCPlus}, {-1, -1});
+    auto* signal = new MCSignal(name, "one e from Xi_c+ and one e from Xi_c0 decays, no beauty in history (inverse signal)", {prongXiC0, prongXiCPlus}, {-1, -1});
     return signal;
-  }
+  });
 
   // Xi_cc++ ->e and Xi_cc++ ->e
-  if (nameStr == "eeFromXiCPlusPlus") {
+  signals.emplace("eeFromXiCPlusPlus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {kElectron, Pdg::kXiCCPlusPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from Xi_cc++, no beauty in history", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal(name, "ee pairs from Xi_cc++, no beauty in history", {prong, prong}, {-1, -1});
     return signal;
-  }
+  });
 
   // c->e and c->e (no check)
-  if (nameStr == "eeFromCCNoCheck") {
+  signals.emplace("eeFromCCNoCheck", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from c->e and c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from c->e and c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // ee from HF in general
-  if (nameStr == "eeFromHF") {
+  signals.emplace("eeFromHF", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 902}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b,c->e and b,c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b,c->e and b,c->e without check", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any c in history but no b -> c -> e
-  if (nameStr == "eeFromPromptCandPromptC") {
+  signals.emplace("eeFromPromptCandPromptC", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true}); // check if mother pdg code is in history
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs with any charm but no beauty in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs with any charm but no beauty in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any b to any c in history b -> c -> e
-  if (nameStr == "eeFromAnyBtoCandAnyBtoC") {
+  signals.emplace("eeFromAnyBtoCandAnyBtoC", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false}); // check if mother pdg code is in history
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->c->e, b->c->e
-  if (nameStr == "eeFromBtoCandBtoC") {
+  signals.emplace("eeFromBtoCandBtoC", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs with any beauty to charm in decay chain", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any b->e and Any b->X->c->e
   // Looking at such decays: B -> (e) D -> (e)e and bar{B} -> e
   // Signal allows combinations of ee from the same B meson
   // + the combination of e fom B and e from bar{B}
-  if (nameStr == "eeFromBandAnyBtoC") {
+  signals.emplace("eeFromBandAnyBtoC", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false}); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->X->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->e and b->X->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // Any b->e and Any b->X->c->e
-  if (nameStr == "eeFromBandAnyBtoCBis") {
+  signals.emplace("eeFromBandAnyBtoCBis", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {false}); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->X->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->X->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e
-  if (nameStr == "eeFromBandBtoC") {
+  signals.emplace("eeFromBandBtoC", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "direkt ee pairs from b->e and b->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "direkt ee pairs from b->e and b->c->e", {prongB, prongBtoC}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e
-  if (nameStr == "eeFromBandBtoCBis") {
+  signals.emplace("eeFromBandBtoCBis", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->c->e and b->e", {prongBtoC, prongB}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e (same mother/grandmother)
   // require that the mother is the grandmother of the other electron
-  if (nameStr == "eeFromBandBtoCsameGM") {
+  signals.emplace("eeFromBandBtoCsameGM", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother = grandmother", {prongB, prongBtoC}, {1, 2}, false); // signal at pair level, accept commonAncestor Pairs
+    auto* signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother = grandmother", {prongB, prongBtoC}, {1, 2}, false); // signal at pair level, accept commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->c->e (same mother/grandmother)
   // require that the mother is the grandmother of the other electron
-  if (nameStr == "eeFromBandBtoCsameGMBis") {
+  signals.emplace("eeFromBandBtoCsameGMBis", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother = grandmother", {prongBtoC, prongB}, {2, 1}, false); // signal at pair level, accept commonAncestor Pairs
+    auto* signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother = grandmother", {prongBtoC, prongB}, {2, 1}, false); // signal at pair level, accept commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->c->e (different mother/grandmother)
   // require that the mother is not the grandmother of the other electron
-  if (nameStr == "eeFromBandBtoCdiffGM") {
+  signals.emplace("eeFromBandBtoCdiffGM", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother != grandmother", {prongB, prongBtoC}, {1, 2}, true); // signal at pair level, exclude commonAncestor Pairs
+    auto* signal = new MCSignal(name, "ee pairs from b->e and b->c->e, mother != grandmother", {prongB, prongBtoC}, {1, 2}, true); // signal at pair level, exclude commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->c->e (different mother/grandmother)
   // require that the mother is not the grandmother of the other electron
-  if (nameStr == "eeFromBandBtoCdiffGMBis") {
+  signals.emplace("eeFromBandBtoCdiffGMBis", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false); // check if mother pdg code is in history
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother != grandmother", {prongBtoC, prongB}, {2, 1}, true); // signal at pair level, exclude commonAncestor Pairs
+    auto* signal = new MCSignal(name, "ee pairs from b->c->e and b->e, mother != grandmother", {prongBtoC, prongB}, {2, 1}, true); // signal at pair level, exclude commonAncestor Pairs
     return signal;
-  }
+  });
 
   // b->e and b->e
-  if (nameStr == "eeFromBB") {
+  signals.emplace("eeFromBB", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->e (commonAncestors)
-  if (nameStr == "eeFromSameB") {
+  signals.emplace("eeFromSameB", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {1, 1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->e and b->e", {prong, prong}, {1, 1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and c->e no check
-  if (nameStr == "eeFromBandFromC") {
+  signals.emplace("eeFromBandFromC", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongB, prongC}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongB, prongC}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and c->e no check
-  if (nameStr == "eeFromBandFromCBis") {
+  signals.emplace("eeFromBandFromCBis", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongC(2, {11, 402}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongC, prongB}, {-1, -1}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->e and c->e", {prongC, prongB}, {-1, -1}); // signal at pair level
     return signal;
-  }
+  });
 
   // b->e and b->c->e (single b)
-  if (nameStr == "eeFromSingleBandBtoC") {
+  signals.emplace("eeFromSingleBandBtoC", [](const char* name) -> MCSignal* {
     MCProng prongB(2, {11, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prongB.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongBtoC(3, {11, 402, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prongBtoC.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "ee pairs from b->e and b->c->e (single b)", {prongB, prongBtoC}, {1, 2}); // signal at pair level
+    auto* signal = new MCSignal(name, "ee pairs from b->e and b->c->e (single b)", {prongB, prongBtoC}, {1, 2}); // signal at pair level
     return signal;
-  }
+  });
 
   //_________________________________________________________________________________________________________________________
 
-  if (nameStr == "kaonFromBplus") {
+  signals.emplace("kaonFromBplus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "kaonFromBplusHistory") {
+  signals.emplace("kaonFromBplusHistory", [](const char* name) -> MCSignal* {
     MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}, false, {521}, {false});
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "kaonPrimaryFromBplusHistory") {
+  signals.emplace("kaonPrimaryFromBplusHistory", [](const char* name) -> MCSignal* {
     MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}, false, {521}, {false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "kaonPrimaryFromBplusFS") {
+  signals.emplace("kaonPrimaryFromBplusFS", [](const char* name) -> MCSignal* {
     MCProng prong(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prong.SetSourceBit(1, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "kaonFromAnyBHistory") {
+  signals.emplace("kaonFromAnyBHistory", [](const char* name) -> MCSignal* {
     MCProng prong(1, {321}, {true}, {false}, {0}, {0}, {false}, false, {503}, {false});
-    signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Kaons from B+ decays", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "JpsiFromBplus") {
+  signals.emplace("JpsiFromBplus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Jpsi from B+ decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eFromJpsiFromBplus") {
+  signals.emplace("eFromJpsiFromBplus", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "electronFromJpsiFromBplus") {
+  signals.emplace("electronFromJpsiFromBplus", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 521}, {false, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Electrons from Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "positronFromJpsiFromBplus") {
+  signals.emplace("positronFromJpsiFromBplus", [](const char* name) -> MCSignal* {
     MCProng prong(3, {-11, 443, 521}, {false, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Positrons from Jpsi from B+ decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Positrons from Jpsi from B+ decays", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromJpsiFromBplus") {
+  signals.emplace("eeFromJpsiFromBplus", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from B+ decays", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from B+ decays", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromBplus") {
+  signals.emplace("eeKaonFromBplus", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromJpsiKaonAny") {
+  signals.emplace("eeFromJpsiKaonAny", [](const char* name) -> MCSignal* {
     MCProng pronge(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongKaon(1, {321}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Kaon and electron pair", {pronge, pronge, prongKaon}, {-1, -1, -1});
+    auto* signal = new MCSignal(name, "Kaon and electron pair", {pronge, pronge, prongKaon}, {-1, -1, -1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromBplusExclusive") {
+  signals.emplace("eeKaonFromBplusExclusive", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
     signal->SetDecayChannelIsExclusive(2, true);
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromBplusNotExclusive") {
+  signals.emplace("eeKaonFromBplusNotExclusive", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon and electron pair from B+", {pronge, pronge, prongKaon}, {2, 2, 1});
     signal->SetDecayChannelIsNotExclusive(2, true);
     return signal;
-  }
+  });
 
   // correlated background
-  if (nameStr == "eePionFromBplus") {
+  signals.emplace("eePionFromBplus", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {211, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Pion and electron pair from B+", {pronge, pronge, prongPion}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Pion and electron pair from B+", {pronge, pronge, prongPion}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromBplusViaEverything") {
+  signals.emplace("eeKaonFromBplusViaEverything", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(3, {321, 0, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B+ via everything", {pronge, pronge, prongKaon}, {2, 2, 2});
+    auto* signal = new MCSignal(name, "Kaon and electron pair from B+ via everything", {pronge, pronge, prongKaon}, {2, 2, 2});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromB0") {
+  signals.emplace("eeKaonFromB0", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 511}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 511}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePionFromB0ViaEverything") { // catching feed-down for B0
+  signals.emplace("eePionFromB0ViaEverything", [](const char* name) -> MCSignal* { // catching feed-down for B0
     MCProng pronge(3, {11, 443, 511}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(3, {211, 0, 511}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Pion and electron pair from B0", {pronge, pronge, prongPion}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Pion and electron pair from B0", {pronge, pronge, prongPion}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromOpenBeautyMesons") {
+  signals.emplace("eeKaonFromOpenBeautyMesons", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 501}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 501}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Excited kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 2});
+    auto* signal = new MCSignal(name, "Excited kaon and electron pair from B0", {pronge, pronge, prongKaon}, {2, 2, 2});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromOpenBeautyHadrons") {
+  signals.emplace("eeKaonFromOpenBeautyHadrons", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 502}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 502}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from open beauty hadrons", {pronge, pronge, prongKaon}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon and electron pair from open beauty hadrons", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonFromLambdaB") {
+  signals.emplace("eeKaonFromLambdaB", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 5122}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 5122}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and electron pair from lambda B", {pronge, pronge, prongKaon}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon and electron pair from lambda B", {pronge, pronge, prongKaon}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonPion0FromBplus") {
+  signals.emplace("eeKaonPion0FromBplus", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {111, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, pi0 and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Kaon, pi0 and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonEtaFromBplus") {
+  signals.emplace("eeKaonEtaFromBplus", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongEta(2, {221, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, eta and electron pair from B+", {pronge, pronge, prongKaon, prongEta}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Kaon, eta and electron pair from B+", {pronge, pronge, prongKaon, prongEta}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonOmegaFromBplus") {
+  signals.emplace("eeKaonOmegaFromBplus", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongOmega(2, {223, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, omega and electron pair from B+", {pronge, pronge, prongKaon, prongOmega}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Kaon, omega and electron pair from B+", {pronge, pronge, prongKaon, prongOmega}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeKaonPionFromBplus") {
+  signals.emplace("eeKaonPionFromBplus", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 521}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongKaon(2, {321, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, 521}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon, pion and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Kaon, pion and electron pair from B+", {pronge, pronge, prongKaon, prongPion}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "Bplus") {
+  signals.emplace("Bplus", [](const char* name) -> MCSignal* {
     MCProng prong(1, {521}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "B+", {prong}, {-1});
+    auto* signal = new MCSignal(name, "B+", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "BplusFS") {
+  signals.emplace("BplusFS", [](const char* name) -> MCSignal* {
     MCProng prong(1, {521}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "B+", {prong}, {-1});
+    auto* signal = new MCSignal(name, "B+", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "beautyPairs") {
+  signals.emplace("beautyPairs", [](const char*) -> MCSignal* {
     MCProng prong(1, {503}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal("beautyPairs", "Beauty hadron pair", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal("beautyPairs", "Beauty hadron pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "everythingFromBeautyPairs") {
+  });
+  signals.emplace("everythingFromBeautyPairs", [](const char*) -> MCSignal* {
     MCProng prong(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal("everythingFromBeautyPairs", "Everything from beauty hadrons pair", {prong, prong}, {-1, -1});
+    auto* signal = new MCSignal("everythingFromBeautyPairs", "Everything from beauty hadrons pair", {prong, prong}, {-1, -1});
     return signal;
-  }
-  if (nameStr == "everythingFromEverythingFromBeautyPairsCM") {
+  });
+  signals.emplace("everythingFromEverythingFromBeautyPairsCM", [](const char*) -> MCSignal* {
     MCProng prong(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal("everythingFromEverythingFromBeautyPairs", "Everything from everything from beauty hadrons pair with common grand-mother", {prong, prong}, {2, 2});
+    auto* signal = new MCSignal("everythingFromEverythingFromBeautyPairs", "Everything from everything from beauty hadrons pair with common grand-mother", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (nameStr == "everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs") {
+  });
+  signals.emplace("everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs", [](const char*) -> MCSignal* {
     MCProng prong1(3, {0, 0, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prong2(2, {0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal("everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs", "Everything beauty and everything from everything from beauty hadrons pair", {prong1, prong2}, {2, 1});
+    auto* signal = new MCSignal("everythingFromBeautyANDeverythingFromEverythingFromBeautyPairs", "Everything beauty and everything from everything from beauty hadrons pair", {prong1, prong2}, {2, 1});
     return signal;
-  }
+  });
 
   //------------------------------------------------------------------------------------
 
-  if (nameStr == "D0") {
+  signals.emplace("D0", [](const char* name) -> MCSignal* {
     MCProng prong(1, {Pdg::kD0}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D0", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D0", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "nonPromptD0") {
+  });
+  signals.emplace("nonPromptD0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {Pdg::kD0, 503}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Non-prompt D0", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Non-prompt D0", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "D0FS") {
+  });
+  signals.emplace("D0FS", [](const char* name) -> MCSignal* {
     MCProng prong(1, {Pdg::kD0}, {true}, {false}, {0}, {0}, {false});
     prong.SetSourceBit(0, MCProng::kHEPMCFinalState);
-    signal = new MCSignal(name, "D0", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D0", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "KPiFromD0") {
+  });
+  signals.emplace("KPiFromD0", [](const char* name) -> MCSignal* {
     MCProng prongKaon(2, {321, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and pion pair from D0", {prongKaon, prongPion}, {1, 1});
+    auto* signal = new MCSignal(name, "Kaon and pion pair from D0", {prongKaon, prongPion}, {1, 1});
     return signal;
-  }
-  if (nameStr == "KPiFromD0Reflected") {
+  });
+  signals.emplace("KPiFromD0Reflected", [](const char* name) -> MCSignal* {
     MCProng prongFalseKaon(2, {211, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongFalsePion(2, {321, Pdg::kD0}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon and pion pair from D0 with reflected mass assumption", {prongFalseKaon, prongFalsePion}, {1, 1});
+    auto* signal = new MCSignal(name, "Kaon and pion pair from D0 with reflected mass assumption", {prongFalseKaon, prongFalsePion}, {1, 1});
     return signal;
-  }
-  if (nameStr == "Dcharged") {
+  });
+  signals.emplace("Dcharged", [](const char* name) -> MCSignal* {
     MCProng prong(1, {Pdg::kDPlus}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D+/-", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D+/-", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Dplus") {
+  });
+  signals.emplace("Dplus", [](const char* name) -> MCSignal* {
     MCProng prong(1, {Pdg::kDPlus}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D+", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D+", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "Dminus") {
+  });
+  signals.emplace("Dminus", [](const char* name) -> MCSignal* {
     MCProng prong(1, {-Pdg::kDPlus}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D+", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D+", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "KPiPiFromDcharged") {
+  });
+  signals.emplace("KPiPiFromDcharged", [](const char* name) -> MCSignal* {
     MCProng prongKaon(2, {321, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D+/-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
+    auto* signal = new MCSignal(name, "Kaon pion pion triplet from D+/-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
     return signal;
-  }
-  if (nameStr == "KPiPiFromDplus") {
+  });
+  signals.emplace("KPiPiFromDplus", [](const char* name) -> MCSignal* {
     MCProng prongKaon(2, {-321, Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D+", {prongKaon, prongPion, prongPion}, {1, 1, 1});
+    auto* signal = new MCSignal(name, "Kaon pion pion triplet from D+", {prongKaon, prongPion, prongPion}, {1, 1, 1});
     return signal;
-  }
-  if (nameStr == "KPiPiFromDminus") {
+  });
+  signals.emplace("KPiPiFromDminus", [](const char* name) -> MCSignal* {
     MCProng prongKaon(2, {321, -Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {-211, -Pdg::kDPlus}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
+    auto* signal = new MCSignal(name, "Kaon pion pion triplet from D-", {prongKaon, prongPion, prongPion}, {1, 1, 1});
     return signal;
-  }
-  if (nameStr == "Dstar") {
+  });
+  signals.emplace("Dstar", [](const char* name) -> MCSignal* {
     MCProng prong(1, {Pdg::kDStar}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D*", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D*", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "DstarPlus") {
+  });
+  signals.emplace("DstarPlus", [](const char* name) -> MCSignal* {
     MCProng prong(1, {Pdg::kDStar}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D*+", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D*+", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "DstarMinus") {
+  });
+  signals.emplace("DstarMinus", [](const char* name) -> MCSignal* {
     MCProng prong(1, {-Pdg::kDStar}, {false}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "D*-", {prong}, {-1});
+    auto* signal = new MCSignal(name, "D*-", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "pionFromDstar") {
+  });
+  signals.emplace("pionFromDstar", [](const char* name) -> MCSignal* {
     MCProng prong(2, {211, Pdg::kDStar}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Pions from D* decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Pions from D* decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "D0FromDstar") {
+  });
+  signals.emplace("D0FromDstar", [](const char* name) -> MCSignal* {
     MCProng prong(2, {Pdg::kD0, Pdg::kDStar}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "D0 from D* decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "D0 from D* decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "KFromD0FromDstar") {
+  });
+  signals.emplace("KFromD0FromDstar", [](const char* name) -> MCSignal* {
     MCProng prong(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Kaons from D0 from D* decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Kaons from D0 from D* decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "PiFromD0FromDstar") {
+  });
+  signals.emplace("PiFromD0FromDstar", [](const char* name) -> MCSignal* {
     MCProng prong(3, {211, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Pions from D0 from D* decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Pions from D0 from D* decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "KPiFromD0FromDstar") {
+  });
+  signals.emplace("KPiFromD0FromDstar", [](const char* name) -> MCSignal* {
     MCProng prongKaon(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Kaon and pion pair from D0 from D* decay", {prongKaon, prongPion}, {1, 1});
+    auto* signal = new MCSignal(name, "Kaon and pion pair from D0 from D* decay", {prongKaon, prongPion}, {1, 1});
     return signal;
-  }
-  if (nameStr == "KPiPiFromD0FromDstar") {
+  });
+  signals.emplace("KPiPiFromD0FromDstar", [](const char* name) -> MCSignal* {
     MCProng prongKaon(3, {321, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPionSecondary(3, {211, Pdg::kD0, Pdg::kDStar}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {211, Pdg::kDStar}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D*", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon pion pion triplet from D*", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
     return signal;
-  }
-  if (nameStr == "KPiPiFromD0FromDstarPlus") {
+  });
+  signals.emplace("KPiPiFromD0FromDstarPlus", [](const char* name) -> MCSignal* {
     MCProng prongKaon(3, {-321, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPionSecondary(3, {211, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {211, Pdg::kDStar}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D*+", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon pion pion triplet from D*+", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
     return signal;
-  }
-  if (nameStr == "KPiPiFromD0FromDstarMinus") {
+  });
+  signals.emplace("KPiPiFromD0FromDstarMinus", [](const char* name) -> MCSignal* {
     MCProng prongKaon(3, {321, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPionSecondary(3, {-211, Pdg::kD0, Pdg::kDStar}, {false, false, false}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPion(2, {-211, Pdg::kDStar}, {false, false}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Kaon pion pion triplet from D*-", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Kaon pion pion triplet from D*-", {prongKaon, prongPionSecondary, prongPion}, {2, 2, 1});
     return signal;
-  }
-  if (nameStr == "KFromDplus") {
+  });
+  signals.emplace("KFromDplus", [](const char* name) -> MCSignal* {
     MCProng prong(2, {321, Pdg::kDPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {502}, {true});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Kaons from D+/- decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Kaons from D+/- decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "LambdaC") {
+  });
+  signals.emplace("LambdaC", [](const char* name) -> MCSignal* {
     MCProng prong(1, {Pdg::kLambdaCPlus}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Lambda_c", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Lambda_c", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "PrKPiFromLambdaC") {
+  });
+  signals.emplace("PrKPiFromLambdaC", [](const char* name) -> MCSignal* {
     MCProng prongProton(2, {2212, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongKaon(2, {321, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPion(2, {211, Pdg::kLambdaCPlus}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Proton kaon pion triplet from Lambda_c+/-", {prongProton, prongKaon, prongPion}, {1, 1, 1});
+    auto* signal = new MCSignal(name, "Proton kaon pion triplet from Lambda_c+/-", {prongProton, prongKaon, prongPion}, {1, 1, 1});
     return signal;
-  }
+  });
 
   //--------------------------------------------------------------------------------
 
-  if (nameStr == "JpsiFromChic0") {
+  signals.emplace("JpsiFromChic0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 10441}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic0 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Jpsi from Chic0 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "eFromJpsiFromChic0") {
+  });
+  signals.emplace("eFromJpsiFromChic0", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 10441}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Jpsi from Chic0 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Electrons from Jpsi from Chic0 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "eeFromJpsiFromChic0") {
+  });
+  signals.emplace("eeFromJpsiFromChic0", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 10441}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic0 decays", {prong, prong}, {2, 2});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from Chic0 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (nameStr == "JpsiFromChic1") {
+  });
+  signals.emplace("JpsiFromChic1", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 20443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic1 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Jpsi from Chic1 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "eFromJpsiFromChic1") {
+  });
+  signals.emplace("eFromJpsiFromChic1", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 20443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Jpsi from Chic1 decays", {prong}, {2});
+    auto* signal = new MCSignal(name, "Electrons from Jpsi from Chic1 decays", {prong}, {2});
     return signal;
-  }
-  if (nameStr == "eeFromJpsiFromChic1") {
+  });
+  signals.emplace("eeFromJpsiFromChic1", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 20443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic1 decays", {prong, prong}, {2, 2});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from Chic1 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (nameStr == "JpsiFromChic2") {
+  });
+  signals.emplace("JpsiFromChic2", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 445}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic2 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Jpsi from Chic2 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "JpsiFromChic2") {
-    MCProng prong(2, {443, 904}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Jpsi from Chic0, Chic1 or Chic2 decays", {prong}, {1});
-    return signal;
-  }
-  if (nameStr == "eFromJpsiFromChic2") {
+  });
+  signals.emplace("eFromJpsiFromChic2", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 445}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electrons from Jpsi from Chic2 decays", {prong}, {2});
+    auto* signal = new MCSignal(name, "Electrons from Jpsi from Chic2 decays", {prong}, {2});
     return signal;
-  }
-  if (nameStr == "eeFromJpsiFromChic2") {
+  });
+  signals.emplace("eeFromJpsiFromChic2", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 445}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic2 decays", {prong, prong}, {2, 2});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from Chic2 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (nameStr == "eeFromJpsiFromChic012") {
+  });
+  signals.emplace("eeFromJpsiFromChic012", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 904}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Electron pair from Jpsi from Chic0, Chic1 or Chic2 decays", {prong, prong}, {2, 2});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from Chic0, Chic1 or Chic2 decays", {prong, prong}, {2, 2});
     return signal;
-  }
-  if (nameStr == "PhotonFromChic0") {
+  });
+  signals.emplace("PhotonFromChic0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {22, 10441}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic0 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Photon from Chic0 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "PhotonFromChic1") {
+  });
+  signals.emplace("PhotonFromChic1", [](const char* name) -> MCSignal* {
     MCProng prong(2, {22, 20443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic1 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Photon from Chic1 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "PhotonFromChic2") {
+  });
+  signals.emplace("PhotonFromChic2", [](const char* name) -> MCSignal* {
     MCProng prong(2, {22, 445}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic2 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Photon from Chic2 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "PhotonFromChic012") {
+  });
+  signals.emplace("PhotonFromChic012", [](const char* name) -> MCSignal* {
     MCProng prong(2, {22, 904}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Chic0, Chic1, and Chic2 decays", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Photon from Chic0, Chic1, and Chic2 decays", {prong}, {-1});
     return signal;
-  }
-  if (nameStr == "PhotonFromPi0") {
+  });
+  signals.emplace("PhotonFromPi0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {22, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     // prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon from Pi0 decays", {prong}, {1});
+    auto* signal = new MCSignal(name, "Photon from Pi0 decays", {prong}, {1});
     return signal;
-  }
-  if (nameStr == "PhotonPhotonFromPi0") {
+  });
+  signals.emplace("PhotonPhotonFromPi0", [](const char* name) -> MCSignal* {
     MCProng prong(2, {22, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     prong.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon Photon from Pi0 decays", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Photon Photon from Pi0 decays", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePhotonFromChic1") {
+  signals.emplace("eePhotonFromChic1", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 20443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPhoton(2, {22, 20443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Chic1", {pronge, pronge, prongPhoton}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Photon and electron pair from Chic1", {pronge, pronge, prongPhoton}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePhotonFromChic2") {
+  signals.emplace("eePhotonFromChic2", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 445}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPhoton(2, {22, 445}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Photon and electron pair from Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePhotonFromChic12") {
+  signals.emplace("eePhotonFromChic12", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, MCProng::kPDGCodeNotAssigned}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPhoton(2, {22, MCProng::kPDGCodeNotAssigned}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Chic0, Chic1 and Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
+    auto* signal = new MCSignal(name, "Photon and electron pair from Chic0, Chic1 and Chic2", {pronge, pronge, prongPhoton}, {2, 2, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePhotonFromPi0") {
+  signals.emplace("eePhotonFromPi0", [](const char* name) -> MCSignal* {
     MCProng pronge(2, {11, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPhoton(2, {22, 111}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     prongPhoton.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "Photon and electron pair from Pi0", {pronge, pronge, prongPhoton}, {1, 1, 1});
+    auto* signal = new MCSignal(name, "Photon and electron pair from Pi0", {pronge, pronge, prongPhoton}, {1, 1, 1});
     return signal;
-  }
+  });
 
   //--------------------------------------------------------------------------------
 
-  if (nameStr == "X3872") {
+  signals.emplace("X3872", [](const char* name) -> MCSignal* {
     MCProng prong(1, {9920443}, {true}, {false}, {0}, {0}, {false});
-    signal = new MCSignal(name, "Inclusive X(3872)", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Inclusive X(3872)", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "JpsiFromX3872") {
+  signals.emplace("JpsiFromX3872", [](const char* name) -> MCSignal* {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {9920443}, {false});
-    signal = new MCSignal(name, "Jpsi from X3872", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Jpsi from X3872", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eFromX3872") {
+  signals.emplace("eFromX3872", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 9920443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electron from Jpsi from X3872", {prong}, {1});
+    auto* signal = new MCSignal(name, "Electron from Jpsi from X3872", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "PionFromX3872") {
+  signals.emplace("PionFromX3872", [](const char* name) -> MCSignal* {
     MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false}, false, {9920443}, {false});
-    signal = new MCSignal(name, "Pion from Jpsi from X3872", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Pion from Jpsi from X3872", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "JpsiFromPsi2S") {
+  signals.emplace("JpsiFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {443}, {true}, {false}, {0}, {0}, {false}, false, {100443}, {false});
-    signal = new MCSignal(name, "Jpsi from Psi2S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Jpsi from Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "JpsiFromPromptPsi2S") {
+  signals.emplace("JpsiFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Jpsi from prompt Psi2S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Jpsi from prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "JpsiFromNonpromptPsi2S") {
+  signals.emplace("JpsiFromNonpromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {443, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Jpsi from non-prompt Psi2S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Jpsi from non-prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eFromJpsiFromPsi2S") {
+  signals.emplace("eFromJpsiFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
-    signal = new MCSignal(name, "Electron from Jpsi from Psi2S", {prong}, {1});
+    auto* signal = new MCSignal(name, "Electron from Jpsi from Psi2S", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eFromJpsiFromPromptPsi2S") {
+  signals.emplace("eFromJpsiFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electron from Jpsi from prompt Psi2S", {prong}, {1});
+    auto* signal = new MCSignal(name, "Electron from Jpsi from prompt Psi2S", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eFromJpsiFromNonpromptPsi2S") {
+  signals.emplace("eFromJpsiFromNonpromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electron from Jpsi from non-prompt Psi2S", {prong}, {1});
+    auto* signal = new MCSignal(name, "Electron from Jpsi from non-prompt Psi2S", {prong}, {1});
     return signal;
-  }
+  });
 
-  if (nameStr == "PionFromPsi2S") {
+  signals.emplace("PionFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(1, {211}, {true}, {false}, {0}, {0}, {false}, false, {100443}, {false});
-    signal = new MCSignal(name, "Pion from Jpsi from Psi2S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Pion from Jpsi from Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "PionFromPromptPsi2S") {
+  signals.emplace("PionFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Pion from prompt Psi2S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Pion from prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "PionFromNonpromptPsi2S") {
+  signals.emplace("PionFromNonpromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Pion from non-prompt Psi2S", {prong}, {-1});
+    auto* signal = new MCSignal(name, "Pion from non-prompt Psi2S", {prong}, {-1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromJpsiFromX3872") {
+  signals.emplace("eeFromJpsiFromX3872", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {9920443}, {false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from X3872", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from X3872", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "JpsiPiPiFromX3872") {
+  signals.emplace("JpsiPiPiFromX3872", [](const char* name) -> MCSignal* {
     MCProng prongJpsi(2, {443, 9920443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPi(2, {211, 9920443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Jpsi and pion pair from X3872", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
+    auto* signal = new MCSignal(name, "Jpsi and pion pair from X3872", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePiPiFromX3872") {
+  signals.emplace("eePiPiFromX3872", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 9920443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPi(2, {211, 9920443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electron pair and pion pair from X3872", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Electron pair and pion pair from X3872", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromJpsiFromPsi2S") {
+  signals.emplace("eeFromJpsiFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {100443}, {false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from Psi2S", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from Psi2S", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromJpsiFromPromptPsi2S") {
+  signals.emplace("eeFromJpsiFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electron pair from Jpsi from prompt Psi2S", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from prompt Psi2S", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromJpsiFromNonpromptPsi2S") {
+  signals.emplace("eeFromJpsiFromNonpromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng prong(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electron pair from Jpsi from non-prompt Psi2S", {prong, prong}, {1, 1});
+    auto* signal = new MCSignal(name, "Electron pair from Jpsi from non-prompt Psi2S", {prong, prong}, {1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "JpsiPiPiFromPsi2S") {
+  signals.emplace("JpsiPiPiFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng prongJpsi(2, {443, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Jpsi and pion pair from Psi2S", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
+    auto* signal = new MCSignal(name, "Jpsi and pion pair from Psi2S", {prongJpsi, prongPi, prongPi}, {1, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePiPiFromPsi2S") {
+  signals.emplace("eePiPiFromPsi2S", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
-    signal = new MCSignal(name, "Electron pair and pion pair from Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Electron pair and pion pair from Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePiPiFromPromptPsi2S") {
+  signals.emplace("eePiPiFromPromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {true});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
-    signal = new MCSignal(name, "Electron pair and pion pair from prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Electron pair and pion pair from prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eePiPiFromNonpromptPsi2S") {
+  signals.emplace("eePiPiFromNonpromptPsi2S", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 100443}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false}, false, {503}, {false});
     MCProng prongPi(2, {211, 100443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {false});
-    signal = new MCSignal(name, "Electron pair and pion pair from non-prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
+    auto* signal = new MCSignal(name, "Electron pair and pion pair from non-prompt Psi2S", {pronge, pronge, prongPi, prongPi}, {2, 2, 1, 1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromPromptJpsiAnyPrimary") {
+  signals.emplace("eeFromPromptJpsiAnyPrimary", [](const char* name) -> MCSignal* {
     MCProng pronge(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false}, false, {503}, {true});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongPrimary(1);
     prongPrimary.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
+    auto* signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromJpsiAnyPrimary") {
+  signals.emplace("eeFromJpsiAnyPrimary", [](const char* name) -> MCSignal* {
     MCProng pronge(2, {11, 443}, {true, true}, {false, false}, {0, 0}, {0, 0}, {false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongPrimary(1);
     prongPrimary.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
+    auto* signal = new MCSignal(name, "anyprimary and electron pair from prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
     return signal;
-  }
+  });
 
-  if (nameStr == "eeFromNonPromptJpsiAnyPrimary") {
+  signals.emplace("eeFromNonPromptJpsiAnyPrimary", [](const char* name) -> MCSignal* {
     MCProng pronge(3, {11, 443, 503}, {true, true, true}, {false, false, false}, {0, 0, 0}, {0, 0, 0}, {false, false, false});
     pronge.SetSourceBit(0, MCProng::kPhysicalPrimary);
     MCProng prongPrimary(1);
     prongPrimary.SetSourceBit(0, MCProng::kPhysicalPrimary);
-    signal = new MCSignal(name, "anyprimary and electron pair from non-prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
+    auto* signal = new MCSignal(name, "anyprimary and electron pair from non-prompt jpsi", {pronge, pronge, prongPrimary}, {1, 1, -1});
     return signal;
+  });
+}
+} // namespace
+
+//_______________________________________________________________________________________________
+MCSignal* o2::aod::dqmcsignals::GetMCSignal(const char* name)
+{
+  //
+  // the signals are registered once, at the first call, and then looked up by name
+  //
+  static const MCSignalRegistry registry = [] {
+    MCSignalRegistry signals;
+    RegisterMCSignals(signals);
+    return signals;
+  }();
+  if (auto it = registry.find(name); it != registry.end()) {
+    return it->second(name);
   }
   return nullptr;
 }
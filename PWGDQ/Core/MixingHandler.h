@@ -23,10 +23,13 @@
 
 #include <Rtypes.h>
 
-#include <array>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <map>
+#include <span>
+#include <utility>
 #include <vector>
 
 class MixingHandler : public TNamed
@@ -39,24 +42,68 @@ class MixingHandler : public TNamed
     float eta;
     float phi;
     uint32_t filteringFlags;
-    // Clear a bit once the track was used in mixing for that bit for the required pool depth.
-    void ClearBit(uint32_t mask) { filteringFlags &= ~mask; }
     void Print() const
     {
       std::cout << "pt: " << pt << ", eta: " << eta << ", phi: " << phi << ", filteringFlags: " << filteringFlags << std::endl;
     }
   };
 
+  // Container of mixing tracks with SoA storage (one contiguous array per track property).
+  // Iterating over the container yields MixingTrack objects, so it can be used as a std::vector<MixingTrack>
+  // in range-based loops; the columns can also be accessed directly as spans.
+  struct MixingTracks {
+    std::vector<float> pt;
+    std::vector<float> eta;
+    std::vector<float> phi;
+    std::vector<uint32_t> filteringFlags;
+
+    struct Iterator {
+      const MixingTracks* tracks;
+      std::size_t index;
+      MixingTrack operator*() const { return (*tracks)[index]; }
+      Iterator& operator++()
+      {
+        ++index;
+        return *this;
+      }
+      bool operator==(const Iterator& other) const { return index == other.index; }
+      bool operator!=(const Iterator& other) const { return index != other.index; }
+    };
+
+    void push_back(const MixingTrack& track)
+    {
+      pt.push_back(track.pt);
+      eta.push_back(track.eta);
+      phi.push_back(track.phi);
+      filteringFlags.push_back(track.filteringFlags);
+    }
+    // clear the tracks, keeping the allocated memory
+    void clear()
+    {
+      pt.clear();
+      eta.clear();
+      phi.clear();
+      filteringFlags.clear();
+    }
+    std::size_t size() const { return pt.size(); }
+    bool empty() const { return pt.empty(); }
+    MixingTrack operator[](std::size_t i) const { return {pt[i], eta[i], phi[i], filteringFlags[i]}; }
+    Iterator begin() const { return {this, 0}; }
+    Iterator end() const { return {this, size()}; }
+    std::span<const float> Pt() const { return pt; }
+    std::span<const float> Eta() const { return eta; }
+    std::span<const float> Phi() const { return phi; }
+    std::span<const uint32_t> FilteringFlags() const { return filteringFlags; }
+  };
+
   // Struct to define events used in mixing and few utility functions.
-  // An event is defined as two vectors of tracks (typically the legs of a two-body
+  // An event is defined as two lists of tracks (typically the legs of a two-body
   // decay or the two-particles in a correlation analysis)
   struct MixingEvent {
-    std::vector<MixingTrack> tracks1;
-    std::vector<MixingTrack> tracks2;
+    MixingTracks tracks1;
+    MixingTracks tracks2;
     // bit map for active filtering bits of all the tracks
     uint32_t filteringMask = 0;
-    // counters to keep track of how many times the event was used for mixing (for each track cut separately)
-    std::array<int16_t, 64> counters = {0};
     // add a track to the event and update the filtering mask accordingly
     void AddTrack1(const MixingTrack& track)
     {
@@ -70,41 +117,12 @@ class MixingHandler : public TNamed
     }
     // Clear bits in the filtering mask.
     void ClearFilteringMask(uint32_t mask) { filteringMask &= ~mask; }
-    // 1) increment the counters for a given track cut bit mask and if the counters reached the pool depth,
-    // 2) clear the corresponding bit in the tracks filtering flags to exclude them from further mixing
-    // 3) for each track, if there are no more active bits in the filtering mask, then remove the track from the event
-    void IncrementCounters(uint32_t mask, int16_t poolDepth)
+    // Remove all tracks, keeping the allocated memory
+    void Clear()
     {
-      for (int i = 0; i < 32; i++) {
-        uint32_t bitMask = (static_cast<uint32_t>(1) << i);
-        if (mask & bitMask) {
-          counters[i]++;
-          if (counters[i] >= poolDepth) {
-            for (auto& track : tracks1) {
-              track.ClearBit(bitMask);
-            }
-            for (auto track = tracks1.begin(); track != tracks1.end();) {
-              if (track->filteringFlags == 0) {
-                track = tracks1.erase(track);
-              } else {
-                ++track;
-              }
-            }
-
-            for (auto& track : tracks2) {
-              track.ClearBit(bitMask);
-            }
-            for (auto track = tracks2.begin(); track != tracks2.end();) {
-              if (track->filteringFlags == 0) {
-                track = tracks2.erase(track);
-              } else {
-                ++track;
-              }
-            }
-            ClearFilteringMask(bitMask);
-          }
-        }
-      }
+      tracks1.clear();
+      tracks2.clear();
+      filteringMask = 0;
     }
     void Print() const
     {
@@ -117,11 +135,6 @@ class MixingHandler : public TNamed
         }
       }
       std::cout << std::endl;
-      for (int i = 0; i < 32; i++) {
-        if (filteringMask & (1ULL << i)) {
-          std::cout << "Counter " << i << ": " << counters[i] << std::endl;
-        }
-      }
       std::cout << "Tracks 1: " << std::endl;
       for (const auto& track : tracks1) {
         track.Print();
@@ -133,37 +146,73 @@ class MixingHandler : public TNamed
     }
   };
 
+  // Pool of events, implemented as a ring buffer holding the last poolDepth events added to the pool.
+  // Each event is used for mixing with the poolDepth events added after it, for all its filtering bits,
+  // after which it is overwritten by the newest event. The event slots are reused, so once the pool is
+  // full no memory is allocated anymore for the typical event sizes.
   struct MixingPool {
-    std::vector<MixingEvent> events;
-
-    // check which events in the pool are empty (i.e. no active tracks for mixing) and remove them from the pool
-    void CleanPool()
+    std::vector<MixingEvent> events; // event slots, events[(first + i) % events.size()] is the i-th oldest event
+    std::size_t first = 0;           // slot of the oldest event
+    std::size_t nEvents = 0;         // number of events currently in the pool
+
+    struct Iterator {
+      const MixingPool* pool;
+      std::size_t index;
+      const MixingEvent& operator*() const { return pool->GetEvent(index); }
+      Iterator& operator++()
+      {
+        ++index;
+        return *this;
+      }
+      bool operator==(const Iterator& other) const { return index == other.index; }
+      bool operator!=(const Iterator& other) const { return index != other.index; }
+    };
+    // range over the events in the pool, from the oldest to the newest
+    struct EventRange {
+      const MixingPool* pool;
+      Iterator begin() const { return {pool, 0}; }
+      Iterator end() const { return {pool, pool->nEvents}; }
+      std::size_t size() const { return pool->nEvents; }
+    };
+
+    // The function that performs the mixing is called outside this class, but the pool provides the events and tracks to be mixed and takes care of updating the pool after mixing:
+    // the event is copied into the slot of the oldest event if the pool is full (O(1), independent of the pool depth and number of tracks)
+    void UpdatePool(const MixingEvent& event, int16_t poolDepth)
     {
-      for (auto event = events.begin(); event != events.end();) {
-        if (event->tracks1.empty() && event->tracks2.empty()) {
-          event = events.erase(event);
-        } else {
-          ++event;
-        }
+      // NOTE: events are used for mixing with at least one following event, also for a pool depth of 0
+      std::size_t capacity = std::max<int16_t>(poolDepth, 1);
+      if (events.size() != capacity) {
+        Resize(capacity);
       }
+      std::size_t slot = (first + nEvents) % capacity;
+      if (nEvents == capacity) {
+        first = (first + 1) % capacity;
+      } else {
+        nEvents++;
+      }
+      events[slot] = event; // copy assignment of the track columns reuses the memory of the slot
     }
-    // The function that performs the mixing is called outside this class, but the pool provides the events and tracks to be mixed and takes care of updating the events after mixing
-    // (e.g. incrementing the counters and removing the tracks that reached the pool depth for a given cut)
-    void UpdatePool(const MixingEvent& event, int16_t poolDepth)
+    // change the number of event slots, keeping the newest events
+    void Resize(std::size_t capacity)
     {
-      for (auto& event : events) {
-        event.IncrementCounters(event.filteringMask, poolDepth);
+      std::vector<MixingEvent> newEvents(capacity);
+      std::size_t nKept = std::min(nEvents, capacity);
+      for (std::size_t i = 0; i < nKept; i++) {
+        newEvents[i] = std::move(events[(first + nEvents - nKept + i) % events.size()]);
       }
-      CleanPool();
-      events.push_back(event);
+      events.swap(newEvents);
+      first = 0;
+      nEvents = nKept;
     }
-    // getter for the events in the pool
-    const std::vector<MixingEvent>& GetEvents() const { return events; }
+    // getters for the events in the pool, the event with index 0 is the oldest one
+    const MixingEvent& GetEvent(std::size_t i) const { return events[(first + i) % events.size()]; }
+    std::size_t GetNEvents() const { return nEvents; }
+    EventRange GetEvents() const { return {this}; }
 
     void Print() const
     {
-      std::cout << "Mixing pool with " << events.size() << " events:" << std::endl;
-      for (const auto& event : events) {
+      std::cout << "Mixing pool with " << nEvents << " events:" << std::endl;
+      for (const auto& event : GetEvents()) {
         event.Print();
       }
     }
@@ -51,39 +51,8 @@ using namespace o2::constants::physics;
 TString VarManager::fgVariableNames[VarManager::kNVars] = {""};
 TString VarManager::fgVariableUnits[VarManager::kNVars] = {""};
 std::map<TString, int> VarManager::fgVarNamesMap;
-bool VarManager::fgUsedVars[VarManager::kNVars] = {false};
-bool VarManager::fgUsedKF = false;
-bool VarManager::fgPVrecalKF = true;
-float VarManager::fgMagField = 0.5;
-float VarManager::fgzMatching = -77.5;
-float VarManager::fgxShiftFwd = 0.0;
-float VarManager::fgyShiftFwd = 0.0;
-float VarManager::fgzShiftFwd = 0.0;
-float VarManager::fgValues[VarManager::kNVars] = {0.0f};
-float VarManager::fgTPCInterSectorBoundary = 1.0; // cm
-int VarManager::fgITSROFbias = 0;
-int VarManager::fgITSROFlength = 100;
-int VarManager::fgITSROFBorderMarginLow = 0;
-int VarManager::fgITSROFBorderMarginHigh = 0;
-uint64_t VarManager::fgSOR = 0;
-uint64_t VarManager::fgEOR = 0;
-ROOT::Math::PxPyPzEVector VarManager::fgBeamA(0, 0, 6799.99, 6800);  // GeV, beam from A-side 4-momentum vector
-ROOT::Math::PxPyPzEVector VarManager::fgBeamC(0, 0, -6799.99, 6800); // GeV, beam from C-side 4-momentum vector
-o2::vertexing::DCAFitterN<2> VarManager::fgFitterTwoProngBarrel;
-o2::vertexing::DCAFitterN<3> VarManager::fgFitterThreeProngBarrel;
-o2::vertexing::DCAFitterN<4> VarManager::fgFitterFourProngBarrel;
-o2::vertexing::FwdDCAFitterN<2> VarManager::fgFitterTwoProngFwd;
-o2::vertexing::FwdDCAFitterN<3> VarManager::fgFitterThreeProngFwd;
-o2::globaltracking::MatchGlobalFwd VarManager::mMatching;
-std::map<VarManager::CalibObjects, TObject*> VarManager::fgCalibs;
-std::array<bool, 4> VarManager::fgRunTPCPostCalibration = {false, false, false, false};
-int VarManager::fgCalibrationType = 0;                // 0 - no calibration, 1 - calibration vs (TPCncls,pIN,eta) typically for pp, 2 - calibration vs (eta,nPV,nLong,tLong) typically for PbPb
-bool VarManager::fgUseInterpolatedCalibration = true; // use interpolated calibration histograms (default: true)
-int VarManager::fgEfficiencyType = 0;                 // type of efficiency to be applied, default is no efficiency
-TObject* VarManager::fgEfficiencyHist = nullptr;      // histogram for efficiency
-TObject* VarManager::fgPosiPhiMap = nullptr;
-TObject* VarManager::fgNegaPhiMap = nullptr;
-bool VarManager::fgUsePhiCorrection = false;
+VarManager::VarContext VarManager::fgDefaultContext;
+float* VarManager::fgValues = VarManager::fgDefaultContext.fValues;
 //__________________________________________________________________
 VarManager::VarManager() : TObject()
 {
@@ -102,44 +71,77 @@ void VarManager::SetVariableDependencies()
   //
   // Set as used variables on which other variables calculation depends
   //
-  if (fgUsedVars[kP]) {
-    fgUsedVars[kPt] = true;
-    fgUsedVars[kEta] = true;
+  if (fgDefaultContext.fUsedVars[kP]) {
+    fgDefaultContext.fUsedVars[kPt] = true;
+    fgDefaultContext.fUsedVars[kEta] = true;
   }
 
-  if (fgUsedVars[kVertexingLxyOverErr]) {
-    fgUsedVars[kVertexingLxy] = true;
-    fgUsedVars[kVertexingLxyErr] = true;
+  if (fgDefaultContext.fUsedVars[kVertexingLxyOverErr]) {
+    fgDefaultContext.fUsedVars[kVertexingLxy] = true;
+    fgDefaultContext.fUsedVars[kVertexingLxyErr] = true;
   }
-  if (fgUsedVars[kVertexingLzOverErr]) {
-    fgUsedVars[kVertexingLz] = true;
-    fgUsedVars[kVertexingLzErr] = true;
+  if (fgDefaultContext.fUsedVars[kVertexingLzOverErr]) {
+    fgDefaultContext.fUsedVars[kVertexingLz] = true;
+    fgDefaultContext.fUsedVars[kVertexingLzErr] = true;
   }
-  if (fgUsedVars[kVertexingLxyzOverErr]) {
-    fgUsedVars[kVertexingLxyz] = true;
-    fgUsedVars[kVertexingLxyzErr] = true;
+  if (fgDefaultContext.fUsedVars[kVertexingLxyzOverErr]) {
+    fgDefaultContext.fUsedVars[kVertexingLxyz] = true;
+    fgDefaultContext.fUsedVars[kVertexingLxyzErr] = true;
   }
-  if (fgUsedVars[kKFTracksDCAxyzMax]) {
-    fgUsedVars[kKFTrack0DCAxyz] = true;
-    fgUsedVars[kKFTrack1DCAxyz] = true;
+  if (fgDefaultContext.fUsedVars[kKFTracksDCAxyzMax]) {
+    fgDefaultContext.fUsedVars[kKFTrack0DCAxyz] = true;
+    fgDefaultContext.fUsedVars[kKFTrack1DCAxyz] = true;
   }
-  if (fgUsedVars[kKFTracksDCAxyMax]) {
-    fgUsedVars[kKFTrack0DCAxy] = true;
-    fgUsedVars[kKFTrack1DCAxy] = true;
+  if (fgDefaultContext.fUsedVars[kKFTracksDCAxyMax]) {
+    fgDefaultContext.fUsedVars[kKFTrack0DCAxy] = true;
+    fgDefaultContext.fUsedVars[kKFTrack1DCAxy] = true;
   }
-  if (fgUsedVars[kTrackIsInsideTPCModule]) {
-    fgUsedVars[kPhiTPCOuter] = true;
+  if (fgDefaultContext.fUsedVars[kTrackIsInsideTPCModule]) {
+    fgDefaultContext.fUsedVars[kPhiTPCOuter] = true;
   }
+  UpdateUsedVarGroups();
 }
 
 //__________________________________________________________________
-void VarManager::ResetValues(int startValue, int endValue, float* values)
+void VarManager::UpdateUsedVarGroups()
+{
+  //
+  // Build the bit map of the pair blocks needed by the used variables
+  //   The pair Fill* functions check one bit to run or skip a block (the rest-frame boosts of a polarization frame,
+  //   the pair angles or the quadratic DCA sums); the variables inside an active block are still checked one by one
+  //
+  static const std::array<std::vector<int>, kNVarGroups> groupVars = {{
+    {kDeltaPhiPair2, kDeltaEtaPair2, kPsiPair, kOpeningAngle},                                     // kVarGroupPairAngles
+    {kCosThetaHE, kPhiHE},                                                                         // kVarGroupPolarizationHE
+    {kCosThetaCS, kPhiCS},                                                                         // kVarGroupPolarizationCS
+    {kCosThetaPP},                                                                                 // kVarGroupPolarizationPP
+    {kCosThetaRM},                                                                                 // kVarGroupPolarizationRM
+    {kMCCosThetaHE, kMCPhiHE},                                                                     // kVarGroupMCPolarizationHE
+    {kMCCosThetaCS, kMCPhiCS},                                                                     // kVarGroupMCPolarizationCS
+    {kMCCosThetaPP},                                                                               // kVarGroupMCPolarizationPP
+    {kMCCosThetaRM},                                                                               // kVarGroupMCPolarizationRM
+    {kQuadDCAabsXY, kQuadDCAsigXY, kQuadDCAabsZ, kQuadDCAsigZ, kQuadDCAsigXYZ, kSignQuadDCAsigXY}, // kVarGroupQuadDCA
+  }};
+
+  fgDefaultContext.fUsedVarGroups = 0;
+  for (int group = 0; group < kNVarGroups; ++group) {
+    for (auto const& var : groupVars[group]) {
+      if (fgDefaultContext.fUsedVars[var]) {
+        fgDefaultContext.fUsedVarGroups |= (1u << group);
+        break;
+      }
+    }
+  }
+}
+
+//__________________________________________________________________
+void VarManager::ResetValues(VarContext& ctx, int startValue, int endValue, float* values)
 {
   //
   // reset all variables to an "innocent" value
   // NOTE: here we use -9999.0 as a neutral value, but depending on situation, this may not be the case
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   for (Int_t i = startValue; i < endValue; ++i) {
     values[i] = -9999.;
@@ -204,8 +206,8 @@ void VarManager::SetCollisionSystem(TString system, float energy)
   float beamCEnergy = energy / 2.0 * sqrt(NumberOfProtonsC * NumberOfProtonsA / NumberOfProtonsA / NumberOfProtonsC); // GeV
   float beamAMomentum = std::sqrt(beamAEnergy * beamAEnergy - NumberOfNucleonsA * NumberOfNucleonsA * MassProton * MassProton);
   float beamCMomentum = std::sqrt(beamCEnergy * beamCEnergy - NumberOfNucleonsC * NumberOfNucleonsC * MassProton * MassProton);
-  fgBeamA.SetPxPyPzE(0, 0, beamAMomentum, beamAEnergy);
-  fgBeamC.SetPxPyPzE(0, 0, -beamCMomentum, beamCEnergy);
+  fgDefaultContext.fBeamA.SetPxPyPzE(0, 0, beamAMomentum, beamAEnergy);
+  fgDefaultContext.fBeamC.SetPxPyPzE(0, 0, -beamCMomentum, beamCEnergy);
 }
 
 //__________________________________________________________________
@@ -219,8 +221,8 @@ void VarManager::SetCollisionSystem(o2::parameters::GRPLHCIFData* grplhcif)
   double beamCNucleons = grplhcif->getBeamA(o2::constants::lhc::BeamDirection::BeamC);
   double beamAMomentum = std::sqrt(beamAEnergy * beamAEnergy - beamANucleons * beamANucleons * MassProton * MassProton);
   double beamCMomentum = std::sqrt(beamCEnergy * beamCEnergy - beamCNucleons * beamCNucleons * MassProton * MassProton);
-  fgBeamA.SetPxPyPzE(0, 0, beamAMomentum, beamAEnergy);
-  fgBeamC.SetPxPyPzE(0, 0, -beamCMomentum, beamCEnergy);
+  fgDefaultContext.fBeamA.SetPxPyPzE(0, 0, beamAMomentum, beamAEnergy);
+  fgDefaultContext.fBeamC.SetPxPyPzE(0, 0, -beamCMomentum, beamCEnergy);
 }
 
 //__________________________________________________________________
@@ -232,12 +234,12 @@ void VarManager::SetCollisionSystem(o2::parameters::GRPLHCIFData* grplhcif)
 // }
 
 //__________________________________________________________________
-void VarManager::FillTrackDerived(float* values)
+void VarManager::FillTrackDerived(VarContext& ctx, float* values)
 {
   //
   // Fill track-wise derived quantities (these are all quantities which can be computed just based on the values already filled in the FillTrack() function)
   //
-  if (fgUsedVars[kP]) {
+  if (ctx.fUsedVars[kP]) {
     values[kP] = values[kPt] * std::cosh(values[kEta]);
   }
 }
@@ -249,12 +251,12 @@ float VarManager::calculateCosPA(KFParticle kfp, KFParticle PV)
 }
 
 //__________________________________________________________________
-double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
+double VarManager::ComputePIDcalibration(VarContext& ctx, int species, double nSigmaValue)
 {
   // species: 0 - electron, 1 - pion, 2 - kaon, 3 - proton
   // Depending on the PID calibration type, we use different types of calibration histograms
 
-  if (fgCalibrationType == 1) {
+  if (ctx.fCalibrationType == 1) {
     // get the calibration histograms
     CalibObjects calibMean, calibSigma;
     switch (species) {
@@ -279,28 +281,28 @@ double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
         return -999.0; // Return zero if species is invalid
     }
 
-    TH3F* calibMeanHist = reinterpret_cast<TH3F*>(fgCalibs[calibMean]);
-    TH3F* calibSigmaHist = reinterpret_cast<TH3F*>(fgCalibs[calibSigma]);
+    TH3F* calibMeanHist = reinterpret_cast<TH3F*>(ctx.fCalibs[calibMean]);
+    TH3F* calibSigmaHist = reinterpret_cast<TH3F*>(ctx.fCalibs[calibSigma]);
     if (!calibMeanHist || !calibSigmaHist) {
       LOG(fatal) << "Calibration histograms not found for species: " << species;
       return -999.0; // Return zero if histograms are not found
     }
 
     // Get the bin indices for the calibration histograms
-    int binTPCncls = calibMeanHist->GetXaxis()->FindBin(fgValues[kTPCncls]);
+    int binTPCncls = calibMeanHist->GetXaxis()->FindBin(ctx.fValues[kTPCncls]);
     binTPCncls = (binTPCncls == 0 ? 1 : binTPCncls);
     binTPCncls = (binTPCncls > calibMeanHist->GetXaxis()->GetNbins() ? calibMeanHist->GetXaxis()->GetNbins() : binTPCncls);
-    int binPin = calibMeanHist->GetYaxis()->FindBin(fgValues[kPin]);
+    int binPin = calibMeanHist->GetYaxis()->FindBin(ctx.fValues[kPin]);
     binPin = (binPin == 0 ? 1 : binPin);
     binPin = (binPin > calibMeanHist->GetYaxis()->GetNbins() ? calibMeanHist->GetYaxis()->GetNbins() : binPin);
-    int binEta = calibMeanHist->GetZaxis()->FindBin(fgValues[kEta]);
+    int binEta = calibMeanHist->GetZaxis()->FindBin(ctx.fValues[kEta]);
     binEta = (binEta == 0 ? 1 : binEta);
     binEta = (binEta > calibMeanHist->GetZaxis()->GetNbins() ? calibMeanHist->GetZaxis()->GetNbins() : binEta);
 
     double mean = calibMeanHist->GetBinContent(binTPCncls, binPin, binEta);
     double sigma = calibSigmaHist->GetBinContent(binTPCncls, binPin, binEta);
     return (nSigmaValue - mean) / sigma; // Return the calibrated nSigma value
-  } else if (fgCalibrationType == 2) {
+  } else if (ctx.fCalibrationType == 2) {
     // get the calibration histograms
     CalibObjects calibMean, calibSigma, calibStatus;
     switch (species) {
@@ -329,25 +331,25 @@ double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
         return -999.0; // Return zero if species is invalid
     }
 
-    THnF* calibMeanHist = reinterpret_cast<THnF*>(fgCalibs[calibMean]);
-    THnF* calibSigmaHist = reinterpret_cast<THnF*>(fgCalibs[calibSigma]);
-    THnF* calibStatusHist = reinterpret_cast<THnF*>(fgCalibs[calibStatus]);
+    THnF* calibMeanHist = reinterpret_cast<THnF*>(ctx.fCalibs[calibMean]);
+    THnF* calibSigmaHist = reinterpret_cast<THnF*>(ctx.fCalibs[calibSigma]);
+    THnF* calibStatusHist = reinterpret_cast<THnF*>(ctx.fCalibs[calibStatus]);
     if (!calibMeanHist || !calibSigmaHist || !calibStatusHist) {
       LOG(fatal) << "Calibration histograms not found for species: " << species;
       return -999.0; // Return zero if histograms are not found
     }
 
     // Get the bin indices for the calibration histograms
-    int binEta = calibMeanHist->GetAxis(0)->FindBin(fgValues[kEta]);
+    int binEta = calibMeanHist->GetAxis(0)->FindBin(ctx.fValues[kEta]);
     binEta = (binEta == 0 ? 1 : binEta);
     binEta = (binEta > calibMeanHist->GetAxis(0)->GetNbins() ? calibMeanHist->GetAxis(0)->GetNbins() : binEta);
-    int binNpv = calibMeanHist->GetAxis(1)->FindBin(fgValues[kVtxNcontribReal]);
+    int binNpv = calibMeanHist->GetAxis(1)->FindBin(ctx.fValues[kVtxNcontribReal]);
     binNpv = (binNpv == 0 ? 1 : binNpv);
     binNpv = (binNpv > calibMeanHist->GetAxis(1)->GetNbins() ? calibMeanHist->GetAxis(1)->GetNbins() : binNpv);
-    int binNlong = calibMeanHist->GetAxis(2)->FindBin(fgValues[kNTPCcontribLongA]);
+    int binNlong = calibMeanHist->GetAxis(2)->FindBin(ctx.fValues[kNTPCcontribLongA]);
     binNlong = (binNlong == 0 ? 1 : binNlong);
     binNlong = (binNlong > calibMeanHist->GetAxis(2)->GetNbins() ? calibMeanHist->GetAxis(2)->GetNbins() : binNlong);
-    int binTlong = calibMeanHist->GetAxis(3)->FindBin(fgValues[kNTPCmedianTimeLongA]);
+    int binTlong = calibMeanHist->GetAxis(3)->FindBin(ctx.fValues[kNTPCmedianTimeLongA]);
     binTlong = (binTlong == 0 ? 1 : binTlong);
     binTlong = (binTlong > calibMeanHist->GetAxis(3)->GetNbins() ? calibMeanHist->GetAxis(3)->GetNbins() : binTlong);
 
@@ -367,7 +369,7 @@ double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
       case 2: // calibration constant has poor stat uncertainty, consider the user option for what to do
       case 3:
         // calibration constants have been interpolated
-        if (fgUseInterpolatedCalibration) {
+        if (ctx.fUseInterpolatedCalibration) {
           return (nSigmaValue - mean) / sigma;
         } else {
           // return the original nSigma value
@@ -384,7 +386,7 @@ double VarManager::ComputePIDcalibration(int species, double nSigmaValue)
     }
   } else {
     // unknown calibration type, return the original nSigma value
-    LOG(fatal) << "Unknown calibration type: " << fgCalibrationType;
+    LOG(fatal) << "Unknown calibration type: " << ctx.fCalibrationType;
     return nSigmaValue; // Return the original nSigma value
   }
 }
@@ -399,27 +401,27 @@ void VarManager::SetEfficiencyObject(int efficiencyType, TObject* obj)
   }
 
   // set the efficiency type
-  fgEfficiencyType = efficiencyType;
+  fgDefaultContext.fEfficiencyType = efficiencyType;
   // set the efficiency object
-  fgEfficiencyHist = obj;
+  fgDefaultContext.fEfficiencyHist = obj;
 }
 
-void VarManager::FillEfficiency(float* values)
+void VarManager::FillEfficiency(VarContext& ctx, float* values)
 {
   // depending on the efficiency type, we use different types of efficiency histograms and different variables to get the efficiency value
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
-  if (fgEfficiencyType == kNone) {
+  if (ctx.fEfficiencyType == kNone) {
     values[kPairEfficiency] = 1.0; // if no efficiency is to be applied, set the efficiency value to 1
     values[kPairWeight] = 1.0;     // set the weight to 1
-  } else if (fgEfficiencyType == kPairPtCentFT0cCosThetaStarFT0c) {
-    if (!fgEfficiencyHist) {
+  } else if (ctx.fEfficiencyType == kPairPtCentFT0cCosThetaStarFT0c) {
+    if (!ctx.fEfficiencyHist) {
       LOG(fatal) << "efficiency histogram not set";
       return;
     }
-    TH3F* efficiencyHist = reinterpret_cast<TH3F*>(fgEfficiencyHist);
+    TH3F* efficiencyHist = reinterpret_cast<TH3F*>(ctx.fEfficiencyHist);
     // Get the bin indices for the efficiency histogram
     int binPt = efficiencyHist->GetXaxis()->FindBin(values[kPt]);
     binPt = (binPt == 0 ? 1 : binPt);
@@ -434,12 +436,12 @@ void VarManager::FillEfficiency(float* values)
     // get the efficiency value from the histogram
     values[kPairEfficiency] = efficiencyHist->GetBinContent(binPt, binCent, binCosThetaStarFT0c);
     values[kPairWeight] = 1.0 / (values[kPairEfficiency] > 0 ? values[kPairEfficiency] : 1.0); // set the weight as the inverse of the efficiency, but avoid division by zero
-  } else if (fgEfficiencyType == kPairPtCentFT0cCosThetaStarRandom) {
-    if (!fgEfficiencyHist) {
+  } else if (ctx.fEfficiencyType == kPairPtCentFT0cCosThetaStarRandom) {
+    if (!ctx.fEfficiencyHist) {
       LOG(fatal) << "efficiency histogram not set";
       return;
     }
-    TH3F* efficiencyHist = reinterpret_cast<TH3F*>(fgEfficiencyHist);
+    TH3F* efficiencyHist = reinterpret_cast<TH3F*>(ctx.fEfficiencyHist);
     // Get the bin indices for the efficiency histogram
     int binPt = efficiencyHist->GetXaxis()->FindBin(values[kPt]);
     binPt = (binPt == 0 ? 1 : binPt);
@@ -455,7 +457,7 @@ void VarManager::FillEfficiency(float* values)
     values[kPairEfficiency] = efficiencyHist->GetBinContent(binPt, binCent, binCosThetaStarRandom);
     values[kPairWeight] = 1.0 / (values[kPairEfficiency] > 0 ? values[kPairEfficiency] : 1.0); // set the weight as the inverse of the efficiency, but avoid division by zero
   } else {
-    LOG(warning) << "FillEfficiency: unknown efficiency type " << fgEfficiencyType << ", using default efficiency = 1";
+    LOG(warning) << "FillEfficiency: unknown efficiency type " << ctx.fEfficiencyType << ", using default efficiency = 1";
     values[kPairEfficiency] = 1;
     values[kPairWeight] = 1;
   }
@@ -463,25 +465,25 @@ void VarManager::FillEfficiency(float* values)
 
 void VarManager::SetPhiMap(TObject* hposi, TObject* hnega, bool option)
 {
-  fgPosiPhiMap = hposi;
-  fgNegaPhiMap = hnega;
-  fgUsePhiCorrection = option;
+  fgDefaultContext.fPosiPhiMap = hposi;
+  fgDefaultContext.fNegaPhiMap = hnega;
+  fgDefaultContext.fUsePhiCorrection = option;
 }
 
-double VarManager::SampleRotationPhi(double pt, double eta, int charge)
+double VarManager::SampleRotationPhi(VarContext& ctx, double pt, double eta, int charge)
 {
   // each type only alarm once
   static bool warnedEmptyPhi = false;
 
-  if (!fgUsePhiCorrection) {
-    return gRandom->Uniform(0., o2::constants::math::TwoPI);
+  if (!ctx.fUsePhiCorrection) {
+    return ctx.GetRandom()->Uniform(0., o2::constants::math::TwoPI);
   } else {
 
     TH3D* hMap = nullptr;
     if (charge > 0) {
-      hMap = dynamic_cast<TH3D*>(fgPosiPhiMap);
+      hMap = dynamic_cast<TH3D*>(ctx.fPosiPhiMap);
     } else {
-      hMap = dynamic_cast<TH3D*>(fgNegaPhiMap);
+      hMap = dynamic_cast<TH3D*>(ctx.fNegaPhiMap);
     }
 
     if (!hMap) {
@@ -519,10 +521,10 @@ double VarManager::SampleRotationPhi(double pt, double eta, int charge)
 
       delete hPhi;
 
-      return gRandom->Uniform(0., o2::constants::math::TwoPI);
+      return ctx.GetRandom()->Uniform(0., o2::constants::math::TwoPI);
     }
 
-    const double phi = RecoDecay::constrainAngle(hPhi->GetRandom());
+    const double phi = RecoDecay::constrainAngle(hPhi->GetRandom(ctx.GetRandom()));
 
     delete hPhi;
     return phi;
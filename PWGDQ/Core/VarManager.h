@@ -1202,6 +1202,76 @@ class VarManager : public TObject
     kToMatching
   };
 
+  enum VarGroups {
+    // Blocks of the pair Fill* functions (FillPair, FillPairME, FillPairMC, FillPairAlice3, FillPairCollision*)
+    //   which are skipped as a whole when none of their variables is used
+    // A group is active if any of its variables is used, see VarManager::UpdateUsedVarGroups()
+    // All the other variables, including those of FillEvent and FillTrack, keep their per-variable checks
+    kVarGroupPairAngles = 0,   // pair opening angles (kDeltaPhiPair2, kDeltaEtaPair2, kPsiPair, kOpeningAngle)
+    kVarGroupPolarizationHE,   // polarization in the helicity frame
+    kVarGroupPolarizationCS,   // polarization in the Collins-Soper frame
+    kVarGroupPolarizationPP,   // polarization in the production plane frame
+    kVarGroupPolarizationRM,   // polarization in the random frame
+    kVarGroupMCPolarizationHE, // generator level polarization in the helicity frame
+    kVarGroupMCPolarizationCS, // generator level polarization in the Collins-Soper frame
+    kVarGroupMCPolarizationPP, // generator level polarization in the production plane frame
+    kVarGroupMCPolarizationRM, // generator level polarization in the random frame
+    kVarGroupQuadDCA,          // quadratic sums of the leg DCAs
+    kNVarGroups
+  };
+
+  // Analysis context holding the computed values, the used variables mask and the per-run state
+  // Each Fill* function has an overload taking the context explicitly; the static API operates on the
+  //   process-wide default context, configured by the static setters, and fgValues points to its values.
+  // To process collisions in parallel, each worker thread uses its own copy of the configured default context
+  //   (copied again after per-run updates) and gives it its own random generator, e.g.
+  //     VarManager::VarContext ctx(VarManager::GetDefaultContext());
+  //     ctx.fRandom = &workerRandom;
+  //     VarManager::FillTrack<fillMap>(ctx, track); // values in ctx.fValues
+  // KFParticle keeps the magnetic field in a static of its own, so contexts using KF vertexing in parallel
+  //   must run with the same field.
+  struct VarContext {
+    float fValues[kNVars] = {0.0f};                         // array holding all variables computed during analysis
+    bool fUsedVars[kNVars] = {false};                       // flags for when the corresponding variable is needed (e.g., in the histogram manager, in cuts, mixing handler, etc.)
+    uint32_t fUsedVarGroups = 0;                            // bit map of the active pair blocks, see VarGroups
+    bool fUsedKF = false;
+    bool fPVrecalKF = true;
+    float fMagField = 0.5;
+    float fzMatching = -77.5;
+    float fxShiftFwd = 0.0;
+    float fyShiftFwd = 0.0;
+    float fzShiftFwd = 0.0;
+    float fTPCInterSectorBoundary = 1.0;                    // TPC inter-sector border size at the TPC outer radius, in cm
+    int fITSROFbias = 0;                                    // ITS ROF bias (from ALPIDE parameters)
+    int fITSROFlength = 100;                                // ITS ROF length (from ALPIDE parameters)
+    int fITSROFBorderMarginLow = 0;                         // ITS ROF border low margin
+    int fITSROFBorderMarginHigh = 0;                        // ITS ROF border high margin
+    uint64_t fSOR = 0;                                      // Timestamp for start of run
+    uint64_t fEOR = 0;                                      // Timestamp for end of run
+    ROOT::Math::PxPyPzEVector fBeamA{0, 0, 6799.99, 6800};  // GeV, beam from A-side 4-momentum vector
+    ROOT::Math::PxPyPzEVector fBeamC{0, 0, -6799.99, 6800}; // GeV, beam from C-side 4-momentum vector
+    o2::vertexing::DCAFitterN<2> fFitterTwoProngBarrel;
+    o2::vertexing::DCAFitterN<3> fFitterThreeProngBarrel;
+    o2::vertexing::DCAFitterN<4> fFitterFourProngBarrel;
+    o2::vertexing::FwdDCAFitterN<2> fFitterTwoProngFwd;
+    o2::vertexing::FwdDCAFitterN<3> fFitterThreeProngFwd;
+    o2::globaltracking::MatchGlobalFwd fMatching;
+    std::map<CalibObjects, TObject*> fCalibs;                                  // map of calibration histograms
+    std::array<bool, 4> fRunTPCPostCalibration = {false, false, false, false}; // 0-electron, 1-pion, 2-kaon, 3-proton
+    int fCalibrationType = 0;                                                  // 0 - no calibration, 1 - calibration vs (TPCncls,pIN,eta) typically for pp, 2 - calibration vs (eta,nPV,nLong,tLong) typically for PbPb
+    bool fUseInterpolatedCalibration = true;                                   // use interpolated calibration histograms (default: true)
+    int fEfficiencyType = 0;                                                   // type of efficiency correction to apply
+    TObject* fEfficiencyHist = nullptr;                                        // histogram for efficiency correction
+    TObject* fPosiPhiMap = nullptr;                                            // phi map to correct track rotation
+    TObject* fNegaPhiMap = nullptr;
+    bool fUsePhiCorrection = false;
+    TRandom* fRandom = nullptr;                                                // random generator, gRandom if not set
+
+    TRandom* GetRandom() const { return fRandom != nullptr ? fRandom : gRandom; }
+  };
+
+  static VarContext& GetDefaultContext() { return fgDefaultContext; }
+
   static TString fgVariableNames[kNVars];      // variable names
   static TString fgVariableUnits[kNVars];      // variable units
   static std::map<TString, int> fgVarNamesMap; // key: variables short name, value: order in the Variables enum
@@ -1210,7 +1280,7 @@ class VarManager : public TObject
   static void SetUseVariable(int var)
   {
     if (var >= 0 && var < kNVars) {
-      fgUsedVars[var] = kTRUE;
+      fgDefaultContext.fUsedVars[var] = kTRUE;
     }
     SetVariableDependencies();
   }
@@ -1218,7 +1288,7 @@ class VarManager : public TObject
   {
     for (int i = 0; i < kNVars; ++i) {
       if (usedVars[i]) {
-        fgUsedVars[i] = true; // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
+        fgDefaultContext.fUsedVars[i] = true; // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
       }
     }
     SetVariableDependencies();
@@ -1226,21 +1296,25 @@ class VarManager : public TObject
   static void SetUseVars(const std::vector<int>& usedVars)
   {
     for (auto const& var : usedVars) {
-      fgUsedVars[var] = true;
+      fgDefaultContext.fUsedVars[var] = true;
     }
+    UpdateUsedVarGroups();
   }
-  static bool GetUsedVar(int var)
+  static bool GetUsedVar(int var) { return GetUsedVar(fgDefaultContext, var); }
+  static bool GetUsedVar(const VarContext& ctx, int var)
   {
     if (var >= 0 && var < kNVars) {
-      return fgUsedVars[var];
+      return ctx.fUsedVars[var];
     }
     return false;
   }
+  static bool GetUsedVarGroup(int group) { return GetUsedVarGroup(fgDefaultContext, group); }
+  static bool GetUsedVarGroup(const VarContext& ctx, int group) { return (ctx.fUsedVarGroups & (1u << group)) != 0; }
 
   // Flag to  set PV recalculation via KF
   static void SetPVrecalculationKF(const bool pvRecalKF)
   {
-    fgPVrecalKF = pvRecalKF;
+    fgDefaultContext.fPVrecalKF = pvRecalKF;
   }
 
   // Setup the collision system
@@ -1249,39 +1323,39 @@ class VarManager : public TObject
 
   static void SetMagneticField(float magField)
   {
-    fgMagField = magField;
+    fgDefaultContext.fMagField = magField;
   }
 
   // Setup plane position for MFT-MCH matching
   static void SetMatchingPlane(float z)
   {
-    fgzMatching = z;
+    fgDefaultContext.fzMatching = z;
   }
 
   static float GetMatchingPlane()
   {
-    return fgzMatching;
+    return fgDefaultContext.fzMatching;
   }
 
   // Set z shift for forward tracks
   static void SetZShift(float z)
   {
-    fgzShiftFwd = z;
+    fgDefaultContext.fzShiftFwd = z;
   }
 
   // Set x, y and z shifts for forward tracks
   static void Set3DShift(float x, float y, float z)
   {
-    fgxShiftFwd = x;
-    fgyShiftFwd = y;
-    fgzShiftFwd = z;
+    fgDefaultContext.fxShiftFwd = x;
+    fgDefaultContext.fyShiftFwd = y;
+    fgDefaultContext.fzShiftFwd = z;
   }
 
   // Setup the 2 prong KFParticle
   static void SetupTwoProngKFParticle(float magField)
   {
     KFParticle::SetField(magField);
-    fgUsedKF = true;
+    fgDefaultContext.fUsedKF = true;
   }
   // Setup magnetic field for muon propagation
   static void SetupMuonMagField()
@@ -1292,79 +1366,79 @@ class VarManager : public TObject
   // Setup the 2 prong DCAFitterN
   static void SetupTwoProngDCAFitter(float magField, bool propagateToPCA, float maxR, float maxDZIni, float minParamChange, float minRelChi2Change, bool useAbsDCA)
   {
-    fgFitterTwoProngBarrel.setBz(magField);
-    fgFitterTwoProngBarrel.setPropagateToPCA(propagateToPCA);
-    fgFitterTwoProngBarrel.setMaxR(maxR);
-    fgFitterTwoProngBarrel.setMaxDZIni(maxDZIni);
-    fgFitterTwoProngBarrel.setMinParamChange(minParamChange);
-    fgFitterTwoProngBarrel.setMinRelChi2Change(minRelChi2Change);
-    fgFitterTwoProngBarrel.setUseAbsDCA(useAbsDCA);
-    fgUsedKF = false;
+    fgDefaultContext.fFitterTwoProngBarrel.setBz(magField);
+    fgDefaultContext.fFitterTwoProngBarrel.setPropagateToPCA(propagateToPCA);
+    fgDefaultContext.fFitterTwoProngBarrel.setMaxR(maxR);
+    fgDefaultContext.fFitterTwoProngBarrel.setMaxDZIni(maxDZIni);
+    fgDefaultContext.fFitterTwoProngBarrel.setMinParamChange(minParamChange);
+    fgDefaultContext.fFitterTwoProngBarrel.setMinRelChi2Change(minRelChi2Change);
+    fgDefaultContext.fFitterTwoProngBarrel.setUseAbsDCA(useAbsDCA);
+    fgDefaultContext.fUsedKF = false;
   }
 
   // Setup the 2 prong FwdDCAFitterN
   static void SetupTwoProngFwdDCAFitter(float magField, bool propagateToPCA, float maxR, float minParamChange, float minRelChi2Change, bool useAbsDCA)
   {
-    fgFitterTwoProngFwd.setBz(magField);
-    fgFitterTwoProngFwd.setPropagateToPCA(propagateToPCA);
-    fgFitterTwoProngFwd.setMaxR(maxR);
-    fgFitterTwoProngFwd.setMinParamChange(minParamChange);
-    fgFitterTwoProngFwd.setMinRelChi2Change(minRelChi2Change);
-    fgFitterTwoProngFwd.setUseAbsDCA(useAbsDCA);
-    fgUsedKF = false;
+    fgDefaultContext.fFitterTwoProngFwd.setBz(magField);
+    fgDefaultContext.fFitterTwoProngFwd.setPropagateToPCA(propagateToPCA);
+    fgDefaultContext.fFitterTwoProngFwd.setMaxR(maxR);
+    fgDefaultContext.fFitterTwoProngFwd.setMinParamChange(minParamChange);
+    fgDefaultContext.fFitterTwoProngFwd.setMinRelChi2Change(minRelChi2Change);
+    fgDefaultContext.fFitterTwoProngFwd.setUseAbsDCA(useAbsDCA);
+    fgDefaultContext.fUsedKF = false;
   }
   // Use MatLayerCylSet to correct MCS in fwdtrack propagation
   static void SetupMatLUTFwdDCAFitter(o2::base::MatLayerCylSet* m)
   {
-    fgFitterTwoProngFwd.setTGeoMat(false);
-    fgFitterTwoProngFwd.setMatLUT(m);
+    fgDefaultContext.fFitterTwoProngFwd.setTGeoMat(false);
+    fgDefaultContext.fFitterTwoProngFwd.setMatLUT(m);
   }
   // Use GeometryManager to correct MCS in fwdtrack propagation
   static void SetupTGeoFwdDCAFitter()
   {
-    fgFitterTwoProngFwd.setTGeoMat(true);
+    fgDefaultContext.fFitterTwoProngFwd.setTGeoMat(true);
   }
   // No material budget in fwdtrack propagation
   static void SetupFwdDCAFitterNoCorr()
   {
-    fgFitterTwoProngFwd.setTGeoMat(false);
+    fgDefaultContext.fFitterTwoProngFwd.setTGeoMat(false);
   }
   // Setup the 3 prong KFParticle
   static void SetupThreeProngKFParticle(float magField)
   {
     KFParticle::SetField(magField);
-    fgUsedKF = true;
+    fgDefaultContext.fUsedKF = true;
   }
 
   // Setup the 3 prong DCAFitterN
   static void SetupThreeProngDCAFitter(float magField, bool propagateToPCA, float maxR, float /*maxDZIni*/, float minParamChange, float minRelChi2Change, bool useAbsDCA)
   {
-    fgFitterThreeProngBarrel.setBz(magField);
-    fgFitterThreeProngBarrel.setPropagateToPCA(propagateToPCA);
-    fgFitterThreeProngBarrel.setMaxR(maxR);
-    fgFitterThreeProngBarrel.setMinParamChange(minParamChange);
-    fgFitterThreeProngBarrel.setMinRelChi2Change(minRelChi2Change);
-    fgFitterThreeProngBarrel.setUseAbsDCA(useAbsDCA);
-    fgUsedKF = false;
+    fgDefaultContext.fFitterThreeProngBarrel.setBz(magField);
+    fgDefaultContext.fFitterThreeProngBarrel.setPropagateToPCA(propagateToPCA);
+    fgDefaultContext.fFitterThreeProngBarrel.setMaxR(maxR);
+    fgDefaultContext.fFitterThreeProngBarrel.setMinParamChange(minParamChange);
+    fgDefaultContext.fFitterThreeProngBarrel.setMinRelChi2Change(minRelChi2Change);
+    fgDefaultContext.fFitterThreeProngBarrel.setUseAbsDCA(useAbsDCA);
+    fgDefaultContext.fUsedKF = false;
   }
 
   // Setup the 4 prong KFParticle
   static void SetupFourProngKFParticle(float magField)
   {
     KFParticle::SetField(magField);
-    fgUsedKF = true;
+    fgDefaultContext.fUsedKF = true;
   }
 
   // Setup the 4 prong DCAFitterN
   static void SetupFourProngDCAFitter(float magField, bool propagateToPCA, float maxR, float /*maxDZIni*/, float minParamChange, float minRelChi2Change, bool useAbsDCA)
   {
-    fgFitterFourProngBarrel.setBz(magField);
-    fgFitterFourProngBarrel.setPropagateToPCA(propagateToPCA);
-    fgFitterFourProngBarrel.setMaxR(maxR);
-    fgFitterFourProngBarrel.setMinParamChange(minParamChange);
-    fgFitterFourProngBarrel.setMinRelChi2Change(minRelChi2Change);
-    fgFitterFourProngBarrel.setUseAbsDCA(useAbsDCA);
-    fgUsedKF = false;
+    fgDefaultContext.fFitterFourProngBarrel.setBz(magField);
+    fgDefaultContext.fFitterFourProngBarrel.setPropagateToPCA(propagateToPCA);
+    fgDefaultContext.fFitterFourProngBarrel.setMaxR(maxR);
+    fgDefaultContext.fFitterFourProngBarrel.setMinParamChange(minParamChange);
+    fgDefaultContext.fFitterFourProngBarrel.setMinRelChi2Change(minRelChi2Change);
+    fgDefaultContext.fFitterFourProngBarrel.setUseAbsDCA(useAbsDCA);
+    fgDefaultContext.fUsedKF = false;
   }
 
   static auto getEventPlane(int harm, float qnxa, float qnya)
@@ -1386,148 +1460,449 @@ class VarManager : public TObject
   template <typename T, typename C>
   static o2::track::TrackParCovFwd FwdToTrackPar(const T& track, const C& cov);
   template <typename T, typename C>
-  static o2::dataformats::GlobalFwdTrack PropagateMuon(const T& muon, const C& collision, int endPoint = kToVertex);
+  static o2::dataformats::GlobalFwdTrack PropagateMuon(const T& muon, const C& collision, int endPoint = kToVertex)
+  {
+    return PropagateMuon<T, C>(fgDefaultContext, muon, collision, endPoint);
+  }
+  template <typename T, typename C>
+  static o2::dataformats::GlobalFwdTrack PropagateMuon(VarContext& ctx, const T& muon, const C& collision, int endPoint = kToVertex);
+  template <typename T, typename C>
+  static o2::track::TrackParCovFwd PropagateFwd(const T& track, const C& cov, float z)
+  {
+    return PropagateFwd<T, C>(fgDefaultContext, track, cov, z);
+  }
   template <typename T, typename C>
-  static o2::track::TrackParCovFwd PropagateFwd(const T& track, const C& cov, float z);
+  static o2::track::TrackParCovFwd PropagateFwd(VarContext& ctx, const T& track, const C& cov, float z);
+  template <uint32_t fillMap, typename T, typename C>
+  static void FillMuonPDca(const T& muon, const C& collision, float* values = nullptr)
+  {
+    FillMuonPDca<fillMap, T, C>(fgDefaultContext, muon, collision, values);
+  }
   template <uint32_t fillMap, typename T, typename C>
-  static void FillMuonPDca(const T& muon, const C& collision, float* values = nullptr);
+  static void FillMuonPDca(VarContext& ctx, const T& muon, const C& collision, float* values = nullptr);
   template <uint32_t fillMap, typename T, typename C>
-  static void FillPropagateMuon(const T& muon, const C& collision, float* values = nullptr);
+  static void FillPropagateMuon(const T& muon, const C& collision, float* values = nullptr)
+  {
+    FillPropagateMuon<fillMap, T, C>(fgDefaultContext, muon, collision, values);
+  }
+  template <uint32_t fillMap, typename T, typename C>
+  static void FillPropagateMuon(VarContext& ctx, const T& muon, const C& collision, float* values = nullptr);
   template <typename T>
-  static void FillBC(T const& bc, float* values = nullptr);
+  static void FillBC(T const& bc, float* values = nullptr)
+  {
+    FillBC<T>(fgDefaultContext, bc, values);
+  }
+  template <typename T>
+  static void FillBC(VarContext& ctx, T const& bc, float* values = nullptr);
+  template <uint32_t fillMap, typename T>
+  static void FillEvent(T const& event, float* values = nullptr)
+  {
+    FillEvent<fillMap, T>(fgDefaultContext, event, values);
+  }
   template <uint32_t fillMap, typename T>
-  static void FillEvent(T const& event, float* values = nullptr);
+  static void FillEvent(VarContext& ctx, T const& event, float* values = nullptr);
   template <typename T>
-  static void FillEventTracks(T const& tracks, float* values = nullptr);
+  static void FillEventTracks(T const& tracks, float* values = nullptr)
+  {
+    FillEventTracks<T>(fgDefaultContext, tracks, values);
+  }
   template <typename T>
-  static void FillTimeFrame(T const& tfTable, float* values = nullptr);
+  static void FillEventTracks(VarContext& ctx, T const& tracks, float* values = nullptr);
+  template <typename T>
+  static void FillTimeFrame(T const& tfTable, float* values = nullptr)
+  {
+    FillTimeFrame<T>(fgDefaultContext, tfTable, values);
+  }
   template <typename T>
-  static void FillEventFlowResoFactor(T const& hs_sp, T const& hs_ep, float* values = nullptr);
+  static void FillTimeFrame(VarContext& ctx, T const& tfTable, float* values = nullptr);
   template <typename T>
-  static void FillTwoEvents(T const& ev1, T const& ev2, float* values = nullptr);
+  static void FillEventFlowResoFactor(T const& hs_sp, T const& hs_ep, float* values = nullptr)
+  {
+    FillEventFlowResoFactor<T>(fgDefaultContext, hs_sp, hs_ep, values);
+  }
+  template <typename T>
+  static void FillEventFlowResoFactor(VarContext& ctx, T const& hs_sp, T const& hs_ep, float* values = nullptr);
+  template <typename T>
+  static void FillTwoEvents(T const& ev1, T const& ev2, float* values = nullptr)
+  {
+    FillTwoEvents<T>(fgDefaultContext, ev1, ev2, values);
+  }
+  template <typename T>
+  static void FillTwoEvents(VarContext& ctx, T const& ev1, T const& ev2, float* values = nullptr);
   template <uint32_t fillMap, typename T1, typename T2>
-  static void FillTwoMixEvents(T1 const& ev1, T1 const& ev2, T2 const& tracks1, T2 const& tracks2, float* values = nullptr);
+  static void FillTwoMixEvents(T1 const& ev1, T1 const& ev2, T2 const& tracks1, T2 const& tracks2, float* values = nullptr)
+  {
+    FillTwoMixEvents<fillMap, T1, T2>(fgDefaultContext, ev1, ev2, tracks1, tracks2, values);
+  }
+  template <uint32_t fillMap, typename T1, typename T2>
+  static void FillTwoMixEvents(VarContext& ctx, T1 const& ev1, T1 const& ev2, T2 const& tracks1, T2 const& tracks2, float* values = nullptr);
   template <typename T>
-  static void FillTwoMixEventsFlowResoFactor(T const& hs_sp, T const& hs_ep, float* values = nullptr);
+  static void FillTwoMixEventsFlowResoFactor(T const& hs_sp, T const& hs_ep, float* values = nullptr)
+  {
+    FillTwoMixEventsFlowResoFactor<T>(fgDefaultContext, hs_sp, hs_ep, values);
+  }
+  template <typename T>
+  static void FillTwoMixEventsFlowResoFactor(VarContext& ctx, T const& hs_sp, T const& hs_ep, float* values = nullptr);
   template <typename T, typename T1, typename T2>
-  static void FillTwoMixEventsCumulants(T const& h_v22ev1, T const& h_v24ev1, T const& h_v22ev2, T const& h_v24ev2, T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillTwoMixEventsCumulants(T const& h_v22ev1, T const& h_v24ev1, T const& h_v22ev2, T const& h_v24ev2, T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillTwoMixEventsCumulants<T, T1, T2>(fgDefaultContext, h_v22ev1, h_v24ev1, h_v22ev2, h_v24ev2, t1, t2, values);
+  }
+  template <typename T, typename T1, typename T2>
+  static void FillTwoMixEventsCumulants(VarContext& ctx, T const& h_v22ev1, T const& h_v24ev1, T const& h_v22ev2, T const& h_v24ev2, T1 const& t1, T2 const& t2, float* values = nullptr);
   template <uint32_t fillMap, typename T>
-  static void FillTrack(T const& track, float* values = nullptr);
+  static void FillTrack(T const& track, float* values = nullptr)
+  {
+    FillTrack<fillMap, T>(fgDefaultContext, track, values);
+  }
   template <uint32_t fillMap, typename T>
-  static void FillPhoton(T const& track, float* values = nullptr);
+  static void FillTrack(VarContext& ctx, T const& track, float* values = nullptr);
+  template <uint32_t fillMap, typename T>
+  static void FillPhoton(T const& track, float* values = nullptr)
+  {
+    FillPhoton<fillMap, T>(fgDefaultContext, track, values);
+  }
+  template <uint32_t fillMap, typename T>
+  static void FillPhoton(VarContext& ctx, T const& track, float* values = nullptr);
+  template <uint32_t fillMap, typename T, typename C>
+  static void FillTrackCollision(T const& track, C const& collision, float* values = nullptr)
+  {
+    FillTrackCollision<fillMap, T, C>(fgDefaultContext, track, collision, values);
+  }
   template <uint32_t fillMap, typename T, typename C>
-  static void FillTrackCollision(T const& track, C const& collision, float* values = nullptr);
+  static void FillTrackCollision(VarContext& ctx, T const& track, C const& collision, float* values = nullptr);
+  template <int candidateType, uint32_t fillMap, typename T1, typename T2, typename C>
+  static void FillTrackCollisionMC(T1 const& track, T2 const& MotherTrack, C const& collision, float* values = nullptr)
+  {
+    FillTrackCollisionMC<candidateType, fillMap, T1, T2, C>(fgDefaultContext, track, MotherTrack, collision, values);
+  }
   template <int candidateType, uint32_t fillMap, typename T1, typename T2, typename C>
-  static void FillTrackCollisionMC(T1 const& track, T2 const& MotherTrack, C const& collision, float* values = nullptr);
+  static void FillTrackCollisionMC(VarContext& ctx, T1 const& track, T2 const& MotherTrack, C const& collision, float* values = nullptr);
+  template <int candidateType, typename T1>
+  static void FillTrackCollisionMC(T1 const& track, const std::array<double, 3>& collPos, float massHyp = -1., float* values = nullptr)
+  {
+    FillTrackCollisionMC<candidateType, T1>(fgDefaultContext, track, collPos, massHyp, values);
+  }
   template <int candidateType, typename T1>
-  static void FillTrackCollisionMC(T1 const& track, const std::array<double, 3>& collPos, float massHyp = -1., float* values = nullptr);
+  static void FillTrackCollisionMC(VarContext& ctx, T1 const& track, const std::array<double, 3>& collPos, float massHyp = -1., float* values = nullptr);
+  template <uint32_t fillMap, typename T, typename C, typename M, typename P>
+  static void FillTrackCollisionMatCorr(T const& track, C const& collision, M const& materialCorr, P const& propagator, float* values = nullptr)
+  {
+    FillTrackCollisionMatCorr<fillMap, T, C, M, P>(fgDefaultContext, track, collision, materialCorr, propagator, values);
+  }
   template <uint32_t fillMap, typename T, typename C, typename M, typename P>
-  static void FillTrackCollisionMatCorr(T const& track, C const& collision, M const& materialCorr, P const& propagator, float* values = nullptr);
+  static void FillTrackCollisionMatCorr(VarContext& ctx, T const& track, C const& collision, M const& materialCorr, P const& propagator, float* values = nullptr);
   template <typename U, typename T>
-  static void FillTrackMC(const U& mcStack, T const& track, float* values = nullptr);
+  static void FillTrackMC(const U& mcStack, T const& track, float* values = nullptr)
+  {
+    FillTrackMC<U, T>(fgDefaultContext, mcStack, track, values);
+  }
+  template <typename U, typename T>
+  static void FillTrackMC(VarContext& ctx, const U& mcStack, T const& track, float* values = nullptr);
   template <int pairType, typename T, typename T1>
-  static void FillEnergyCorrelatorsMC(T const& track, T1 const& t1, float* values = nullptr, float Translow = 1. / 3, float Transhigh = 2. / 3, float Accweight = 1.0f);
+  static void FillEnergyCorrelatorsMC(T const& track, T1 const& t1, float* values = nullptr, float Translow = 1. / 3, float Transhigh = 2. / 3, float Accweight = 1.0f)
+  {
+    FillEnergyCorrelatorsMC<pairType, T, T1>(fgDefaultContext, track, t1, values, Translow, Transhigh, Accweight);
+  }
+  template <int pairType, typename T, typename T1>
+  static void FillEnergyCorrelatorsMC(VarContext& ctx, T const& track, T1 const& t1, float* values = nullptr, float Translow = 1. / 3, float Transhigh = 2. / 3, float Accweight = 1.0f);
+  template <uint32_t fillMap, typename T1, typename T2, typename C>
+  static void FillPairPropagateMuon(T1 const& muon1, T2 const& muon2, const C& collision, float* values = nullptr)
+  {
+    FillPairPropagateMuon<fillMap, T1, T2, C>(fgDefaultContext, muon1, muon2, collision, values);
+  }
   template <uint32_t fillMap, typename T1, typename T2, typename C>
-  static void FillPairPropagateMuon(T1 const& muon1, T2 const& muon2, const C& collision, float* values = nullptr);
+  static void FillPairPropagateMuon(VarContext& ctx, T1 const& muon1, T2 const& muon2, const C& collision, float* values = nullptr);
   template <uint32_t fillMap, typename T1, typename T2, typename C>
-  static void FillGlobalMuonRefit(T1 const& muontrack, T2 const& mfttrack, const C& collision, float* values = nullptr);
+  static void FillGlobalMuonRefit(T1 const& muontrack, T2 const& mfttrack, const C& collision, float* values = nullptr)
+  {
+    FillGlobalMuonRefit<fillMap, T1, T2, C>(fgDefaultContext, muontrack, mfttrack, collision, values);
+  }
+  template <uint32_t fillMap, typename T1, typename T2, typename C>
+  static void FillGlobalMuonRefit(VarContext& ctx, T1 const& muontrack, T2 const& mfttrack, const C& collision, float* values = nullptr);
+  template <uint32_t MuonfillMap, uint32_t MFTfillMap, typename T1, typename T2, typename C, typename C2>
+  static void FillGlobalMuonRefitCov(T1 const& muontrack, T2 const& mfttrack, const C& collision, C2 const& mftcov, float* values = nullptr)
+  {
+    FillGlobalMuonRefitCov<MuonfillMap, MFTfillMap, T1, T2, C, C2>(fgDefaultContext, muontrack, mfttrack, collision, mftcov, values);
+  }
   template <uint32_t MuonfillMap, uint32_t MFTfillMap, typename T1, typename T2, typename C, typename C2>
-  static void FillGlobalMuonRefitCov(T1 const& muontrack, T2 const& mfttrack, const C& collision, C2 const& mftcov, float* values = nullptr);
+  static void FillGlobalMuonRefitCov(VarContext& ctx, T1 const& muontrack, T2 const& mfttrack, const C& collision, C2 const& mftcov, float* values = nullptr);
+  template <int pairType, uint32_t fillMap, typename T1, typename T2>
+  static void FillPair(T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillPair<pairType, fillMap, T1, T2>(fgDefaultContext, t1, t2, values);
+  }
   template <int pairType, uint32_t fillMap, typename T1, typename T2>
-  static void FillPair(T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillPair(VarContext& ctx, T1 const& t1, T2 const& t2, float* values = nullptr);
+  template <int pairType, uint32_t fillMap, typename T1, typename T2>
+  static void FillPairRotation(T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillPairRotation<pairType, fillMap, T1, T2>(fgDefaultContext, t1, t2, values);
+  }
   template <int pairType, uint32_t fillMap, typename T1, typename T2>
-  static void FillPairRotation(T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillPairRotation(VarContext& ctx, T1 const& t1, T2 const& t2, float* values = nullptr);
   template <int pairType, uint32_t fillMap, typename C, typename T1, typename T2>
-  static void FillPairCollision(C const& collision, T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillPairCollision(C const& collision, T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillPairCollision<pairType, fillMap, C, T1, T2>(fgDefaultContext, collision, t1, t2, values);
+  }
+  template <int pairType, uint32_t fillMap, typename C, typename T1, typename T2>
+  static void FillPairCollision(VarContext& ctx, C const& collision, T1 const& t1, T2 const& t2, float* values = nullptr);
   template <int pairType, uint32_t fillMap, typename C, typename T1, typename T2, typename M, typename P>
-  static void FillPairCollisionMatCorr(C const& collision, T1 const& t1, T2 const& t2, M const& materialCorr, P const& propagator, float* values = nullptr);
+  static void FillPairCollisionMatCorr(C const& collision, T1 const& t1, T2 const& t2, M const& materialCorr, P const& propagator, float* values = nullptr)
+  {
+    FillPairCollisionMatCorr<pairType, fillMap, C, T1, T2, M, P>(fgDefaultContext, collision, t1, t2, materialCorr, propagator, values);
+  }
+  template <int pairType, uint32_t fillMap, typename C, typename T1, typename T2, typename M, typename P>
+  static void FillPairCollisionMatCorr(VarContext& ctx, C const& collision, T1 const& t1, T2 const& t2, M const& materialCorr, P const& propagator, float* values = nullptr);
+  template <typename T1, typename T2, typename T3>
+  static void FillTriple(T1 const& t1, T2 const& t2, T3 const& t3, float* values = nullptr, PairCandidateType pairType = kTripleCandidateToEEPhoton)
+  {
+    FillTriple<T1, T2, T3>(fgDefaultContext, t1, t2, t3, values, pairType);
+  }
   template <typename T1, typename T2, typename T3>
-  static void FillTriple(T1 const& t1, T2 const& t2, T3 const& t3, float* values = nullptr, PairCandidateType pairType = kTripleCandidateToEEPhoton);
+  static void FillTriple(VarContext& ctx, T1 const& t1, T2 const& t2, T3 const& t3, float* values = nullptr, PairCandidateType pairType = kTripleCandidateToEEPhoton);
   template <uint32_t fillMap, int pairType, typename T1, typename T2>
-  static void FillPairME(T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillPairME(T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillPairME<fillMap, pairType, T1, T2>(fgDefaultContext, t1, t2, values);
+  }
+  template <uint32_t fillMap, int pairType, typename T1, typename T2>
+  static void FillPairME(VarContext& ctx, T1 const& t1, T2 const& t2, float* values = nullptr);
   template <typename T>
-  static void FillPairMEAcrossTFs(T const& t1, T const& t2, float* values = nullptr);
+  static void FillPairMEAcrossTFs(T const& t1, T const& t2, float* values = nullptr)
+  {
+    FillPairMEAcrossTFs<T>(fgDefaultContext, t1, t2, values);
+  }
+  template <typename T>
+  static void FillPairMEAcrossTFs(VarContext& ctx, T const& t1, T const& t2, float* values = nullptr);
+  template <int pairType, typename T1, typename T2>
+  static void FillPairMC(T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillPairMC<pairType, T1, T2>(fgDefaultContext, t1, t2, values);
+  }
   template <int pairType, typename T1, typename T2>
-  static void FillPairMC(T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillPairMC(VarContext& ctx, T1 const& t1, T2 const& t2, float* values = nullptr);
+  template <int candidateType, typename T1, typename T2, typename T3>
+  static void FillTripleMC(T1 const& t1, T2 const& t2, T3 const& t3, float* values = nullptr)
+  {
+    FillTripleMC<candidateType, T1, T2, T3>(fgDefaultContext, t1, t2, t3, values);
+  }
   template <int candidateType, typename T1, typename T2, typename T3>
-  static void FillTripleMC(T1 const& t1, T2 const& t2, T3 const& t3, float* values = nullptr);
+  static void FillTripleMC(VarContext& ctx, T1 const& t1, T2 const& t2, T3 const& t3, float* values = nullptr);
   template <int candidateType, typename T1, typename T2>
-  static void FillQuadMC(T1 const& dilepton, T2 const& track1, T2 const& track2, float* values = nullptr);
+  static void FillQuadMC(T1 const& dilepton, T2 const& track1, T2 const& track2, float* values = nullptr)
+  {
+    FillQuadMC<candidateType, T1, T2>(fgDefaultContext, dilepton, track1, track2, values);
+  }
+  template <int candidateType, typename T1, typename T2>
+  static void FillQuadMC(VarContext& ctx, T1 const& dilepton, T2 const& track1, T2 const& track2, float* values = nullptr);
+  template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
+  static void FillPairVertexing(C const& collision, T const& t1, T const& t2, bool propToSV = false, float* values = nullptr)
+  {
+    FillPairVertexing<pairType, collFillMap, fillMap, C, T>(fgDefaultContext, collision, t1, t2, propToSV, values);
+  }
   template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-  static void FillPairVertexing(C const& collision, T const& t1, T const& t2, bool propToSV = false, float* values = nullptr);
+  static void FillPairVertexing(VarContext& ctx, C const& collision, T const& t1, T const& t2, bool propToSV = false, float* values = nullptr);
   template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-  static void FillPairVertexingRecomputePV(C const& /*collision*/, T const& t1, T const& t2, const o2::dataformats::VertexBase& pvRefitted, float* values = nullptr);
+  static void FillPairVertexingRecomputePV(C const& collision, T const& t1, T const& t2, const o2::dataformats::VertexBase& pvRefitted, float* values = nullptr)
+  {
+    FillPairVertexingRecomputePV<pairType, collFillMap, fillMap, C, T>(fgDefaultContext, collision, t1, t2, pvRefitted, values);
+  }
+  template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
+  static void FillPairVertexingRecomputePV(VarContext& ctx, C const& /*collision*/, T const& t1, T const& t2, const o2::dataformats::VertexBase& pvRefitted, float* values = nullptr);
   template <uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-  static void FillTripletVertexing(C const& collision, T const& t1, T const& t2, T const& t3, PairCandidateType tripletType, float* values = nullptr);
+  static void FillTripletVertexing(C const& collision, T const& t1, T const& t2, T const& t3, PairCandidateType tripletType, float* values = nullptr)
+  {
+    FillTripletVertexing<collFillMap, fillMap, C, T>(fgDefaultContext, collision, t1, t2, t3, tripletType, values);
+  }
+  template <uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
+  static void FillTripletVertexing(VarContext& ctx, C const& collision, T const& t1, T const& t2, T const& t3, PairCandidateType tripletType, float* values = nullptr);
+  template <int candidateType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T1>
+  static void FillDileptonTrackVertexing(C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track, float* values)
+  {
+    FillDileptonTrackVertexing<candidateType, collFillMap, fillMap, C, T1>(fgDefaultContext, collision, lepton1, lepton2, track, values);
+  }
   template <int candidateType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T1>
-  static void FillDileptonTrackVertexing(C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track, float* values);
+  static void FillDileptonTrackVertexing(VarContext& ctx, C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track, float* values);
   template <typename T1, typename T2>
-  static void FillDileptonHadron(T1 const& dilepton, T2 const& hadron, float* values = nullptr, float hadronMass = 0.0f);
+  static void FillDileptonHadron(T1 const& dilepton, T2 const& hadron, float* values = nullptr, float hadronMass = 0.0f)
+  {
+    FillDileptonHadron<T1, T2>(fgDefaultContext, dilepton, hadron, values, hadronMass);
+  }
+  template <typename T1, typename T2>
+  static void FillDileptonHadron(VarContext& ctx, T1 const& dilepton, T2 const& hadron, float* values = nullptr, float hadronMass = 0.0f);
+  template <typename T1, typename T2, typename T3>
+  static void FillEnergyCorrelatorTriple(T1 const& lepton1, T2 const& lepton2, T3 const& hadron, float* values = nullptr, float Translow = 1. / 3, float Transhigh = 2. / 3, bool applyFitMass = false, float sidebandMass = 0.0f, float weight = 1.0f)
+  {
+    FillEnergyCorrelatorTriple<T1, T2, T3>(fgDefaultContext, lepton1, lepton2, hadron, values, Translow, Transhigh, applyFitMass, sidebandMass, weight);
+  }
   template <typename T1, typename T2, typename T3>
-  static void FillEnergyCorrelatorTriple(T1 const& lepton1, T2 const& lepton2, T3 const& hadron, float* values = nullptr, float Translow = 1. / 3, float Transhigh = 2. / 3, bool applyFitMass = false, float sidebandMass = 0.0f, float weight = 1.0f);
+  static void FillEnergyCorrelatorTriple(VarContext& ctx, T1 const& lepton1, T2 const& lepton2, T3 const& hadron, float* values = nullptr, float Translow = 1. / 3, float Transhigh = 2. / 3, bool applyFitMass = false, float sidebandMass = 0.0f, float weight = 1.0f);
+  template <int pairType, typename T1, typename T2, typename T3, typename T4, typename T5>
+  static void FillEnergyCorrelatorsUnfoldingTriple(T1 const& lepton1, T2 const& lepton2, T3 const& hadron, T4 const& track, T5 const& t1, float* values = nullptr, bool applyFitMass = false, float Effweight_rec = 1.f, float Accweight_gen = 1.f, float Translow = 1. / 3, float Transhigh = 2. / 3)
+  {
+    FillEnergyCorrelatorsUnfoldingTriple<pairType, T1, T2, T3, T4, T5>(fgDefaultContext, lepton1, lepton2, hadron, track, t1, values, applyFitMass, Effweight_rec, Accweight_gen, Translow, Transhigh);
+  }
   template <int pairType, typename T1, typename T2, typename T3, typename T4, typename T5>
-  static void FillEnergyCorrelatorsUnfoldingTriple(T1 const& lepton1, T2 const& lepton2, T3 const& hadron, T4 const& track, T5 const& t1, float* values = nullptr, bool applyFitMass = false, float Effweight_rec = 1.f, float Accweight_gen = 1.f, float Translow = 1. / 3, float Transhigh = 2. / 3);
+  static void FillEnergyCorrelatorsUnfoldingTriple(VarContext& ctx, T1 const& lepton1, T2 const& lepton2, T3 const& hadron, T4 const& track, T5 const& t1, float* values = nullptr, bool applyFitMass = false, float Effweight_rec = 1.f, float Accweight_gen = 1.f, float Translow = 1. / 3, float Transhigh = 2. / 3);
+  template <typename T1, typename T2>
+  static void FillDileptonPhoton(T1 const& dilepton, T2 const& photon, float* values = nullptr)
+  {
+    FillDileptonPhoton<T1, T2>(fgDefaultContext, dilepton, photon, values);
+  }
   template <typename T1, typename T2>
-  static void FillDileptonPhoton(T1 const& dilepton, T2 const& photon, float* values = nullptr);
+  static void FillDileptonPhoton(VarContext& ctx, T1 const& dilepton, T2 const& photon, float* values = nullptr);
   template <typename T>
-  static void FillHadron(T const& hadron, float* values = nullptr, float hadronMass = 0.0f);
+  static void FillHadron(T const& hadron, float* values = nullptr, float hadronMass = 0.0f)
+  {
+    FillHadron<T>(fgDefaultContext, hadron, values, hadronMass);
+  }
+  template <typename T>
+  static void FillHadron(VarContext& ctx, T const& hadron, float* values = nullptr, float hadronMass = 0.0f);
   template <int partType, typename Cand, typename H, typename T>
-  static void FillSingleDileptonCharmHadron(Cand const& candidate, H hfHelper, T& bdtScoreCharmHad, float* values = nullptr);
+  static void FillSingleDileptonCharmHadron(Cand const& candidate, H hfHelper, T& bdtScoreCharmHad, float* values = nullptr)
+  {
+    FillSingleDileptonCharmHadron<partType, Cand, H, T>(fgDefaultContext, candidate, hfHelper, bdtScoreCharmHad, values);
+  }
+  template <int partType, typename Cand, typename H, typename T>
+  static void FillSingleDileptonCharmHadron(VarContext& ctx, Cand const& candidate, H hfHelper, T& bdtScoreCharmHad, float* values = nullptr);
   template <int partTypeCharmHad, typename DQ, typename HF, typename H, typename T>
-  static void FillDileptonCharmHadron(DQ const& dilepton, HF const& charmHadron, H hfHelper, T& bdtScoreCharmHad, float* values = nullptr);
+  static void FillDileptonCharmHadron(DQ const& dilepton, HF const& charmHadron, H hfHelper, T& bdtScoreCharmHad, float* values = nullptr)
+  {
+    FillDileptonCharmHadron<partTypeCharmHad, DQ, HF, H, T>(fgDefaultContext, dilepton, charmHadron, hfHelper, bdtScoreCharmHad, values);
+  }
+  template <int partTypeCharmHad, typename DQ, typename HF, typename H, typename T>
+  static void FillDileptonCharmHadron(VarContext& ctx, DQ const& dilepton, HF const& charmHadron, H hfHelper, T& bdtScoreCharmHad, float* values = nullptr);
   template <typename C, typename A>
-  static void FillQVectorFromGFW(C const& collision, A const& compA11, A const& compB11, A const& compC11, A const& compA21, A const& compB21, A const& compC21, A const& compA31, A const& compB31, A const& compC31, A const& compA41, A const& compB41, A const& compC41, A const& compA23, A const& compA42, float S10A = 1.0, float S10B = 1.0, float S10C = 1.0, float S11A = 1.0, float S11B = 1.0, float S11C = 1.0, float S12A = 1.0, float S13A = 1.0, float S14A = 1.0, float S21A = 1.0, float S22A = 1.0, float S31A = 1.0, float S41A = 1.0, float* values = nullptr);
+  static void FillQVectorFromGFW(C const& collision, A const& compA11, A const& compB11, A const& compC11, A const& compA21, A const& compB21, A const& compC21, A const& compA31, A const& compB31, A const& compC31, A const& compA41, A const& compB41, A const& compC41, A const& compA23, A const& compA42, float S10A = 1.0, float S10B = 1.0, float S10C = 1.0, float S11A = 1.0, float S11B = 1.0, float S11C = 1.0, float S12A = 1.0, float S13A = 1.0, float S14A = 1.0, float S21A = 1.0, float S22A = 1.0, float S31A = 1.0, float S41A = 1.0, float* values = nullptr)
+  {
+    FillQVectorFromGFW<C, A>(fgDefaultContext, collision, compA11, compB11, compC11, compA21, compB21, compC21, compA31, compB31, compC31, compA41, compB41, compC41, compA23, compA42, S10A, S10B, S10C, S11A, S11B, S11C, S12A, S13A, S14A, S21A, S22A, S31A, S41A, values);
+  }
+  template <typename C, typename A>
+  static void FillQVectorFromGFW(VarContext& ctx, C const& collision, A const& compA11, A const& compB11, A const& compC11, A const& compA21, A const& compB21, A const& compC21, A const& compA31, A const& compB31, A const& compC31, A const& compA41, A const& compB41, A const& compC41, A const& compA23, A const& compA42, float S10A = 1.0, float S10B = 1.0, float S10C = 1.0, float S11A = 1.0, float S11B = 1.0, float S11C = 1.0, float S12A = 1.0, float S13A = 1.0, float S14A = 1.0, float S21A = 1.0, float S22A = 1.0, float S31A = 1.0, float S41A = 1.0, float* values = nullptr);
+  template <typename C>
+  static void FillQVectorFromCentralFW(C const& collision, float* values = nullptr)
+  {
+    FillQVectorFromCentralFW<C>(fgDefaultContext, collision, values);
+  }
   template <typename C>
-  static void FillQVectorFromCentralFW(C const& collision, float* values = nullptr);
+  static void FillQVectorFromCentralFW(VarContext& ctx, C const& collision, float* values = nullptr);
   template <typename C>
   static void FillNewQVectorFromCentralFW(C const& collision, float* values = nullptr);
   template <typename C>
-  static void FillSpectatorPlane(C const& collision, float* values = nullptr);
+  static void FillSpectatorPlane(C const& collision, float* values = nullptr)
+  {
+    FillSpectatorPlane<C>(fgDefaultContext, collision, values);
+  }
+  template <typename C>
+  static void FillSpectatorPlane(VarContext& ctx, C const& collision, float* values = nullptr);
+  template <uint32_t fillMap, int pairType, typename T1, typename T2>
+  static void FillPairVn(T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillPairVn<fillMap, pairType, T1, T2>(fgDefaultContext, t1, t2, values);
+  }
   template <uint32_t fillMap, int pairType, typename T1, typename T2>
-  static void FillPairVn(T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillPairVn(VarContext& ctx, T1 const& t1, T2 const& t2, float* values = nullptr);
   template <int candidateType, typename T1, typename T2, typename T3>
-  static void FillDileptonTrackTrack(T1 const& dilepton, T2 const& hadron1, T3 const& hadron2, float* values = nullptr);
+  static void FillDileptonTrackTrack(T1 const& dilepton, T2 const& hadron1, T3 const& hadron2, float* values = nullptr)
+  {
+    FillDileptonTrackTrack<candidateType, T1, T2, T3>(fgDefaultContext, dilepton, hadron1, hadron2, values);
+  }
+  template <int candidateType, typename T1, typename T2, typename T3>
+  static void FillDileptonTrackTrack(VarContext& ctx, T1 const& dilepton, T2 const& hadron1, T3 const& hadron2, float* values = nullptr);
   template <int candidateType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T1>
-  static void FillDileptonTrackTrackVertexing(C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track1, T1 const& track2, float* values);
+  static void FillDileptonTrackTrackVertexing(C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track1, T1 const& track2, float* values)
+  {
+    FillDileptonTrackTrackVertexing<candidateType, collFillMap, fillMap, C, T1>(fgDefaultContext, collision, lepton1, lepton2, track1, track2, values);
+  }
+  template <int candidateType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T1>
+  static void FillDileptonTrackTrackVertexing(VarContext& ctx, C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track1, T1 const& track2, float* values);
   template <typename T>
-  static void FillZDC(const T& zdc, float* values = nullptr);
+  static void FillZDC(const T& zdc, float* values = nullptr)
+  {
+    FillZDC<T>(fgDefaultContext, zdc, values);
+  }
+  template <typename T>
+  static void FillZDC(VarContext& ctx, const T& zdc, float* values = nullptr);
+  template <typename T>
+  static void FillBdtScore(const T& bdtScore, float* values = nullptr)
+  {
+    FillBdtScore<T>(fgDefaultContext, bdtScore, values);
+  }
   template <typename T>
-  static void FillBdtScore(const T& bdtScore, float* values = nullptr);
+  static void FillBdtScore(VarContext& ctx, const T& bdtScore, float* values = nullptr);
   template <typename T1, typename T2, typename T3, typename T4, typename T5>
-  static void FillFIT(const T1& bc, const T2& bcs, const T3& ft0s, const T4& fv0as, const T5& fdds, float* values = nullptr);
+  static void FillFIT(const T1& bc, const T2& bcs, const T3& ft0s, const T4& fv0as, const T5& fdds, float* values = nullptr)
+  {
+    FillFIT<T1, T2, T3, T4, T5>(fgDefaultContext, bc, bcs, ft0s, fv0as, fdds, values);
+  }
+  template <typename T1, typename T2, typename T3, typename T4, typename T5>
+  static void FillFIT(VarContext& ctx, const T1& bc, const T2& bcs, const T3& ft0s, const T4& fv0as, const T5& fdds, float* values = nullptr);
   template <int pairType, uint32_t fillMap, typename T1, typename T2>
-  static void FillPairAlice3(T1 const& t1, T2 const& t2, float* values = nullptr);
+  static void FillPairAlice3(T1 const& t1, T2 const& t2, float* values = nullptr)
+  {
+    FillPairAlice3<pairType, fillMap, T1, T2>(fgDefaultContext, t1, t2, values);
+  }
+  template <int pairType, uint32_t fillMap, typename T1, typename T2>
+  static void FillPairAlice3(VarContext& ctx, T1 const& t1, T2 const& t2, float* values = nullptr);
+  template <uint32_t fillMap, typename T>
+  static void FillEventAlice3(T const& event, float* values = nullptr)
+  {
+    FillEventAlice3<fillMap, T>(fgDefaultContext, event, values);
+  }
+  template <uint32_t fillMap, typename T>
+  static void FillEventAlice3(VarContext& ctx, T const& event, float* values = nullptr);
   template <uint32_t fillMap, typename T>
-  static void FillEventAlice3(T const& event, float* values = nullptr);
+  static void FillTrackAlice3(T const& track, float* values = nullptr)
+  {
+    FillTrackAlice3<fillMap, T>(fgDefaultContext, track, values);
+  }
   template <uint32_t fillMap, typename T>
-  static void FillTrackAlice3(T const& track, float* values = nullptr);
+  static void FillTrackAlice3(VarContext& ctx, T const& track, float* values = nullptr);
+  template <typename M, typename T>
+  static void FillResolutions(M const& mcTrack, T const& track, float* values = nullptr)
+  {
+    FillResolutions<M, T>(fgDefaultContext, mcTrack, track, values);
+  }
   template <typename M, typename T>
-  static void FillResolutions(M const& mcTrack, T const& track, float* values = nullptr);
+  static void FillResolutions(VarContext& ctx, M const& mcTrack, T const& track, float* values = nullptr);
   template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-  static void FillPairVertexingAlice3(C const& collision, T const& t1, T const& t2, bool propToSV = false, float* values = nullptr);
+  static void FillPairVertexingAlice3(C const& collision, T const& t1, T const& t2, bool propToSV = false, float* values = nullptr)
+  {
+    FillPairVertexingAlice3<pairType, collFillMap, fillMap, C, T>(fgDefaultContext, collision, t1, t2, propToSV, values);
+  }
+  template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
+  static void FillPairVertexingAlice3(VarContext& ctx, C const& collision, T const& t1, T const& t2, bool propToSV = false, float* values = nullptr);
   template <uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-  static void FillTripletVertexingALICE3(C const& collision, T const& t1, T const& t2, T const& t3, VarManager::PairCandidateType tripletType, float* values = nullptr);
+  static void FillTripletVertexingALICE3(C const& collision, T const& t1, T const& t2, T const& t3, VarManager::PairCandidateType tripletType, float* values = nullptr)
+  {
+    FillTripletVertexingALICE3<collFillMap, fillMap, C, T>(fgDefaultContext, collision, t1, t2, t3, tripletType, values);
+  }
+  template <uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
+  static void FillTripletVertexingALICE3(VarContext& ctx, C const& collision, T const& t1, T const& t2, T const& t3, VarManager::PairCandidateType tripletType, float* values = nullptr);
 
   static void SetCalibrationObject(CalibObjects calib, TObject* obj)
   {
-    fgCalibs[calib] = obj;
+    fgDefaultContext.fCalibs[calib] = obj;
     // Check whether all the needed objects for TPC postcalibration are available
-    if (fgCalibs.contains(kTPCElectronMean) && fgCalibs.contains(kTPCElectronSigma)) {
-      fgRunTPCPostCalibration[0] = true;
-      fgUsedVars[kTPCnSigmaEl_Corr] = true;
+    if (fgDefaultContext.fCalibs.contains(kTPCElectronMean) && fgDefaultContext.fCalibs.contains(kTPCElectronSigma)) {
+      fgDefaultContext.fRunTPCPostCalibration[0] = true;
+      fgDefaultContext.fUsedVars[kTPCnSigmaEl_Corr] = true;
     }
-    if (fgCalibs.contains(kTPCPionMean) && fgCalibs.contains(kTPCPionSigma)) {
-      fgRunTPCPostCalibration[1] = true;
-      fgUsedVars[kTPCnSigmaPi_Corr] = true;
+    if (fgDefaultContext.fCalibs.contains(kTPCPionMean) && fgDefaultContext.fCalibs.contains(kTPCPionSigma)) {
+      fgDefaultContext.fRunTPCPostCalibration[1] = true;
+      fgDefaultContext.fUsedVars[kTPCnSigmaPi_Corr] = true;
     }
-    if (fgCalibs.contains(kTPCKaonMean) && fgCalibs.contains(kTPCKaonSigma)) {
-      fgRunTPCPostCalibration[2] = true;
-      fgUsedVars[kTPCnSigmaKa_Corr] = true;
+    if (fgDefaultContext.fCalibs.contains(kTPCKaonMean) && fgDefaultContext.fCalibs.contains(kTPCKaonSigma)) {
+      fgDefaultContext.fRunTPCPostCalibration[2] = true;
+      fgDefaultContext.fUsedVars[kTPCnSigmaKa_Corr] = true;
     }
-    if (fgCalibs.contains(kTPCProtonMean) && fgCalibs.contains(kTPCProtonSigma)) {
-      fgRunTPCPostCalibration[3] = true;
-      fgUsedVars[kTPCnSigmaPr_Corr] = true;
+    if (fgDefaultContext.fCalibs.contains(kTPCProtonMean) && fgDefaultContext.fCalibs.contains(kTPCProtonSigma)) {
+      fgDefaultContext.fRunTPCPostCalibration[3] = true;
+      fgDefaultContext.fUsedVars[kTPCnSigmaPr_Corr] = true;
     }
+    UpdateUsedVarGroups();
   }
 
   static void SetCalibrationType(int type, bool useInterpolation = true)
@@ -1535,72 +1910,59 @@ class VarManager : public TObject
     if (type < 0 || type > 2) {
       LOG(fatal) << "Invalid calibration type. Must be 0, 1, or 2.";
     }
-    fgCalibrationType = type;
-    fgUseInterpolatedCalibration = useInterpolation;
+    fgDefaultContext.fCalibrationType = type;
+    fgDefaultContext.fUseInterpolatedCalibration = useInterpolation;
   }
-  static double ComputePIDcalibration(int species, double nSigmaValue);
+  static double ComputePIDcalibration(int species, double nSigmaValue) { return ComputePIDcalibration(fgDefaultContext, species, nSigmaValue); }
+  static double ComputePIDcalibration(VarContext& ctx, int species, double nSigmaValue);
 
   static void SetEfficiencyObject(int type, TObject* obj);
-  static void FillEfficiency(float* values = nullptr);
+  static void FillEfficiency(float* values = nullptr) { FillEfficiency(fgDefaultContext, values); }
+  static void FillEfficiency(VarContext& ctx, float* values = nullptr);
   static void SetPhiMap(TObject* h1, TObject* h2, bool option);
-  static double SampleRotationPhi(double pT, double eta, int charge);
+  static double SampleRotationPhi(double pT, double eta, int charge) { return SampleRotationPhi(fgDefaultContext, pT, eta, charge); }
+  static double SampleRotationPhi(VarContext& ctx, double pT, double eta, int charge);
   static TObject* GetCalibrationObject(CalibObjects calib)
   {
-    auto obj = fgCalibs.find(calib);
-    if (obj == fgCalibs.end()) {
+    auto obj = fgDefaultContext.fCalibs.find(calib);
+    if (obj == fgDefaultContext.fCalibs.end()) {
       return nullptr;
     }
     return obj->second;
   }
   static void SetTPCInterSectorBoundary(float boundarySize)
   {
-    fgTPCInterSectorBoundary = boundarySize;
+    fgDefaultContext.fTPCInterSectorBoundary = boundarySize;
   }
   static void SetITSROFBorderselection(int bias, int length, int marginLow, int marginHigh)
   {
-    fgITSROFbias = bias;
-    fgITSROFlength = length;
-    fgITSROFBorderMarginLow = marginLow;
-    fgITSROFBorderMarginHigh = marginHigh;
+    fgDefaultContext.fITSROFbias = bias;
+    fgDefaultContext.fITSROFlength = length;
+    fgDefaultContext.fITSROFBorderMarginLow = marginLow;
+    fgDefaultContext.fITSROFBorderMarginHigh = marginHigh;
   }
 
   static void SetSORandEOR(uint64_t sor, uint64_t eor)
   {
-    fgSOR = sor;
-    fgEOR = eor;
+    fgDefaultContext.fSOR = sor;
+    fgDefaultContext.fEOR = eor;
   }
 
   VarManager();
   ~VarManager() override;
 
-  static float fgValues[kNVars]; // array holding all variables computed during analysis
-  static void ResetValues(int startValue = 0, int endValue = kNVars, float* values = nullptr);
+  static float* fgValues; // values of the default context, filled by the static API
+  static void ResetValues(int startValue = 0, int endValue = kNVars, float* values = nullptr) { ResetValues(fgDefaultContext, startValue, endValue, values); }
+  static void ResetValues(VarContext& ctx, int startValue = 0, int endValue = kNVars, float* values = nullptr);
 
  private:
-  static bool fgUsedVars[kNVars]; // holds flags for when the corresponding variable is needed (e.g., in the histogram manager, in cuts, mixing handler, etc.)
-  static bool fgUsedKF;
-  static bool fgPVrecalKF;
+  static VarContext fgDefaultContext;    // process-wide context of the static API
   static void SetVariableDependencies(); // toggle those variables on which other used variables might depend
-
-  static float fgMagField;
-  static float fgzMatching;
-  static float fgxShiftFwd;
-  static float fgyShiftFwd;
-  static float fgzShiftFwd;
-  static float fgCenterOfMassEnergy;        // collision energy
-  static float fgMassofCollidingParticle;   // mass of the colliding particle
-  static float fgTPCInterSectorBoundary;    // TPC inter-sector border size at the TPC outer radius, in cm
-  static int fgITSROFbias;                  // ITS ROF bias (from ALPIDE parameters)
-  static int fgITSROFlength;                // ITS ROF length (from ALPIDE parameters)
-  static int fgITSROFBorderMarginLow;       // ITS ROF border low margin
-  static int fgITSROFBorderMarginHigh;      // ITS ROF border high margin
-  static uint64_t fgSOR;                    // Timestamp for start of run
-  static uint64_t fgEOR;                    // Timestamp for end of run
-  static ROOT::Math::PxPyPzEVector fgBeamA; // beam from A-side 4-momentum vector
-  static ROOT::Math::PxPyPzEVector fgBeamC; // beam from C-side 4-momentum vector
+  static void UpdateUsedVarGroups();     // build the map of active pair blocks, see VarGroups
 
   // static void FillEventDerived(float* values = nullptr);
-  static void FillTrackDerived(float* values = nullptr);
+  static void FillTrackDerived(float* values = nullptr) { FillTrackDerived(fgDefaultContext, values); }
+  static void FillTrackDerived(VarContext& ctx, float* values = nullptr);
   template <typename T, typename U, typename V>
   static auto getRotatedCovMatrixXX(const T& matrix, U phi, V theta);
   template <typename T>
@@ -1611,29 +1973,15 @@ class VarManager : public TObject
   static KFPVertex createKFPVertexFromCollision(const T& collision);
   static float calculateCosPA(KFParticle kfp, KFParticle PV);
   template <int pairType, typename T1, typename T2>
-  static float calculatePhiV(const T1& t1, const T2& t2);
+  static float calculatePhiV(const T1& t1, const T2& t2)
+  {
+    return calculatePhiV<pairType, T1, T2>(fgDefaultContext, t1, t2);
+  }
+  template <int pairType, typename T1, typename T2>
+  static float calculatePhiV(VarContext& ctx, const T1& t1, const T2& t2);
   template <typename T1, typename T2>
   static float LorentzTransformJpsihadroncosChi(const TString& Option, const T1& v1, const T2& v2);
 
-  static o2::vertexing::DCAFitterN<2> fgFitterTwoProngBarrel;
-  static o2::vertexing::DCAFitterN<3> fgFitterThreeProngBarrel;
-  static o2::vertexing::DCAFitterN<4> fgFitterFourProngBarrel;
-  static o2::vertexing::FwdDCAFitterN<2> fgFitterTwoProngFwd;
-  static o2::vertexing::FwdDCAFitterN<3> fgFitterThreeProngFwd;
-  static o2::globaltracking::MatchGlobalFwd mMatching;
-
-  static std::map<CalibObjects, TObject*> fgCalibs;   // map of calibration histograms
-  static std::array<bool, 4> fgRunTPCPostCalibration; // 0-electron, 1-pion, 2-kaon, 3-proton
-  static int fgCalibrationType;                       // 0 - no calibration, 1 - calibration vs (TPCncls,pIN,eta) typically for pp, 2 - calibration vs (eta,nPV,nLong,tLong) typically for PbPb
-  static bool fgUseInterpolatedCalibration;           // use interpolated calibration histograms (default: true)
-
-  static int fgEfficiencyType;      // type of efficiency correction to apply
-  static TObject* fgEfficiencyHist; // histogram for efficiency correction
-
-  static TObject* fgPosiPhiMap; // phi map to correct track rotation
-  static TObject* fgNegaPhiMap;
-  static bool fgUsePhiCorrection;
-
   VarManager& operator=(const VarManager& c);
   VarManager(const VarManager& c);
 };
@@ -1763,16 +2111,16 @@ o2::dataformats::VertexBase VarManager::RecalculatePrimaryVertex(T const& track0
 }
 
 template <typename T, typename C>
-o2::dataformats::GlobalFwdTrack VarManager::PropagateMuon(const T& muon, const C& collision, const int endPoint)
+o2::dataformats::GlobalFwdTrack VarManager::PropagateMuon(VarContext& ctx, const T& muon, const C& collision, const int endPoint)
 {
-  o2::track::TrackParCovFwd fwdtrack = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(muon, fgxShiftFwd, fgyShiftFwd, fgzShiftFwd, muon);
+  o2::track::TrackParCovFwd fwdtrack = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(muon, ctx.fxShiftFwd, ctx.fyShiftFwd, ctx.fzShiftFwd, muon);
   o2::dataformats::GlobalFwdTrack propmuon;
   if (static_cast<int>(muon.trackType()) > 2) {
     o2::dataformats::GlobalFwdTrack track;
     track.setParameters(fwdtrack.getParameters());
     track.setZ(fwdtrack.getZ());
     track.setCovariances(fwdtrack.getCovariances());
-    auto mchTrack = mMatching.FwdtoMCH(track);
+    auto mchTrack = ctx.fMatching.FwdtoMCH(track);
 
     if (endPoint == kToVertex) {
       o2::mch::TrackExtrap::extrapToVertex(mchTrack, collision.posX(), collision.posY(), collision.posZ(), collision.covXX(), collision.covYY());
@@ -1784,17 +2132,17 @@ o2::dataformats::GlobalFwdTrack VarManager::PropagateMuon(const T& muon, const C
       o2::mch::TrackExtrap::extrapToZ(mchTrack, -505.);
     }
     if (endPoint == kToMatching) {
-      o2::mch::TrackExtrap::extrapToVertexWithoutBranson(mchTrack, fgzMatching);
+      o2::mch::TrackExtrap::extrapToVertexWithoutBranson(mchTrack, ctx.fzMatching);
     }
 
-    auto proptrack = mMatching.MCHtoFwd(mchTrack);
+    auto proptrack = ctx.fMatching.MCHtoFwd(mchTrack);
     propmuon.setParameters(proptrack.getParameters());
     propmuon.setZ(proptrack.getZ());
     propmuon.setCovariances(proptrack.getCovariances());
 
   } else if (static_cast<int>(muon.trackType()) < 2) {
     std::array<double, 3> dcaInfOrig{999.f, 999.f, 999.f};
-    fwdtrack.propagateToDCAhelix(fgMagField, {collision.posX(), collision.posY(), collision.posZ()}, dcaInfOrig);
+    fwdtrack.propagateToDCAhelix(ctx.fMagField, {collision.posX(), collision.posY(), collision.posZ()}, dcaInfOrig);
     propmuon.setParameters(fwdtrack.getParameters());
     propmuon.setZ(fwdtrack.getZ());
     propmuon.setCovariances(fwdtrack.getCovariances());
@@ -1803,24 +2151,24 @@ o2::dataformats::GlobalFwdTrack VarManager::PropagateMuon(const T& muon, const C
 }
 
 template <typename T, typename C>
-o2::track::TrackParCovFwd VarManager::PropagateFwd(const T& track, const C& cov, float z)
+o2::track::TrackParCovFwd VarManager::PropagateFwd(VarContext& ctx, const T& track, const C& cov, float z)
 {
   o2::track::TrackParCovFwd fwdtrack = FwdToTrackPar(track, cov);
-  fwdtrack.propagateToZhelix(z, fgMagField);
+  fwdtrack.propagateToZhelix(z, ctx.fMagField);
   return fwdtrack;
 }
 
 template <uint32_t fillMap, typename T, typename C>
-void VarManager::FillMuonPDca(const T& muon, const C& collision, float* values)
+void VarManager::FillMuonPDca(VarContext& ctx, const T& muon, const C& collision, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr ((fillMap & MuonCov) > 0 || (fillMap & ReducedMuonCov) > 0) {
 
-    o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(muon, collision);
-    o2::dataformats::GlobalFwdTrack propmuonAtDCA = PropagateMuon(muon, collision, kToDCA);
+    o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(ctx, muon, collision);
+    o2::dataformats::GlobalFwdTrack propmuonAtDCA = PropagateMuon(ctx, muon, collision, kToDCA);
 
     float dcaX = (propmuonAtDCA.getX() - collision.posX());
     float dcaY = (propmuonAtDCA.getY() - collision.posY());
@@ -1830,10 +2178,10 @@ void VarManager::FillMuonPDca(const T& muon, const C& collision, float* values)
 }
 
 template <uint32_t fillMap, typename T, typename C>
-void VarManager::FillPropagateMuon(const T& muon, const C& collision, float* values)
+void VarManager::FillPropagateMuon(VarContext& ctx, const T& muon, const C& collision, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr ((fillMap & ReducedMuonCov) > 0) {
@@ -1843,7 +2191,7 @@ void VarManager::FillPropagateMuon(const T& muon, const C& collision, float* val
   }
 
   if constexpr ((fillMap & MuonCov) > 0 || (fillMap & ReducedMuonCov) > 0 || (fillMap & MuonCovRealign) > 0) {
-    o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(muon, collision);
+    o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(ctx, muon, collision);
     values[kPt] = propmuon.getPt();
     values[kX] = propmuon.getX();
     values[kY] = propmuon.getY();
@@ -1855,8 +2203,8 @@ void VarManager::FillPropagateMuon(const T& muon, const C& collision, float* val
     // Redo propagation only for muon tracks
     // propagation of MFT tracks alredy done in fwdtrack-extention task
     if (static_cast<int>(muon.trackType()) > 2) {
-      o2::dataformats::GlobalFwdTrack propmuonAtDCA = PropagateMuon(muon, collision, kToDCA);
-      o2::dataformats::GlobalFwdTrack propmuonAtRabs = PropagateMuon(muon, collision, kToRabs);
+      o2::dataformats::GlobalFwdTrack propmuonAtDCA = PropagateMuon(ctx, muon, collision, kToDCA);
+      o2::dataformats::GlobalFwdTrack propmuonAtRabs = PropagateMuon(ctx, muon, collision, kToRabs);
       float dcaX = (propmuonAtDCA.getX() - collision.posX());
       float dcaY = (propmuonAtDCA.getY() - collision.posY());
       values[kMuonDCAx] = dcaX;
@@ -1886,18 +2234,18 @@ void VarManager::FillPropagateMuon(const T& muon, const C& collision, float* val
 }
 
 template <uint32_t fillMap, typename T1, typename T2, typename C>
-void VarManager::FillGlobalMuonRefit(T1 const& muontrack, T2 const& mfttrack, const C& collision, float* values)
+void VarManager::FillGlobalMuonRefit(VarContext& ctx, T1 const& muontrack, T2 const& mfttrack, const C& collision, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   if constexpr ((fillMap & MuonCov) > 0 || (fillMap & ReducedMuonCov) > 0) {
-    o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(muontrack, collision);
+    o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(ctx, muontrack, collision);
     double px = propmuon.getP() * std::sin(o2::constants::math::PIHalf - std::atan(mfttrack.tgl())) * std::cos(mfttrack.phi());
     double py = propmuon.getP() * std::sin(o2::constants::math::PIHalf - std::atan(mfttrack.tgl())) * std::sin(mfttrack.phi());
     double pz = propmuon.getP() * std::cos(o2::constants::math::PIHalf - std::atan(mfttrack.tgl()));
     double pt = std::sqrt(std::pow(px, 2) + std::pow(py, 2));
-    auto mftprop = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(mfttrack, fgxShiftFwd, fgyShiftFwd, fgzShiftFwd);
+    auto mftprop = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(mfttrack, ctx.fxShiftFwd, ctx.fyShiftFwd, ctx.fzShiftFwd);
     values[kX] = mftprop.getX();
     values[kY] = mftprop.getY();
     values[kZ] = mftprop.getZ();
@@ -1910,15 +2258,15 @@ void VarManager::FillGlobalMuonRefit(T1 const& muontrack, T2 const& mfttrack, co
 }
 
 template <uint32_t MuonfillMap, uint32_t MFTfillMap, typename T1, typename T2, typename C, typename C2>
-void VarManager::FillGlobalMuonRefitCov(T1 const& muontrack, T2 const& mfttrack, const C& collision, C2 const& mftcov, float* values)
+void VarManager::FillGlobalMuonRefitCov(VarContext& ctx, T1 const& muontrack, T2 const& mfttrack, const C& collision, C2 const& mftcov, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   if constexpr ((MuonfillMap & MuonCov) > 0) {
     if constexpr ((MFTfillMap & MFTCov) > 0) {
-      o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(muontrack, collision);
-      auto mft = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(mfttrack, fgxShiftFwd, fgyShiftFwd, fgzShiftFwd, mftcov);
+      o2::dataformats::GlobalFwdTrack propmuon = PropagateMuon(ctx, muontrack, collision);
+      auto mft = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(mfttrack, ctx.fxShiftFwd, ctx.fyShiftFwd, ctx.fzShiftFwd, mftcov);
 
       o2::dataformats::GlobalFwdTrack globalRefit = o2::aod::fwdtrackutils::refitGlobalMuonCov(propmuon, mft);
       values[kX] = globalRefit.getX();
@@ -1934,10 +2282,10 @@ void VarManager::FillGlobalMuonRefitCov(T1 const& muontrack, T2 const& mfttrack,
 }
 
 template <typename T>
-void VarManager::FillTimeFrame(T const& tf, float* values)
+void VarManager::FillTimeFrame(VarContext& ctx, T const& tf, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   if constexpr (T::template contains<o2::aod::BCs>()) {
     values[kTFNBCs] = tf.size();
@@ -1960,117 +2308,117 @@ void VarManager::FillTimeFrame(T const& tf, float* values)
 }
 
 template <typename T>
-void VarManager::FillBC(T const& bc, float* values)
+void VarManager::FillBC(VarContext& ctx, T const& bc, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   values[kRunNo] = bc.runNumber();
   values[kBC] = bc.globalBC();
   values[kBCOrbit] = bc.globalBC() % o2::constants::lhc::LHCMaxBunches;
   values[kTimestamp] = bc.timestamp();
-  values[kTimeFromSOR] = (fgSOR > 0 ? (bc.timestamp() - fgSOR) / 60000. : -1.0);
+  values[kTimeFromSOR] = (ctx.fSOR > 0 ? (bc.timestamp() - ctx.fSOR) / 60000. : -1.0);
 }
 
 template <uint32_t fillMap, typename T>
-void VarManager::FillEvent(T const& event, float* values)
+void VarManager::FillEvent(VarContext& ctx, T const& event, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr ((fillMap & CollisionTimestamp) > 0) {
     values[kTimestamp] = event.timestamp();
   }
 
-  if (fgUsedVars[kCollisionRandom]) {
-    values[kCollisionRandom] = gRandom->Rndm();
+  if (ctx.fUsedVars[kCollisionRandom]) {
+    values[kCollisionRandom] = ctx.GetRandom()->Rndm();
   }
 
-  if (fgUsedVars[kRandomPsi2]) {
-    values[kRandomPsi2] = gRandom->Uniform(-o2::constants::math::PIHalf, o2::constants::math::PIHalf);
+  if (ctx.fUsedVars[kRandomPsi2]) {
+    values[kRandomPsi2] = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, o2::constants::math::PIHalf);
   }
 
   if constexpr ((fillMap & Collision) > 0) {
     // TODO: trigger info from the event selection requires a separate flag
     //       so that it can be switched off independently of the rest of Collision variables (e.g. if event selection is not available)
 
-    if (fgUsedVars[kIsNoITSROFBorder]) {
+    if (ctx.fUsedVars[kIsNoITSROFBorder]) {
       values[kIsNoITSROFBorder] = event.selection_bit(o2::aod::evsel::kNoITSROFrameBorder);
     }
-    if (fgUsedVars[kTrackOccupancyInTimeRange]) {
+    if (ctx.fUsedVars[kTrackOccupancyInTimeRange]) {
       values[kTrackOccupancyInTimeRange] = event.trackOccupancyInTimeRange();
     }
-    if (fgUsedVars[kFT0COccupancyInTimeRange]) {
+    if (ctx.fUsedVars[kFT0COccupancyInTimeRange]) {
       values[kFT0COccupancyInTimeRange] = event.ft0cOccupancyInTimeRange();
     }
-    if (fgUsedVars[kNoCollInTimeRangeStandard]) {
+    if (ctx.fUsedVars[kNoCollInTimeRangeStandard]) {
       values[kNoCollInTimeRangeStandard] = event.selection_bit(o2::aod::evsel::kNoCollInTimeRangeStandard);
     }
-    if (fgUsedVars[kIsTVXTriggered]) {
+    if (ctx.fUsedVars[kIsTVXTriggered]) {
       values[kIsTVXTriggered] = event.selection_bit(o2::aod::evsel::kIsTriggerTVX);
     }
-    if (fgUsedVars[kIsNoTFBorder]) {
+    if (ctx.fUsedVars[kIsNoTFBorder]) {
       values[kIsNoTFBorder] = event.selection_bit(o2::aod::evsel::kNoTimeFrameBorder);
     }
-    if (fgUsedVars[kIsTriggerZNAZNC]) {
+    if (ctx.fUsedVars[kIsTriggerZNAZNC]) {
       values[kIsTriggerZNAZNC] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsBBZNA) && event.selection_bit(o2::aod::evsel::kIsBBZNC));
     }
-    if (fgUsedVars[kIsNoSameBunch]) {
+    if (ctx.fUsedVars[kIsNoSameBunch]) {
       values[kIsNoSameBunch] = event.selection_bit(o2::aod::evsel::kNoSameBunchPileup);
     }
-    if (fgUsedVars[kIsGoodZvtxFT0vsPV]) {
+    if (ctx.fUsedVars[kIsGoodZvtxFT0vsPV]) {
       values[kIsGoodZvtxFT0vsPV] = event.selection_bit(o2::aod::evsel::kIsGoodZvtxFT0vsPV);
     }
-    if (fgUsedVars[kIsVertexITSTPC]) {
+    if (ctx.fUsedVars[kIsVertexITSTPC]) {
       values[kIsVertexITSTPC] = event.selection_bit(o2::aod::evsel::kIsVertexITSTPC);
     }
-    if (fgUsedVars[kIsVertexTOFmatched]) {
+    if (ctx.fUsedVars[kIsVertexTOFmatched]) {
       values[kIsVertexTOFmatched] = event.selection_bit(o2::aod::evsel::kIsVertexTOFmatched);
     }
-    if (fgUsedVars[kIsSel8]) {
+    if (ctx.fUsedVars[kIsSel8]) {
       values[kIsSel8] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsTriggerTVX) && event.selection_bit(o2::aod::evsel::kNoITSROFrameBorder) && event.selection_bit(o2::aod::evsel::kNoTimeFrameBorder));
     }
-    if (fgUsedVars[kIsGoodITSLayer3]) {
+    if (ctx.fUsedVars[kIsGoodITSLayer3]) {
       values[kIsGoodITSLayer3] = event.selection_bit(o2::aod::evsel::kIsGoodITSLayer3);
     }
-    if (fgUsedVars[kIsGoodITSLayer0123]) {
+    if (ctx.fUsedVars[kIsGoodITSLayer0123]) {
       values[kIsGoodITSLayer0123] = event.selection_bit(o2::aod::evsel::kIsGoodITSLayer0123);
     }
-    if (fgUsedVars[kIsGoodITSLayersAll]) {
+    if (ctx.fUsedVars[kIsGoodITSLayersAll]) {
       values[kIsGoodITSLayersAll] = event.selection_bit(o2::aod::evsel::kIsGoodITSLayersAll);
     }
-    if (fgUsedVars[kIsINT7]) {
+    if (ctx.fUsedVars[kIsINT7]) {
       values[kIsINT7] = static_cast<float>(event.alias_bit(kINT7) > 0);
     }
-    if (fgUsedVars[kIsEMC7]) {
+    if (ctx.fUsedVars[kIsEMC7]) {
       values[kIsEMC7] = static_cast<float>(event.alias_bit(kEMC7) > 0);
     }
-    if (fgUsedVars[kIsINT7inMUON]) {
+    if (ctx.fUsedVars[kIsINT7inMUON]) {
       values[kIsINT7inMUON] = static_cast<float>(event.alias_bit(kINT7inMUON) > 0);
     }
-    if (fgUsedVars[kIsMuonSingleLowPt7]) {
+    if (ctx.fUsedVars[kIsMuonSingleLowPt7]) {
       values[kIsMuonSingleLowPt7] = static_cast<float>(event.alias_bit(kMuonSingleLowPt7) > 0);
     }
-    if (fgUsedVars[kIsMuonSingleHighPt7]) {
+    if (ctx.fUsedVars[kIsMuonSingleHighPt7]) {
       values[kIsMuonSingleHighPt7] = static_cast<float>(event.alias_bit(kMuonSingleHighPt7) > 0);
     }
-    if (fgUsedVars[kIsMuonUnlikeLowPt7]) {
+    if (ctx.fUsedVars[kIsMuonUnlikeLowPt7]) {
       values[kIsMuonUnlikeLowPt7] = static_cast<float>(event.alias_bit(kMuonUnlikeLowPt7) > 0);
     }
-    if (fgUsedVars[kIsMuonLikeLowPt7]) {
+    if (ctx.fUsedVars[kIsMuonLikeLowPt7]) {
       values[kIsMuonLikeLowPt7] = static_cast<float>(event.alias_bit(kMuonLikeLowPt7) > 0);
     }
-    if (fgUsedVars[kIsCUP8]) {
+    if (ctx.fUsedVars[kIsCUP8]) {
       values[kIsCUP8] = static_cast<float>(event.alias_bit(kCUP8) > 0);
     }
-    if (fgUsedVars[kIsCUP9]) {
+    if (ctx.fUsedVars[kIsCUP9]) {
       values[kIsCUP9] = static_cast<float>(event.alias_bit(kCUP9) > 0);
     }
-    if (fgUsedVars[kIsMUP10]) {
+    if (ctx.fUsedVars[kIsMUP10]) {
       values[kIsMUP10] = static_cast<float>(event.alias_bit(kMUP10) > 0);
     }
-    if (fgUsedVars[kIsMUP11]) {
+    if (ctx.fUsedVars[kIsMUP11]) {
       values[kIsMUP11] = static_cast<float>(event.alias_bit(kMUP11) > 0);
     }
     values[kVtxX] = event.posX();
@@ -2151,14 +2499,14 @@ void VarManager::FillEvent(T const& event, float* values)
     values[kVtxY] = event.posY();
     values[kVtxZ] = event.posZ();
     values[kVtxNcontrib] = event.numContrib();
-    if (fgUsedVars[kIsDoubleGap] || fgUsedVars[kIsSingleGap] || fgUsedVars[kIsSingleGapA] || fgUsedVars[kIsSingleGapC] || fgUsedVars[kIsNoGap]) {
+    if (ctx.fUsedVars[kIsDoubleGap] || ctx.fUsedVars[kIsSingleGap] || ctx.fUsedVars[kIsSingleGapA] || ctx.fUsedVars[kIsSingleGapC] || ctx.fUsedVars[kIsNoGap]) {
       values[kIsDoubleGap] = static_cast<float>(event.tag_bit(56 + kDoubleGap) > 0);
       values[kIsSingleGapA] = static_cast<float>(event.tag_bit(56 + kSingleGapA) > 0);
       values[kIsSingleGapC] = static_cast<float>(event.tag_bit(56 + kSingleGapC) > 0);
       values[kIsSingleGap] = static_cast<float>(values[kIsSingleGapA] != 0.f || values[kIsSingleGapC] != 0.f);
       values[kIsNoGap] = static_cast<float>(values[kIsDoubleGap] == 0.f && values[kIsSingleGap] == 0.f);
     }
-    if (fgUsedVars[kIsITSUPCMode]) {
+    if (ctx.fUsedVars[kIsITSUPCMode]) {
       values[kIsITSUPCMode] = static_cast<float>(event.tag_bit(56 + kITSUPCMode) > 0);
     }
     values[kCollisionTime] = event.collisionTime();
@@ -2169,83 +2517,83 @@ void VarManager::FillEvent(T const& event, float* values)
     values[kBC] = event.globalBC();
     values[kBCOrbit] = event.globalBC() % o2::constants::lhc::LHCMaxBunches;
     values[kTimestamp] = event.timestamp();
-    values[kTimeFromSOR] = (fgSOR > 0 ? (event.timestamp() - fgSOR) / 60000. : -1.0);
+    values[kTimeFromSOR] = (ctx.fSOR > 0 ? (event.timestamp() - ctx.fSOR) / 60000. : -1.0);
     values[kCentVZERO] = event.centRun2V0M();
     values[kCentFT0C] = event.centFT0C();
-    if (fgUsedVars[kIsNoITSROFBorderRecomputed]) {
-      uint16_t bcInITSROF = (event.globalBC() + 3564 - fgITSROFbias) % fgITSROFlength;
-      values[kIsNoITSROFBorderRecomputed] = bcInITSROF > fgITSROFBorderMarginLow && bcInITSROF < fgITSROFlength - fgITSROFBorderMarginHigh ? 1.0 : 0.0;
+    if (ctx.fUsedVars[kIsNoITSROFBorderRecomputed]) {
+      uint16_t bcInITSROF = (event.globalBC() + 3564 - ctx.fITSROFbias) % ctx.fITSROFlength;
+      values[kIsNoITSROFBorderRecomputed] = bcInITSROF > ctx.fITSROFBorderMarginLow && bcInITSROF < ctx.fITSROFlength - ctx.fITSROFBorderMarginHigh ? 1.0 : 0.0;
     }
-    if (fgUsedVars[kIsNoITSROFBorder]) {
+    if (ctx.fUsedVars[kIsNoITSROFBorder]) {
       values[kIsNoITSROFBorder] = static_cast<float>(event.selection_bit(o2::aod::evsel::kNoITSROFrameBorder) > 0);
     }
-    if (fgUsedVars[kIsTVXTriggered]) {
+    if (ctx.fUsedVars[kIsTVXTriggered]) {
       values[kIsTVXTriggered] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsTriggerTVX) > 0);
     }
-    if (fgUsedVars[kIsNoTFBorder]) {
+    if (ctx.fUsedVars[kIsNoTFBorder]) {
       values[kIsNoTFBorder] = static_cast<float>(event.selection_bit(o2::aod::evsel::kNoTimeFrameBorder) > 0);
     }
-    if (fgUsedVars[kNoCollInTimeRangeStandard]) {
+    if (ctx.fUsedVars[kNoCollInTimeRangeStandard]) {
       values[kNoCollInTimeRangeStandard] = static_cast<float>(event.selection_bit(o2::aod::evsel::kNoCollInTimeRangeStandard) > 0);
     }
-    if (fgUsedVars[kIsNoSameBunch]) {
+    if (ctx.fUsedVars[kIsNoSameBunch]) {
       values[kIsNoSameBunch] = static_cast<float>(event.selection_bit(o2::aod::evsel::kNoSameBunchPileup) > 0);
     }
-    if (fgUsedVars[kIsTriggerZNAZNC]) {
+    if (ctx.fUsedVars[kIsTriggerZNAZNC]) {
       values[kIsTriggerZNAZNC] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsBBZNA) && event.selection_bit(o2::aod::evsel::kIsBBZNC));
     }
-    if (fgUsedVars[kIsGoodZvtxFT0vsPV]) {
+    if (ctx.fUsedVars[kIsGoodZvtxFT0vsPV]) {
       values[kIsGoodZvtxFT0vsPV] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsGoodZvtxFT0vsPV) > 0);
     }
-    if (fgUsedVars[kIsVertexITSTPC]) {
+    if (ctx.fUsedVars[kIsVertexITSTPC]) {
       values[kIsVertexITSTPC] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsVertexITSTPC) > 0);
     }
-    if (fgUsedVars[kIsVertexTOFmatched]) {
+    if (ctx.fUsedVars[kIsVertexTOFmatched]) {
       values[kIsVertexTOFmatched] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsVertexTOFmatched) > 0);
     }
-    if (fgUsedVars[kIsSel8]) {
+    if (ctx.fUsedVars[kIsSel8]) {
       values[kIsSel8] = static_cast<float>(event.selection_bit(o2::aod::evsel::kIsTriggerTVX) && event.selection_bit(o2::aod::evsel::kNoTimeFrameBorder) && event.selection_bit(o2::aod::evsel::kNoITSROFrameBorder));
     }
-    if (fgUsedVars[kIsGoodITSLayer3]) {
+    if (ctx.fUsedVars[kIsGoodITSLayer3]) {
       values[kIsGoodITSLayer3] = event.selection_bit(o2::aod::evsel::kIsGoodITSLayer3);
     }
-    if (fgUsedVars[kIsGoodITSLayer0123]) {
+    if (ctx.fUsedVars[kIsGoodITSLayer0123]) {
       values[kIsGoodITSLayer0123] = event.selection_bit(o2::aod::evsel::kIsGoodITSLayer0123);
     }
-    if (fgUsedVars[kIsGoodITSLayersAll]) {
+    if (ctx.fUsedVars[kIsGoodITSLayersAll]) {
       values[kIsGoodITSLayersAll] = event.selection_bit(o2::aod::evsel::kIsGoodITSLayersAll);
     }
-    if (fgUsedVars[kIsINT7]) {
+    if (ctx.fUsedVars[kIsINT7]) {
       values[kIsINT7] = static_cast<float>(event.alias_bit(kINT7) > 0);
     }
-    if (fgUsedVars[kIsEMC7]) {
+    if (ctx.fUsedVars[kIsEMC7]) {
       values[kIsEMC7] = static_cast<float>(event.alias_bit(kEMC7) > 0);
     }
-    if (fgUsedVars[kIsINT7inMUON]) {
+    if (ctx.fUsedVars[kIsINT7inMUON]) {
       values[kIsINT7inMUON] = static_cast<float>(event.alias_bit(kINT7inMUON) > 0);
     }
-    if (fgUsedVars[kIsMuonSingleLowPt7]) {
+    if (ctx.fUsedVars[kIsMuonSingleLowPt7]) {
       values[kIsMuonSingleLowPt7] = static_cast<float>(event.alias_bit(kMuonSingleLowPt7) > 0);
     }
-    if (fgUsedVars[kIsMuonSingleHighPt7]) {
+    if (ctx.fUsedVars[kIsMuonSingleHighPt7]) {
       values[kIsMuonSingleHighPt7] = static_cast<float>(event.alias_bit(kMuonSingleHighPt7) > 0);
     }
-    if (fgUsedVars[kIsMuonUnlikeLowPt7]) {
+    if (ctx.fUsedVars[kIsMuonUnlikeLowPt7]) {
       values[kIsMuonUnlikeLowPt7] = static_cast<float>(event.alias_bit(kMuonUnlikeLowPt7) > 0);
     }
-    if (fgUsedVars[kIsMuonLikeLowPt7]) {
+    if (ctx.fUsedVars[kIsMuonLikeLowPt7]) {
       values[kIsMuonLikeLowPt7] = static_cast<float>(event.alias_bit(kMuonLikeLowPt7) > 0);
     }
-    if (fgUsedVars[kIsCUP8]) {
+    if (ctx.fUsedVars[kIsCUP8]) {
       values[kIsCUP8] = static_cast<float>(event.alias_bit(kCUP8) > 0);
     }
-    if (fgUsedVars[kIsCUP9]) {
+    if (ctx.fUsedVars[kIsCUP9]) {
       values[kIsCUP9] = static_cast<float>(event.alias_bit(kCUP9) > 0);
     }
-    if (fgUsedVars[kIsMUP10]) {
+    if (ctx.fUsedVars[kIsMUP10]) {
       values[kIsMUP10] = static_cast<float>(event.alias_bit(kMUP10) > 0);
     }
-    if (fgUsedVars[kIsMUP11]) {
+    if (ctx.fUsedVars[kIsMUP11]) {
       values[kIsMUP11] = static_cast<float>(event.alias_bit(kMUP11) > 0);
     }
   }
@@ -2571,7 +2919,7 @@ void VarManager::FillEvent(T const& event, float* values)
   }
 
   if constexpr ((fillMap & ReducedZdc) > 0) {
-    FillZDC(event, values);
+    FillZDC(ctx, event, values);
   }
 
   if constexpr ((fillMap & ReducedFit) > 0) {
@@ -2640,10 +2988,10 @@ void VarManager::FillEvent(T const& event, float* values)
 }
 
 template <typename T>
-void VarManager::FillEventTracks(T const& tracks, float* values)
+void VarManager::FillEventTracks(VarContext& ctx, T const& tracks, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   // compute event properties based on DCAz of the tracks
@@ -2776,10 +3124,10 @@ void VarManager::FillEventTracks(T const& tracks, float* values)
 }
 
 template <typename T>
-void VarManager::FillEventFlowResoFactor(T const& hs_sp, T const& hs_ep, float* values)
+void VarManager::FillEventFlowResoFactor(VarContext& ctx, T const& hs_sp, T const& hs_ep, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if (values[kCentFT0C] >= 0.) {
@@ -2792,10 +3140,10 @@ void VarManager::FillEventFlowResoFactor(T const& hs_sp, T const& hs_ep, float*
 }
 
 template <typename T>
-void VarManager::FillTwoMixEventsFlowResoFactor(T const& hs_sp, T const& hs_ep, float* values)
+void VarManager::FillTwoMixEventsFlowResoFactor(VarContext& ctx, T const& hs_sp, T const& hs_ep, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if (values[kTwoEvCentFT0C1] >= 0.) {
@@ -2816,10 +3164,10 @@ void VarManager::FillTwoMixEventsFlowResoFactor(T const& hs_sp, T const& hs_ep,
 }
 
 template <typename T, typename T1, typename T2>
-void VarManager::FillTwoMixEventsCumulants(T const& h_v22ev1, T const& h_v24ev1, T const& h_v22ev2, T const& h_v24ev2, T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillTwoMixEventsCumulants(VarContext& ctx, T const& h_v22ev1, T const& h_v24ev1, T const& h_v22ev2, T const& h_v24ev2, T1 const& t1, T2 const& t2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   int idx_v22ev1 = 0;
@@ -2862,10 +3210,10 @@ void VarManager::FillTwoMixEventsCumulants(T const& h_v22ev1, T const& h_v24ev1,
 }
 
 template <typename T>
-void VarManager::FillTwoEvents(T const& ev1, T const& ev2, float* values)
+void VarManager::FillTwoEvents(VarContext& ctx, T const& ev1, T const& ev2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   // if constexpr (T::template contains<o2::aod::Collision>()) {
   values[kTwoEvPosZ1] = ev1.posZ();
@@ -2882,10 +3230,10 @@ void VarManager::FillTwoEvents(T const& ev1, T const& ev2, float* values)
 }
 
 template <uint32_t fillMap, typename T1, typename T2>
-void VarManager::FillTwoMixEvents(T1 const& ev1, T1 const& ev2, T2 const& /*tracks1*/, T2 const& /*tracks2*/, float* values)
+void VarManager::FillTwoMixEvents(VarContext& ctx, T1 const& ev1, T1 const& ev2, T2 const& /*tracks1*/, T2 const& /*tracks2*/, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   values[kTwoEvPosZ1] = ev1.posZ();
   values[kTwoEvPosZ2] = ev2.posZ();
@@ -2940,10 +3288,10 @@ void VarManager::FillTwoMixEvents(T1 const& ev1, T1 const& ev2, T2 const& /*trac
 }
 
 template <uint32_t fillMap, typename T>
-void VarManager::FillTrack(T const& track, float* values)
+void VarManager::FillTrack(VarContext& ctx, T const& track, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr ((fillMap & TrackMFT) > 0) {
@@ -2969,31 +3317,31 @@ void VarManager::FillTrack(T const& track, float* values)
   if constexpr ((fillMap & Track) > 0 || (fillMap & Muon) > 0 || (fillMap & MuonRealign) > 0 || (fillMap & ReducedTrack) > 0 || (fillMap & ReducedMuon) > 0) {
     values[kPt] = track.pt();
     values[kSignedPt] = track.pt() * track.sign();
-    if (fgUsedVars[kP]) {
+    if (ctx.fUsedVars[kP]) {
       values[kP] = track.p();
     }
-    if (fgUsedVars[kPx]) {
+    if (ctx.fUsedVars[kPx]) {
       values[kPx] = track.px();
     }
-    if (fgUsedVars[kPy]) {
+    if (ctx.fUsedVars[kPy]) {
       values[kPy] = track.py();
     }
-    if (fgUsedVars[kPz]) {
+    if (ctx.fUsedVars[kPz]) {
       values[kPz] = track.pz();
     }
-    if (fgUsedVars[kInvPt]) {
+    if (ctx.fUsedVars[kInvPt]) {
       values[kInvPt] = 1. / track.pt();
     }
     values[kEta] = track.eta();
     values[kPhi] = track.phi();
     values[kCharge] = track.sign();
-    if (fgUsedVars[kPhiTPCOuter]) {
-      values[kPhiTPCOuter] = RecoDecay::constrainAngle(track.phi() - (track.sign() > 0 ? 1.0 : -1.0) * (o2::constants::math::PIHalf - TMath::ACos(0.22 * fgMagField / track.pt())));
+    if (ctx.fUsedVars[kPhiTPCOuter]) {
+      values[kPhiTPCOuter] = RecoDecay::constrainAngle(track.phi() - (track.sign() > 0 ? 1.0 : -1.0) * (o2::constants::math::PIHalf - TMath::ACos(0.22 * ctx.fMagField / track.pt())));
     }
-    if (fgUsedVars[kTrackIsInsideTPCModule]) {
+    if (ctx.fUsedVars[kTrackIsInsideTPCModule]) {
       float localSectorPhi = values[kPhiTPCOuter] - TMath::Floor(18.0 * values[kPhiTPCOuter] / o2::constants::math::TwoPI) * (o2::constants::math::TwoPI / 18.0);
-      float edge = fgTPCInterSectorBoundary / 2.0 / 246.6; // minimal inter-sector boundary as angle
-      float curvature = 3.0 * 3.33 * track.pt() / fgMagField * (1.0 - TMath::Sin(TMath::ACos(0.22 * fgMagField / track.pt())));
+      float edge = ctx.fTPCInterSectorBoundary / 2.0 / 246.6; // minimal inter-sector boundary as angle
+      float curvature = 3.0 * 3.33 * track.pt() / ctx.fMagField * (1.0 - TMath::Sin(TMath::ACos(0.22 * ctx.fMagField / track.pt())));
       if (curvature / 2.466 > edge) {
         edge = curvature / 2.466;
       }
@@ -3020,7 +3368,7 @@ void VarManager::FillTrack(T const& track, float* values)
       }
     }
 
-    if (fgUsedVars[kM11REFoverMpsingle]) {
+    if (ctx.fUsedVars[kM11REFoverMpsingle]) {
       float m = o2::constants::physics::MassMuon;
       ROOT::Math::PtEtaPhiMVector v(track.pt(), track.eta(), track.phi(), m);
       std::complex<double> Q21(values[kQ2X0A] * values[kS11A], values[kQ2Y0A] * values[kS11A]);
@@ -3049,44 +3397,44 @@ void VarManager::FillTrack(T const& track, float* values)
   if constexpr ((fillMap & TrackExtra) > 0 || (fillMap & ReducedTrackBarrel) > 0) {
     values[kPin] = track.tpcInnerParam();
     values[kSignedPin] = track.tpcInnerParam() * track.sign();
-    if (fgUsedVars[kIsITSrefit]) {
+    if (ctx.fUsedVars[kIsITSrefit]) {
       values[kIsITSrefit] = static_cast<float>((track.flags() & o2::aod::track::ITSrefit) > 0); // NOTE: This is just for Run-2
     }
-    if (fgUsedVars[kTrackTimeResIsRange]) {
+    if (ctx.fUsedVars[kTrackTimeResIsRange]) {
       values[kTrackTimeResIsRange] = static_cast<float>((track.flags() & o2::aod::track::TrackTimeResIsRange) > 0); // NOTE: This is NOT for Run-2
     }
-    if (fgUsedVars[kIsTPCrefit]) {
+    if (ctx.fUsedVars[kIsTPCrefit]) {
       values[kIsTPCrefit] = static_cast<float>((track.flags() & o2::aod::track::TPCrefit) > 0); // NOTE: This is just for Run-2
     }
-    if (fgUsedVars[kPVContributor]) {
+    if (ctx.fUsedVars[kPVContributor]) {
       values[kPVContributor] = static_cast<float>((track.flags() & o2::aod::track::PVContributor) > 0); // NOTE: This is NOT for Run-2
     }
-    if (fgUsedVars[kIsGoldenChi2]) {
+    if (ctx.fUsedVars[kIsGoldenChi2]) {
       values[kIsGoldenChi2] = static_cast<float>((track.flags() & o2::aod::track::GoldenChi2) > 0); // NOTE: This is just for Run-2
     }
-    if (fgUsedVars[kOrphanTrack]) {
+    if (ctx.fUsedVars[kOrphanTrack]) {
       values[kOrphanTrack] = static_cast<float>((track.flags() & o2::aod::track::OrphanTrack) > 0); // NOTE: This is NOT for Run-2
     }
-    if (fgUsedVars[kIsSPDfirst]) {
+    if (ctx.fUsedVars[kIsSPDfirst]) {
       values[kIsSPDfirst] = static_cast<float>((track.itsClusterMap() & uint8_t(1)) > 0);
     }
-    if (fgUsedVars[kIsSPDboth]) {
+    if (ctx.fUsedVars[kIsSPDboth]) {
       values[kIsSPDboth] = static_cast<float>((track.itsClusterMap() & uint8_t(3)) > 0);
     }
-    if (fgUsedVars[kIsSPDany]) {
+    if (ctx.fUsedVars[kIsSPDany]) {
       values[kIsSPDany] = static_cast<float>((track.itsClusterMap() & uint8_t(1)) || (track.itsClusterMap() & uint8_t(2)));
     }
-    if (fgUsedVars[kITSClusterMap]) {
+    if (ctx.fUsedVars[kITSClusterMap]) {
       values[kITSClusterMap] = track.itsClusterMap();
     }
 
-    if (fgUsedVars[kIsITSibFirst]) {
+    if (ctx.fUsedVars[kIsITSibFirst]) {
       values[kIsITSibFirst] = static_cast<float>((track.itsClusterMap() & uint8_t(1)) > 0);
     }
-    if (fgUsedVars[kIsITSibAny]) {
+    if (ctx.fUsedVars[kIsITSibAny]) {
       values[kIsITSibAny] = static_cast<float>((track.itsClusterMap() & (1 << uint8_t(0))) > 0 || (track.itsClusterMap() & (1 << uint8_t(1))) > 0 || (track.itsClusterMap() & (1 << uint8_t(2))) > 0);
     }
-    if (fgUsedVars[kIsITSibAll]) {
+    if (ctx.fUsedVars[kIsITSibAll]) {
       values[kIsITSibAll] = static_cast<float>((track.itsClusterMap() & (1 << uint8_t(0))) > 0 && (track.itsClusterMap() & (1 << uint8_t(1))) > 0 && (track.itsClusterMap() & (1 << uint8_t(2))) > 0);
     }
 
@@ -3111,13 +3459,13 @@ void VarManager::FillTrack(T const& track, float* values)
     values[kHasTPC] = track.hasTPC();
 
     if constexpr ((fillMap & TrackExtra) > 0) {
-      if (fgUsedVars[kTPCnCRoverFindCls]) {
+      if (ctx.fUsedVars[kTPCnCRoverFindCls]) {
         values[kTPCnCRoverFindCls] = track.tpcCrossedRowsOverFindableCls();
       }
-      if (fgUsedVars[kITSncls]) {
+      if (ctx.fUsedVars[kITSncls]) {
         values[kITSncls] = track.itsNCls(); // dynamic column
       }
-      if (fgUsedVars[kITSmeanClsSize]) {
+      if (ctx.fUsedVars[kITSmeanClsSize]) {
         values[kITSmeanClsSize] = 0.0;
         uint32_t clsizeflag = track.itsClusterSizes();
         float mcls = 0.;
@@ -3130,28 +3478,28 @@ void VarManager::FillTrack(T const& track, float* values)
       }
     }
     if constexpr ((fillMap & ReducedTrackBarrel) > 0) {
-      if (fgUsedVars[kITSncls]) {
+      if (ctx.fUsedVars[kITSncls]) {
         values[kITSncls] = 0.0;
         for (int i = 0; i < 7; ++i) {
           values[kITSncls] += ((track.itsClusterMap() & (1 << i)) ? 1 : 0);
         }
       }
-      if (fgUsedVars[kTPCnCRoverFindCls]) {
+      if (ctx.fUsedVars[kTPCnCRoverFindCls]) {
         values[kTPCnCRoverFindCls] = values[kTPCnclsCR] / values[kTPCncls];
       }
       values[kTrackDCAxy] = track.dcaXY();
       values[kTrackDCAz] = track.dcaZ();
       if constexpr ((fillMap & ReducedTrackBarrelCov) > 0) {
-        if (fgUsedVars[kTrackDCAsigXY]) {
+        if (ctx.fUsedVars[kTrackDCAsigXY]) {
           values[kTrackDCAsigXY] = track.dcaXY() / std::sqrt(track.cYY());
         }
-        if (fgUsedVars[kTrackDCAsigZ]) {
+        if (ctx.fUsedVars[kTrackDCAsigZ]) {
           values[kTrackDCAsigZ] = track.dcaZ() / std::sqrt(track.cZZ());
         }
-        if (fgUsedVars[kTrackDCAresXY]) {
+        if (ctx.fUsedVars[kTrackDCAresXY]) {
           values[kTrackDCAresXY] = std::sqrt(track.cYY());
         }
-        if (fgUsedVars[kTrackDCAresZ]) {
+        if (ctx.fUsedVars[kTrackDCAresZ]) {
           values[kTrackDCAresZ] = std::sqrt(track.cZZ());
         }
       }
@@ -3163,16 +3511,16 @@ void VarManager::FillTrack(T const& track, float* values)
     values[kTrackDCAxy] = track.dcaXY();
     values[kTrackDCAz] = track.dcaZ();
     if constexpr ((fillMap & TrackCov) > 0) {
-      if (fgUsedVars[kTrackDCAsigXY]) {
+      if (ctx.fUsedVars[kTrackDCAsigXY]) {
         values[kTrackDCAsigXY] = track.dcaXY() / std::sqrt(track.cYY());
       }
-      if (fgUsedVars[kTrackDCAsigZ]) {
+      if (ctx.fUsedVars[kTrackDCAsigZ]) {
         values[kTrackDCAsigZ] = track.dcaZ() / std::sqrt(track.cZZ());
       }
-      if (fgUsedVars[kTrackDCAresXY]) {
+      if (ctx.fUsedVars[kTrackDCAresXY]) {
         values[kTrackDCAresXY] = std::sqrt(track.cYY());
       }
-      if (fgUsedVars[kTrackDCAresZ]) {
+      if (ctx.fUsedVars[kTrackDCAresZ]) {
         values[kTrackDCAresZ] = std::sqrt(track.cZZ());
       }
     }
@@ -3224,9 +3572,9 @@ void VarManager::FillTrack(T const& track, float* values)
       }
     }
     // compute TPC postcalibrated electron nsigma based on calibration histograms from CCDB
-    if (fgUsedVars[kTPCnSigmaEl_Corr] && fgRunTPCPostCalibration[0]) {
+    if (ctx.fUsedVars[kTPCnSigmaEl_Corr] && ctx.fRunTPCPostCalibration[0]) {
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaEl_Corr] = ComputePIDcalibration(0, values[kTPCnSigmaEl]);
+        values[kTPCnSigmaEl_Corr] = ComputePIDcalibration(ctx, 0, values[kTPCnSigmaEl]);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaEl_Corr] = track.tpcNSigmaEl();
@@ -3234,27 +3582,27 @@ void VarManager::FillTrack(T const& track, float* values)
     }
 
     // compute TPC postcalibrated pion nsigma if required
-    if (fgUsedVars[kTPCnSigmaPi_Corr] && fgRunTPCPostCalibration[1]) {
+    if (ctx.fUsedVars[kTPCnSigmaPi_Corr] && ctx.fRunTPCPostCalibration[1]) {
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaPi_Corr] = ComputePIDcalibration(1, values[kTPCnSigmaPi]);
+        values[kTPCnSigmaPi_Corr] = ComputePIDcalibration(ctx, 1, values[kTPCnSigmaPi]);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaPi_Corr] = track.tpcNSigmaPi();
       }
     }
-    if (fgUsedVars[kTPCnSigmaKa_Corr] && fgRunTPCPostCalibration[2]) {
+    if (ctx.fUsedVars[kTPCnSigmaKa_Corr] && ctx.fRunTPCPostCalibration[2]) {
       // compute TPC postcalibrated kaon nsigma if required
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaKa_Corr] = ComputePIDcalibration(2, values[kTPCnSigmaKa]);
+        values[kTPCnSigmaKa_Corr] = ComputePIDcalibration(ctx, 2, values[kTPCnSigmaKa]);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaKa_Corr] = track.tpcNSigmaKa();
       }
     }
     // compute TPC postcalibrated proton nsigma if required
-    if (fgUsedVars[kTPCnSigmaPr_Corr] && fgRunTPCPostCalibration[3]) {
+    if (ctx.fUsedVars[kTPCnSigmaPr_Corr] && ctx.fRunTPCPostCalibration[3]) {
       if (!isTPCCalibrated) {
-        values[kTPCnSigmaPr_Corr] = ComputePIDcalibration(3, values[kTPCnSigmaPr]);
+        values[kTPCnSigmaPr_Corr] = ComputePIDcalibration(ctx, 3, values[kTPCnSigmaPr]);
       } else {
         LOG(fatal) << "TPC PID postcalibration is configured but the tracks are already postcalibrated. This is not allowed. Please check your configuration.";
         values[kTPCnSigmaPr_Corr] = track.tpcNSigmaPr();
@@ -3337,7 +3685,7 @@ void VarManager::FillTrack(T const& track, float* values)
     values[kMuonC1Pt21Pt2] = track.c1Pt21Pt2();
   }
   if constexpr ((fillMap & MuonCov) > 0 || (fillMap & MuonCovRealign) > 0) {
-    auto muonTrack = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(track, fgxShiftFwd, fgyShiftFwd, fgzShiftFwd, track);
+    auto muonTrack = o2::aod::fwdtrackutils::getTrackParCovFwd3DShift(track, ctx.fxShiftFwd, ctx.fyShiftFwd, ctx.fzShiftFwd, track);
     auto muonCov = muonTrack.getCovariances();
     values[kX] = muonTrack.getX();
     values[kY] = muonTrack.getY();
@@ -3368,36 +3716,36 @@ void VarManager::FillTrack(T const& track, float* values)
   }
 
   // Derived quantities which can be computed based on already filled variables
-  FillTrackDerived(values);
+  FillTrackDerived(ctx, values);
 }
 
 template <uint32_t fillMap, typename T, typename C>
-void VarManager::FillTrackCollision(T const& track, C const& collision, float* values)
+void VarManager::FillTrackCollision(VarContext& ctx, T const& track, C const& collision, float* values)
 {
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   if constexpr ((fillMap & ReducedTrackBarrel) > 0 || (fillMap & TrackDCA) > 0) {
     auto trackPar = getTrackPar(track);
     std::array<float, 2> dca{1e10f, 1e10f};
-    trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, fgMagField, &dca);
+    trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, ctx.fMagField, &dca);
 
     values[kTrackDCAxy] = dca[0];
     values[kTrackDCAz] = dca[1];
 
     if constexpr ((fillMap & ReducedTrackBarrelCov) > 0 || (fillMap & TrackCov) > 0) {
-      if (fgUsedVars[kTrackDCAsigXY]) {
+      if (ctx.fUsedVars[kTrackDCAsigXY]) {
         values[kTrackDCAsigXY] = dca[0] / std::sqrt(track.cYY());
       }
-      if (fgUsedVars[kTrackDCAsigZ]) {
+      if (ctx.fUsedVars[kTrackDCAsigZ]) {
         values[kTrackDCAsigZ] = dca[1] / std::sqrt(track.cZZ());
       }
     }
   }
   if constexpr ((fillMap & MuonCov) > 0 || (fillMap & MuonCovRealign) > 0 || (fillMap & ReducedMuonCov) > 0) {
 
-    o2::dataformats::GlobalFwdTrack propmuonAtDCA = PropagateMuon(track, collision, kToDCA);
+    o2::dataformats::GlobalFwdTrack propmuonAtDCA = PropagateMuon(ctx, track, collision, kToDCA);
 
     float dcaX = (propmuonAtDCA.getX() - collision.posX());
     float dcaY = (propmuonAtDCA.getY() - collision.posY());
@@ -3407,16 +3755,16 @@ void VarManager::FillTrackCollision(T const& track, C const& collision, float* v
 }
 
 template <uint32_t fillMap, typename T, typename C, typename M, typename P>
-void VarManager::FillTrackCollisionMatCorr(T const& track, C const& collision, M const& materialCorr, P const& propagator, float* values)
+void VarManager::FillTrackCollisionMatCorr(VarContext& ctx, T const& track, C const& collision, M const& materialCorr, P const& propagator, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   if constexpr ((fillMap & ReducedTrackBarrel) > 0 || (fillMap & TrackDCA) > 0) {
     auto trackPar = getTrackPar(track);
     std::array<float, 2> dca{1e10f, 1e10f};
     std::array<float, 3> pVec = {track.px(), track.py(), track.pz()};
-    // trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, fgMagField, &dca);
+    // trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, ctx.fMagField, &dca);
     propagator->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackPar, 2.f, materialCorr, &dca);
     getPxPyPz(trackPar, pVec);
 
@@ -3424,10 +3772,10 @@ void VarManager::FillTrackCollisionMatCorr(T const& track, C const& collision, M
     values[kTrackDCAz] = dca[1];
 
     if constexpr ((fillMap & ReducedTrackBarrelCov) > 0 || (fillMap & TrackCov) > 0) {
-      if (fgUsedVars[kTrackDCAsigXY]) {
+      if (ctx.fUsedVars[kTrackDCAsigXY]) {
         values[kTrackDCAsigXY] = dca[0] / std::sqrt(track.cYY());
       }
-      if (fgUsedVars[kTrackDCAsigZ]) {
+      if (ctx.fUsedVars[kTrackDCAsigZ]) {
         values[kTrackDCAsigZ] = dca[1] / std::sqrt(track.cZZ());
       }
     }
@@ -3435,28 +3783,28 @@ void VarManager::FillTrackCollisionMatCorr(T const& track, C const& collision, M
 }
 
 template <uint32_t fillMap, typename T>
-void VarManager::FillPhoton(T const& track, float* values)
+void VarManager::FillPhoton(VarContext& ctx, T const& track, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   // Quantities based on the basic table (contains just kine information and filter bits)
   if constexpr ((fillMap & Track) > 0 || (fillMap & ReducedTrack) > 0) {
     values[kPt] = track.pt();
-    if (fgUsedVars[kP]) {
+    if (ctx.fUsedVars[kP]) {
       values[kP] = track.p();
     }
-    if (fgUsedVars[kPx]) {
+    if (ctx.fUsedVars[kPx]) {
       values[kPx] = track.px();
     }
-    if (fgUsedVars[kPy]) {
+    if (ctx.fUsedVars[kPy]) {
       values[kPy] = track.py();
     }
-    if (fgUsedVars[kPz]) {
+    if (ctx.fUsedVars[kPz]) {
       values[kPz] = track.pz();
     }
-    if (fgUsedVars[kInvPt]) {
+    if (ctx.fUsedVars[kInvPt]) {
       values[kInvPt] = 1. / track.pt();
     }
     values[kEta] = track.eta();
@@ -3467,10 +3815,10 @@ void VarManager::FillPhoton(T const& track, float* values)
 }
 
 template <typename U, typename T>
-void VarManager::FillTrackMC(const U& mcStack, T const& track, float* values)
+void VarManager::FillTrackMC(VarContext& ctx, const U& mcStack, T const& track, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   // Quantities based on the mc particle table
@@ -3488,7 +3836,7 @@ void VarManager::FillTrackMC(const U& mcStack, T const& track, float* values)
   values[kMCEta] = track.eta();
   values[kMCY] = -track.y();
   values[kMCParticleGeneratorId] = track.producedByGenerator();
-  if (fgUsedVars[kMCMotherPdgCode]) {
+  if (ctx.fUsedVars[kMCMotherPdgCode]) {
     if (track.has_mothers()) {
       auto motherId = track.mothersIds()[0];
       auto mother = mcStack.rawIteratorAt(motherId);
@@ -3496,15 +3844,15 @@ void VarManager::FillTrackMC(const U& mcStack, T const& track, float* values)
     }
   }
 
-  FillTrackDerived(values);
+  FillTrackDerived(ctx, values);
 }
 
 template <int candidateType, uint32_t fillMap, typename T1, typename T2, typename C>
-void VarManager::FillTrackCollisionMC(T1 const& track, T2 const& MotherTrack, C const& collision, float* values)
+void VarManager::FillTrackCollisionMC(VarContext& ctx, T1 const& track, T2 const& MotherTrack, C const& collision, float* values)
 {
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m = o2::constants::physics::MassBPlus;
@@ -3554,11 +3902,11 @@ void VarManager::FillTrackCollisionMC(T1 const& track, T2 const& MotherTrack, C
 }
 
 template <int candidateType, typename T1>
-void VarManager::FillTrackCollisionMC(T1 const& track, const std::array<double, 3>& collPos, float massHyp, float* values)
+void VarManager::FillTrackCollisionMC(VarContext& ctx, T1 const& track, const std::array<double, 3>& collPos, float massHyp, float* values)
 {
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m = o2::constants::physics::MassJPsi;
@@ -3586,7 +3934,7 @@ void VarManager::FillTrackCollisionMC(T1 const& track, const std::array<double,
 }
 
 template <int pairType, typename T, typename T1>
-void VarManager::FillEnergyCorrelatorsMC(T const& track, T1 const& t1, float* values, float Translow, float Transhigh, float Accweight)
+void VarManager::FillEnergyCorrelatorsMC(VarContext& ctx, T const& track, T1 const& t1, float* values, float Translow, float Transhigh, float Accweight)
 {
   // energy correlators
   float MassHadron = o2::constants::physics::MassPionCharged;
@@ -3627,9 +3975,9 @@ void VarManager::FillEnergyCorrelatorsMC(T const& track, T1 const& t1, float* va
 
   float deltaphitrans = RecoDecay::constrainAngle(track.phi() - t1.phi(), -o2::constants::math::PI);
   if ((deltaphitrans > -Transhigh * o2::constants::math::PI && deltaphitrans < -Translow * o2::constants::math::PI) || (deltaphitrans > Translow * o2::constants::math::PI && deltaphitrans < Transhigh * o2::constants::math::PI)) {
-    randomPhi_trans = gRandom->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
-    randomPhi_toward = gRandom->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
-    randomPhi_away = gRandom->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
+    randomPhi_trans = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
+    randomPhi_toward = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
+    randomPhi_away = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
 
     values[kMCHadronpt_randomPhi_trans] = v2.pt();
     ROOT::Math::PtEtaPhiMVector v2_randomPhi_trans(v2.pt(), v2.eta(), randomPhi_trans, MassHadron);
@@ -3651,13 +3999,13 @@ void VarManager::FillEnergyCorrelatorsMC(T const& track, T1 const& t1, float* va
 }
 
 template <uint32_t fillMap, typename T1, typename T2, typename C>
-void VarManager::FillPairPropagateMuon(T1 const& muon1, T2 const& muon2, const C& collision, float* values)
+void VarManager::FillPairPropagateMuon(VarContext& ctx, T1 const& muon1, T2 const& muon2, const C& collision, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
-  o2::dataformats::GlobalFwdTrack propmuon1 = PropagateMuon(muon1, collision);
-  o2::dataformats::GlobalFwdTrack propmuon2 = PropagateMuon(muon2, collision);
+  o2::dataformats::GlobalFwdTrack propmuon1 = PropagateMuon(ctx, muon1, collision);
+  o2::dataformats::GlobalFwdTrack propmuon2 = PropagateMuon(ctx, muon2, collision);
 
   float m = o2::constants::physics::MassMuon;
 
@@ -3676,10 +4024,10 @@ void VarManager::FillPairPropagateMuon(T1 const& muon1, T2 const& muon2, const C
 }
 
 template <int pairType, uint32_t fillMap, typename T1, typename T2>
-void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillPair(VarContext& ctx, T1 const& t1, T2 const& t2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -3729,49 +4077,52 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
   values[kEta2] = t2.eta();
   values[kPhi2] = t2.phi();
 
-  if (fgUsedVars[kDeltaPhiPair2]) {
-    values[kDeltaPhiPair2] = RecoDecay::constrainAngle(v1.Phi() - v2.Phi(), -o2::constants::math::PIHalf);
-  }
+  if (GetUsedVarGroup(ctx, kVarGroupPairAngles)) {
+    if (ctx.fUsedVars[kDeltaPhiPair2]) {
+      values[kDeltaPhiPair2] = RecoDecay::constrainAngle(v1.Phi() - v2.Phi(), -o2::constants::math::PIHalf);
+    }
 
-  if (fgUsedVars[kDeltaEtaPair2]) {
-    values[kDeltaEtaPair2] = v1.Eta() - v2.Eta();
-  }
+    if (ctx.fUsedVars[kDeltaEtaPair2]) {
+      values[kDeltaEtaPair2] = v1.Eta() - v2.Eta();
+    }
 
-  if (fgUsedVars[kPsiPair]) {
-    values[kDeltaPhiPair] = (t1.sign() * fgMagField > 0.) ? (v1.Phi() - v2.Phi()) : (v2.Phi() - v1.Phi());
-    double xipair = TMath::ACos((v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz()) / v1.P() / v2.P());
-    values[kPsiPair] = (t1.sign() * fgMagField > 0.) ? TMath::ASin((v1.Theta() - v2.Theta()) / xipair) : TMath::ASin((v2.Theta() - v1.Theta()) / xipair);
-  }
+    if (ctx.fUsedVars[kPsiPair]) {
+      values[kDeltaPhiPair] = (t1.sign() * ctx.fMagField > 0.) ? (v1.Phi() - v2.Phi()) : (v2.Phi() - v1.Phi());
+      double xipair = TMath::ACos((v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz()) / v1.P() / v2.P());
+      values[kPsiPair] = (t1.sign() * ctx.fMagField > 0.) ? TMath::ASin((v1.Theta() - v2.Theta()) / xipair) : TMath::ASin((v2.Theta() - v1.Theta()) / xipair);
+    }
 
-  if (fgUsedVars[kOpeningAngle]) {
-    double scalar = v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz();
-    double Ptot12 = Ptot1 * Ptot2;
-    if (Ptot12 <= 0) {
-      values[kOpeningAngle] = 0.;
-    } else {
-      double arg = scalar / Ptot12;
-      if (arg > 1.) {
-        arg = 1.;
-      }
-      if (arg < -1) {
-        arg = -1;
+    if (ctx.fUsedVars[kOpeningAngle]) {
+      double scalar = v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz();
+      double Ptot12 = Ptot1 * Ptot2;
+      if (Ptot12 <= 0) {
+        values[kOpeningAngle] = 0.;
+      } else {
+        double arg = scalar / Ptot12;
+        if (arg > 1.) {
+          arg = 1.;
+        }
+        if (arg < -1) {
+          arg = -1;
+        }
+        values[kOpeningAngle] = TMath::ACos(arg);
       }
-      values[kOpeningAngle] = TMath::ACos(arg);
     }
   }
 
   // polarization parameters
-  bool useHE = fgUsedVars[kCosThetaHE] || fgUsedVars[kPhiHE]; // helicity frame
-  bool useCS = fgUsedVars[kCosThetaCS] || fgUsedVars[kPhiCS]; // Collins-Soper frame
-  bool usePP = fgUsedVars[kCosThetaPP];                       // production plane frame
-  bool useRM = fgUsedVars[kCosThetaRM];                       // Random frame
+  const uint32_t usedGroups = ctx.fUsedVarGroups;
+  bool useHE = (usedGroups & (1u << kVarGroupPolarizationHE)) != 0; // helicity frame
+  bool useCS = (usedGroups & (1u << kVarGroupPolarizationCS)) != 0; // Collins-Soper frame
+  bool usePP = (usedGroups & (1u << kVarGroupPolarizationPP)) != 0; // production plane frame
+  bool useRM = (usedGroups & (1u << kVarGroupPolarizationRM)) != 0; // Random frame
 
   if (useHE || useCS || usePP || useRM) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v1_CM{(boostv12(v1).Vect()).Unit()};
     ROOT::Math::XYZVectorF v2_CM{(boostv12(v2).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(fgBeamA).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(fgBeamC).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(ctx.fBeamA).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(ctx.fBeamC).Vect()).Unit()};
 
     // using positive sign convention for the first track
     ROOT::Math::XYZVectorF v_CM = (t1.sign() > 0 ? v1_CM : v2_CM);
@@ -3780,14 +4131,14 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_HE{(v12.Vect()).Unit()};
       ROOT::Math::XYZVectorF yaxis_HE{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_HE{(yaxis_HE.Cross(zaxis_HE)).Unit()};
-      if (fgUsedVars[kCosThetaHE]) {
+      if (ctx.fUsedVars[kCosThetaHE]) {
         values[kCosThetaHE] = zaxis_HE.Dot(v_CM);
       }
-      if (fgUsedVars[kPhiHE]) {
+      if (ctx.fUsedVars[kPhiHE]) {
         values[kPhiHE] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_HE.Dot(v_CM), xaxis_HE.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildeHE]) {
-        if (fgUsedVars[kCosThetaHE] && fgUsedVars[kPhiHE]) {
+      if (ctx.fUsedVars[kPhiTildeHE]) {
+        if (ctx.fUsedVars[kCosThetaHE] && ctx.fUsedVars[kPhiHE]) {
           if (values[kCosThetaHE] > 0) {
             values[kPhiTildeHE] = RecoDecay::constrainAngle(values[kPhiHE] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -3803,14 +4154,14 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_CS{(Beam1_CM - Beam2_CM).Unit()};
       ROOT::Math::XYZVectorF yaxis_CS{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_CS{(yaxis_CS.Cross(zaxis_CS)).Unit()};
-      if (fgUsedVars[kCosThetaCS]) {
+      if (ctx.fUsedVars[kCosThetaCS]) {
         values[kCosThetaCS] = zaxis_CS.Dot(v_CM);
       }
-      if (fgUsedVars[kPhiCS]) {
+      if (ctx.fUsedVars[kPhiCS]) {
         values[kPhiCS] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_CS.Dot(v_CM), xaxis_CS.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildeCS]) {
-        if (fgUsedVars[kCosThetaCS] && fgUsedVars[kPhiCS]) {
+      if (ctx.fUsedVars[kPhiTildeCS]) {
+        if (ctx.fUsedVars[kCosThetaCS] && ctx.fUsedVars[kPhiCS]) {
           if (values[kCosThetaCS] > 0) {
             values[kPhiTildeCS] = RecoDecay::constrainAngle(values[kPhiCS] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -3826,14 +4177,14 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVector zaxis_PP = ROOT::Math::XYZVector(v12.Py(), -v12.Px(), 0.f);
       ROOT::Math::XYZVector yaxis_PP{(v12.Vect()).Unit()};
       ROOT::Math::XYZVector xaxis_PP{(yaxis_PP.Cross(zaxis_PP)).Unit()};
-      if (fgUsedVars[kCosThetaPP]) {
+      if (ctx.fUsedVars[kCosThetaPP]) {
         values[kCosThetaPP] = zaxis_PP.Dot(v_CM) / std::sqrt(zaxis_PP.Mag2());
       }
-      if (fgUsedVars[kPhiPP]) {
+      if (ctx.fUsedVars[kPhiPP]) {
         values[kPhiPP] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_PP.Dot(v_CM), xaxis_PP.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildePP]) {
-        if (fgUsedVars[kCosThetaPP] && fgUsedVars[kPhiPP]) {
+      if (ctx.fUsedVars[kPhiTildePP]) {
+        if (ctx.fUsedVars[kCosThetaPP] && ctx.fUsedVars[kPhiPP]) {
           if (values[kCosThetaPP] > 0) {
             values[kPhiTildePP] = RecoDecay::constrainAngle(values[kPhiPP] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -3846,16 +4197,16 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
     }
 
     if (useRM) {
-      double randomCostheta = gRandom->Uniform(-1., 1.);
-      double randomPhi = gRandom->Uniform(0., o2::constants::math::TwoPI);
+      double randomCostheta = ctx.GetRandom()->Uniform(-1., 1.);
+      double randomPhi = ctx.GetRandom()->Uniform(0., o2::constants::math::TwoPI);
       ROOT::Math::XYZVectorF zaxis_RM(randomCostheta, std::sqrt(1 - randomCostheta * randomCostheta) * std::cos(randomPhi), std::sqrt(1 - randomCostheta * randomCostheta) * std::sin(randomPhi));
-      if (fgUsedVars[kCosThetaRM]) {
+      if (ctx.fUsedVars[kCosThetaRM]) {
         values[kCosThetaRM] = zaxis_RM.Dot(v_CM);
       }
     }
   }
 
-  if (fgUsedVars[kCosThetaStarRandom]) {
+  if (ctx.fUsedVars[kCosThetaStarRandom]) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v1_CM{(boostv12(v1).Vect()).Unit()};
     ROOT::Math::XYZVectorF v2_CM{(boostv12(v2).Vect()).Unit()};
@@ -3869,7 +4220,7 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
     values[kCos2ThetaStarRandom] = values[kCosThetaStarRandom] * values[kCosThetaStarRandom];
 
     // if the truth event plane angle is available, calculate the cos(theta*) with respect to the true event plane angle for comparison
-    if (fgUsedVars[kMCCosThetaStar] && fgUsedVars[kMCEventPlaneAngle]) {
+    if (ctx.fUsedVars[kMCCosThetaStar] && ctx.fUsedVars[kMCEventPlaneAngle]) {
       // truth event plane angle
       ROOT::Math::XYZVector zaxisTrue = ROOT::Math::XYZVector(TMath::Cos(values[kMCEventPlaneAngle]), TMath::Sin(values[kMCEventPlaneAngle]), 0).Unit();
       values[kMCCosThetaStar] = v_CM.Dot(zaxisTrue);
@@ -3898,7 +4249,7 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
       values[kDCAxy2] = dca2XY;
       values[kDCAz2] = dca2Z;
 
-      if (fgUsedVars[kQuadDCAabsXY] || fgUsedVars[kQuadDCAsigXY] || fgUsedVars[kQuadDCAabsZ] || fgUsedVars[kQuadDCAsigZ] || fgUsedVars[kQuadDCAsigXYZ] || fgUsedVars[kSignQuadDCAsigXY]) {
+      if (GetUsedVarGroup(ctx, kVarGroupQuadDCA)) {
         // Quantities based on the barrel tables
 
         double dca1sigXY = dca1XY / std::sqrt(t1.cYY());
@@ -3929,7 +4280,7 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
     }
   }
   if constexpr ((pairType == kDecayToMuMu) && ((fillMap & Muon) > 0 || (fillMap & ReducedMuon) > 0)) {
-    if (fgUsedVars[kQuadDCAabsXY]) {
+    if (ctx.fUsedVars[kQuadDCAabsXY]) {
       double dca1X = t1.fwdDcaX();
       double dca1Y = t1.fwdDcaY();
       double dca1XY = std::sqrt(dca1X * dca1X + dca1Y * dca1Y);
@@ -3944,17 +4295,17 @@ void VarManager::FillPair(T1 const& t1, T2 const& t2, float* values)
     values[kDCAxy1] = t1.dcaXY();
     values[kDCAz1] = t1.dcaZ();
   }
-  if (fgUsedVars[kPairPhiv]) {
-    values[kPairPhiv] = calculatePhiV<pairType>(t1, t2);
+  if (ctx.fUsedVars[kPairPhiv]) {
+    values[kPairPhiv] = calculatePhiV<pairType>(ctx, t1, t2);
   }
 }
 
 // change_start: rotation pair
 template <int pairType, uint32_t fillMap, typename T1, typename T2>
-void VarManager::FillPairRotation(T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillPairRotation(VarContext& ctx, T1 const& t1, T2 const& t2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -3981,7 +4332,7 @@ void VarManager::FillPairRotation(T1 const& t1, T2 const& t2, float* values)
     m2 = o2::constants::physics::MassMuon;
   }
 
-  double rotationphi2 = SampleRotationPhi(t2.pt(), t2.eta(), t2.sign());
+  double rotationphi2 = SampleRotationPhi(ctx, t2.pt(), t2.eta(), t2.sign());
 
   values[kCharge] = t1.sign() + t2.sign();
   values[kCharge1] = t1.sign();
@@ -4008,23 +4359,23 @@ void VarManager::FillPairRotation(T1 const& t1, T2 const& t2, float* values)
 }
 
 template <int pairType, uint32_t fillMap, typename C, typename T1, typename T2>
-void VarManager::FillPairCollision(const C& collision, T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillPairCollision(VarContext& ctx, const C& collision, T1 const& t1, T2 const& t2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr ((pairType == kDecayToEE) && ((fillMap & TrackCov) > 0 || (fillMap & ReducedTrackBarrelCov) > 0)) {
 
-    if (fgUsedVars[kQuadDCAabsXY] || fgUsedVars[kQuadDCAsigXY] || fgUsedVars[kQuadDCAabsZ] || fgUsedVars[kQuadDCAsigZ] || fgUsedVars[kQuadDCAsigXYZ] || fgUsedVars[kSignQuadDCAsigXY]) {
+    if (GetUsedVarGroup(ctx, kVarGroupQuadDCA)) {
 
       auto trackPart1 = getTrackPar(t1);
       std::array<float, 2> dca1{1e10f, 1e10f};
-      trackPart1.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, fgMagField, &dca1);
+      trackPart1.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, ctx.fMagField, &dca1);
 
       auto trackPart2 = getTrackPar(t2);
       std::array<float, 2> dca2{1e10f, 1e10f};
-      trackPart2.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, fgMagField, &dca2);
+      trackPart2.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, ctx.fMagField, &dca2);
 
       // Recalculated quantities
       double dca1XY = dca1[0];
@@ -4060,27 +4411,27 @@ void VarManager::FillPairCollision(const C& collision, T1 const& t1, T2 const& t
 }
 
 template <int pairType, uint32_t fillMap, typename C, typename T1, typename T2, typename M, typename P>
-void VarManager::FillPairCollisionMatCorr(C const& collision, T1 const& t1, T2 const& t2, M const& materialCorr, P const& propagator, float* values)
+void VarManager::FillPairCollisionMatCorr(VarContext& ctx, C const& collision, T1 const& t1, T2 const& t2, M const& materialCorr, P const& propagator, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr ((pairType == kDecayToEE) && ((fillMap & TrackCov) > 0 || (fillMap & ReducedTrackBarrelCov) > 0)) {
 
-    if (fgUsedVars[kQuadDCAabsXY] || fgUsedVars[kQuadDCAsigXY] || fgUsedVars[kQuadDCAabsZ] || fgUsedVars[kQuadDCAsigZ] || fgUsedVars[kQuadDCAsigXYZ] || fgUsedVars[kSignQuadDCAsigXY]) {
+    if (GetUsedVarGroup(ctx, kVarGroupQuadDCA)) {
 
       auto trackPart1 = getTrackPar(t1);
       std::array<float, 2> dca1{1e10f, 1e10f};
       std::array<float, 3> pVect1 = {t1.px(), t1.py(), t1.pz()};
-      // trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, fgMagField, &dca);
+      // trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, ctx.fMagField, &dca);
       propagator->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackPart1, 2.f, materialCorr, &dca1);
       getPxPyPz(trackPart1, pVect1);
 
       auto trackPart2 = getTrackPar(t2);
       std::array<float, 2> dca2{1e10f, 1e10f};
       std::array<float, 3> pVect2 = {t2.px(), t2.py(), t2.pz()};
-      // trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, fgMagField, &dca);
+      // trackPar.propagateParamToDCA({collision.posX(), collision.posY(), collision.posZ()}, ctx.fMagField, &dca);
       propagator->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackPart2, 2.f, materialCorr, &dca2);
       getPxPyPz(trackPart2, pVect2);
 
@@ -4118,11 +4469,11 @@ void VarManager::FillPairCollisionMatCorr(C const& collision, T1 const& t1, T2 c
 }
 
 template <typename T1, typename T2, typename T3>
-void VarManager::FillTriple(T1 const& t1, T2 const& t2, T3 const& t3, float* values, PairCandidateType pairType)
+void VarManager::FillTriple(VarContext& ctx, T1 const& t1, T2 const& t2, T3 const& t3, float* values, PairCandidateType pairType)
 {
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   if (pairType == kTripleCandidateToEEPhoton) {
     float m1 = o2::constants::physics::MassElectron;
@@ -4190,13 +4541,13 @@ void VarManager::FillTriple(T1 const& t1, T2 const& t2, T3 const& t3, float* val
 }
 
 template <uint32_t fillMap, int pairType, typename T1, typename T2>
-void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillPairME(VarContext& ctx, T1 const& t1, T2 const& t2, float* values)
 {
   //
   // Lightweight fill function called from the innermost event mixing loop
   //
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -4233,26 +4584,27 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
   values[kEta2] = t2.eta();
   values[kPhi2] = t2.phi();
 
-  if (fgUsedVars[kDeltaPhiPair2]) {
+  if (ctx.fUsedVars[kDeltaPhiPair2]) {
     values[kDeltaPhiPair2] = RecoDecay::constrainAngle(v1.Phi() - v2.Phi(), -o2::constants::math::PIHalf);
   }
 
-  if (fgUsedVars[kDeltaEtaPair2]) {
+  if (ctx.fUsedVars[kDeltaEtaPair2]) {
     values[kDeltaEtaPair2] = v1.Eta() - v2.Eta();
   }
 
   // polarization parameters
-  bool useHE = fgUsedVars[kCosThetaHE] || fgUsedVars[kPhiHE]; // helicity frame
-  bool useCS = fgUsedVars[kCosThetaCS] || fgUsedVars[kPhiCS]; // Collins-Soper frame
-  bool usePP = fgUsedVars[kCosThetaPP];                       // production plane frame
-  bool useRM = fgUsedVars[kCosThetaRM];                       // Random frame
+  const uint32_t usedGroups = ctx.fUsedVarGroups;
+  bool useHE = (usedGroups & (1u << kVarGroupPolarizationHE)) != 0; // helicity frame
+  bool useCS = (usedGroups & (1u << kVarGroupPolarizationCS)) != 0; // Collins-Soper frame
+  bool usePP = (usedGroups & (1u << kVarGroupPolarizationPP)) != 0; // production plane frame
+  bool useRM = (usedGroups & (1u << kVarGroupPolarizationRM)) != 0; // Random frame
 
   if (useHE || useCS || usePP || useRM) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v1_CM{(boostv12(v1).Vect()).Unit()};
     ROOT::Math::XYZVectorF v2_CM{(boostv12(v2).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(fgBeamA).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(fgBeamC).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(ctx.fBeamA).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(ctx.fBeamC).Vect()).Unit()};
 
     // using positive sign convention for the first track
     ROOT::Math::XYZVectorF v_CM = (t1.sign() > 0 ? v1_CM : v2_CM);
@@ -4261,14 +4613,14 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_HE{(v12.Vect()).Unit()};
       ROOT::Math::XYZVectorF yaxis_HE{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_HE{(yaxis_HE.Cross(zaxis_HE)).Unit()};
-      if (fgUsedVars[kCosThetaHE]) {
+      if (ctx.fUsedVars[kCosThetaHE]) {
         values[kCosThetaHE] = zaxis_HE.Dot(v_CM);
       }
-      if (fgUsedVars[kPhiHE]) {
+      if (ctx.fUsedVars[kPhiHE]) {
         values[kPhiHE] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_HE.Dot(v_CM), xaxis_HE.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildeHE]) {
-        if (fgUsedVars[kCosThetaHE] && fgUsedVars[kPhiHE]) {
+      if (ctx.fUsedVars[kPhiTildeHE]) {
+        if (ctx.fUsedVars[kCosThetaHE] && ctx.fUsedVars[kPhiHE]) {
           if (values[kCosThetaHE] > 0) {
             values[kPhiTildeHE] = RecoDecay::constrainAngle(values[kPhiHE] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -4284,14 +4636,14 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_CS{(Beam1_CM - Beam2_CM).Unit()};
       ROOT::Math::XYZVectorF yaxis_CS{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_CS{(yaxis_CS.Cross(zaxis_CS)).Unit()};
-      if (fgUsedVars[kCosThetaCS]) {
+      if (ctx.fUsedVars[kCosThetaCS]) {
         values[kCosThetaCS] = zaxis_CS.Dot(v_CM);
       }
-      if (fgUsedVars[kPhiCS]) {
+      if (ctx.fUsedVars[kPhiCS]) {
         values[kPhiCS] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_CS.Dot(v_CM), xaxis_CS.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildeCS]) {
-        if (fgUsedVars[kCosThetaCS] && fgUsedVars[kPhiCS]) {
+      if (ctx.fUsedVars[kPhiTildeCS]) {
+        if (ctx.fUsedVars[kCosThetaCS] && ctx.fUsedVars[kPhiCS]) {
           if (values[kCosThetaCS] > 0) {
             values[kPhiTildeCS] = RecoDecay::constrainAngle(values[kPhiCS] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -4307,14 +4659,14 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVector zaxis_PP = ROOT::Math::XYZVector(v12.Py(), -v12.Px(), 0.f);
       ROOT::Math::XYZVector yaxis_PP{(v12.Vect()).Unit()};
       ROOT::Math::XYZVector xaxis_PP{(yaxis_PP.Cross(zaxis_PP)).Unit()};
-      if (fgUsedVars[kCosThetaPP]) {
+      if (ctx.fUsedVars[kCosThetaPP]) {
         values[kCosThetaPP] = zaxis_PP.Dot(v_CM) / std::sqrt(zaxis_PP.Mag2());
       }
-      if (fgUsedVars[kPhiPP]) {
+      if (ctx.fUsedVars[kPhiPP]) {
         values[kPhiPP] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_PP.Dot(v_CM), xaxis_PP.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildePP]) {
-        if (fgUsedVars[kCosThetaPP] && fgUsedVars[kPhiPP]) {
+      if (ctx.fUsedVars[kPhiTildePP]) {
+        if (ctx.fUsedVars[kCosThetaPP] && ctx.fUsedVars[kPhiPP]) {
           if (values[kCosThetaPP] > 0) {
             values[kPhiTildePP] = RecoDecay::constrainAngle(values[kPhiPP] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -4327,10 +4679,10 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
     }
 
     if (useRM) {
-      double randomCostheta = gRandom->Uniform(-1., 1.);
-      double randomPhi = gRandom->Uniform(0., o2::constants::math::TwoPI);
+      double randomCostheta = ctx.GetRandom()->Uniform(-1., 1.);
+      double randomPhi = ctx.GetRandom()->Uniform(0., o2::constants::math::TwoPI);
       ROOT::Math::XYZVectorF zaxis_RM(randomCostheta, std::sqrt(1 - randomCostheta * randomCostheta) * std::cos(randomPhi), std::sqrt(1 - randomCostheta * randomCostheta) * std::sin(randomPhi));
-      if (fgUsedVars[kCosThetaRM]) {
+      if (ctx.fUsedVars[kCosThetaRM]) {
         values[kCosThetaRM] = zaxis_RM.Dot(v_CM);
       }
     }
@@ -4376,7 +4728,7 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
     values[kWV24ME] = (std::isnan(V22ME) || std::isinf(V22ME) || std::isnan(V24ME) || std::isinf(V24ME)) ? 0. : 1.0;
 
     // coherent Jpsi A2
-    bool useCoherentJpsiA2 = fgUsedVars[kA2EPME_TPC] || fgUsedVars[kA2EPME_FT0A] || fgUsedVars[kA2EPME_FT0C];
+    bool useCoherentJpsiA2 = ctx.fUsedVars[kA2EPME_TPC] || ctx.fUsedVars[kA2EPME_FT0A] || ctx.fUsedVars[kA2EPME_FT0C];
     if (useCoherentJpsiA2) {
       ROOT::Math::Boost boostv12{v12.BoostToCM()};
       ROOT::Math::PtEtaPhiMVector v_daughter = boostv12(t1.sign() > 0 ? v1 : v2);
@@ -4429,7 +4781,7 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
     }
   }
   if constexpr (pairType == kDecayToMuMu) {
-    if (fgUsedVars[kQuadDCAabsXY]) {
+    if (ctx.fUsedVars[kQuadDCAabsXY]) {
       double dca1X = t1.fwdDcaX();
       double dca1Y = t1.fwdDcaY();
       double dca1XY = std::sqrt(dca1X * dca1X + dca1Y * dca1Y);
@@ -4439,16 +4791,16 @@ void VarManager::FillPairME(T1 const& t1, T2 const& t2, float* values)
       values[kQuadDCAabsXY] = std::sqrt((dca1XY * dca1XY + dca2XY * dca2XY) / 2.);
     }
   }
-  if (fgUsedVars[kPairPhiv]) {
-    values[kPairPhiv] = calculatePhiV<pairType>(t1, t2);
+  if (ctx.fUsedVars[kPairPhiv]) {
+    values[kPairPhiv] = calculatePhiV<pairType>(ctx, t1, t2);
   }
 }
 
 template <typename T>
-void VarManager::FillPairMEAcrossTFs(T const& t1, T const& t2, float* values)
+void VarManager::FillPairMEAcrossTFs(VarContext& ctx, T const& t1, T const& t2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -4461,18 +4813,18 @@ void VarManager::FillPairMEAcrossTFs(T const& t1, T const& t2, float* values)
   values[kPhi] = RecoDecay::constrainAngle(v12.Phi());
   values[kRap] = -v12.Rapidity();
 
-  if (fgUsedVars[kCosThetaStarRandom] || fgUsedVars[kCosThetaStarFT0C]) {
+  if (ctx.fUsedVars[kCosThetaStarRandom] || ctx.fUsedVars[kCosThetaStarFT0C]) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v_CM{(boostv12(v1).Vect()).Unit()};
 
-    if (fgUsedVars[kCosThetaStarRandom]) {
+    if (ctx.fUsedVars[kCosThetaStarRandom]) {
       // Randomize the event plane angle to check the unpolarized contribution
       ROOT::Math::XYZVector zaxisRandom = ROOT::Math::XYZVector(TMath::Cos(values[kRandomPsi2]), TMath::Sin(values[kRandomPsi2]), 0).Unit();
       values[kCosThetaStarRandom] = v_CM.Dot(zaxisRandom);
       values[kCos2ThetaStarRandom] = values[kCosThetaStarRandom] * values[kCosThetaStarRandom];
     }
 
-    if (fgUsedVars[kCosThetaStarFT0C]) {
+    if (ctx.fUsedVars[kCosThetaStarFT0C]) {
       // event plane angle from FT0C
       ROOT::Math::XYZVector zaxisFT0C = ROOT::Math::XYZVector(TMath::Cos(values[kPsi2C]), TMath::Sin(values[kPsi2C]), 0).Unit();
       values[kCosThetaStarFT0C] = v_CM.Dot(zaxisFT0C);
@@ -4481,7 +4833,7 @@ void VarManager::FillPairMEAcrossTFs(T const& t1, T const& t2, float* values)
     }
   }
 
-  bool useCoherentJpsiA2 = fgUsedVars[kA2EP_TPC] || fgUsedVars[kA2EP_FT0A] || fgUsedVars[kA2EP_FT0C];
+  bool useCoherentJpsiA2 = ctx.fUsedVars[kA2EP_TPC] || ctx.fUsedVars[kA2EP_FT0A] || ctx.fUsedVars[kA2EP_FT0C];
   if (useCoherentJpsiA2) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::PtEtaPhiMVector v_daughter = boostv12(v1);
@@ -4515,10 +4867,10 @@ void VarManager::FillPairMEAcrossTFs(T const& t1, T const& t2, float* values)
 }
 
 template <int pairType, typename T1, typename T2>
-void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillPairMC(VarContext& ctx, T1 const& t1, T2 const& t2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -4559,17 +4911,18 @@ void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
   values[kMCP2] = t2.p();
 
   // polarization parameters
-  bool useHE = fgUsedVars[kMCCosThetaHE] || fgUsedVars[kMCPhiHE]; // helicity frame
-  bool useCS = fgUsedVars[kMCCosThetaCS] || fgUsedVars[kMCPhiCS]; // Collins-Soper frame
-  bool usePP = fgUsedVars[kMCCosThetaPP];                         // production plane frame
-  bool useRM = fgUsedVars[kMCCosThetaRM];                         // Random frame
+  const uint32_t usedGroups = ctx.fUsedVarGroups;
+  bool useHE = (usedGroups & (1u << kVarGroupMCPolarizationHE)) != 0; // helicity frame
+  bool useCS = (usedGroups & (1u << kVarGroupMCPolarizationCS)) != 0; // Collins-Soper frame
+  bool usePP = (usedGroups & (1u << kVarGroupMCPolarizationPP)) != 0; // production plane frame
+  bool useRM = (usedGroups & (1u << kVarGroupMCPolarizationRM)) != 0; // Random frame
 
   if (useHE || useCS || usePP || useRM) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v1_CM{(boostv12(v1).Vect()).Unit()};
     ROOT::Math::XYZVectorF v2_CM{(boostv12(v2).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(fgBeamA).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(fgBeamC).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(ctx.fBeamA).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(ctx.fBeamC).Vect()).Unit()};
 
     // using positive sign convention for the first track
     ROOT::Math::XYZVectorF v_CM = (t1.pdgCode() > 0 ? v1_CM : v2_CM);
@@ -4578,14 +4931,14 @@ void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_HE{(v12.Vect()).Unit()};
       ROOT::Math::XYZVectorF yaxis_HE{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_HE{(yaxis_HE.Cross(zaxis_HE)).Unit()};
-      if (fgUsedVars[kMCCosThetaHE]) {
+      if (ctx.fUsedVars[kMCCosThetaHE]) {
         values[kMCCosThetaHE] = zaxis_HE.Dot(v_CM);
       }
-      if (fgUsedVars[kMCPhiHE]) {
+      if (ctx.fUsedVars[kMCPhiHE]) {
         values[kMCPhiHE] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_HE.Dot(v_CM), xaxis_HE.Dot(v_CM)));
       }
-      if (fgUsedVars[kMCPhiTildeHE]) {
-        if (fgUsedVars[kMCCosThetaHE] && fgUsedVars[kMCPhiHE]) {
+      if (ctx.fUsedVars[kMCPhiTildeHE]) {
+        if (ctx.fUsedVars[kMCCosThetaHE] && ctx.fUsedVars[kMCPhiHE]) {
           if (values[kMCCosThetaHE] > 0) {
             values[kMCPhiTildeHE] = RecoDecay::constrainAngle(values[kMCPhiHE] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -4601,14 +4954,14 @@ void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_CS{(Beam1_CM - Beam2_CM).Unit()};
       ROOT::Math::XYZVectorF yaxis_CS{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_CS{(yaxis_CS.Cross(zaxis_CS)).Unit()};
-      if (fgUsedVars[kMCCosThetaCS]) {
+      if (ctx.fUsedVars[kMCCosThetaCS]) {
         values[kMCCosThetaCS] = zaxis_CS.Dot(v_CM);
       }
-      if (fgUsedVars[kMCPhiCS]) {
+      if (ctx.fUsedVars[kMCPhiCS]) {
         values[kMCPhiCS] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_CS.Dot(v_CM), xaxis_CS.Dot(v_CM)));
       }
-      if (fgUsedVars[kMCPhiTildeCS]) {
-        if (fgUsedVars[kMCCosThetaCS] && fgUsedVars[kMCPhiCS]) {
+      if (ctx.fUsedVars[kMCPhiTildeCS]) {
+        if (ctx.fUsedVars[kMCCosThetaCS] && ctx.fUsedVars[kMCPhiCS]) {
           if (values[kMCCosThetaCS] > 0) {
             values[kMCPhiTildeCS] = RecoDecay::constrainAngle(values[kMCPhiCS] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -4624,14 +4977,14 @@ void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVector zaxis_PP = ROOT::Math::XYZVector(v12.Py(), -v12.Px(), 0.f);
       ROOT::Math::XYZVector yaxis_PP{v12.Vect().Unit()};
       ROOT::Math::XYZVector xaxis_PP{(yaxis_PP.Cross(zaxis_PP)).Unit()};
-      if (fgUsedVars[kMCCosThetaPP]) {
+      if (ctx.fUsedVars[kMCCosThetaPP]) {
         values[kMCCosThetaPP] = zaxis_PP.Dot(v_CM);
       }
-      if (fgUsedVars[kMCPhiPP]) {
+      if (ctx.fUsedVars[kMCPhiPP]) {
         values[kMCPhiPP] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_PP.Dot(v_CM), xaxis_PP.Dot(v_CM)));
       }
-      if (fgUsedVars[kMCPhiTildePP]) {
-        if (fgUsedVars[kMCCosThetaPP] && fgUsedVars[kMCPhiPP]) {
+      if (ctx.fUsedVars[kMCPhiTildePP]) {
+        if (ctx.fUsedVars[kMCCosThetaPP] && ctx.fUsedVars[kMCPhiPP]) {
           if (values[kMCCosThetaPP] > 0) {
             values[kMCPhiTildePP] = RecoDecay::constrainAngle(values[kMCPhiPP] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -4644,16 +4997,16 @@ void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
     }
 
     if (useRM) {
-      double randomCostheta = gRandom->Uniform(-1., 1.);
-      double randomPhi = gRandom->Uniform(0., o2::constants::math::TwoPI);
+      double randomCostheta = ctx.GetRandom()->Uniform(-1., 1.);
+      double randomPhi = ctx.GetRandom()->Uniform(0., o2::constants::math::TwoPI);
       ROOT::Math::XYZVectorF zaxis_RM(randomCostheta, std::sqrt(1 - randomCostheta * randomCostheta) * std::cos(randomPhi), std::sqrt(1 - randomCostheta * randomCostheta) * std::sin(randomPhi));
-      if (fgUsedVars[kMCCosThetaRM]) {
+      if (ctx.fUsedVars[kMCCosThetaRM]) {
         values[kMCCosThetaRM] = zaxis_RM.Dot(v_CM);
       }
     }
   }
 
-  if (fgUsedVars[kCosThetaStarRandom] || fgUsedVars[kMCCosThetaStar]) {
+  if (ctx.fUsedVars[kCosThetaStarRandom] || ctx.fUsedVars[kMCCosThetaStar]) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v1_CM{(boostv12(v1).Vect()).Unit()};
     ROOT::Math::XYZVectorF v2_CM{(boostv12(v2).Vect()).Unit()};
@@ -4671,7 +5024,7 @@ void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
     values[kMCCosThetaStar] = v_CM.Dot(zaxisTrue);
   }
 
-  if (fgUsedVars[kCos2DeltaPhi_Random] || fgUsedVars[kCos2DeltaPhiPP_Random] || fgUsedVars[kCos2DeltaPhi_MC] || fgUsedVars[kCos2DeltaPhiPP_MC]) {
+  if (ctx.fUsedVars[kCos2DeltaPhi_Random] || ctx.fUsedVars[kCos2DeltaPhiPP_Random] || ctx.fUsedVars[kCos2DeltaPhi_MC] || ctx.fUsedVars[kCos2DeltaPhiPP_MC]) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::PtEtaPhiMVector v_daughter = boostv12(t1.pdgCode() > 0 ? v1 : v2);
 
@@ -4690,10 +5043,10 @@ void VarManager::FillPairMC(T1 const& t1, T2 const& t2, float* values)
 }
 
 template <int candidateType, typename T1, typename T2, typename T3>
-void VarManager::FillTripleMC(T1 const& t1, T2 const& t2, T3 const& t3, float* values)
+void VarManager::FillTripleMC(VarContext& ctx, T1 const& t1, T2 const& t2, T3 const& t3, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr (candidateType == kTripleCandidateToEEPhoton) {
@@ -4775,7 +5128,7 @@ void VarManager::FillTripleMC(T1 const& t1, T2 const& t2, T3 const& t3, float* v
 }
 
 template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2, bool propToSV, float* values)
+void VarManager::FillPairVertexing(VarContext& ctx, C const& collision, T const& t1, T const& t2, bool propToSV, float* values)
 {
   // check at compile time that the event and cov matrix have the cov matrix
   constexpr bool eventHasVtxCov = ((collFillMap & Collision) > 0 || (collFillMap & ReducedEventVtxCov) > 0);
@@ -4783,7 +5136,7 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
   constexpr bool muonHasCov = ((fillMap & MuonCov) > 0 || (fillMap & ReducedMuonCov) > 0);
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   float m1 = o2::constants::physics::MassElectron;
   float m2 = o2::constants::physics::MassElectron;
@@ -4799,8 +5152,8 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
   ROOT::Math::PtEtaPhiMVector v2(t2.pt(), t2.eta(), t2.phi(), m2);
   ROOT::Math::PtEtaPhiMVector v12 = v1 + v2;
 
-  values[kUsedKF] = static_cast<float>(fgUsedKF);
-  if (!fgUsedKF) {
+  values[kUsedKF] = static_cast<float>(ctx.fUsedKF);
+  if (!ctx.fUsedKF) {
     int procCode = 0;
 
     // TODO: use trackUtilities functions to initialize the various matrices to avoid code duplication
@@ -4818,12 +5171,12 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
                                       t2.cSnpSnp(), t2.cTglY(), t2.cTglZ(), t2.cTglSnp(), t2.cTglTgl(),
                                       t2.c1PtY(), t2.c1PtZ(), t2.c1PtSnp(), t2.c1PtTgl(), t2.c1Pt21Pt2()};
       o2::track::TrackParCov pars2{t2.x(), t2.alpha(), t2pars, t2covs};
-      procCode = fgFitterTwoProngBarrel.process(pars1, pars2);
+      procCode = ctx.fFitterTwoProngBarrel.process(pars1, pars2);
     } else if constexpr ((pairType == kDecayToMuMu) && muonHasCov) {
       // Initialize track parameters for forward
       o2::track::TrackParCovFwd pars1 = FwdToTrackPar(t1, t1);
       o2::track::TrackParCovFwd pars2 = FwdToTrackPar(t2, t2);
-      procCode = fgFitterTwoProngFwd.process(pars1, pars2);
+      procCode = ctx.fFitterTwoProngFwd.process(pars1, pars2);
     } else {
       return;
     }
@@ -4863,27 +5216,27 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
       auto covMatrixPV = primaryVertex.getCov();
 
       if constexpr ((pairType == kDecayToEE || pairType == kDecayToKPi) && trackHasCov) {
-        secondaryVertex = fgFitterTwoProngBarrel.getPCACandidate();
+        secondaryVertex = ctx.fFitterTwoProngBarrel.getPCACandidate();
         // printf("secVtx (first) %f %f  %f \n",secondaryVertex[0],secondaryVertex[1],secondaryVertex[2]);
-        covMatrixPCA = fgFitterTwoProngBarrel.calcPCACovMatrixFlat();
-        auto chi2PCA = fgFitterTwoProngBarrel.getChi2AtPCACandidate();
-        auto trackParVar0 = fgFitterTwoProngBarrel.getTrack(0);
-        auto trackParVar1 = fgFitterTwoProngBarrel.getTrack(1);
+        covMatrixPCA = ctx.fFitterTwoProngBarrel.calcPCACovMatrixFlat();
+        auto chi2PCA = ctx.fFitterTwoProngBarrel.getChi2AtPCACandidate();
+        auto trackParVar0 = ctx.fFitterTwoProngBarrel.getTrack(0);
+        auto trackParVar1 = ctx.fFitterTwoProngBarrel.getTrack(1);
         values[kVertexingChi2PCA] = chi2PCA;
         v1 = {trackParVar0.getPt(), trackParVar0.getEta(), trackParVar0.getPhi(), m1};
         v2 = {trackParVar1.getPt(), trackParVar1.getEta(), trackParVar1.getPhi(), m2};
         v12 = v1 + v2;
-        if (fgPVrecalKF) {
+        if (ctx.fPVrecalKF) {
           primaryVertexNew = RecalculatePrimaryVertex(t1, t2, collision);
         }
 
       } else if constexpr (pairType == kDecayToMuMu && muonHasCov) {
         // Get pca candidate from forward DCA fitter
-        secondaryVertex = fgFitterTwoProngFwd.getPCACandidate();
-        covMatrixPCA = fgFitterTwoProngFwd.calcPCACovMatrixFlat();
-        auto chi2PCA = fgFitterTwoProngFwd.getChi2AtPCACandidate();
-        auto trackParVar0 = fgFitterTwoProngFwd.getTrack(0);
-        auto trackParVar1 = fgFitterTwoProngFwd.getTrack(1);
+        secondaryVertex = ctx.fFitterTwoProngFwd.getPCACandidate();
+        covMatrixPCA = ctx.fFitterTwoProngFwd.calcPCACovMatrixFlat();
+        auto chi2PCA = ctx.fFitterTwoProngFwd.getChi2AtPCACandidate();
+        auto trackParVar0 = ctx.fFitterTwoProngFwd.getTrack(0);
+        auto trackParVar1 = ctx.fFitterTwoProngFwd.getTrack(1);
         values[kVertexingChi2PCA] = chi2PCA;
         v1 = {trackParVar0.getPt(), trackParVar0.getEta(), trackParVar0.getPhi(), m1};
         v2 = {trackParVar1.getPt(), trackParVar1.getEta(), trackParVar1.getPhi(), m2};
@@ -4933,14 +5286,14 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
       values[kVertexingLxyProjected] = values[kVertexingLxyProjected] / TMath::Sqrt((v12.Px() * v12.Px()) + (v12.Py() * v12.Py()));
       values[kVertexingLxyzProjected] = ((secondaryVertex[0] - collision.posX()) * v12.Px()) + ((secondaryVertex[1] - collision.posY()) * v12.Py()) + ((secondaryVertex[2] - collision.posZ()) * v12.Pz());
       values[kVertexingLxyzProjected] = values[kVertexingLxyzProjected] / TMath::Sqrt((v12.Px() * v12.Px()) + (v12.Py() * v12.Py()) + (v12.Pz() * v12.Pz()));
-      if (fgPVrecalKF) {
+      if (ctx.fPVrecalKF) {
         values[kVertexingLxyProjectedRecalculatePV] = (secondaryVertex[0] - primaryVertexNew.getX()) * v12.Px() + (secondaryVertex[1] - primaryVertexNew.getY()) * v12.Py();
         values[kVertexingLxyProjectedRecalculatePV] = values[kVertexingLxyProjectedRecalculatePV] / v12.Pt();
       }
       values[kVertexingTauxyProjected] = values[kVertexingLxyProjected] * v12.M() / (v12.Pt());
       values[kVertexingTauxyProjectedPoleJPsiMass] = values[kVertexingLxyProjected] * o2::constants::physics::MassJPsi / (v12.Pt());
       values[kVertexingTauxyProjectedNs] = values[kVertexingTauxyProjected] / o2::constants::physics::LightSpeedCm2NS;
-      if (fgPVrecalKF) {
+      if (ctx.fPVrecalKF) {
         values[kVertexingTauxyProjectedPoleJPsiMassRecalculatePV] = values[kVertexingLxyProjectedRecalculatePV] * o2::constants::physics::MassJPsi / (v12.Pt());
       }
       values[kVertexingTauzProjected] = values[kVertexingLzProjected] * v12.M() / TMath::Abs(v12.Pz());
@@ -4980,7 +5333,7 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
       KFGeoTwoProng.AddDaughter(trk0KF);
       KFGeoTwoProng.AddDaughter(trk1KF);
     }
-    if (fgUsedVars[kKFMass]) {
+    if (ctx.fUsedVars[kKFMass]) {
       float mass = 0., massErr = 0.;
       if (!KFGeoTwoProng.GetMass(mass, massErr)) {
         values[kKFMass] = mass;
@@ -4996,7 +5349,7 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
       double dxPair2PV = KFGeoTwoProng.GetX() - KFPV.GetX();
       double dyPair2PV = KFGeoTwoProng.GetY() - KFPV.GetY();
       double dzPair2PV = KFGeoTwoProng.GetZ() - KFPV.GetZ();
-      if (fgUsedVars[kVertexingLxy] || fgUsedVars[kVertexingLz] || fgUsedVars[kVertexingLxyz] || fgUsedVars[kVertexingLxyErr] || fgUsedVars[kVertexingLzErr] || fgUsedVars[kVertexingTauxy] || fgUsedVars[kVertexingLxyOverErr] || fgUsedVars[kVertexingLzOverErr] || fgUsedVars[kVertexingLxyzOverErr] || fgUsedVars[kCosPointingAngle]) {
+      if (ctx.fUsedVars[kVertexingLxy] || ctx.fUsedVars[kVertexingLz] || ctx.fUsedVars[kVertexingLxyz] || ctx.fUsedVars[kVertexingLxyErr] || ctx.fUsedVars[kVertexingLzErr] || ctx.fUsedVars[kVertexingTauxy] || ctx.fUsedVars[kVertexingLxyOverErr] || ctx.fUsedVars[kVertexingLzOverErr] || ctx.fUsedVars[kVertexingLxyzOverErr] || ctx.fUsedVars[kCosPointingAngle]) {
         values[kVertexingLxy] = std::sqrt(dxPair2PV * dxPair2PV + dyPair2PV * dyPair2PV);
         values[kVertexingLz] = std::sqrt(dzPair2PV * dzPair2PV);
         values[kVertexingLxyz] = std::sqrt(dxPair2PV * dxPair2PV + dyPair2PV * dyPair2PV + dzPair2PV * dzPair2PV);
@@ -5027,7 +5380,7 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
                                     (v12.P() * values[VarManager::kVertexingLxyz]);
       }
       // As defined in Run 2 (projected onto momentum)
-      if (fgUsedVars[kVertexingLxyProjected] || fgUsedVars[kVertexingLxyzProjected] || fgUsedVars[kVertexingLzProjected]) {
+      if (ctx.fUsedVars[kVertexingLxyProjected] || ctx.fUsedVars[kVertexingLxyzProjected] || ctx.fUsedVars[kVertexingLzProjected]) {
         values[kVertexingLzProjected] = (dzPair2PV * KFGeoTwoProng.GetPz()) / TMath::Sqrt(KFGeoTwoProng.GetPz() * KFGeoTwoProng.GetPz());
         values[kVertexingLxyProjected] = (dxPair2PV * KFGeoTwoProng.GetPx()) + (dyPair2PV * KFGeoTwoProng.GetPy());
         values[kVertexingLxyProjected] = values[kVertexingLxyProjected] / TMath::Sqrt((KFGeoTwoProng.GetPx() * KFGeoTwoProng.GetPx()) + (KFGeoTwoProng.GetPy() * KFGeoTwoProng.GetPy()));
@@ -5039,60 +5392,60 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
         values[kVertexingTauzProjected] = values[kVertexingLzProjected] * KFGeoTwoProng.GetMass() / TMath::Abs(KFGeoTwoProng.GetPz());
       }
 
-      if (fgUsedVars[kVertexingLxyOverErr] || fgUsedVars[kVertexingLzOverErr] || fgUsedVars[kVertexingLxyzOverErr]) {
+      if (ctx.fUsedVars[kVertexingLxyOverErr] || ctx.fUsedVars[kVertexingLzOverErr] || ctx.fUsedVars[kVertexingLxyzOverErr]) {
         values[kVertexingLxyOverErr] = values[kVertexingLxy] / values[kVertexingLxyErr];
         values[kVertexingLzOverErr] = values[kVertexingLz] / values[kVertexingLzErr];
         values[kVertexingLxyzOverErr] = values[kVertexingLxyz] / values[kVertexingLxyzErr];
       }
 
-      if (fgUsedVars[kKFChi2OverNDFGeo]) {
+      if (ctx.fUsedVars[kKFChi2OverNDFGeo]) {
         values[kKFChi2OverNDFGeo] = KFGeoTwoProng.GetChi2() / KFGeoTwoProng.GetNDF();
       }
-      if (fgUsedVars[kKFCosPA]) {
+      if (ctx.fUsedVars[kKFCosPA]) {
         values[kKFCosPA] = calculateCosPA(KFGeoTwoProng, KFPV);
       }
 
       // in principle, they should be in FillTrack
-      if (fgUsedVars[kKFTrack0DCAxyz] || fgUsedVars[kKFTrack1DCAxyz]) {
+      if (ctx.fUsedVars[kKFTrack0DCAxyz] || ctx.fUsedVars[kKFTrack1DCAxyz]) {
         values[kKFTrack0DCAxyz] = trk0KF.GetDistanceFromVertex(KFPV);
         values[kKFTrack1DCAxyz] = trk1KF.GetDistanceFromVertex(KFPV);
       }
-      if (fgUsedVars[kKFTrack0DCAxy] || fgUsedVars[kKFTrack1DCAxy]) {
+      if (ctx.fUsedVars[kKFTrack0DCAxy] || ctx.fUsedVars[kKFTrack1DCAxy]) {
         values[kKFTrack0DCAxy] = trk0KF.GetDistanceFromVertexXY(KFPV);
         values[kKFTrack1DCAxy] = trk1KF.GetDistanceFromVertexXY(KFPV);
       }
-      if (fgUsedVars[kKFDCAxyzBetweenProngs]) {
+      if (ctx.fUsedVars[kKFDCAxyzBetweenProngs]) {
         values[kKFDCAxyzBetweenProngs] = trk0KF.GetDistanceFromParticle(trk1KF);
       }
-      if (fgUsedVars[kKFDCAxyBetweenProngs]) {
+      if (ctx.fUsedVars[kKFDCAxyBetweenProngs]) {
         values[kKFDCAxyBetweenProngs] = trk0KF.GetDistanceFromParticleXY(trk1KF);
       }
 
-      if (fgUsedVars[kKFTracksDCAxyzMax]) {
+      if (ctx.fUsedVars[kKFTracksDCAxyzMax]) {
         values[kKFTracksDCAxyzMax] = values[kKFTrack0DCAxyz] > values[kKFTrack1DCAxyz] ? values[kKFTrack0DCAxyz] : values[kKFTrack1DCAxyz];
       }
-      if (fgUsedVars[kKFTracksDCAxyMax]) {
+      if (ctx.fUsedVars[kKFTracksDCAxyMax]) {
         values[kKFTracksDCAxyMax] = TMath::Abs(values[kKFTrack0DCAxy]) > TMath::Abs(values[kKFTrack1DCAxy]) ? values[kKFTrack0DCAxy] : values[kKFTrack1DCAxy];
       }
-      if (fgUsedVars[kKFTrack0DeviationFromPV] || fgUsedVars[kKFTrack1DeviationFromPV]) {
+      if (ctx.fUsedVars[kKFTrack0DeviationFromPV] || ctx.fUsedVars[kKFTrack1DeviationFromPV]) {
         values[kKFTrack0DeviationFromPV] = trk0KF.GetDeviationFromVertex(KFPV);
         values[kKFTrack1DeviationFromPV] = trk1KF.GetDeviationFromVertex(KFPV);
       }
-      if (fgUsedVars[kKFTrack0DeviationxyFromPV] || fgUsedVars[kKFTrack1DeviationxyFromPV]) {
+      if (ctx.fUsedVars[kKFTrack0DeviationxyFromPV] || ctx.fUsedVars[kKFTrack1DeviationxyFromPV]) {
         values[kKFTrack0DeviationxyFromPV] = trk0KF.GetDeviationFromVertexXY(KFPV);
         values[kKFTrack1DeviationxyFromPV] = trk1KF.GetDeviationFromVertexXY(KFPV);
       }
-      if (fgUsedVars[kKFJpsiDCAxyz]) {
+      if (ctx.fUsedVars[kKFJpsiDCAxyz]) {
         values[kKFJpsiDCAxyz] = KFGeoTwoProng.GetDistanceFromVertex(KFPV);
       }
-      if (fgUsedVars[kKFJpsiDCAxy]) {
+      if (ctx.fUsedVars[kKFJpsiDCAxy]) {
         values[kKFJpsiDCAxy] = KFGeoTwoProng.GetDistanceFromVertexXY(KFPV);
       }
-      if (fgUsedVars[kKFPairDeviationFromPV] || fgUsedVars[kKFPairDeviationxyFromPV]) {
+      if (ctx.fUsedVars[kKFPairDeviationFromPV] || ctx.fUsedVars[kKFPairDeviationxyFromPV]) {
         values[kKFPairDeviationFromPV] = KFGeoTwoProng.GetDeviationFromVertex(KFPV);
         values[kKFPairDeviationxyFromPV] = KFGeoTwoProng.GetDeviationFromVertexXY(KFPV);
       }
-      if (fgUsedVars[kKFChi2OverNDFGeoTop] || fgUsedVars[kKFMassGeoTop]) {
+      if (ctx.fUsedVars[kKFChi2OverNDFGeoTop] || ctx.fUsedVars[kKFMassGeoTop]) {
         KFParticle KFGeoTopTwoProngBarrel = KFGeoTwoProng;
         KFGeoTopTwoProngBarrel.SetProductionVertex(KFPV);
         values[kKFChi2OverNDFGeoTop] = KFGeoTopTwoProngBarrel.GetChi2() / KFGeoTopTwoProngBarrel.GetNDF();
@@ -5170,7 +5523,7 @@ void VarManager::FillPairVertexing(C const& collision, T const& t1, T const& t2,
 }
 
 template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-void VarManager::FillPairVertexingRecomputePV(C const& /*collision*/, T const& t1, T const& t2, const o2::dataformats::VertexBase& pvRefitted, float* values)
+void VarManager::FillPairVertexingRecomputePV(VarContext& ctx, C const& /*collision*/, T const& t1, T const& t2, const o2::dataformats::VertexBase& pvRefitted, float* values)
 {
   // recompute decay lenght variables using updated primary vertex
 
@@ -5180,7 +5533,7 @@ void VarManager::FillPairVertexingRecomputePV(C const& /*collision*/, T const& t
   constexpr bool muonHasCov = ((fillMap & MuonCov) > 0 || (fillMap & ReducedMuonCov) > 0);
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -5197,20 +5550,20 @@ void VarManager::FillPairVertexingRecomputePV(C const& /*collision*/, T const& t
   ROOT::Math::PtEtaPhiMVector v2(t2.pt(), t2.eta(), t2.phi(), m2);
   ROOT::Math::PtEtaPhiMVector v12 = v1 + v2;
 
-  if (fgFitterTwoProngBarrel.getNCandidates() == 0) {
+  if (ctx.fFitterTwoProngBarrel.getNCandidates() == 0) {
     return;
   }
   Vec3D secondaryVertex;
 
-  if (!fgUsedKF) { // to be updated when seconday vertex is computed with KF
+  if (!ctx.fUsedKF) { // to be updated when seconday vertex is computed with KF
     if constexpr (eventHasVtxCov) {
 
       if constexpr ((pairType == kDecayToEE || pairType == kDecayToKPi) && trackHasCov) {
         // Get pca candidate from forward DCA fitter
         // no need to re-compute secondary vertex (done already in FillPairVertexing)
-        secondaryVertex = fgFitterTwoProngBarrel.getPCACandidate();
-        auto trackParVar0 = fgFitterTwoProngBarrel.getTrack(0);
-        auto trackParVar1 = fgFitterTwoProngBarrel.getTrack(1);
+        secondaryVertex = ctx.fFitterTwoProngBarrel.getPCACandidate();
+        auto trackParVar0 = ctx.fFitterTwoProngBarrel.getTrack(0);
+        auto trackParVar1 = ctx.fFitterTwoProngBarrel.getTrack(1);
         v1 = {trackParVar0.getPt(), trackParVar0.getEta(), trackParVar0.getPhi(), m1};
         v2 = {trackParVar1.getPt(), trackParVar1.getEta(), trackParVar1.getPhi(), m2};
         v12 = v1 + v2;
@@ -5218,9 +5571,9 @@ void VarManager::FillPairVertexingRecomputePV(C const& /*collision*/, T const& t
       } else if constexpr (pairType == kDecayToMuMu && muonHasCov) {
         // Get pca candidate from forward DCA fitter
         // no need to re-compute secondary vertex (done already in FillPairVertexing)
-        secondaryVertex = fgFitterTwoProngFwd.getPCACandidate();
-        auto trackParVar0 = fgFitterTwoProngFwd.getTrack(0);
-        auto trackParVar1 = fgFitterTwoProngFwd.getTrack(1);
+        secondaryVertex = ctx.fFitterTwoProngFwd.getPCACandidate();
+        auto trackParVar0 = ctx.fFitterTwoProngFwd.getTrack(0);
+        auto trackParVar1 = ctx.fFitterTwoProngFwd.getTrack(1);
         v1 = {trackParVar0.getPt(), trackParVar0.getEta(), trackParVar0.getPhi(), m1};
         v2 = {trackParVar1.getPt(), trackParVar1.getEta(), trackParVar1.getPhi(), m2};
         v12 = v1 + v2;
@@ -5234,14 +5587,14 @@ void VarManager::FillPairVertexingRecomputePV(C const& /*collision*/, T const& t
 }
 
 template <uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-void VarManager::FillTripletVertexing(C const& collision, T const& t1, T const& t2, T const& t3, VarManager::PairCandidateType tripletType, float* values)
+void VarManager::FillTripletVertexing(VarContext& ctx, C const& collision, T const& t1, T const& t2, T const& t3, VarManager::PairCandidateType tripletType, float* values)
 {
   // TODO: Vertexing error variables
   constexpr bool eventHasVtxCov = ((collFillMap & Collision) > 0 || (collFillMap & ReducedEventVtxCov) > 0);
   bool trackHasCov = ((fillMap & ReducedTrackBarrelCov) > 0);
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassKaonCharged;
@@ -5258,8 +5611,8 @@ void VarManager::FillTripletVertexing(C const& collision, T const& t1, T const&
   ROOT::Math::PtEtaPhiMVector v3(t3.pt(), t3.eta(), t3.phi(), m3);
   ROOT::Math::PtEtaPhiMVector v123 = v1 + v2 + v3;
 
-  values[kUsedKF] = static_cast<float>(fgUsedKF);
-  if (!fgUsedKF) {
+  values[kUsedKF] = static_cast<float>(ctx.fUsedKF);
+  if (!ctx.fUsedKF) {
     int procCode = 0;
 
     if (trackHasCov) {
@@ -5278,7 +5631,7 @@ void VarManager::FillTripletVertexing(C const& collision, T const& t1, T const&
                                       t3.cSnpSnp(), t3.cTglY(), t3.cTglZ(), t3.cTglSnp(), t3.cTglTgl(),
                                       t3.c1PtY(), t3.c1PtZ(), t3.c1PtSnp(), t3.c1PtTgl(), t3.c1Pt21Pt2()};
       o2::track::TrackParCov pars3{t3.x(), t3.alpha(), t3pars, t3covs};
-      procCode = VarManager::fgFitterThreeProngBarrel.process(pars1, pars2, pars3);
+      procCode = VarManager::ctx.fFitterThreeProngBarrel.process(pars1, pars2, pars3);
     } else {
       return;
     }
@@ -5312,17 +5665,17 @@ void VarManager::FillTripletVertexing(C const& collision, T const& t1, T const&
     Vec3D secondaryVertex;
 
     if constexpr (eventHasVtxCov) {
-      secondaryVertex = fgFitterThreeProngBarrel.getPCACandidate();
+      secondaryVertex = ctx.fFitterThreeProngBarrel.getPCACandidate();
 
-      std::array<float, 6> covMatrixPCA = fgFitterThreeProngBarrel.calcPCACovMatrixFlat();
+      std::array<float, 6> covMatrixPCA = ctx.fFitterThreeProngBarrel.calcPCACovMatrixFlat();
 
       o2::math_utils::Point3D<float> vtxXYZ(collision.posX(), collision.posY(), collision.posZ());
       std::array<float, 6> vtxCov{collision.covXX(), collision.covXY(), collision.covYY(), collision.covXZ(), collision.covYZ(), collision.covZZ()};
       o2::dataformats::VertexBase primaryVertex = {vtxXYZ, vtxCov};
       auto covMatrixPV = primaryVertex.getCov();
 
-      if (fgUsedVars[kVertexingChi2PCA]) {
-        auto chi2PCA = fgFitterThreeProngBarrel.getChi2AtPCACandidate();
+      if (ctx.fUsedVars[kVertexingChi2PCA]) {
+        auto chi2PCA = ctx.fFitterThreeProngBarrel.getChi2AtPCACandidate();
         values[VarManager::kVertexingChi2PCA] = chi2PCA;
       }
 
@@ -5396,7 +5749,7 @@ void VarManager::FillTripletVertexing(C const& collision, T const& t1, T const&
       KFGeoThreeProng.AddDaughter(trk1KF);
       KFGeoThreeProng.AddDaughter(trk2KF);
     }
-    if (fgUsedVars[kKFMass]) {
+    if (ctx.fUsedVars[kKFMass]) {
       float mass = 0., massErr = 0.;
       if (!KFGeoThreeProng.GetMass(mass, massErr)) {
         values[kKFMass] = mass;
@@ -5457,14 +5810,14 @@ void VarManager::FillTripletVertexing(C const& collision, T const& t1, T const&
 }
 
 template <int candidateType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T1>
-void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track, float* values)
+void VarManager::FillDileptonTrackVertexing(VarContext& ctx, C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track, float* values)
 {
 
   constexpr bool eventHasVtxCov = ((collFillMap & Collision) > 0 || (collFillMap & ReducedEventVtxCov) > 0);
   constexpr bool trackHasCov = ((fillMap & TrackCov) > 0 || (fillMap & ReducedTrackBarrelCov) > 0);
   constexpr bool muonHasCov = ((fillMap & MuonCov) > 0 || (fillMap & ReducedMuonCov) > 0);
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float mtrack = o2::constants::physics::MassMuon;
@@ -5474,16 +5827,16 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
   int procCode = 0;
   int procCodeJpsi = 0;
 
-  values[kUsedKF] = static_cast<float>(fgUsedKF);
-  if (!fgUsedKF) {
+  values[kUsedKF] = static_cast<float>(ctx.fUsedKF);
+  if (!ctx.fUsedKF) {
     if constexpr ((candidateType == kBcToThreeMuons) && muonHasCov) {
 
       o2::track::TrackParCovFwd pars1 = FwdToTrackPar(lepton1, lepton1);
       o2::track::TrackParCovFwd pars2 = FwdToTrackPar(lepton2, lepton2);
       o2::track::TrackParCovFwd pars3 = FwdToTrackPar(track, track);
 
-      procCode = VarManager::fgFitterThreeProngFwd.process(pars1, pars2, pars3);
-      procCodeJpsi = VarManager::fgFitterTwoProngFwd.process(pars1, pars2);
+      procCode = VarManager::ctx.fFitterThreeProngFwd.process(pars1, pars2, pars3);
+      procCodeJpsi = VarManager::ctx.fFitterTwoProngFwd.process(pars1, pars2);
     } else if constexpr ((candidateType == kBtoJpsiEEK || candidateType == kDstarToD0KPiPi) && trackHasCov) {
       if constexpr (candidateType == kBtoJpsiEEK) {
         mlepton1 = o2::constants::physics::MassElectron;
@@ -5509,8 +5862,8 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
                                            track.cSnpSnp(), track.cTglY(), track.cTglZ(), track.cTglSnp(), track.cTglTgl(),
                                            track.c1PtY(), track.c1PtZ(), track.c1PtSnp(), track.c1PtTgl(), track.c1Pt21Pt2()};
       o2::track::TrackParCov pars3{track.x(), track.alpha(), lepton3pars, lepton3covs};
-      procCode = VarManager::fgFitterThreeProngBarrel.process(pars1, pars2, pars3);
-      procCodeJpsi = VarManager::fgFitterTwoProngBarrel.process(pars1, pars2);
+      procCode = VarManager::ctx.fFitterThreeProngBarrel.process(pars1, pars2, pars3);
+      procCodeJpsi = VarManager::ctx.fFitterTwoProngBarrel.process(pars1, pars2);
     } else {
       return;
     }
@@ -5527,7 +5880,7 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
     values[VarManager::kPairPt] = v123.Pt();
     values[VarManager::kPairRap] = -v123.Rapidity();
     values[VarManager::kPairEta] = v123.Eta();
-    if (fgUsedVars[kPairMassDau] || fgUsedVars[kPairPtDau]) {
+    if (ctx.fUsedVars[kPairMassDau] || ctx.fUsedVars[kPairPtDau]) {
       values[VarManager::kPairMassDau] = v12.M();
       values[VarManager::kPairPtDau] = v12.Pt();
     }
@@ -5569,15 +5922,15 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
       auto covMatrixPV = primaryVertex.getCov();
 
       if constexpr ((candidateType == kBtoJpsiEEK || candidateType == kDstarToD0KPiPi) && trackHasCov) {
-        secondaryVertex = fgFitterThreeProngBarrel.getPCACandidate();
-        covMatrixPCA = fgFitterThreeProngBarrel.calcPCACovMatrixFlat();
+        secondaryVertex = ctx.fFitterThreeProngBarrel.getPCACandidate();
+        covMatrixPCA = ctx.fFitterThreeProngBarrel.calcPCACovMatrixFlat();
       } else if constexpr (candidateType == kBcToThreeMuons && muonHasCov) {
-        secondaryVertex = fgFitterThreeProngFwd.getPCACandidate();
-        covMatrixPCA = fgFitterThreeProngFwd.calcPCACovMatrixFlat();
+        secondaryVertex = ctx.fFitterThreeProngFwd.getPCACandidate();
+        covMatrixPCA = ctx.fFitterThreeProngFwd.calcPCACovMatrixFlat();
       }
 
-      if (fgUsedVars[kVertexingChi2PCA]) {
-        auto chi2PCA = fgFitterThreeProngBarrel.getChi2AtPCACandidate();
+      if (ctx.fUsedVars[kVertexingChi2PCA]) {
+        auto chi2PCA = ctx.fFitterThreeProngBarrel.getChi2AtPCACandidate();
         values[VarManager::kVertexingChi2PCA] = chi2PCA;
       }
 
@@ -5585,7 +5938,7 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
       double theta = std::atan2(secondaryVertex[2] - collision.posZ(),
                                 std::sqrt((secondaryVertex[0] - collision.posX()) * (secondaryVertex[0] - collision.posX()) +
                                           (secondaryVertex[1] - collision.posY()) * (secondaryVertex[1] - collision.posY())));
-      if (fgUsedVars[kVertexingLxy] || fgUsedVars[kVertexingLz] || fgUsedVars[kVertexingLxyz]) {
+      if (ctx.fUsedVars[kVertexingLxy] || ctx.fUsedVars[kVertexingLz] || ctx.fUsedVars[kVertexingLxyz]) {
 
         values[VarManager::kVertexingLxy] = (collision.posX() - secondaryVertex[0]) * (collision.posX() - secondaryVertex[0]) +
                                             (collision.posY() - secondaryVertex[1]) * (collision.posY() - secondaryVertex[1]);
@@ -5596,7 +5949,7 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
         values[VarManager::kVertexingLxyz] = std::sqrt(values[VarManager::kVertexingLxyz]);
       }
 
-      if (fgUsedVars[kVertexingLxyzErr] || fgUsedVars[kVertexingLxyErr] || fgUsedVars[kVertexingLzErr]) {
+      if (ctx.fUsedVars[kVertexingLxyzErr] || ctx.fUsedVars[kVertexingLxyErr] || ctx.fUsedVars[kVertexingLzErr]) {
         values[kVertexingLxyzErr] = std::sqrt(getRotatedCovMatrixXX(covMatrixPV, phi, theta) + getRotatedCovMatrixXX(covMatrixPCA, phi, theta));
         values[kVertexingLxyErr] = std::sqrt(getRotatedCovMatrixXX(covMatrixPV, phi, 0.) + getRotatedCovMatrixXX(covMatrixPCA, phi, 0.));
         values[kVertexingLzErr] = std::sqrt(getRotatedCovMatrixXX(covMatrixPV, 0, theta) + getRotatedCovMatrixXX(covMatrixPCA, 0, theta));
@@ -5611,14 +5964,14 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
       values[kVertexingTauzErr] = values[kVertexingLzErr] * v123.M() / (TMath::Abs(v123.Pz()) * o2::constants::physics::LightSpeedCm2NS);
       values[kVertexingTauxyErr] = values[kVertexingLxyErr] * v123.M() / (v123.Pt() * o2::constants::physics::LightSpeedCm2NS);
 
-      if (fgUsedVars[kCosPointingAngle] && fgUsedVars[kVertexingLxyz]) {
+      if (ctx.fUsedVars[kCosPointingAngle] && ctx.fUsedVars[kVertexingLxyz]) {
         values[VarManager::kCosPointingAngle] = ((secondaryVertex[0] - collision.posX()) * v123.Px() +
                                                  (secondaryVertex[1] - collision.posY()) * v123.Py() +
                                                  (secondaryVertex[2] - collision.posZ()) * v123.Pz()) /
                                                 (v123.P() * values[VarManager::kVertexingLxyz]);
       }
       // run 2 definitions: Lxy projected onto the momentum vector of the candidate
-      if (fgUsedVars[kVertexingLxyProjected] || fgUsedVars[kVertexingLxyzProjected] || fgUsedVars[kVertexingTauxyProjected]) {
+      if (ctx.fUsedVars[kVertexingLxyProjected] || ctx.fUsedVars[kVertexingLxyzProjected] || ctx.fUsedVars[kVertexingTauxyProjected]) {
         values[kVertexingLzProjected] = (secondaryVertex[2] - collision.posZ()) * v123.Pz();
         values[kVertexingLzProjected] = values[kVertexingLzProjected] / TMath::Sqrt(v123.Pz() * v123.Pz());
         values[kVertexingLxyProjected] = ((secondaryVertex[0] - collision.posX()) * v123.Px()) + ((secondaryVertex[1] - collision.posY()) * v123.Py());
@@ -5648,13 +6001,13 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
       KFGeoTwoLeptons.AddDaughter(lepton1KF);
       KFGeoTwoLeptons.AddDaughter(lepton2KF);
 
-      if (fgUsedVars[kPairMassDau] || fgUsedVars[kPairPtDau]) {
+      if (ctx.fUsedVars[kPairMassDau] || ctx.fUsedVars[kPairPtDau]) {
         values[VarManager::kPairMassDau] = KFGeoTwoLeptons.GetMass();
         values[VarManager::kPairPtDau] = KFGeoTwoLeptons.GetPt();
       }
 
       // Quantities between 3rd prong and candidate
-      if (fgUsedVars[kKFDCAxyzBetweenProngs]) {
+      if (ctx.fUsedVars[kKFDCAxyzBetweenProngs]) {
         values[kKFDCAxyzBetweenProngs] = KFGeoTwoLeptons.GetDistanceFromParticle(hadronKF);
       }
 
@@ -5662,7 +6015,7 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
       KFGeoThreeProng.AddDaughter(KFGeoTwoLeptons);
       KFGeoThreeProng.AddDaughter(hadronKF);
 
-      if (fgUsedVars[kKFMass]) {
+      if (ctx.fUsedVars[kKFMass]) {
         values[kKFMass] = KFGeoThreeProng.GetMass();
       }
 
@@ -5673,7 +6026,7 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
         double dyTriplet3PV = KFGeoThreeProng.GetY() - KFPV.GetY();
         double dzTriplet3PV = KFGeoThreeProng.GetZ() - KFPV.GetZ();
 
-        if (fgUsedVars[kVertexingLxy] || fgUsedVars[kVertexingLz] || fgUsedVars[kVertexingLxyz] || fgUsedVars[kVertexingLxyErr] || fgUsedVars[kVertexingLzErr] || fgUsedVars[kVertexingTauxy] || fgUsedVars[kVertexingLxyOverErr] || fgUsedVars[kVertexingLzOverErr] || fgUsedVars[kVertexingLxyzOverErr] || fgUsedVars[kCosPointingAngle]) {
+        if (ctx.fUsedVars[kVertexingLxy] || ctx.fUsedVars[kVertexingLz] || ctx.fUsedVars[kVertexingLxyz] || ctx.fUsedVars[kVertexingLxyErr] || ctx.fUsedVars[kVertexingLzErr] || ctx.fUsedVars[kVertexingTauxy] || ctx.fUsedVars[kVertexingLxyOverErr] || ctx.fUsedVars[kVertexingLzOverErr] || ctx.fUsedVars[kVertexingLxyzOverErr] || ctx.fUsedVars[kCosPointingAngle]) {
           values[kVertexingLxy] = std::sqrt(dxTriplet3PV * dxTriplet3PV + dyTriplet3PV * dyTriplet3PV);
           values[kVertexingLz] = std::sqrt(dzTriplet3PV * dzTriplet3PV);
           values[kVertexingLxyz] = std::sqrt(dxTriplet3PV * dxTriplet3PV + dyTriplet3PV * dyTriplet3PV + dzTriplet3PV * dzTriplet3PV);
@@ -5693,14 +6046,14 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
           }
           values[kVertexingLxyzErr] = values[kVertexingLxyzErr] < 0. ? 1.e8f : std::sqrt(values[kVertexingLxyzErr]) / values[kVertexingLxyz];
 
-          if (fgUsedVars[kVertexingTauxy]) {
+          if (ctx.fUsedVars[kVertexingTauxy]) {
             values[kVertexingTauxy] = KFGeoThreeProng.GetPseudoProperDecayTime(KFPV, KFGeoThreeProng.GetMass()) / (o2::constants::physics::LightSpeedCm2NS);
           }
-          if (fgUsedVars[kVertexingTauxyErr]) {
+          if (ctx.fUsedVars[kVertexingTauxyErr]) {
             values[kVertexingTauxyErr] = values[kVertexingLxyErr] * KFGeoThreeProng.GetMass() / (KFGeoThreeProng.GetPt() * o2::constants::physics::LightSpeedCm2NS);
           }
 
-          if (fgUsedVars[kCosPointingAngle]) {
+          if (ctx.fUsedVars[kCosPointingAngle]) {
             values[VarManager::kCosPointingAngle] = (dxTriplet3PV * KFGeoThreeProng.GetPx() +
                                                      dyTriplet3PV * KFGeoThreeProng.GetPy() +
                                                      dzTriplet3PV * KFGeoThreeProng.GetPz()) /
@@ -5709,7 +6062,7 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
         } // end calculate vertex variables
 
         // As defined in Run 2 (projected onto momentum)
-        if (fgUsedVars[kVertexingLxyProjected] || fgUsedVars[kVertexingLxyzProjected] || fgUsedVars[kVertexingLzProjected]) {
+        if (ctx.fUsedVars[kVertexingLxyProjected] || ctx.fUsedVars[kVertexingLxyzProjected] || ctx.fUsedVars[kVertexingLzProjected]) {
           values[kVertexingLzProjected] = (dzTriplet3PV * KFGeoThreeProng.GetPz()) / TMath::Sqrt(KFGeoThreeProng.GetPz() * KFGeoThreeProng.GetPz());
           values[kVertexingLxyProjected] = (dxTriplet3PV * KFGeoThreeProng.GetPx()) + (dyTriplet3PV * KFGeoThreeProng.GetPy());
           values[kVertexingLxyProjected] = values[kVertexingLxyProjected] / TMath::Sqrt((KFGeoThreeProng.GetPx() * KFGeoThreeProng.GetPx()) + (KFGeoThreeProng.GetPy() * KFGeoThreeProng.GetPy()));
@@ -5725,10 +6078,10 @@ void VarManager::FillDileptonTrackVertexing(C const& collision, T1 const& lepton
 }
 
 template <typename C, typename A>
-void VarManager::FillQVectorFromGFW(C const& /*collision*/, A const& compA11, A const& compB11, A const& compC11, A const& compA21, A const& compB21, A const& compC21, A const& compA31, A const& compB31, A const& compC31, A const& compA41, A const& compB41, A const& compC41, A const& compA23, A const& compA42, float S10A, float S10B, float S10C, float S11A, float S11B, float S11C, float S12A, float S13A, float S14A, float S21A, float S22A, float S31A, float S41A, float* values)
+void VarManager::FillQVectorFromGFW(VarContext& ctx, C const& /*collision*/, A const& compA11, A const& compB11, A const& compC11, A const& compA21, A const& compB21, A const& compC21, A const& compA31, A const& compB31, A const& compC31, A const& compA41, A const& compB41, A const& compC41, A const& compA23, A const& compA42, float S10A, float S10B, float S10C, float S11A, float S11B, float S11C, float S12A, float S13A, float S14A, float S21A, float S22A, float S31A, float S41A, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   // Fill Qn vectors from generic flow framework for different eta gap A, B, C (n=1,2,3,4) with proper normalisation
@@ -5830,10 +6183,10 @@ void VarManager::FillQVectorFromGFW(C const& /*collision*/, A const& compA11, A
 }
 
 template <typename C>
-void VarManager::FillQVectorFromCentralFW(C const& collision, float* values)
+void VarManager::FillQVectorFromCentralFW(VarContext& ctx, C const& collision, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float xQVecFT0a = collision.qvecFT0ARe();   // already normalised
@@ -5926,10 +6279,10 @@ void VarManager::FillQVectorFromCentralFW(C const& collision, float* values)
 }
 
 template <typename C>
-void VarManager::FillSpectatorPlane(C const& collision, float* values)
+void VarManager::FillSpectatorPlane(VarContext& ctx, C const& collision, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   auto zncEnergy = collision.energySectorZNC();
@@ -6033,11 +6386,11 @@ void VarManager::FillSpectatorPlane(C const& collision, float* values)
 }
 
 template <uint32_t fillMap, int pairType, typename T1, typename T2>
-void VarManager::FillPairVn(T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillPairVn(VarContext& ctx, T1 const& t1, T2 const& t2, float* values)
 {
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -6102,29 +6455,29 @@ void VarManager::FillPairVn(T1 const& t1, T2 const& t2, float* values)
   values[kV2EP_FT0C] = std::isnan(V2EP_FT0C) || std::isinf(V2EP_FT0C) ? 0. : V2EP_FT0C;
   values[kWV2EP] = std::isnan(V2EP) || std::isinf(V2EP) ? 0. : 1.0;
 
-  if (std::isnan(VarManager::fgValues[VarManager::kU2Q2])) {
+  if (std::isnan(ctx.fValues[VarManager::kU2Q2])) {
     values[kU2Q2] = -999.;
     values[kR2SP_AB] = -999.;
     values[kR2SP_AC] = -999.;
     values[kR2SP_BC] = -999.;
   }
-  if (std::isnan(VarManager::fgValues[VarManager::kU3Q3])) {
+  if (std::isnan(ctx.fValues[VarManager::kU3Q3])) {
     values[kU3Q3] = -999.;
     values[kR3SP] = -999.;
   }
-  if (std::isnan(VarManager::fgValues[VarManager::kCos2DeltaPhi])) {
+  if (std::isnan(ctx.fValues[VarManager::kCos2DeltaPhi])) {
     values[kCos2DeltaPhi] = -999.;
     values[kR2EP_AB] = -999.;
     values[kR2EP_AC] = -999.;
     values[kR2EP_BC] = -999.;
   }
-  if (std::isnan(VarManager::fgValues[VarManager::kCos3DeltaPhi])) {
+  if (std::isnan(ctx.fValues[VarManager::kCos3DeltaPhi])) {
     values[kCos3DeltaPhi] = -999.;
     values[kR3EP] = -999.;
   }
 
   // global polarization parameters
-  bool useGlobalPolarizatiobSpinOne = fgUsedVars[kCosThetaStarTPC] || fgUsedVars[kCosThetaStarFT0A] || fgUsedVars[kCosThetaStarFT0C];
+  bool useGlobalPolarizatiobSpinOne = ctx.fUsedVars[kCosThetaStarTPC] || ctx.fUsedVars[kCosThetaStarFT0A] || ctx.fUsedVars[kCosThetaStarFT0C];
   if (useGlobalPolarizatiobSpinOne) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v1_CM{(boostv12(v1).Vect()).Unit()};
@@ -6146,7 +6499,7 @@ void VarManager::FillPairVn(T1 const& t1, T2 const& t2, float* values)
   }
 
   // Coherent Jpsi A2
-  bool useCoherentJpsiA2 = fgUsedVars[kA2EP_TPC] || fgUsedVars[kA2EP_FT0A] || fgUsedVars[kA2EP_FT0C];
+  bool useCoherentJpsiA2 = ctx.fUsedVars[kA2EP_TPC] || ctx.fUsedVars[kA2EP_FT0A] || ctx.fUsedVars[kA2EP_FT0C];
   if (useCoherentJpsiA2) {
     // remove daughter from TPC Q-vector
     // TODO: remove based on track cut in qVectorTable
@@ -6283,10 +6636,10 @@ void VarManager::FillPairVn(T1 const& t1, T2 const& t2, float* values)
 }
 
 template <typename T>
-void VarManager::FillZDC(T const& zdc, float* values)
+void VarManager::FillZDC(VarContext& ctx, T const& zdc, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   values[kEnergyCommonZNA] = (zdc.energyCommonZNA() > 0) ? zdc.energyCommonZNA() : -1.;
@@ -6300,13 +6653,13 @@ void VarManager::FillZDC(T const& zdc, float* values)
 }
 
 template <typename T1, typename T2>
-void VarManager::FillDileptonHadron(T1 const& dilepton, T2 const& hadron, float* values, float hadronMass)
+void VarManager::FillDileptonHadron(VarContext& ctx, T1 const& dilepton, T2 const& hadron, float* values, float hadronMass)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
-  if (fgUsedVars[kPairMass] || fgUsedVars[kPairPt] || fgUsedVars[kPairEta] || fgUsedVars[kPairPhi] || fgUsedVars[kPairMassDau] || fgUsedVars[kPairPtDau] || fgUsedVars[kDileptonHadronKstar]) {
+  if (ctx.fUsedVars[kPairMass] || ctx.fUsedVars[kPairPt] || ctx.fUsedVars[kPairEta] || ctx.fUsedVars[kPairPhi] || ctx.fUsedVars[kPairMassDau] || ctx.fUsedVars[kPairPtDau] || ctx.fUsedVars[kDileptonHadronKstar]) {
     ROOT::Math::PtEtaPhiMVector v1(dilepton.pt(), dilepton.eta(), dilepton.phi(), dilepton.mass());
     ROOT::Math::PtEtaPhiMVector v2(hadron.pt(), hadron.eta(), hadron.phi(), hadronMass);
     ROOT::Math::PtEtaPhiMVector v12 = v1 + v2;
@@ -6325,23 +6678,23 @@ void VarManager::FillDileptonHadron(T1 const& dilepton, T2 const& hadron, float*
     values[kDileptonHadronKstar] = std::sqrt(Q1 * Q1 - v12_Qvect.M2()) / 2.0;
   }
 
-  if (fgUsedVars[kDeltaPhi]) {
+  if (ctx.fUsedVars[kDeltaPhi]) {
     values[kDeltaPhi] = RecoDecay::constrainAngle(dilepton.phi() - hadron.phi(), -o2::constants::math::PIHalf);
   }
-  if (fgUsedVars[kDeltaPhiSym]) {
+  if (ctx.fUsedVars[kDeltaPhiSym]) {
     double delta = std::abs(dilepton.phi() - hadron.phi());
     if (delta > o2::constants::math::PI) {
       delta = o2::constants::math::TwoPI - delta;
     }
     values[kDeltaPhiSym] = delta;
   }
-  if (fgUsedVars[kDeltaEta]) {
+  if (ctx.fUsedVars[kDeltaEta]) {
     values[kDeltaEta] = dilepton.eta() - hadron.eta();
   }
 }
 
 template <typename T1, typename T2, typename T3>
-void VarManager::FillEnergyCorrelatorTriple(T1 const& lepton1, T2 const& lepton2, T3 const& hadron, float* values, float Translow, float Transhigh, bool applyFitMass, float sidebandMass, float weight)
+void VarManager::FillEnergyCorrelatorTriple(VarContext& ctx, T1 const& lepton1, T2 const& lepton2, T3 const& hadron, float* values, float Translow, float Transhigh, bool applyFitMass, float sidebandMass, float weight)
 {
   float m1 = o2::constants::physics::MassElectron;
   float m2 = o2::constants::physics::MassElectron;
@@ -6358,7 +6711,7 @@ void VarManager::FillEnergyCorrelatorTriple(T1 const& lepton1, T2 const& lepton2
     dileptonmass = sidebandMass;
   }
 
-  if (fgUsedVars[kCosChi] || fgUsedVars[kECWeight] || fgUsedVars[kCosTheta] || fgUsedVars[kEWeight_before] || fgUsedVars[kPtDau] || fgUsedVars[kEtaDau] || fgUsedVars[kPhiDau] || fgUsedVars[kCosChi_randomPhi_trans] || fgUsedVars[kCosChi_randomPhi_toward] || fgUsedVars[kCosChi_randomPhi_away]) {
+  if (ctx.fUsedVars[kCosChi] || ctx.fUsedVars[kECWeight] || ctx.fUsedVars[kCosTheta] || ctx.fUsedVars[kEWeight_before] || ctx.fUsedVars[kPtDau] || ctx.fUsedVars[kEtaDau] || ctx.fUsedVars[kPhiDau] || ctx.fUsedVars[kCosChi_randomPhi_trans] || ctx.fUsedVars[kCosChi_randomPhi_toward] || ctx.fUsedVars[kCosChi_randomPhi_away]) {
     values[kdileptonmass] = dileptonmass;
     ROOT::Math::PtEtaPhiMVector v1(dilepton.pt(), dilepton.eta(), dilepton.phi(), dileptonmass);
     ROOT::Math::PtEtaPhiMVector v2(hadron.pt(), hadron.eta(), hadron.phi(), o2::constants::physics::MassPionCharged);
@@ -6389,9 +6742,9 @@ void VarManager::FillEnergyCorrelatorTriple(T1 const& lepton1, T2 const& lepton2
     float randomPhi_away = -o2::constants::math::PIHalf;
 
     if ((deltaphi > -Transhigh * o2::constants::math::PI && deltaphi < -Translow * o2::constants::math::PI) || (deltaphi > Translow * o2::constants::math::PI && deltaphi < Transhigh * o2::constants::math::PI)) {
-      randomPhi_trans = gRandom->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
-      randomPhi_toward = gRandom->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
-      randomPhi_away = gRandom->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
+      randomPhi_trans = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
+      randomPhi_toward = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
+      randomPhi_away = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
       values[kPtDau_randomPhi_trans] = v2.pt();
       ROOT::Math::PtEtaPhiMVector v2_randomPhi_trans(v2.pt(), v2.eta(), randomPhi_trans, o2::constants::physics::MassPionCharged);
       values[kCosChi_randomPhi_trans] = LorentzTransformJpsihadroncosChi("coschi", v1, v2_randomPhi_trans);
@@ -6412,9 +6765,9 @@ void VarManager::FillEnergyCorrelatorTriple(T1 const& lepton1, T2 const& lepton2
 }
 
 template <int pairType, typename T1, typename T2, typename T3, typename T4, typename T5>
-void VarManager::FillEnergyCorrelatorsUnfoldingTriple(T1 const& lepton1, T2 const& lepton2, T3 const& hadron, T4 const& track, T5 const& t1, float* values, bool applyFitMass, float Effweight_rec, float Accweight_gen, float Translow, float Transhigh)
+void VarManager::FillEnergyCorrelatorsUnfoldingTriple(VarContext& ctx, T1 const& lepton1, T2 const& lepton2, T3 const& hadron, T4 const& track, T5 const& t1, float* values, bool applyFitMass, float Effweight_rec, float Accweight_gen, float Translow, float Transhigh)
 {
-  if (fgUsedVars[kMCCosChi_gen] || fgUsedVars[kMCWeight_gen] || fgUsedVars[kMCdeltaeta_gen] || fgUsedVars[kMCCosChi_rec] || fgUsedVars[kMCWeight_rec] || fgUsedVars[kMCdeltaeta_rec]) {
+  if (ctx.fUsedVars[kMCCosChi_gen] || ctx.fUsedVars[kMCWeight_gen] || ctx.fUsedVars[kMCdeltaeta_gen] || ctx.fUsedVars[kMCCosChi_rec] || ctx.fUsedVars[kMCWeight_rec] || ctx.fUsedVars[kMCdeltaeta_rec]) {
     // energy correlators
 
     float m1 = o2::constants::physics::MassElectron;
@@ -6453,7 +6806,7 @@ void VarManager::FillEnergyCorrelatorsUnfoldingTriple(T1 const& lepton1, T2 cons
     float deltaphi_rec = RecoDecay::constrainAngle(dilepton.phi() - hadron.phi(), -o2::constants::math::PIHalf);
 
     if ((deltaphi_rec > -Transhigh * o2::constants::math::PI && deltaphi_rec < -Translow * o2::constants::math::PI) || (deltaphi_rec > Translow * o2::constants::math::PI && deltaphi_rec < Transhigh * o2::constants::math::PI)) {
-      float randomPhi_trans_rec = gRandom->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
+      float randomPhi_trans_rec = ctx.GetRandom()->Uniform(-o2::constants::math::PIHalf, 3. * o2::constants::math::PIHalf);
       ROOT::Math::PtEtaPhiMVector v2_randomPhi_trans_rec(v2_rec.pt(), v2_rec.eta(), randomPhi_trans_rec, o2::constants::physics::MassPionCharged);
       values[kMCCosChi_randomPhi_trans_rec] = LorentzTransformJpsihadroncosChi("coschi", v1_rec, v2_randomPhi_trans_rec);
       values[kMCWeight_randomPhi_trans_rec] = LorentzTransformJpsihadroncosChi("weight_boost", v1_rec, v2_randomPhi_trans_rec) / v1_rec.M() * Effweight_rec;
@@ -6465,12 +6818,12 @@ void VarManager::FillEnergyCorrelatorsUnfoldingTriple(T1 const& lepton1, T2 cons
 }
 
 template <typename T1, typename T2>
-void VarManager::FillDileptonPhoton(T1 const& dilepton, T2 const& photon, float* values)
+void VarManager::FillDileptonPhoton(VarContext& ctx, T1 const& dilepton, T2 const& photon, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
-  if (fgUsedVars[kPairMass] || fgUsedVars[kPairPt] || fgUsedVars[kPairEta] || fgUsedVars[kPairPhi]) {
+  if (ctx.fUsedVars[kPairMass] || ctx.fUsedVars[kPairPt] || ctx.fUsedVars[kPairEta] || ctx.fUsedVars[kPairPhi]) {
     ROOT::Math::PtEtaPhiMVector v1(dilepton.pt(), dilepton.eta(), dilepton.phi(), dilepton.mass());
     ROOT::Math::PtEtaPhiMVector v2(photon.pt(), photon.eta(), photon.phi(), photon.mGamma());
     ROOT::Math::PtEtaPhiMVector v12 = v1 + v2;
@@ -6492,10 +6845,10 @@ void VarManager::FillDileptonPhoton(T1 const& dilepton, T2 const& photon, float*
 }
 
 template <typename T>
-void VarManager::FillHadron(T const& hadron, float* values, float hadronMass)
+void VarManager::FillHadron(VarContext& ctx, T const& hadron, float* values, float hadronMass)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   ROOT::Math::PtEtaPhiMVector vhadron(hadron.pt(), hadron.eta(), hadron.phi(), hadronMass);
@@ -6507,10 +6860,10 @@ void VarManager::FillHadron(T const& hadron, float* values, float hadronMass)
 }
 
 template <int partType, typename Cand, typename H, typename T>
-void VarManager::FillSingleDileptonCharmHadron(Cand const& candidate, H hfHelper, T& bdtScoreCharmHad, float* values)
+void VarManager::FillSingleDileptonCharmHadron(VarContext& ctx, Cand const& candidate, H hfHelper, T& bdtScoreCharmHad, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr (partType == kJPsi) {
@@ -6536,17 +6889,17 @@ void VarManager::FillSingleDileptonCharmHadron(Cand const& candidate, H hfHelper
 }
 
 template <int partTypeCharmHad, typename DQ, typename HF, typename H, typename T>
-void VarManager::FillDileptonCharmHadron(DQ const& dilepton, HF const& charmHadron, H hfHelper, T& bdtScoreCharmHad, float* values)
+void VarManager::FillDileptonCharmHadron(VarContext& ctx, DQ const& dilepton, HF const& charmHadron, H hfHelper, T& bdtScoreCharmHad, float* values)
 {
-  FillSingleDileptonCharmHadron<kJPsi>(dilepton, hfHelper, bdtScoreCharmHad, values);
-  FillSingleDileptonCharmHadron<partTypeCharmHad>(charmHadron, hfHelper, bdtScoreCharmHad, values);
+  FillSingleDileptonCharmHadron<kJPsi>(ctx, dilepton, hfHelper, bdtScoreCharmHad, values);
+  FillSingleDileptonCharmHadron<partTypeCharmHad>(ctx, charmHadron, hfHelper, bdtScoreCharmHad, values);
 }
 
 template <int candidateType, typename T1, typename T2, typename T3>
-void VarManager::FillDileptonTrackTrack(T1 const& dilepton, T2 const& hadron1, T3 const& hadron2, float* values)
+void VarManager::FillDileptonTrackTrack(VarContext& ctx, T1 const& dilepton, T2 const& hadron1, T3 const& hadron2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   double defaultDileptonMass = o2::constants::physics::MassJPsi;
@@ -6581,7 +6934,7 @@ void VarManager::FillDileptonTrackTrack(T1 const& dilepton, T2 const& hadron1, T
   values[kTrackDCAzProng2] = hadron2.dcaZ();
   values[kPt2] = hadron2.pt();
 
-  if (fgUsedVars[kCosthetaDileptonDitrack] || fgUsedVars[kPairMass] || fgUsedVars[kPairPt] || fgUsedVars[kDitrackPt] || fgUsedVars[kDitrackMass] || fgUsedVars[kQ] || fgUsedVars[kDeltaR1] || fgUsedVars[kDeltaR2] || fgUsedVars[kRap]) {
+  if (ctx.fUsedVars[kCosthetaDileptonDitrack] || ctx.fUsedVars[kPairMass] || ctx.fUsedVars[kPairPt] || ctx.fUsedVars[kDitrackPt] || ctx.fUsedVars[kDitrackMass] || ctx.fUsedVars[kQ] || ctx.fUsedVars[kDeltaR1] || ctx.fUsedVars[kDeltaR2] || ctx.fUsedVars[kRap]) {
     ROOT::Math::PtEtaPhiMVector v23 = v2 + v3;
     values[kPairMass] = v1.M();
     values[kPairPt] = v1.Pt();
@@ -6598,7 +6951,7 @@ void VarManager::FillDileptonTrackTrack(T1 const& dilepton, T2 const& hadron1, T
 
 //__________________________________________________________________
 template <int candidateType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T1>
-void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track1, T1 const& track2, float* values)
+void VarManager::FillDileptonTrackTrackVertexing(VarContext& ctx, C const& collision, T1 const& lepton1, T1 const& lepton2, T1 const& track1, T1 const& track2, float* values)
 {
   constexpr bool eventHasVtxCov = ((collFillMap & Collision) > 0 || (collFillMap & ReducedEventVtxCov) > 0);
   constexpr bool trackHasCov = ((fillMap & TrackCov) > 0 || (fillMap & ReducedTrackBarrelCov) > 0);
@@ -6608,7 +6961,7 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
   }
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float mlepton1 = o2::constants::physics::MassElectron;
@@ -6625,8 +6978,8 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
   int procCodeDilepton = 0;
   int procCodeDileptonTrackTrack = 0;
 
-  values[kUsedKF] = static_cast<float>(fgUsedKF);
-  if (!fgUsedKF) {
+  values[kUsedKF] = static_cast<float>(ctx.fUsedKF);
+  if (!ctx.fUsedKF) {
     // create covariance matrix
     std::array<float, 5> lepton1pars = {lepton1.y(), lepton1.z(), lepton1.snp(), lepton1.tgl(), lepton1.signed1Pt()};
     std::array<float, 15> lepton1covs = {lepton1.cYY(), lepton1.cZY(), lepton1.cZZ(), lepton1.cSnpY(), lepton1.cSnpZ(),
@@ -6649,11 +7002,11 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
                                         track2.c1PtY(), track2.c1PtZ(), track2.c1PtSnp(), track2.c1PtTgl(), track2.c1Pt21Pt2()};
     o2::track::TrackParCov pars4{track2.x(), track2.alpha(), track2pars, track2covs};
 
-    procCodeDilepton = VarManager::fgFitterTwoProngBarrel.process(pars1, pars2);
+    procCodeDilepton = VarManager::ctx.fFitterTwoProngBarrel.process(pars1, pars2);
     // create dilepton track
-    // o2::track::TrackParCov parsDilepton = VarManager::fgFitterTwoProngBarrel.createParentTrackParCov(0);
-    // procCodeDileptonTrackTrack = VarManager::fgFitterThreeProngBarrel.process(parsDilepton, pars3, pars4);
-    procCodeDileptonTrackTrack = VarManager::fgFitterFourProngBarrel.process(pars1, pars2, pars3, pars4);
+    // o2::track::TrackParCov parsDilepton = VarManager::ctx.fFitterTwoProngBarrel.createParentTrackParCov(0);
+    // procCodeDileptonTrackTrack = VarManager::ctx.fFitterThreeProngBarrel.process(parsDilepton, pars3, pars4);
+    procCodeDileptonTrackTrack = VarManager::ctx.fFitterFourProngBarrel.process(pars1, pars2, pars3, pars4);
 
     // fill values
     if (procCodeDilepton == 0 && procCodeDileptonTrackTrack == 0) {
@@ -6679,8 +7032,8 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
 
     Vec3D secondaryVertex;
     std::array<float, 6> covMatrixPCA{};
-    secondaryVertex = fgFitterFourProngBarrel.getPCACandidate();
-    covMatrixPCA = fgFitterFourProngBarrel.calcPCACovMatrixFlat();
+    secondaryVertex = ctx.fFitterFourProngBarrel.getPCACandidate();
+    covMatrixPCA = ctx.fFitterFourProngBarrel.calcPCACovMatrixFlat();
 
     o2::math_utils::Point3D<float> vtxXYZ(collision.posX(), collision.posY(), collision.posZ());
     std::array<float, 6> vtxCov{collision.covXX(), collision.covXY(), collision.covYY(), collision.covXZ(), collision.covYZ(), collision.covZZ()};
@@ -6747,7 +7100,7 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
       KFGeoTwoLeptons.AddDaughter(lepton1KF);
       KFGeoTwoLeptons.AddDaughter(lepton2KF);
 
-      if (fgUsedVars[kPairMass] || fgUsedVars[kPairPt]) {
+      if (ctx.fUsedVars[kPairMass] || ctx.fUsedVars[kPairPt]) {
         values[VarManager::kPairMass] = KFGeoTwoLeptons.GetMass();
         values[VarManager::kPairPt] = KFGeoTwoLeptons.GetPt();
       }
@@ -6756,7 +7109,7 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
       KFGeoTwoTracks.AddDaughter(trk1KF);
       KFGeoTwoTracks.AddDaughter(trk2KF);
 
-      if (fgUsedVars[kDitrackMass] || fgUsedVars[kDitrackPt]) {
+      if (ctx.fUsedVars[kDitrackMass] || ctx.fUsedVars[kDitrackPt]) {
         values[VarManager::kDitrackMass] = KFGeoTwoTracks.GetMass();
         values[VarManager::kDitrackPt] = KFGeoTwoTracks.GetPt();
       }
@@ -6780,7 +7133,7 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
       KFGeoTwoLeptons.AddDaughter(lepton1KF);
       KFGeoTwoLeptons.AddDaughter(lepton2KF);
 
-      if (fgUsedVars[kPairMass] || fgUsedVars[kPairPt]) {
+      if (ctx.fUsedVars[kPairMass] || ctx.fUsedVars[kPairPt]) {
         values[VarManager::kPairMass] = KFGeoTwoLeptons.GetMass();
         values[VarManager::kPairPt] = KFGeoTwoLeptons.GetPt();
       }
@@ -6791,7 +7144,7 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
       KFGeoFourProng.AddDaughter(trk2KF);
     }
 
-    if (fgUsedVars[kKFMass]) {
+    if (ctx.fUsedVars[kKFMass]) {
       float mass = 0., massErr = 0.;
       if (!KFGeoFourProng.GetMass(mass, massErr)) {
         values[kKFMass] = mass;
@@ -6855,10 +7208,10 @@ void VarManager::FillDileptonTrackTrackVertexing(C const& collision, T1 const& l
 
 //__________________________________________________________________
 template <int candidateType, typename T1, typename T2>
-void VarManager::FillQuadMC(T1 const& dilepton, T2 const& track1, T2 const& track2, float* values)
+void VarManager::FillQuadMC(VarContext& ctx, T1 const& dilepton, T2 const& track1, T2 const& track2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   double defaultDileptonMass = o2::constants::physics::MassJPsi;
@@ -6890,7 +7243,7 @@ void VarManager::FillQuadMC(T1 const& dilepton, T2 const& track1, T2 const& trac
 
 //__________________________________________________________________
 template <int pairType, typename T1, typename T2>
-float VarManager::calculatePhiV(T1 const& t1, T2 const& t2)
+float VarManager::calculatePhiV(VarContext& ctx, T1 const& t1, T2 const& t2)
 {
   // cos(phiv) = w*a /|w||a|
   // with w = u x v
@@ -6919,7 +7272,7 @@ float VarManager::calculatePhiV(T1 const& t1, T2 const& t2)
   ROOT::Math::PtEtaPhiMVector v12 = v1 + v2;
 
   float pairPhiV = -999;
-  float bz = fgMagField;
+  float bz = ctx.fMagField;
 
   bool swapTracks = false;
   if (v1.Pt() < v2.Pt()) { // ordering of track, pt1 > pt2
@@ -7006,10 +7359,10 @@ float VarManager::calculatePhiV(T1 const& t1, T2 const& t2)
 /// Fill BDT score values.
 /// Supports binary (1 output) and multiclass (3 outputs) models.
 template <typename T1>
-void VarManager::FillBdtScore(T1 const& bdtScore, float* values)
+void VarManager::FillBdtScore(VarContext& ctx, T1 const& bdtScore, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if (bdtScore.size() == 1) {
@@ -7047,10 +7400,10 @@ float VarManager::LorentzTransformJpsihadroncosChi(const TString& Option, T1 con
 }
 
 template <typename T1, typename T2, typename T3, typename T4, typename T5>
-void VarManager::FillFIT(T1 const& bc, T2 const& bcs, T3 const& ft0s, T4 const& fv0as, T5 const& fdds, float* values)
+void VarManager::FillFIT(VarContext& ctx, T1 const& bc, T2 const& bcs, T3 const& ft0s, T4 const& fv0as, T5 const& fdds, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   // Initialize FIT info structure
@@ -7107,10 +7460,10 @@ void VarManager::FillFIT(T1 const& bc, T2 const& bcs, T3 const& ft0s, T4 const&
 }
 
 template <uint32_t fillMap, typename T>
-void VarManager::FillEventAlice3(T const& event, float* values)
+void VarManager::FillEventAlice3(VarContext& ctx, T const& event, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   if constexpr ((fillMap & CollisionTimestamp) > 0) {
     values[kTimestamp] = event.timestamp();
@@ -7175,39 +7528,39 @@ void VarManager::FillEventAlice3(T const& event, float* values)
 }
 
 template <uint32_t fillMap, typename T>
-void VarManager::FillTrackAlice3(T const& track, float* values)
+void VarManager::FillTrackAlice3(VarContext& ctx, T const& track, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   if constexpr ((fillMap & Track) > 0 || (fillMap & ReducedTrack) > 0) {
     values[kPt] = track.pt();
     values[kSignedPt] = track.pt() * track.sign();
-    if (fgUsedVars[kP]) {
+    if (ctx.fUsedVars[kP]) {
       values[kP] = track.p();
     }
-    if (fgUsedVars[kPx]) {
+    if (ctx.fUsedVars[kPx]) {
       values[kPx] = track.px();
     }
-    if (fgUsedVars[kPy]) {
+    if (ctx.fUsedVars[kPy]) {
       values[kPy] = track.py();
     }
-    if (fgUsedVars[kPz]) {
+    if (ctx.fUsedVars[kPz]) {
       values[kPz] = track.pz();
     }
-    if (fgUsedVars[kInvPt]) {
+    if (ctx.fUsedVars[kInvPt]) {
       values[kInvPt] = 1. / track.pt();
     }
     values[kEta] = track.eta();
     values[kPhi] = track.phi();
     values[kCharge] = track.sign();
 
-    if (fgUsedVars[kPVContributor]) {
+    if (ctx.fUsedVars[kPVContributor]) {
       values[kPVContributor] = static_cast<float>((track.flags() & o2::aod::track::PVContributor) > 0);
     }
 
-    if (fgUsedVars[kITSClusterMap]) {
+    if (ctx.fUsedVars[kITSClusterMap]) {
       values[kITSClusterMap] = track.itsClusterMap();
     }
 
@@ -7225,16 +7578,16 @@ void VarManager::FillTrackAlice3(T const& track, float* values)
       values[kTrackDCAxy] = track.dcaXY();
       values[kTrackDCAz] = track.dcaZ();
       if constexpr ((fillMap & ReducedTrackBarrelCov) > 0) {
-        if (fgUsedVars[kTrackDCAsigXY]) {
+        if (ctx.fUsedVars[kTrackDCAsigXY]) {
           values[kTrackDCAsigXY] = track.dcaXY() / std::sqrt(track.cYY());
         }
-        if (fgUsedVars[kTrackDCAsigZ]) {
+        if (ctx.fUsedVars[kTrackDCAsigZ]) {
           values[kTrackDCAsigZ] = track.dcaZ() / std::sqrt(track.cZZ());
         }
-        if (fgUsedVars[kTrackDCAresXY]) {
+        if (ctx.fUsedVars[kTrackDCAresXY]) {
           values[kTrackDCAresXY] = std::sqrt(track.cYY());
         }
-        if (fgUsedVars[kTrackDCAresZ]) {
+        if (ctx.fUsedVars[kTrackDCAresZ]) {
           values[kTrackDCAresZ] = std::sqrt(track.cZZ());
         }
       }
@@ -7246,16 +7599,16 @@ void VarManager::FillTrackAlice3(T const& track, float* values)
     values[kTrackDCAxy] = track.dcaXY();
     values[kTrackDCAz] = track.dcaZ();
     if constexpr ((fillMap & TrackCov) > 0) {
-      if (fgUsedVars[kTrackDCAsigXY]) {
+      if (ctx.fUsedVars[kTrackDCAsigXY]) {
         values[kTrackDCAsigXY] = track.dcaXY() / std::sqrt(track.cYY());
       }
-      if (fgUsedVars[kTrackDCAsigZ]) {
+      if (ctx.fUsedVars[kTrackDCAsigZ]) {
         values[kTrackDCAsigZ] = track.dcaZ() / std::sqrt(track.cZZ());
       }
-      if (fgUsedVars[kTrackDCAresXY]) {
+      if (ctx.fUsedVars[kTrackDCAresXY]) {
         values[kTrackDCAresXY] = std::sqrt(track.cYY());
       }
-      if (fgUsedVars[kTrackDCAresZ]) {
+      if (ctx.fUsedVars[kTrackDCAresZ]) {
         values[kTrackDCAresZ] = std::sqrt(track.cZZ());
       }
     }
@@ -7324,14 +7677,14 @@ void VarManager::FillTrackAlice3(T const& track, float* values)
   }
 
   // Derived quantities which can be computed based on already filled variables
-  FillTrackDerived(values);
+  FillTrackDerived(ctx, values);
 }
 
 template <int pairType, uint32_t fillMap, typename T1, typename T2>
-void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
+void VarManager::FillPairAlice3(VarContext& ctx, T1 const& t1, T2 const& t2, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassElectron;
@@ -7373,49 +7726,52 @@ void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
   values[kEta2] = t2.eta();
   values[kPhi2] = t2.phi();
 
-  if (fgUsedVars[kDeltaPhiPair2]) {
-    values[kDeltaPhiPair2] = RecoDecay::constrainAngle(v1.Phi() - v2.Phi(), -o2::constants::math::PIHalf);
-  }
+  if (GetUsedVarGroup(ctx, kVarGroupPairAngles)) {
+    if (ctx.fUsedVars[kDeltaPhiPair2]) {
+      values[kDeltaPhiPair2] = RecoDecay::constrainAngle(v1.Phi() - v2.Phi(), -o2::constants::math::PIHalf);
+    }
 
-  if (fgUsedVars[kDeltaEtaPair2]) {
-    values[kDeltaEtaPair2] = v1.Eta() - v2.Eta();
-  }
+    if (ctx.fUsedVars[kDeltaEtaPair2]) {
+      values[kDeltaEtaPair2] = v1.Eta() - v2.Eta();
+    }
 
-  if (fgUsedVars[kPsiPair]) {
-    values[kDeltaPhiPair] = (t1.sign() * fgMagField > 0.) ? (v1.Phi() - v2.Phi()) : (v2.Phi() - v1.Phi());
-    double xipair = TMath::ACos((v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz()) / v1.P() / v2.P());
-    values[kPsiPair] = (t1.sign() * fgMagField > 0.) ? TMath::ASin((v1.Theta() - v2.Theta()) / xipair) : TMath::ASin((v2.Theta() - v1.Theta()) / xipair);
-  }
+    if (ctx.fUsedVars[kPsiPair]) {
+      values[kDeltaPhiPair] = (t1.sign() * ctx.fMagField > 0.) ? (v1.Phi() - v2.Phi()) : (v2.Phi() - v1.Phi());
+      double xipair = TMath::ACos((v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz()) / v1.P() / v2.P());
+      values[kPsiPair] = (t1.sign() * ctx.fMagField > 0.) ? TMath::ASin((v1.Theta() - v2.Theta()) / xipair) : TMath::ASin((v2.Theta() - v1.Theta()) / xipair);
+    }
 
-  if (fgUsedVars[kOpeningAngle]) {
-    double scalar = v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz();
-    double Ptot12 = Ptot1 * Ptot2;
-    if (Ptot12 <= 0) {
-      values[kOpeningAngle] = 0.;
-    } else {
-      double arg = scalar / Ptot12;
-      if (arg > 1.) {
-        arg = 1.;
-      }
-      if (arg < -1) {
-        arg = -1;
+    if (ctx.fUsedVars[kOpeningAngle]) {
+      double scalar = v1.Px() * v2.Px() + v1.Py() * v2.Py() + v1.Pz() * v2.Pz();
+      double Ptot12 = Ptot1 * Ptot2;
+      if (Ptot12 <= 0) {
+        values[kOpeningAngle] = 0.;
+      } else {
+        double arg = scalar / Ptot12;
+        if (arg > 1.) {
+          arg = 1.;
+        }
+        if (arg < -1) {
+          arg = -1;
+        }
+        values[kOpeningAngle] = TMath::ACos(arg);
       }
-      values[kOpeningAngle] = TMath::ACos(arg);
     }
   }
 
   // polarization parameters
-  bool useHE = fgUsedVars[kCosThetaHE] || fgUsedVars[kPhiHE]; // helicity frame
-  bool useCS = fgUsedVars[kCosThetaCS] || fgUsedVars[kPhiCS]; // Collins-Soper frame
-  bool usePP = fgUsedVars[kCosThetaPP];                       // production plane frame
-  bool useRM = fgUsedVars[kCosThetaRM];                       // Random frame
+  const uint32_t usedGroups = ctx.fUsedVarGroups;
+  bool useHE = (usedGroups & (1u << kVarGroupPolarizationHE)) != 0; // helicity frame
+  bool useCS = (usedGroups & (1u << kVarGroupPolarizationCS)) != 0; // Collins-Soper frame
+  bool usePP = (usedGroups & (1u << kVarGroupPolarizationPP)) != 0; // production plane frame
+  bool useRM = (usedGroups & (1u << kVarGroupPolarizationRM)) != 0; // Random frame
 
   if (useHE || useCS || usePP || useRM) {
     ROOT::Math::Boost boostv12{v12.BoostToCM()};
     ROOT::Math::XYZVectorF v1_CM{(boostv12(v1).Vect()).Unit()};
     ROOT::Math::XYZVectorF v2_CM{(boostv12(v2).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(fgBeamA).Vect()).Unit()};
-    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(fgBeamC).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam1_CM{(boostv12(ctx.fBeamA).Vect()).Unit()};
+    ROOT::Math::XYZVectorF Beam2_CM{(boostv12(ctx.fBeamC).Vect()).Unit()};
 
     // using positive sign convention for the first track
     ROOT::Math::XYZVectorF v_CM = (t1.sign() > 0 ? v1_CM : v2_CM);
@@ -7424,14 +7780,14 @@ void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_HE{(v12.Vect()).Unit()};
       ROOT::Math::XYZVectorF yaxis_HE{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_HE{(yaxis_HE.Cross(zaxis_HE)).Unit()};
-      if (fgUsedVars[kCosThetaHE]) {
+      if (ctx.fUsedVars[kCosThetaHE]) {
         values[kCosThetaHE] = zaxis_HE.Dot(v_CM);
       }
-      if (fgUsedVars[kPhiHE]) {
+      if (ctx.fUsedVars[kPhiHE]) {
         values[kPhiHE] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_HE.Dot(v_CM), xaxis_HE.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildeHE]) {
-        if (fgUsedVars[kCosThetaHE] && fgUsedVars[kPhiHE]) {
+      if (ctx.fUsedVars[kPhiTildeHE]) {
+        if (ctx.fUsedVars[kCosThetaHE] && ctx.fUsedVars[kPhiHE]) {
           if (values[kCosThetaHE] > 0) {
             values[kPhiTildeHE] = RecoDecay::constrainAngle(values[kPhiHE] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -7447,14 +7803,14 @@ void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVectorF zaxis_CS{(Beam1_CM - Beam2_CM).Unit()};
       ROOT::Math::XYZVectorF yaxis_CS{(Beam1_CM.Cross(Beam2_CM)).Unit()};
       ROOT::Math::XYZVectorF xaxis_CS{(yaxis_CS.Cross(zaxis_CS)).Unit()};
-      if (fgUsedVars[kCosThetaCS]) {
+      if (ctx.fUsedVars[kCosThetaCS]) {
         values[kCosThetaCS] = zaxis_CS.Dot(v_CM);
       }
-      if (fgUsedVars[kPhiCS]) {
+      if (ctx.fUsedVars[kPhiCS]) {
         values[kPhiCS] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_CS.Dot(v_CM), xaxis_CS.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildeCS]) {
-        if (fgUsedVars[kCosThetaCS] && fgUsedVars[kPhiCS]) {
+      if (ctx.fUsedVars[kPhiTildeCS]) {
+        if (ctx.fUsedVars[kCosThetaCS] && ctx.fUsedVars[kPhiCS]) {
           if (values[kCosThetaCS] > 0) {
             values[kPhiTildeCS] = RecoDecay::constrainAngle(values[kPhiCS] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -7470,14 +7826,14 @@ void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
       ROOT::Math::XYZVector zaxis_PP = ROOT::Math::XYZVector(v12.Py(), -v12.Px(), 0.f);
       ROOT::Math::XYZVector yaxis_PP{(v12.Vect()).Unit()};
       ROOT::Math::XYZVector xaxis_PP{(yaxis_PP.Cross(zaxis_PP)).Unit()};
-      if (fgUsedVars[kCosThetaPP]) {
+      if (ctx.fUsedVars[kCosThetaPP]) {
         values[kCosThetaPP] = zaxis_PP.Dot(v_CM) / std::sqrt(zaxis_PP.Mag2());
       }
-      if (fgUsedVars[kPhiPP]) {
+      if (ctx.fUsedVars[kPhiPP]) {
         values[kPhiPP] = RecoDecay::constrainAngle(TMath::ATan2(yaxis_PP.Dot(v_CM), xaxis_PP.Dot(v_CM)));
       }
-      if (fgUsedVars[kPhiTildePP]) {
-        if (fgUsedVars[kCosThetaPP] && fgUsedVars[kPhiPP]) {
+      if (ctx.fUsedVars[kPhiTildePP]) {
+        if (ctx.fUsedVars[kCosThetaPP] && ctx.fUsedVars[kPhiPP]) {
           if (values[kCosThetaPP] > 0) {
             values[kPhiTildePP] = RecoDecay::constrainAngle(values[kPhiPP] - o2::constants::math::PIQuarter); // phi_tilde = phi - pi/4
           } else {
@@ -7490,10 +7846,10 @@ void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
     }
 
     if (useRM) {
-      double randomCostheta = gRandom->Uniform(-1., 1.);
-      double randomPhi = gRandom->Uniform(0., o2::constants::math::TwoPI);
+      double randomCostheta = ctx.GetRandom()->Uniform(-1., 1.);
+      double randomPhi = ctx.GetRandom()->Uniform(0., o2::constants::math::TwoPI);
       ROOT::Math::XYZVectorF zaxis_RM(randomCostheta, std::sqrt(1 - randomCostheta * randomCostheta) * std::cos(randomPhi), std::sqrt(1 - randomCostheta * randomCostheta) * std::sin(randomPhi));
-      if (fgUsedVars[kCosThetaRM]) {
+      if (ctx.fUsedVars[kCosThetaRM]) {
         values[kCosThetaRM] = zaxis_RM.Dot(v_CM);
       }
     }
@@ -7501,7 +7857,7 @@ void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
 
   if constexpr ((pairType == kDecayToEE) && ((fillMap & TrackCov) > 0 || (fillMap & ReducedTrackBarrelCov) > 0)) {
 
-    if (fgUsedVars[kQuadDCAabsXY] || fgUsedVars[kQuadDCAsigXY] || fgUsedVars[kQuadDCAabsZ] || fgUsedVars[kQuadDCAsigZ] || fgUsedVars[kQuadDCAsigXYZ] || fgUsedVars[kSignQuadDCAsigXY]) {
+    if (GetUsedVarGroup(ctx, kVarGroupQuadDCA)) {
       // Quantities based on the barrel tables
       double dca1XY = t1.dcaXY();
       double dca2XY = t2.dcaXY();
@@ -7533,16 +7889,16 @@ void VarManager::FillPairAlice3(T1 const& t1, T2 const& t2, float* values)
       }
     }
   }
-  if (fgUsedVars[kPairPhiv]) {
-    values[kPairPhiv] = calculatePhiV<pairType>(t1, t2);
+  if (ctx.fUsedVars[kPairPhiv]) {
+    values[kPairPhiv] = calculatePhiV<pairType>(ctx, t1, t2);
   }
 }
 
 template <typename M, typename T>
-void VarManager::FillResolutions(M const& mcTrack, T const& track, float* values)
+void VarManager::FillResolutions(VarContext& ctx, M const& mcTrack, T const& track, float* values)
 {
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   values[kDeltaPt] = track.pt() - mcTrack.pt();
@@ -7552,14 +7908,14 @@ void VarManager::FillResolutions(M const& mcTrack, T const& track, float* values
 }
 
 template <int pairType, uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-void VarManager::FillPairVertexingAlice3(C const& collision, T const& t1, T const& t2, bool propToSV, float* values)
+void VarManager::FillPairVertexingAlice3(VarContext& ctx, C const& collision, T const& t1, T const& t2, bool propToSV, float* values)
 {
   // check at compile time that the event and cov matrix have the cov matrix
   constexpr bool eventHasVtxCov = ((collFillMap & Collision) > 0 || (collFillMap & ReducedEventVtxCov) > 0);
   constexpr bool trackHasCov = ((fillMap & TrackCov) > 0 || (fillMap & ReducedTrackBarrelCov) > 0);
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
   float m1 = o2::constants::physics::MassElectron;
   float m2 = o2::constants::physics::MassElectron;
@@ -7571,8 +7927,8 @@ void VarManager::FillPairVertexingAlice3(C const& collision, T const& t1, T cons
   ROOT::Math::PtEtaPhiMVector v2(t2.pt(), t2.eta(), t2.phi(), m2);
   ROOT::Math::PtEtaPhiMVector v12 = v1 + v2;
 
-  values[kUsedKF] = static_cast<float>(fgUsedKF);
-  if (!fgUsedKF) {
+  values[kUsedKF] = static_cast<float>(ctx.fUsedKF);
+  if (!ctx.fUsedKF) {
     int procCode = 0;
 
     // TODO: use trackUtilities functions to initialize the various matrices to avoid code duplication
@@ -7590,7 +7946,7 @@ void VarManager::FillPairVertexingAlice3(C const& collision, T const& t1, T cons
                                       t2.cSnpSnp(), t2.cTglY(), t2.cTglZ(), t2.cTglSnp(), t2.cTglTgl(),
                                       t2.c1PtY(), t2.c1PtZ(), t2.c1PtSnp(), t2.c1PtTgl(), t2.c1Pt21Pt2()};
       o2::track::TrackParCov pars2{t2.x(), t2.alpha(), t2pars, t2covs};
-      procCode = fgFitterTwoProngBarrel.process(pars1, pars2);
+      procCode = ctx.fFitterTwoProngBarrel.process(pars1, pars2);
     } else {
       return;
     }
@@ -7630,12 +7986,12 @@ void VarManager::FillPairVertexingAlice3(C const& collision, T const& t1, T cons
       auto covMatrixPV = primaryVertex.getCov();
 
       if constexpr ((pairType == kDecayToEE || pairType == kDecayToKPi) && trackHasCov) {
-        secondaryVertex = fgFitterTwoProngBarrel.getPCACandidate();
+        secondaryVertex = ctx.fFitterTwoProngBarrel.getPCACandidate();
         // printf("secVtx (first) %f %f  %f \n",secondaryVertex[0],secondaryVertex[1],secondaryVertex[2]);
-        covMatrixPCA = fgFitterTwoProngBarrel.calcPCACovMatrixFlat();
-        auto chi2PCA = fgFitterTwoProngBarrel.getChi2AtPCACandidate();
-        auto trackParVar0 = fgFitterTwoProngBarrel.getTrack(0);
-        auto trackParVar1 = fgFitterTwoProngBarrel.getTrack(1);
+        covMatrixPCA = ctx.fFitterTwoProngBarrel.calcPCACovMatrixFlat();
+        auto chi2PCA = ctx.fFitterTwoProngBarrel.getChi2AtPCACandidate();
+        auto trackParVar0 = ctx.fFitterTwoProngBarrel.getTrack(0);
+        auto trackParVar1 = ctx.fFitterTwoProngBarrel.getTrack(1);
         values[kVertexingChi2PCA] = chi2PCA;
         v1 = {trackParVar0.getPt(), trackParVar0.getEta(), trackParVar0.getPhi(), m1};
         v2 = {trackParVar1.getPt(), trackParVar1.getEta(), trackParVar1.getPhi(), m2};
@@ -7677,14 +8033,14 @@ void VarManager::FillPairVertexingAlice3(C const& collision, T const& t1, T cons
       values[kVertexingLxyProjected] = values[kVertexingLxyProjected] / TMath::Sqrt((v12.Px() * v12.Px()) + (v12.Py() * v12.Py()));
       values[kVertexingLxyzProjected] = ((secondaryVertex[0] - collision.posX()) * v12.Px()) + ((secondaryVertex[1] - collision.posY()) * v12.Py()) + ((secondaryVertex[2] - collision.posZ()) * v12.Pz());
       values[kVertexingLxyzProjected] = values[kVertexingLxyzProjected] / TMath::Sqrt((v12.Px() * v12.Px()) + (v12.Py() * v12.Py()) + (v12.Pz() * v12.Pz()));
-      if (fgPVrecalKF) {
+      if (ctx.fPVrecalKF) {
         values[kVertexingLxyProjectedRecalculatePV] = (secondaryVertex[0] - primaryVertexNew.getX()) * v12.Px() + (secondaryVertex[1] - primaryVertexNew.getY()) * v12.Py();
         values[kVertexingLxyProjectedRecalculatePV] = values[kVertexingLxyProjectedRecalculatePV] / v12.Pt();
       }
       values[kVertexingTauxyProjected] = values[kVertexingLxyProjected] * v12.M() / (v12.Pt());
       values[kVertexingTauxyProjectedPoleJPsiMass] = values[kVertexingLxyProjected] * o2::constants::physics::MassJPsi / (v12.Pt());
       values[kVertexingTauxyProjectedNs] = values[kVertexingTauxyProjected] / o2::constants::physics::LightSpeedCm2NS;
-      if (fgPVrecalKF) {
+      if (ctx.fPVrecalKF) {
         values[kVertexingTauxyProjectedPoleJPsiMassRecalculatePV] = values[kVertexingLxyProjectedRecalculatePV] * o2::constants::physics::MassJPsi / (v12.Pt());
       }
       values[kVertexingTauzProjected] = values[kVertexingLzProjected] * v12.M() / TMath::Abs(v12.Pz());
@@ -7709,14 +8065,14 @@ void VarManager::FillPairVertexingAlice3(C const& collision, T const& t1, T cons
 }
 
 template <uint32_t collFillMap, uint32_t fillMap, typename C, typename T>
-void VarManager::FillTripletVertexingALICE3(C const& collision, T const& t1, T const& t2, T const& t3, VarManager::PairCandidateType tripletType, float* values)
+void VarManager::FillTripletVertexingALICE3(VarContext& ctx, C const& collision, T const& t1, T const& t2, T const& t3, VarManager::PairCandidateType tripletType, float* values)
 {
   // TODO: Vertexing error variables
   constexpr bool eventHasVtxCov = ((collFillMap & Collision) > 0 || (collFillMap & ReducedEventVtxCov) > 0);
   bool trackHasCov = ((fillMap & ReducedTrackBarrelCov) > 0);
 
   if (!values) {
-    values = fgValues;
+    values = ctx.fValues;
   }
 
   float m1 = o2::constants::physics::MassKaonCharged;
@@ -7756,7 +8112,7 @@ void VarManager::FillTripletVertexingALICE3(C const& collision, T const& t1, T c
                                     t3.cSnpSnp(), t3.cTglY(), t3.cTglZ(), t3.cTglSnp(), t3.cTglTgl(),
                                     t3.c1PtY(), t3.c1PtZ(), t3.c1PtSnp(), t3.c1PtTgl(), t3.c1Pt21Pt2()};
     o2::track::TrackParCov pars3{t3.x(), t3.alpha(), t3pars, t3covs};
-    procCode = VarManager::fgFitterThreeProngBarrel.process(pars1, pars2, pars3);
+    procCode = VarManager::ctx.fFitterThreeProngBarrel.process(pars1, pars2, pars3);
   } else {
     return;
   }
@@ -7790,17 +8146,17 @@ void VarManager::FillTripletVertexingALICE3(C const& collision, T const& t1, T c
   Vec3D secondaryVertex;
 
   if constexpr (eventHasVtxCov) {
-    secondaryVertex = fgFitterThreeProngBarrel.getPCACandidate();
+    secondaryVertex = ctx.fFitterThreeProngBarrel.getPCACandidate();
 
-    std::array<float, 6> covMatrixPCA = fgFitterThreeProngBarrel.calcPCACovMatrixFlat();
+    std::array<float, 6> covMatrixPCA = ctx.fFitterThreeProngBarrel.calcPCACovMatrixFlat();
 
     o2::math_utils::Point3D<float> vtxXYZ(collision.posX(), collision.posY(), collision.posZ());
     std::array<float, 6> vtxCov{collision.covXX(), collision.covXY(), collision.covYY(), collision.covXZ(), collision.covYZ(), collision.covZZ()};
     o2::dataformats::VertexBase primaryVertex = {vtxXYZ, vtxCov};
     auto covMatrixPV = primaryVertex.getCov();
 
-    if (fgUsedVars[kVertexingChi2PCA]) {
-      auto chi2PCA = fgFitterThreeProngBarrel.getChi2AtPCACandidate();
+    if (ctx.fUsedVars[kVertexingChi2PCA]) {
+      auto chi2PCA = ctx.fFitterThreeProngBarrel.getChi2AtPCACandidate();
       values[VarManager::kVertexingChi2PCA] = chi2PCA;
     }
 
@@ -0,0 +1,220 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file testAnalysisCutProgram.cxx
+/// \brief Check that AnalysisCutProgram takes the same decisions as AnalysisCompositeCut::IsSelected()
+//
+// Library cuts and hand-made cuts covering exclusion ranges, dependent variables, function limits (including a sharp one)
+// and nested AND/OR composites are evaluated on random candidates. The values of the variables are sampled around the cut limits,
+// including values exactly at the limits and NaNs. The program returns 1 if any decision differs.
+//
+
+#include "PWGDQ/Core/AnalysisCompositeCut.h"
+#include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/AnalysisCutProgram.h"
+#include "PWGDQ/Core/CutsLibrary.h"
+#include "PWGDQ/Core/VarManager.h"
+
+#include <Framework/Logger.h>
+
+#include <TF1.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+// limits of all range tests of a cut, per variable, used to sample the variables around them
+void collectLimits(const AnalysisCut& cut, std::map<int, std::vector<float>>& limits)
+{
+  for (auto const& container : cut.GetCuts()) {
+    if (!container.fFuncLow) {
+      limits[container.fVar].push_back(container.fLow);
+    }
+    if (!container.fFuncHigh) {
+      limits[container.fVar].push_back(container.fHigh);
+    }
+    if (container.fDepVar != -1) {
+      limits[container.fDepVar].push_back(container.fDepLow);
+      limits[container.fDepVar].push_back(container.fDepHigh);
+    }
+    if (container.fDepVar2 != -1) {
+      limits[container.fDepVar2].push_back(container.fDep2Low);
+      limits[container.fDepVar2].push_back(container.fDep2High);
+    }
+  }
+  if (const auto* composite = dynamic_cast<const AnalysisCompositeCut*>(&cut)) {
+    for (auto const& child : composite->GetCutList()) {
+      collectLimits(child, limits);
+    }
+    for (auto const& child : composite->GetCompositeCutList()) {
+      collectLimits(child, limits);
+    }
+  }
+}
+
+// range tests with function limits, whose variable is also sampled exactly at the limit
+void collectFunctionLimits(const AnalysisCut& cut, std::vector<AnalysisCut::CutContainer>& containers)
+{
+  for (auto const& container : cut.GetCuts()) {
+    if (container.fFuncLow || container.fFuncHigh) {
+      containers.push_back(container);
+    }
+  }
+  if (const auto* composite = dynamic_cast<const AnalysisCompositeCut*>(&cut)) {
+    for (auto const& child : composite->GetCutList()) {
+      collectFunctionLimits(child, containers);
+    }
+    for (auto const& child : composite->GetCompositeCutList()) {
+      collectFunctionLimits(child, containers);
+    }
+  }
+}
+
+std::vector<AnalysisCompositeCut*> buildCuts()
+{
+  std::vector<AnalysisCompositeCut*> cuts;
+  // cuts of the library, including TF1 limits
+  for (auto const* name : {"jpsiO2MCdebugCuts", "jpsiO2MCdebugCuts2", "jpsiBenchmarkCuts"}) {
+    cuts.push_back(o2::aod::dqcuts::GetCompositeCut(name));
+  }
+  for (auto const* name : {"electronPID1", "electronPrimary_dca3sigma"}) {
+    auto* cut = new AnalysisCompositeCut(name, name);
+    cut->AddCut(o2::aod::dqcuts::GetAnalysisCut(name));
+    cuts.push_back(cut);
+  }
+
+  // exclusion ranges and dependent variables, with exclusion
+  AnalysisCut exclusion("exclusion", "exclusion");
+  exclusion.AddCut(VarManager::kEta, -0.2, 0.2, true);
+  exclusion.AddCut(VarManager::kPhi, 1.0, 2.0, false, VarManager::kPt, 1.0, 5.0, true);
+  exclusion.AddCut(VarManager::kTPCsignal, 60.0, 90.0, false, VarManager::kPin, 0.5, 3.0, false, VarManager::kEta, -0.5, 0.5, true);
+
+  // function limits on both sides, and with a restricted function range
+  auto funcLow = std::make_shared<TF1>("testFuncLow", "[0] + [1] * pow(x, -[2])", 0.1, 20.);
+  funcLow->SetParameters(-0.01, -0.02, 0.8);
+  auto funcHigh = std::make_shared<TF1>("testFuncHigh", "pol2", 0., 5.);
+  funcHigh->SetParameters(0.05, 0.01, -0.001);
+  AnalysisCut functions("functions", "functions");
+  functions.AddCut(VarManager::kTrackDCAxy, funcLow, funcHigh, false, VarManager::kPt, 0.2, 10.0);
+  functions.AddCut(VarManager::kTrackDCAz, -1.0, funcHigh, true, VarManager::kPt, 0.0, 100.0);
+
+  // sharp function limit, varying by orders of magnitude within a small range of the dependent variable
+  auto funcSharp = std::make_shared<TF1>("testFuncSharp", "[0] + [1] * pow(x, -[2])", 0.05, 10.);
+  funcSharp->SetParameters(50., 1.e-4, 6.);
+  AnalysisCut sharp("sharp", "sharp");
+  sharp.AddCut(VarManager::kTPCsignal, funcSharp, 200.0, false, VarManager::kPin, 0.05, 10.0);
+  auto* sharpCut = new AnalysisCompositeCut("sharp", "sharp");
+  sharpCut->AddCut(&sharp);
+  cuts.push_back(sharpCut);
+
+  auto* orCut = new AnalysisCompositeCut("or", "or", false);
+  orCut->AddCut(&exclusion);
+  orCut->AddCut(&functions);
+  cuts.push_back(orCut);
+
+  // nested composites
+  AnalysisCompositeCut inner("inner", "inner", false);
+  inner.AddCut(&exclusion);
+  inner.AddCut(o2::aod::dqcuts::GetAnalysisCut("electronPID1"));
+  auto* nested = new AnalysisCompositeCut("nested", "nested", true);
+  nested->AddCut(&inner);
+  nested->AddCut(&functions);
+  cuts.push_back(nested);
+
+  // empty composites
+  cuts.push_back(new AnalysisCompositeCut("emptyAND", "emptyAND", true));
+  cuts.push_back(new AnalysisCompositeCut("emptyOR", "emptyOR", false));
+  return cuts;
+}
+} // namespace
+
+int main()
+{
+  constexpr int kNBatches = 50;
+  constexpr int kNCandidatesPerBatch = 1000;
+
+  auto cuts = buildCuts();
+  std::map<int, std::vector<float>> limits;
+  std::vector<AnalysisCut::CutContainer> functionLimits;
+  std::vector<AnalysisCut*> programCuts;
+  for (auto* cut : cuts) {
+    collectLimits(*cut, limits);
+    collectFunctionLimits(*cut, functionLimits);
+    programCuts.push_back(cut);
+  }
+
+  AnalysisCutProgram program;
+  program.Compile(programCuts);
+
+  std::mt19937 rng(12345);
+  std::uniform_real_distribution<float> uniform(0.f, 1.f);
+  std::vector<std::vector<float>> candidates(kNCandidatesPerBatch, std::vector<float>(VarManager::kNVars, 0.f));
+  std::vector<uint64_t> masks(kNCandidatesPerBatch);
+  int nMismatches = 0;
+  int nSelected = 0;
+
+  for (int iBatch = 0; iBatch < kNBatches; ++iBatch) {
+    program.Clear();
+    for (auto& values : candidates) {
+      for (auto const& var : program.GetUsedVars()) {
+        const auto& varLimits = limits[var];
+        float r = uniform(rng);
+        if (r < 0.05) {
+          values[var] = std::numeric_limits<float>::quiet_NaN();
+        } else if (r < 0.25 && !varLimits.empty()) {
+          values[var] = varLimits[rng() % varLimits.size()];
+        } else if (varLimits.empty()) {
+          values[var] = -10.f + 20.f * uniform(rng);
+        } else {
+          auto [minLimit, maxLimit] = std::minmax_element(varLimits.begin(), varLimits.end());
+          float margin = 0.1f * (*maxLimit - *minLimit) + 0.1f;
+          values[var] = *minLimit - margin + (*maxLimit - *minLimit + 2.f * margin) * uniform(rng);
+        }
+      }
+      // put some candidates exactly at (or next to) the function limits
+      for (auto const& container : functionLimits) {
+        if (uniform(rng) > 0.3) {
+          continue;
+        }
+        const auto& func = (container.fFuncLow && (!container.fFuncHigh || uniform(rng) < 0.5)) ? container.fFuncLow : container.fFuncHigh;
+        float limit = func->Eval(values[container.fDepVar]);
+        float r = uniform(rng);
+        values[container.fVar] = r < 0.33 ? limit : std::nextafter(limit, r < 0.66 ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity());
+      }
+      program.AddCandidate(values.data());
+    }
+
+    program.Evaluate(masks.data());
+    for (int iCand = 0; iCand < kNCandidatesPerBatch; ++iCand) {
+      for (std::size_t iCut = 0; iCut < cuts.size(); ++iCut) {
+        bool expected = cuts[iCut]->IsSelected(candidates[iCand].data());
+        bool decision = (masks[iCand] >> iCut) & 1;
+        nSelected += expected;
+        if (expected != decision) {
+          if (nMismatches < 10) {
+            LOG(error) << "Cut " << cuts[iCut]->GetName() << ": AnalysisCutProgram decision " << decision << " differs from IsSelected() " << expected << " (batch " << iBatch << ", candidate " << iCand << ")";
+          }
+          nMismatches++;
+        }
+      }
+    }
+  }
+
+  LOG(info) << "Checked " << cuts.size() << " cuts on " << kNBatches * kNCandidatesPerBatch << " candidates, " << nSelected << " selections, " << nMismatches << " mismatches";
+  return nMismatches > 0 ? 1 : 0;
+}
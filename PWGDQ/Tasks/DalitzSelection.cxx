@@ -158,7 +158,7 @@ struct DalitzSelection {
   bool fSkipEvent = false; // speed up by skipping next step of event if no track/pair is selected
 
   MixingHandler fMixingHandler;
-  MixingHandler::MixingEvent* fMixingEvent = nullptr;
+  MixingHandler::MixingEvent fMixingEvent; // event being filled, reused for all events to keep the track memory
 
   HistogramManager* fHistMan = nullptr;
 
@@ -441,23 +441,23 @@ struct DalitzSelection {
           if (filterMap) {
             // we use the 8th bit to keep track of the track sign
             MixingHandler::MixingTrack mixingTrack(fullTrack.pt(), fullTrack.eta(), fullTrack.phi(), fullTrack.sign() > 0 ? (static_cast<uint32_t>(filterMap) | (static_cast<uint32_t>(1) << 8)) : static_cast<uint32_t>(filterMap));
-            fMixingEvent->AddTrack1(mixingTrack);
+            fMixingEvent.AddTrack1(mixingTrack);
           }
           if (filterMapProbe) {
             // we use the 8th bit to keep track of the track sign
             MixingHandler::MixingTrack mixingTrack(fullTrack.pt(), fullTrack.eta(), fullTrack.phi(), fullTrack.sign() > 0 ? (static_cast<uint32_t>(filterMapProbe) | (static_cast<uint32_t>(1) << 8)) : static_cast<uint32_t>(filterMapProbe));
-            fMixingEvent->AddTrack2(mixingTrack);
+            fMixingEvent.AddTrack2(mixingTrack);
           }
         } else {
           if (filterMap) {
             // we use the 8th bit to keep track of the track sign
             MixingHandler::MixingTrack mixingTrack(track1.pt(), track1.eta(), track1.phi(), track1.sign() > 0 ? (static_cast<uint32_t>(filterMap) | (static_cast<uint32_t>(1) << 8)) : static_cast<uint32_t>(filterMap));
-            fMixingEvent->AddTrack1(mixingTrack);
+            fMixingEvent.AddTrack1(mixingTrack);
           }
           if (filterMapProbe) {
             // we use the 8th bit to keep track of the track sign
             MixingHandler::MixingTrack mixingTrack(track1.pt(), track1.eta(), track1.phi(), track1.sign() > 0 ? (static_cast<uint32_t>(filterMapProbe) | (static_cast<uint32_t>(1) << 8)) : static_cast<uint32_t>(filterMapProbe));
-            fMixingEvent->AddTrack2(mixingTrack);
+            fMixingEvent.AddTrack2(mixingTrack);
           }
         }
       }
@@ -669,17 +669,9 @@ struct DalitzSelection {
     // run the mixing with the events in the pool corresponding to this event
     auto& pool = fMixingHandler.GetPool(fMixingHandler.FindEventCategory(static_cast<float*>(VarManager::fgValues)));
 
-    // Bit 8 is a special bit in this case (keeping track sign), so we don't want it to be erased, except when everything else is empty
-    uint32_t bitMask = (static_cast<uint32_t>(1) << 8);
-    fMixingEvent->ClearFilteringMask(bitMask);
-
-    for (auto& poolEvent : pool.events) {
-      if ((poolEvent.filteringMask & static_cast<uint32_t>(255)) == 0) {
-        // all other bits have been erased, so we can also mark bit 8 for deletion
-        poolEvent.filteringMask |= bitMask;
-        poolEvent.counters[8] = fMixingHandler.GetPoolDepth();
-      }
-      for (auto const& t1 : fMixingEvent->tracks1) {
+    // NOTE: bit 8 of the track filtering flags keeps the track sign; events are removed from the pool after the pool depth, independently of the filtering bits
+    for (auto const& poolEvent : pool.GetEvents()) {
+      for (auto const& t1 : fMixingEvent.tracks1) {
         // tag from event 1 and probe from event 2. If not tag and probe method, all tracks are in tracks1 array
         for (auto const& t2 : (fIsTagAndProbe ? poolEvent.tracks2 : poolEvent.tracks1)) {
           // check the two-track filter for the mixed pair
@@ -716,7 +708,7 @@ struct DalitzSelection {
         }
       }
       if (fIsTagAndProbe) {
-        for (auto const& t2 : fMixingEvent->tracks2) {
+        for (auto const& t2 : fMixingEvent.tracks2) {
           // tag from event 2 and probe from event 1
           for (auto const& t1 : poolEvent.tracks1) {
             auto mixedTwoTrackFilter = static_cast<uint8_t>(t1.filteringFlags & t2.filteringFlags & static_cast<uint32_t>(255)); // we keep only first 8 bits
@@ -746,7 +738,7 @@ struct DalitzSelection {
       } // end if tag and probe
     } // end loop on events from the pool
     // add the current event to the pool
-    pool.UpdatePool(*fMixingEvent, fMixingHandler.GetPoolDepth());
+    pool.UpdatePool(fMixingEvent, fMixingHandler.GetPoolDepth());
   }
 
   void initNewRun(int64_t timestamp)
@@ -827,7 +819,7 @@ struct DalitzSelection {
         }
 
         if (fConfigOptions.fRunEventMixing) {
-          fMixingEvent = new MixingHandler::MixingEvent();
+          fMixingEvent.Clear();
         }
 
         auto groupedFilteredTracks = filteredTracks.sliceBy(perCollision, collision.globalIndex());
@@ -837,11 +829,10 @@ struct DalitzSelection {
         }
 
         if (fConfigOptions.fRunEventMixing) {
-          if (!fMixingEvent->tracks1.empty()) {
+          if (!fMixingEvent.tracks1.empty()) {
             // we require that there is at least one tag track in the event to avoid having the pool full of events with only probe tracks which become useless for mixing
             runMixing();
           }
-          delete fMixingEvent;
         }
       }
     }
@@ -889,7 +880,7 @@ struct DalitzSelection {
         }
 
         if (fConfigOptions.fRunEventMixing) {
-          fMixingEvent = new MixingHandler::MixingEvent();
+          fMixingEvent.Clear();
         }
 
         auto groupedTracksAssoc = trackAssocs.sliceBy(trackIndicesPerCollision, collision.globalIndex());
@@ -898,12 +889,11 @@ struct DalitzSelection {
           runDalitzPairing<true, pairType, TrackFillMap, MyBarrelTracks>(groupedTracksAssoc, groupedTracksAssoc, collision);
         }
         if (fConfigOptions.fRunEventMixing) {
-          if (!fMixingEvent->tracks1.empty()) {
+          if (!fMixingEvent.tracks1.empty()) {
             // we require that there is at least one tag track in the event to avoid having the pool full of events with only probe tracks which are then useless
             // In addition, this allows to avoid mixing events which are too close in time, which could contain tracks from the same event due to track-to-collision reassociation
             runMixing();
           }
-          delete fMixingEvent;
         }
       }
     }
@@ -951,7 +941,7 @@ struct DalitzSelection {
         }
 
         if (fConfigOptions.fRunEventMixing) {
-          fMixingEvent = new MixingHandler::MixingEvent();
+          fMixingEvent.Clear();
         }
 
         auto groupedTracksAssoc = trackAssocs.sliceBy(trackIndicesPerCollision, collision.globalIndex());
@@ -960,12 +950,11 @@ struct DalitzSelection {
           runDalitzPairing<true, pairType, TrackFillMapNoTOF, MyBarrelTracksNoTOF>(groupedTracksAssoc, groupedTracksAssoc, collision);
         }
         if (fConfigOptions.fRunEventMixing) {
-          if (!fMixingEvent->tracks1.empty()) {
+          if (!fMixingEvent.tracks1.empty()) {
             // we require that there is at least one tag track in the event to avoid having the pool full of events with only probe tracks which are then useless
             // In addition, this allows to avoid mixing events which are too close in time, which could contain tracks from the same event due to track-to-collision reassociation
             runMixing();
           }
-          delete fMixingEvent;
         }
       }
     }
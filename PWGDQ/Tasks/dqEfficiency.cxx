@@ -40,6 +40,7 @@
 
 #include <RtypesCore.h>
 
+#include <array>
 #include <cstdint>
 #include <cstdio>
 #include <memory>
@@ -96,6 +97,8 @@ constexpr static uint32_t gkMuonFillMapWithCov = VarManager::ObjTypes::ReducedMu
 constexpr static uint32_t gkParticleMCFillMap = VarManager::ObjTypes::ParticleMC;
 
 void DefineHistograms(HistogramManager* histMan, TString histClasses);
+// get the fill handles of a list of histogram classes (with an optional suffix appended to each name), to fill them without composing or looking up class names
+std::vector<int> GetHistClassHandles(HistogramManager* histMan, const std::vector<TString>& histClasses, const char* suffix = "");
 
 struct AnalysisEventSelection {
   Produces<aod::EventCuts> eventSel;
@@ -105,6 +108,8 @@ struct AnalysisEventSelection {
 
   HistogramManager* fHistMan;
   AnalysisCompositeCut* fEventCut;
+  int fHistBeforeCuts = HistogramManager::kNothing; // fill handle of the histograms before the event cuts
+  int fHistAfterCuts = HistogramManager::kNothing;  // fill handle of the histograms after the event cuts
 
   void init(o2::framework::InitContext& context)
   {
@@ -125,6 +130,8 @@ struct AnalysisEventSelection {
       DefineHistograms(fHistMan, "Event_BeforeCuts;Event_AfterCuts;"); // define all histograms
       VarManager::SetUseVars(fHistMan->GetUsedVars());                 // provide the list of required variables so that VarManager knows what to fill
       fOutputList.setObject(fHistMan->GetMainHistogramList());
+      fHistBeforeCuts = fHistMan->GetHistClassHandle("Event_BeforeCuts");
+      fHistAfterCuts = fHistMan->GetHistClassHandle("Event_AfterCuts");
     }
   }
 
@@ -142,11 +149,11 @@ struct AnalysisEventSelection {
       VarManager::FillEvent<TEventMCFillMap>(event.mcCollision());
     }
     if (fConfigQA) {
-      fHistMan->FillHistClass("Event_BeforeCuts", VarManager::fgValues); // automatically fill all the histograms in the class Event
+      fHistMan->FillHistClass(fHistBeforeCuts, VarManager::fgValues); // automatically fill all the histograms in the class Event
     }
     if (fEventCut->IsSelected(VarManager::fgValues)) {
       if (fConfigQA) {
-        fHistMan->FillHistClass("Event_AfterCuts", VarManager::fgValues);
+        fHistMan->FillHistClass(fHistAfterCuts, VarManager::fgValues);
       }
       eventSel(1);
     } else {
@@ -179,6 +186,9 @@ struct AnalysisTrackSelection {
   std::vector<MCSignal> fMCSignals; // list of signals to be checked
   std::vector<TString> fHistNamesReco;
   std::vector<std::vector<TString>> fHistNamesMCMatched;
+  int fHistBeforeCuts = HistogramManager::kNothing; // fill handle of the histograms before cuts
+  std::vector<int> fHistReco;                       // fill handles of the fHistNamesReco histogram classes
+  std::vector<std::vector<int>> fHistMCMatched;     // fill handles of the fHistNamesMCMatched histogram classes
 
   void init(o2::framework::InitContext& context)
   {
@@ -235,6 +245,11 @@ struct AnalysisTrackSelection {
       DefineHistograms(fHistMan, histClasses.Data());  // define all histograms
       VarManager::SetUseVars(fHistMan->GetUsedVars()); // provide the list of required variables so that VarManager knows what to fill
       fOutputList.setObject(fHistMan->GetMainHistogramList());
+      fHistBeforeCuts = fHistMan->GetHistClassHandle("TrackBarrel_BeforeCuts");
+      fHistReco = GetHistClassHandles(fHistMan, fHistNamesReco);
+      for (auto& names : fHistNamesMCMatched) {
+        fHistMCMatched.push_back(GetHistClassHandles(fHistMan, names));
+      }
     }
   }
 
@@ -266,7 +281,7 @@ struct AnalysisTrackSelection {
       }
 
       if (fConfigQA) {
-        fHistMan->FillHistClass("TrackBarrel_BeforeCuts", VarManager::fgValues);
+        fHistMan->FillHistClass(fHistBeforeCuts, VarManager::fgValues);
       }
 
       // compute track selection and publish the bit map
@@ -275,7 +290,7 @@ struct AnalysisTrackSelection {
         if ((*cut).IsSelected(VarManager::fgValues)) {
           filterMap |= (static_cast<uint32_t>(1) << i);
           if (fConfigQA) {
-            fHistMan->FillHistClass(fHistNamesReco[i].Data(), VarManager::fgValues);
+            fHistMan->FillHistClass(fHistReco[i], VarManager::fgValues);
           }
         }
       }
@@ -311,7 +326,7 @@ struct AnalysisTrackSelection {
         }
         for (unsigned int j = 0; j < fTrackCuts.size(); j++) {
           if (filterMap & (uint8_t(1) << j)) {
-            fHistMan->FillHistClass(fHistNamesMCMatched[j][i].Data(), VarManager::fgValues);
+            fHistMan->FillHistClass(fHistMCMatched[j][i], VarManager::fgValues);
           }
         } // end loop over cuts
       } // end loop over MC signals
@@ -348,6 +363,9 @@ struct AnalysisMuonSelection {
   std::vector<MCSignal> fMCSignals; // list of signals to be checked
   std::vector<TString> fHistNamesReco;
   std::vector<std::vector<TString>> fHistNamesMCMatched;
+  int fHistBeforeCuts = HistogramManager::kNothing; // fill handle of the histograms before cuts
+  std::vector<int> fHistReco;                       // fill handles of the fHistNamesReco histogram classes
+  std::vector<std::vector<int>> fHistMCMatched;     // fill handles of the fHistNamesMCMatched histogram classes
 
   void init(o2::framework::InitContext& context)
   {
@@ -404,6 +422,11 @@ struct AnalysisMuonSelection {
       DefineHistograms(fHistMan, histClasses.Data());  // define all histograms
       VarManager::SetUseVars(fHistMan->GetUsedVars()); // provide the list of required variables so that VarManager knows what to fill
       fOutputList.setObject(fHistMan->GetMainHistogramList());
+      fHistBeforeCuts = fHistMan->GetHistClassHandle("TrackMuon_BeforeCuts");
+      fHistReco = GetHistClassHandles(fHistMan, fHistNamesReco);
+      for (auto& names : fHistNamesMCMatched) {
+        fHistMCMatched.push_back(GetHistClassHandles(fHistMan, names));
+      }
     }
   }
 
@@ -436,7 +459,7 @@ struct AnalysisMuonSelection {
       }
 
       if (fConfigQA) {
-        fHistMan->FillHistClass("TrackMuon_BeforeCuts", VarManager::fgValues);
+        fHistMan->FillHistClass(fHistBeforeCuts, VarManager::fgValues);
       }
 
       // compute the cut selections and publish the filter bit map
@@ -445,7 +468,7 @@ struct AnalysisMuonSelection {
         if ((*cut).IsSelected(VarManager::fgValues)) {
           filterMap |= (static_cast<uint32_t>(1) << i);
           if (fConfigQA) {
-            fHistMan->FillHistClass(fHistNamesReco[i].Data(), VarManager::fgValues);
+            fHistMan->FillHistClass(fHistReco[i], VarManager::fgValues);
           }
         }
       }
@@ -484,7 +507,7 @@ struct AnalysisMuonSelection {
         }
         for (unsigned int j = 0; j < fTrackCuts.size(); j++) {
           if (filterMap & (uint8_t(1) << j)) {
-            fHistMan->FillHistClass(fHistNamesMCMatched[j][i].Data(), VarManager::fgValues);
+            fHistMan->FillHistClass(fHistMCMatched[j][i], VarManager::fgValues);
           }
         } // end loop over cuts
       } // end loop over MC signals
@@ -553,6 +576,14 @@ struct AnalysisSameEventPairing {
   std::vector<std::vector<TString>> fMuonHistNamesMCmatched;
   std::vector<std::vector<TString>> fBarrelMuonHistNames;
   std::vector<std::vector<TString>> fBarrelMuonHistNamesMCmatched;
+  // fill handles of the classes above, for each cut: the classes followed by their "_unambiguous" versions
+  std::vector<std::vector<int>> fBarrelHistHandles;
+  std::vector<std::vector<int>> fBarrelHistHandlesMCmatched;
+  std::vector<std::vector<int>> fMuonHistHandles;
+  std::vector<std::vector<int>> fMuonHistHandlesMCmatched;
+  std::vector<std::vector<int>> fBarrelMuonHistHandles;
+  std::vector<std::vector<int>> fBarrelMuonHistHandlesMCmatched;
+  std::vector<int> fGenHistHandles; // one per generator level MC signal
   std::vector<MCSignal> fRecMCSignals;
   std::vector<MCSignal> fGenMCSignals;
 
@@ -701,18 +732,20 @@ struct AnalysisSameEventPairing {
     */
 
     // Add histogram classes for each specified MCsignal at the generator level
-    // TODO: create a std::vector of hist classes to be used at Fill time, to avoid using Form in the process function
     TString sigGenNamesStr = fConfigMCGenSignals.value;
     std::unique_ptr<TObjArray> objGenSigArray(sigGenNamesStr.Tokenize(","));
+    std::vector<TString> genHistNames;
     for (int isig = 0; isig < objGenSigArray->GetEntries(); isig++) {
       MCSignal* sig = o2::aod::dqmcsignals::GetMCSignal(objGenSigArray->At(isig)->GetName());
       if (sig) {
         if (sig->GetNProngs() == 1) { // NOTE: 1-prong signals required
           fGenMCSignals.push_back(*sig);
-          histNames += Form("MCTruthGen_%s;", sig->GetName()); // TODO: Add these names to a std::vector to avoid using Form in the process function
-        } else if (sig->GetNProngs() == 2) {                   // NOTE: 2-prong signals required
+          genHistNames.push_back(Form("MCTruthGen_%s", sig->GetName()));
+          histNames += Form("%s;", genHistNames.back().Data());
+        } else if (sig->GetNProngs() == 2) { // NOTE: 2-prong signals required
           fGenMCSignals.push_back(*sig);
-          histNames += Form("MCTruthGenPair_%s;", sig->GetName());
+          genHistNames.push_back(Form("MCTruthGenPair_%s", sig->GetName()));
+          histNames += Form("%s;", genHistNames.back().Data());
         }
       }
     }
@@ -720,6 +753,26 @@ struct AnalysisSameEventPairing {
     DefineHistograms(fHistMan, histNames.Data());    // define all histograms
     VarManager::SetUseVars(fHistMan->GetUsedVars()); // provide the list of required variables so that VarManager knows what to fill
     fOutputList.setObject(fHistMan->GetMainHistogramList());
+
+    fBarrelHistHandles = getPairHistHandles(fBarrelHistNames);
+    fBarrelHistHandlesMCmatched = getPairHistHandles(fBarrelHistNamesMCmatched);
+    fMuonHistHandles = getPairHistHandles(fMuonHistNames);
+    fMuonHistHandlesMCmatched = getPairHistHandles(fMuonHistNamesMCmatched);
+    fBarrelMuonHistHandles = getPairHistHandles(fBarrelMuonHistNames);
+    fBarrelMuonHistHandlesMCmatched = getPairHistHandles(fBarrelMuonHistNamesMCmatched);
+    fGenHistHandles = GetHistClassHandles(fHistMan, genHistNames);
+  }
+
+  std::vector<std::vector<int>> getPairHistHandles(const std::vector<std::vector<TString>>& histNames)
+  {
+    std::vector<std::vector<int>> handles;
+    for (const auto& names : histNames) {
+      std::vector<int> cutHandles = GetHistClassHandles(fHistMan, names);
+      std::vector<int> unambiguousHandles = GetHistClassHandles(fHistMan, names, "_unambiguous");
+      cutHandles.insert(cutHandles.end(), unambiguousHandles.begin(), unambiguousHandles.end());
+      handles.push_back(cutHandles);
+    }
+    return handles;
   }
 
   template <int TPairType, uint32_t TEventFillMap, uint32_t TEventMCFillMap, uint32_t TTrackFillMap, typename TEvent, typename TTracks1, typename TTracks2, typename TEventsMC, typename TTracksMC>
@@ -751,19 +804,10 @@ struct AnalysisSameEventPairing {
     }
 
     // establish the right histogram classes to be filled depending on TPairType (ee,mumu,emu)
-    unsigned int ncuts = fBarrelHistNames.size();
-    std::vector<std::vector<TString>> histNames = fBarrelHistNames;
-    std::vector<std::vector<TString>> histNamesMCmatched = fBarrelHistNamesMCmatched;
-    if constexpr (TPairType == VarManager::kDecayToMuMu) {
-      ncuts = fMuonHistNames.size();
-      histNames = fMuonHistNames;
-      histNamesMCmatched = fMuonHistNamesMCmatched;
-    }
-    if constexpr (TPairType == VarManager::kElectronMuon) {
-      ncuts = fBarrelMuonHistNames.size();
-      histNames = fBarrelMuonHistNames;
-      histNamesMCmatched = fBarrelMuonHistNamesMCmatched;
-    }
+    const auto& histHandles = TPairType == VarManager::kDecayToMuMu ? fMuonHistHandles : (TPairType == VarManager::kElectronMuon ? fBarrelMuonHistHandles : fBarrelHistHandles);
+    const auto& histHandlesMCmatched = TPairType == VarManager::kDecayToMuMu ? fMuonHistHandlesMCmatched : (TPairType == VarManager::kElectronMuon ? fBarrelMuonHistHandlesMCmatched : fBarrelHistHandlesMCmatched);
+    unsigned int ncuts = histHandles.size();
+    const unsigned int nRecSignals = fRecMCSignals.size();
 
     // Loop over two track combinations
     uint8_t twoTrackFilter = 0;
@@ -878,28 +922,28 @@ struct AnalysisSameEventPairing {
       for (unsigned int icut = 0; icut < ncuts; icut++) {
         if (twoTrackFilter & (uint8_t(1) << icut)) {
           if (t1.sign() * t2.sign() < 0) {
-            fHistMan->FillHistClass(histNames[icut][0].Data(), VarManager::fgValues);
+            fHistMan->FillHistClass(histHandles[icut][0], VarManager::fgValues);
             if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-              fHistMan->FillHistClass(Form("%s_unambiguous", histNames[icut][0].Data()), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[icut][3], VarManager::fgValues);
             }
-            for (unsigned int isig = 0; isig < fRecMCSignals.size(); isig++) {
+            for (unsigned int isig = 0; isig < nRecSignals; isig++) {
               if (mcDecision & (static_cast<uint32_t>(1) << isig)) {
-                fHistMan->FillHistClass(histNamesMCmatched[icut][isig].Data(), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandlesMCmatched[icut][isig], VarManager::fgValues);
                 if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                  fHistMan->FillHistClass(Form("%s_unambiguous", histNamesMCmatched[icut][isig].Data()), VarManager::fgValues);
+                  fHistMan->FillHistClass(histHandlesMCmatched[icut][nRecSignals + isig], VarManager::fgValues);
                 }
               }
             }
           } else {
             if (t1.sign() > 0) {
-              fHistMan->FillHistClass(histNames[icut][1].Data(), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[icut][1], VarManager::fgValues);
               if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                fHistMan->FillHistClass(Form("%s_unambiguous", histNames[icut][1].Data()), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[icut][4], VarManager::fgValues);
               }
             } else {
-              fHistMan->FillHistClass(histNames[icut][2].Data(), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[icut][2], VarManager::fgValues);
               if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                fHistMan->FillHistClass(Form("%s_unambiguous", histNames[icut][2].Data()), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[icut][5], VarManager::fgValues);
               }
             }
           }
@@ -919,7 +963,8 @@ struct AnalysisSameEventPairing {
       // NOTE: Signals are checked here mostly based on the skimmed MC stack, so depending on the requested signal, the stack could be incomplete.
       // NOTE: However, the working model is that the decisions on MC signals are precomputed during skimming and are stored in the mcReducedFlags member.
       // TODO:  Use the mcReducedFlags to select signals
-      for (auto& sig : fGenMCSignals) {
+      for (unsigned int isig = 0; isig < fGenMCSignals.size(); isig++) {
+        auto& sig = fGenMCSignals[isig];
         if (sig.GetNProngs() != 1) { // NOTE: 1-prong signals required
           continue;
         }
@@ -931,13 +976,14 @@ struct AnalysisSameEventPairing {
           checked = sig.CheckSignal(false, mctrack);
         }
         if (checked) {
-          fHistMan->FillHistClass(Form("MCTruthGen_%s", sig.GetName()), VarManager::fgValues);
+          fHistMan->FillHistClass(fGenHistHandles[isig], VarManager::fgValues);
         }
       }
     }
 
     //    // loop over mc stack and fill histograms for pure MC truth signals
-    for (auto& sig : fGenMCSignals) {
+    for (unsigned int isig = 0; isig < fGenMCSignals.size(); isig++) {
+      auto& sig = fGenMCSignals[isig];
       if (sig.GetNProngs() != 2) { // NOTE: 2-prong signals required
         continue;
       }
@@ -952,7 +998,7 @@ struct AnalysisSameEventPairing {
         }
         if (checked) {
           VarManager::FillPairMC<VarManager::kDecayToEE>(t1, t2);
-          fHistMan->FillHistClass(Form("MCTruthGenPair_%s", sig.GetName()), VarManager::fgValues);
+          fHistMan->FillHistClass(fGenHistHandles[isig], VarManager::fgValues);
         }
       }
     } // end of true pairing loop
@@ -1079,6 +1125,13 @@ struct AnalysisDileptonTrack {
   std::vector<std::vector<TString>> fMuonHistNamesMCmatched;
   std::vector<TString> fRecMCSignalsNames;
 
+  // fill handles of the histogram classes, the MC matched ones are given for each reconstructed MC signal
+  int fHistDileptons = HistogramManager::kNothing;
+  int fHistDileptonTrack = HistogramManager::kNothing;
+  std::vector<int> fHistDileptonsMCmatched;
+  std::vector<int> fHistDileptonTrackMCmatched;
+  std::vector<int> fGenHistHandles; // one per generator level MC signal
+
   std::vector<MCSignal> fRecMCSignals;
   std::vector<MCSignal> fGenMCSignals;
 
@@ -1155,15 +1208,16 @@ struct AnalysisDileptonTrack {
       }
 
       // Add histogram classes for each specified MCsignal at the generator level
-      // TODO: create a std::vector of hist classes to be used at Fill time, to avoid using Form in the process function
       TString sigGenNamesStr = fConfigMCGenSignals.value;
       std::unique_ptr<TObjArray> objGenSigArray(sigGenNamesStr.Tokenize(","));
+      std::vector<TString> genHistNames;
       for (int isig = 0; isig < objGenSigArray->GetEntries(); isig++) {
         MCSignal* sig = o2::aod::dqmcsignals::GetMCSignal(objGenSigArray->At(isig)->GetName());
         if (sig) {
           if (sig->GetNProngs() == 1) { // NOTE: 1-prong signals required
             fGenMCSignals.push_back(*sig);
-            histNames += Form("MCTruthGen_%s;", sig->GetName()); // TODO: Add these names to a std::vector to avoid using Form in the process function
+            genHistNames.push_back(Form("MCTruthGen_%s", sig->GetName()));
+            histNames += Form("%s;", genHistNames.back().Data());
           }
         }
       }
@@ -1171,6 +1225,14 @@ struct AnalysisDileptonTrack {
       DefineHistograms(fHistMan, histNames.Data()); // define all histograms
       VarManager::SetUseVars(fHistMan->GetUsedVars());
       fOutputList.setObject(fHistMan->GetMainHistogramList());
+
+      fHistDileptons = fHistMan->GetHistClassHandle("DileptonsSelected");
+      fHistDileptonTrack = fHistMan->GetHistClassHandle("DileptonTrackInvMass");
+      for (const auto& sigName : fRecMCSignalsNames) {
+        fHistDileptonsMCmatched.push_back(fHistMan->GetHistClassHandle(Form("DileptonsSelected_matchedMC_%s", sigName.Data())));
+        fHistDileptonTrackMCmatched.push_back(fHistMan->GetHistClassHandle(Form("DileptonTrackInvMass_matchedMC_%s", sigName.Data())));
+      }
+      fGenHistHandles = GetHistClassHandles(fHistMan, genHistNames);
     }
 
     TString configCutNamesStr = fConfigTrackCuts.value;
@@ -1226,7 +1288,7 @@ struct AnalysisDileptonTrack {
       }
 
       VarManager::FillTrack<fgDileptonFillMap>(dilepton, fValuesDilepton);
-      fHistMan->FillHistClass("DileptonsSelected", fValuesDilepton);
+      fHistMan->FillHistClass(fHistDileptons, fValuesDilepton);
 
       auto lepton1MC = lepton1.reducedMCTrack();
       auto lepton2MC = lepton2.reducedMCTrack();
@@ -1244,7 +1306,7 @@ struct AnalysisDileptonTrack {
 
       for (unsigned int isig = 0; isig < fRecMCSignals.size(); isig++) {
         if (mcDecision & (static_cast<uint32_t>(1) << isig)) {
-          fHistMan->FillHistClass(Form("DileptonsSelected_matchedMC_%s", fRecMCSignalsNames[isig].Data()), fValuesDilepton);
+          fHistMan->FillHistClass(fHistDileptonsMCmatched[isig], fValuesDilepton);
         }
       }
 
@@ -1262,7 +1324,7 @@ struct AnalysisDileptonTrack {
 
         VarManager::FillDileptonHadron(dilepton, track, fValuesTrack);
         VarManager::FillDileptonTrackVertexing<TCandidateType, TEventFillMap, TTrackFillMap>(event, lepton1, lepton2, track, fValuesTrack);
-        fHistMan->FillHistClass("DileptonTrackInvMass", fValuesTrack);
+        fHistMan->FillHistClass(fHistDileptonTrack, fValuesTrack);
 
         mcDecision = 0;
         isig = 0;
@@ -1280,7 +1342,7 @@ struct AnalysisDileptonTrack {
 
         for (unsigned int isig = 0; isig < fRecMCSignals.size(); isig++) {
           if (mcDecision & (static_cast<uint32_t>(1) << isig)) {
-            fHistMan->FillHistClass(Form("DileptonTrackInvMass_matchedMC_%s", fRecMCSignalsNames[isig].Data()), fValuesTrack);
+            fHistMan->FillHistClass(fHistDileptonTrackMCmatched[isig], fValuesTrack);
           }
         }
       }
@@ -1298,7 +1360,8 @@ struct AnalysisDileptonTrack {
       // NOTE: Signals are checked here mostly based on the skimmed MC stack, so depending on the requested signal, the stack could be incomplete.
       // NOTE: However, the working model is that the decisions on MC signals are precomputed during skimming and are stored in the mcReducedFlags member.
       // TODO:  Use the mcReducedFlags to select signals
-      for (auto& sig : fGenMCSignals) {
+      for (unsigned int isig = 0; isig < fGenMCSignals.size(); isig++) {
+        auto& sig = fGenMCSignals[isig];
         if (sig.GetNProngs() != 1) { // NOTE: 1-prong signals required
           continue;
         }
@@ -1310,7 +1373,7 @@ struct AnalysisDileptonTrack {
           checked = sig.CheckSignal(false, mctrack);
         }
         if (checked) {
-          fHistMan->FillHistClass(Form("MCTruthGen_%s", sig.GetName()), VarManager::fgValues);
+          fHistMan->FillHistClass(fGenHistHandles[isig], VarManager::fgValues);
         }
       }
     }
@@ -1371,6 +1434,10 @@ struct AnalysisDileptonTrackTrack {
   float* fValuesQuadruplet;
 
   std::vector<TString> fQuadrupletCutNames;
+  // fill handles for each quadruplet cut: SEPM, SEMP, SEPP, SEMM and one per reconstructed MC signal
+  std::vector<std::array<int, 4>> fHistQuadruplets;
+  std::vector<std::vector<int>> fHistQuadrupletsMCRec;
+  std::vector<int> fGenHistHandles; // one per generator level MC signal
   AnalysisCompositeCut fDileptonCut;
   std::vector<AnalysisCompositeCut> fQuadrupletCuts;
   TString fTrackCutName1;
@@ -1456,12 +1523,14 @@ struct AnalysisDileptonTrackTrack {
     // Genarate MC signals
     TString sigGenNamesStr = fConfigMCGenSignals.value;
     std::unique_ptr<TObjArray> objGenSigArray(sigGenNamesStr.Tokenize(","));
+    std::vector<TString> genHistNames;
     for (int isig = 0; isig < objGenSigArray->GetEntries(); isig++) {
       MCSignal* sig = o2::aod::dqmcsignals::GetMCSignal(objGenSigArray->At(isig)->GetName());
       if (sig) {
         if (sig->GetNProngs() == 1) { // NOTE: 1-prong signals required
           fGenMCSignals.push_back(*sig);
-          histNames += Form("MCTruthGenQuad_%s;", sig->GetName()); // TODO: Add these names to a std::vector to avoid using Form in the process function
+          genHistNames.push_back(Form("MCTruthGenQuad_%s", sig->GetName()));
+          histNames += Form("%s;", genHistNames.back().Data());
         }
       }
     }
@@ -1470,6 +1539,20 @@ struct AnalysisDileptonTrackTrack {
     VarManager::SetUseVars(fHistMan->GetUsedVars());
     fOutputList.setObject(fHistMan->GetMainHistogramList());
 
+    for (const auto& cutName : fQuadrupletCutNames) {
+      fHistQuadruplets.push_back({fHistMan->GetHistClassHandle(Form("QuadrupletSEPM_%s", cutName.Data())),
+                                  fHistMan->GetHistClassHandle(Form("QuadrupletSEMP_%s", cutName.Data())),
+                                  fHistMan->GetHistClassHandle(Form("QuadrupletSEPP_%s", cutName.Data())),
+                                  fHistMan->GetHistClassHandle(Form("QuadrupletSEMM_%s", cutName.Data()))});
+      // NOTE: the MC matched classes are indexed like fRecMCSignals; signals without a class name get the kNothing handle
+      std::vector<int> mcRecHandles(fRecMCSignals.size(), HistogramManager::kNothing);
+      for (std::size_t isig = 0; isig < mcRecHandles.size() && isig < fRecMCSignalsNames.size(); isig++) {
+        mcRecHandles[isig] = fHistMan->GetHistClassHandle(Form("MCTruthRecQuad_%s_%s", cutName.Data(), fRecMCSignalsNames[isig].Data()));
+      }
+      fHistQuadrupletsMCRec.push_back(mcRecHandles);
+    }
+    fGenHistHandles = GetHistClassHandles(fHistMan, genHistNames);
+
     // dilepton MC signal
     TString configDileptonMCRecSignalStr = fConfigDileptonMCRecSignal.value;
     std::unique_ptr<TObjArray> objDileptonMCRecSignalArray(configDileptonMCRecSignalStr.Tokenize(","));
@@ -1562,19 +1645,19 @@ struct AnalysisDileptonTrackTrack {
             CutDecision |= (static_cast<uint32_t>(1) << iCut);
             if (fIsSameTrackCut) {
               if (t1.sign() * t2.sign() < 0) {
-                fHistMan->FillHistClass(Form("QuadrupletSEPM_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+                fHistMan->FillHistClass(fHistQuadruplets[iCut][0], fValuesQuadruplet);
               }
             } else {
               if ((t1.sign() < 0) && (t2.sign() > 0)) {
-                fHistMan->FillHistClass(Form("QuadrupletSEMP_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+                fHistMan->FillHistClass(fHistQuadruplets[iCut][1], fValuesQuadruplet);
               } else if ((t1.sign() > 0) && (t2.sign() < 0)) {
-                fHistMan->FillHistClass(Form("QuadrupletSEPM_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+                fHistMan->FillHistClass(fHistQuadruplets[iCut][0], fValuesQuadruplet);
               }
             }
             if ((t1.sign() > 0) && (t2.sign() > 0)) {
-              fHistMan->FillHistClass(Form("QuadrupletSEPP_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+              fHistMan->FillHistClass(fHistQuadruplets[iCut][2], fValuesQuadruplet);
             } else if ((t1.sign() < 0) && (t2.sign() < 0)) {
-              fHistMan->FillHistClass(Form("QuadrupletSEMM_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+              fHistMan->FillHistClass(fHistQuadruplets[iCut][3], fValuesQuadruplet);
             }
 
             // Reco MC signals
@@ -1587,7 +1670,7 @@ struct AnalysisDileptonTrackTrack {
               }
               for (unsigned int isig = 0; isig < fRecMCSignals.size(); isig++) {
                 if (mcDecision & (static_cast<uint32_t>(1) << isig)) {
-                  fHistMan->FillHistClass(Form("MCTruthRecQuad_%s_%s", fQuadrupletCutNames[iCut].Data(), fRecMCSignalsNames[isig].Data()), fValuesQuadruplet);
+                  fHistMan->FillHistClass(fHistQuadrupletsMCRec[iCut][isig], fValuesQuadruplet);
                 }
               }
             }
@@ -1618,7 +1701,8 @@ struct AnalysisDileptonTrackTrack {
     // loop over mc stack and fill histograms for pure MC truth signals
     for (auto& track : mcTracks) {
       VarManager::FillTrackMC(mcTracks, track);
-      for (auto& sig : fGenMCSignals) {
+      for (unsigned int isig = 0; isig < fGenMCSignals.size(); isig++) {
+        auto& sig = fGenMCSignals[isig];
         if (sig.CheckSignal(true, track)) {
           int daughterIdFirst = track.daughtersIds()[0];
           int daughterIdEnd = track.daughtersIds()[1];
@@ -1629,7 +1713,7 @@ struct AnalysisDileptonTrackTrack {
             auto track2 = mcTracks.rawIteratorAt(daughterIdFirst + 2);
             VarManager::FillQuadMC<TCandidateType>(dilepton, track1, track2);
           }
-          fHistMan->FillHistClass(Form("MCTruthGenQuad_%s", sig.GetName()), VarManager::fgValues);
+          fHistMan->FillHistClass(fGenHistHandles[isig], VarManager::fgValues);
         }
       }
     }
@@ -1665,6 +1749,20 @@ WorkflowSpec defineDataProcessing(ConfigContext const& cfgc)
     adaptAnalysisTask<AnalysisDileptonTrackTrack>(cfgc)};
 }
 
+std::vector<int> GetHistClassHandles(HistogramManager* histMan, const std::vector<TString>& histClasses, const char* suffix)
+{
+  //
+  // resolve the histogram classes once, such that no class name is composed or looked up in the process functions
+  // NOTE: classes which are not defined (e.g. the "_unambiguous" ones if not requested) get the kNothing handle and are not filled
+  //
+  std::vector<int> handles;
+  handles.reserve(histClasses.size());
+  for (const auto& histClass : histClasses) {
+    handles.push_back(histMan->GetHistClassHandle(Form("%s%s", histClass.Data(), suffix)));
+  }
+  return handles;
+}
+
 void DefineHistograms(HistogramManager* histMan, TString histClasses)
 {
   //
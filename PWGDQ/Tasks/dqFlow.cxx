@@ -505,9 +505,9 @@ struct DQEventQvector {
 
     if (fGFW && (tracks1.size() > 0)) {
       // Obtain the GFWCumulant where Q is calculated (index=region, with different eta gaps)
-      GFWCumulant gfwCumN = fGFW->GetCumulant(0);
-      GFWCumulant gfwCumP = fGFW->GetCumulant(1);
-      GFWCumulant gfwCumFull = fGFW->GetCumulant(2);
+      const GFWCumulant& gfwCumN = fGFW->GetCumulant(0);
+      const GFWCumulant& gfwCumP = fGFW->GetCumulant(1);
+      const GFWCumulant& gfwCumFull = fGFW->GetCumulant(2);
 
       // S(1,0) for event multiplicity
       S10N = gfwCumN.Vec(0, 0).real();
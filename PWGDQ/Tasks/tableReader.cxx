@@ -13,6 +13,7 @@
 //
 #include "PWGDQ/Core/AnalysisCompositeCut.h"
 #include "PWGDQ/Core/AnalysisCut.h"
+#include "PWGDQ/Core/AnalysisCutProgram.h"
 #include "PWGDQ/Core/CutsLibrary.h"
 #include "PWGDQ/Core/DQMlResponse.h"
 #include "PWGDQ/Core/HistogramManager.h"
@@ -46,6 +47,7 @@
 
 #include <RtypesCore.h>
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -159,6 +161,8 @@ constexpr static int pairTypeEMu = VarManager::kElectronMuon;
 
 // Global function used to define needed histogram classes
 void DefineHistograms(HistogramManager* histMan, TString histClasses, Configurable<std::string> configVar); // defines histograms for all tasks
+// Global function used to get the fill handles of the pair histogram classes, for each cut: PM, PP, MM and their "_unambiguous" versions
+std::vector<std::vector<int>> GetPairHistHandles(HistogramManager* histMan, const std::vector<std::vector<TString>>& histNames);
 
 struct AnalysisEventSelection {
   Produces<aod::EventCuts> eventSel;
@@ -179,6 +183,8 @@ struct AnalysisEventSelection {
   MixingHandler* fMixHandler = nullptr;
   AnalysisCompositeCut* fEventCut;
   int fLastRun;
+  int fHistBeforeCuts = HistogramManager::kNothing; // fill handle of the histograms before the event cuts
+  int fHistAfterCuts = HistogramManager::kNothing;  // fill handle of the histograms after the event cuts
 
   Service<o2::ccdb::BasicCCDBManager> fCCDB;
 
@@ -201,6 +207,8 @@ struct AnalysisEventSelection {
       DefineHistograms(fHistMan, "Event_BeforeCuts;Event_AfterCuts;", fConfigAddEventHistogram); // define all histograms
       VarManager::SetUseVars(fHistMan->GetUsedVars());                                           // provide the list of required variables so that VarManager knows what to fill
       fOutputList.setObject(fHistMan->GetMainHistogramList());
+      fHistBeforeCuts = fHistMan->GetHistClassHandle("Event_BeforeCuts");
+      fHistAfterCuts = fHistMan->GetHistClassHandle("Event_AfterCuts");
     }
 
     TString mixVarsString = fConfigMixingVariables.value;
@@ -248,13 +256,13 @@ struct AnalysisEventSelection {
     VarManager::FillEvent<TEventFillMap>(event);
     // TODO: make this condition at compile time
     if (fConfigQA) {
-      fHistMan->FillHistClass("Event_BeforeCuts", VarManager::fgValues); // automatically fill all the histograms in the class Event
+      fHistMan->FillHistClass(fHistBeforeCuts, VarManager::fgValues); // automatically fill all the histograms in the class Event
     }
 
     if (!fConfigRunZorro) {
       if (fEventCut->IsSelected(VarManager::fgValues)) {
         if (fConfigQA) {
-          fHistMan->FillHistClass("Event_AfterCuts", VarManager::fgValues);
+          fHistMan->FillHistClass(fHistAfterCuts, VarManager::fgValues);
         }
         eventSel(1);
       } else {
@@ -263,7 +271,7 @@ struct AnalysisEventSelection {
     } else {
       if (fEventCut->IsSelected(VarManager::fgValues) && event.tag_bit(56)) { // This is the bit used for the software trigger event selections [TO BE DONE: find a more clear way to use it]
         if (fConfigQA) {
-          fHistMan->FillHistClass("Event_AfterCuts", VarManager::fgValues);
+          fHistMan->FillHistClass(fHistAfterCuts, VarManager::fgValues);
         }
         eventSel(1);
       } else {
@@ -342,11 +350,16 @@ struct AnalysisTrackSelection {
   Configurable<int64_t> fConfigNoLaterThan{"ccdb-no-later-than", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count(), "latest acceptable timestamp of creation for the object"};
   Configurable<bool> fConfigComputeTPCpostCalib{"cfgTPCpostCalib", false, "If true, compute TPC post-calibrated n-sigmas"};
   Configurable<std::string> fConfigRunPeriods{"cfgRunPeriods", "LHC22f", "run periods for used data"};
+  Configurable<bool> fConfigUseCutProgram{"cfgUseCutProgram", false, "If true, evaluate the track cuts in batches with AnalysisCutProgram (not used when QA histograms are filled)"};
 
   Service<o2::ccdb::BasicCCDBManager> fCCDB;
 
   HistogramManager* fHistMan;
   std::vector<AnalysisCompositeCut> fTrackCuts;
+  AnalysisCutProgram fCutProgram;  // compiled track cuts, evaluated on all the tracks of an event at once
+  std::vector<uint64_t> fCutMasks; // decisions of the compiled cuts, one mask per track
+  int fHistBeforeCuts = HistogramManager::kNothing; // fill handle of the histograms before the track cuts
+  std::vector<int> fHistCuts;                       // fill handles of the histograms of each track cut
 
   int fCurrentRun; // needed to detect if the run changed and trigger update of calibrations etc.
 
@@ -370,6 +383,14 @@ struct AnalysisTrackSelection {
 
     VarManager::SetUseVars(AnalysisCut::fgUsedVars); // provide the list of required variables so that VarManager knows what to fill
 
+    if (fConfigUseCutProgram && !fConfigQA) {
+      std::vector<AnalysisCut*> cuts;
+      for (auto& cut : fTrackCuts) {
+        cuts.push_back(&cut);
+      }
+      fCutProgram.Compile(cuts);
+    }
+
     if (fConfigQA) {
       VarManager::SetDefaultVarNames();
       fHistMan = new HistogramManager("analysisHistos", "aa", VarManager::kNVars);
@@ -385,6 +406,10 @@ struct AnalysisTrackSelection {
       DefineHistograms(fHistMan, histDirNames.Data(), fConfigAddTrackHistogram); // define all histograms
       VarManager::SetUseVars(fHistMan->GetUsedVars());                           // provide the list of required variables so that VarManager knows what to fill
       fOutputList.setObject(fHistMan->GetMainHistogramList());
+      fHistBeforeCuts = fHistMan->GetHistClassHandle("TrackBarrel_BeforeCuts");
+      for (auto& cut : fTrackCuts) {
+        fHistCuts.push_back(fHistMan->GetHistClassHandle(Form("TrackBarrel_%s", cut.GetName())));
+      }
     }
     if (fConfigComputeTPCpostCalib) {
       // CCDB configuration
@@ -424,12 +449,39 @@ struct AnalysisTrackSelection {
     bool prefilterSelected = false;
     int iCut = 0;
 
+    if (fConfigUseCutProgram && !fConfigQA) {
+      // fill the variables of all the tracks first, then evaluate all the cuts at once
+      for (auto& track : tracks) {
+        VarManager::FillTrack<TTrackFillMap>(track);
+        fCutProgram.AddCandidate(VarManager::fgValues);
+      }
+      fCutMasks.resize(fCutProgram.GetNCandidates());
+      fCutProgram.Evaluate(fCutMasks.data());
+      fCutProgram.Clear();
+      for (const auto& mask : fCutMasks) {
+        filterMap = 0;
+        prefilterSelected = false;
+        for (iCut = 0; iCut < fCutProgram.GetNCuts(); iCut++) {
+          if (mask & (static_cast<uint64_t>(1) << iCut)) {
+            if (iCut != fConfigPrefilterCutId) {
+              filterMap |= (static_cast<uint32_t>(1) << iCut);
+            }
+            if (iCut == fConfigPrefilterCutId) {
+              prefilterSelected = true;
+            }
+          }
+        }
+        trackSel(static_cast<int>(filterMap), static_cast<int>(prefilterSelected));
+      }
+      return;
+    }
+
     for (auto& track : tracks) {
       filterMap = 0;
       prefilterSelected = false;
       VarManager::FillTrack<TTrackFillMap>(track);
       if (fConfigQA) { // TODO: make this compile time
-        fHistMan->FillHistClass("TrackBarrel_BeforeCuts", VarManager::fgValues);
+        fHistMan->FillHistClass(fHistBeforeCuts, VarManager::fgValues);
       }
       iCut = 0;
       for (auto cut = fTrackCuts.begin(); cut != fTrackCuts.end(); cut++, iCut++) {
@@ -441,7 +493,7 @@ struct AnalysisTrackSelection {
             prefilterSelected = true;
           }
           if (fConfigQA) { // TODO: make this compile time
-            fHistMan->FillHistClass(Form("TrackBarrel_%s", (*cut).GetName()), VarManager::fgValues);
+            fHistMan->FillHistClass(fHistCuts[iCut], VarManager::fgValues);
           }
         }
       }
@@ -477,6 +529,8 @@ struct AnalysisMuonSelection {
 
   HistogramManager* fHistMan;
   std::vector<AnalysisCompositeCut> fMuonCuts;
+  int fHistBeforeCuts = HistogramManager::kNothing; // fill handle of the histograms before the muon cuts
+  std::vector<int> fHistCuts;                       // fill handles of the histograms of each muon cut
 
   Filter filterEventSelected = aod::dqanalysisflags::isEventSelected == 1;
 
@@ -512,6 +566,10 @@ struct AnalysisMuonSelection {
       DefineHistograms(fHistMan, histDirNames.Data(), fConfigAddMuonHistogram); // define all histograms
       VarManager::SetUseVars(fHistMan->GetUsedVars());                          // provide the list of required variables so that VarManager knows what to fill
       fOutputList.setObject(fHistMan->GetMainHistogramList());
+      fHistBeforeCuts = fHistMan->GetHistClassHandle("TrackMuon_BeforeCuts");
+      for (auto& cut : fMuonCuts) {
+        fHistCuts.push_back(fHistMan->GetHistClassHandle(Form("TrackMuon_%s", cut.GetName())));
+      }
     }
   }
 
@@ -550,7 +608,7 @@ struct AnalysisMuonSelection {
       filterMap = 0;
       VarManager::FillTrack<TMuonFillMap>(muon);
       if (fConfigQA) { // TODO: make this compile time
-        fHistMan->FillHistClass("TrackMuon_BeforeCuts", VarManager::fgValues);
+        fHistMan->FillHistClass(fHistBeforeCuts, VarManager::fgValues);
       }
 
       iCut = 0;
@@ -558,7 +616,7 @@ struct AnalysisMuonSelection {
         if ((*cut).IsSelected(VarManager::fgValues)) {
           filterMap |= (static_cast<uint32_t>(1) << iCut);
           if (fConfigQA) { // TODO: make this compile time
-            fHistMan->FillHistClass(Form("TrackMuon_%s", (*cut).GetName()), VarManager::fgValues);
+            fHistMan->FillHistClass(fHistCuts[iCut], VarManager::fgValues);
           }
         }
       }
@@ -728,6 +786,9 @@ struct AnalysisEventMixing {
   std::vector<std::vector<TString>> fTrackHistNames;
   std::vector<std::vector<TString>> fMuonHistNames;
   std::vector<std::vector<TString>> fTrackMuonHistNames;
+  std::vector<std::vector<int>> fTrackHistHandles; // fill handles of the histogram classes in fTrackHistNames
+  std::vector<std::vector<int>> fMuonHistHandles;
+  std::vector<std::vector<int>> fTrackMuonHistHandles;
 
   NoBinningPolicy<aod::dqanalysisflags::MixingHash> hashBin;
 
@@ -810,22 +871,17 @@ struct AnalysisEventMixing {
     dqhistograms::AddHistogramsFromJSON(fHistMan, fConfigAddJSONHistograms.value.c_str());
     VarManager::SetUseVars(fHistMan->GetUsedVars()); // provide the list of required variables so that VarManager knows what to fill
     fOutputList.setObject(fHistMan->GetMainHistogramList());
+    fTrackHistHandles = GetPairHistHandles(fHistMan, fTrackHistNames);
+    fMuonHistHandles = GetPairHistHandles(fHistMan, fMuonHistNames);
+    fTrackMuonHistHandles = GetPairHistHandles(fHistMan, fTrackMuonHistNames);
   }
 
   template <uint32_t TEventFillMap, int TPairType, typename TTracks1, typename TTracks2>
   void runMixedPairing(TTracks1 const& tracks1, TTracks2 const& tracks2)
   {
 
-    unsigned int ncuts = fTrackHistNames.size();
-    std::vector<std::vector<TString>> histNames = fTrackHistNames;
-    if constexpr (TPairType == pairTypeMuMu) {
-      ncuts = fMuonHistNames.size();
-      histNames = fMuonHistNames;
-    }
-    if constexpr (TPairType == pairTypeEMu) {
-      ncuts = fTrackMuonHistNames.size();
-      histNames = fTrackMuonHistNames;
-    }
+    const auto& histHandles = TPairType == pairTypeMuMu ? fMuonHistHandles : (TPairType == pairTypeEMu ? fTrackMuonHistHandles : fTrackHistHandles);
+    unsigned int ncuts = histHandles.size();
 
     uint32_t twoTrackFilter = 0;
     uint32_t mult_dimuons = 0;
@@ -865,20 +921,20 @@ struct AnalysisEventMixing {
         for (unsigned int icut = 0; icut < ncuts; icut++) {
           if (twoTrackFilter & (static_cast<uint32_t>(1) << icut)) {
             if (track1.sign() * track2.sign() < 0) {
-              fHistMan->FillHistClass(histNames[icut][0].Data(), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[icut][0], VarManager::fgValues);
               if (fConfigAmbiguousHist && !(track1.isAmbiguous() || track2.isAmbiguous())) {
-                fHistMan->FillHistClass(Form("%s_unambiguous", histNames[icut][0].Data()), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[icut][3], VarManager::fgValues);
               }
             } else {
               if (track1.sign() > 0) {
-                fHistMan->FillHistClass(histNames[icut][1].Data(), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[icut][1], VarManager::fgValues);
                 if (fConfigAmbiguousHist && !(track1.isAmbiguous() || track2.isAmbiguous())) {
-                  fHistMan->FillHistClass(Form("%s_unambiguous", histNames[icut][1].Data()), VarManager::fgValues);
+                  fHistMan->FillHistClass(histHandles[icut][4], VarManager::fgValues);
                 }
               } else {
-                fHistMan->FillHistClass(histNames[icut][2].Data(), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[icut][2], VarManager::fgValues);
                 if (fConfigAmbiguousHist && !(track1.isAmbiguous() || track2.isAmbiguous())) {
-                  fHistMan->FillHistClass(Form("%s_unambiguous", histNames[icut][2].Data()), VarManager::fgValues);
+                  fHistMan->FillHistClass(histHandles[icut][5], VarManager::fgValues);
                 }
               }
             }
@@ -1107,6 +1163,9 @@ struct AnalysisSameEventPairing {
   std::vector<std::vector<TString>> fTrackHistNames;
   std::vector<std::vector<TString>> fMuonHistNames;
   std::vector<std::vector<TString>> fTrackMuonHistNames;
+  std::vector<std::vector<int>> fTrackHistHandles; // fill handles of the histogram classes in fTrackHistNames
+  std::vector<std::vector<int>> fMuonHistHandles;
+  std::vector<std::vector<int>> fTrackMuonHistHandles;
   std::vector<AnalysisCompositeCut> fPairCuts;
 
   int64_t reserveSize = 0;
@@ -1313,6 +1372,9 @@ struct AnalysisSameEventPairing {
     dqhistograms::AddHistogramsFromJSON(fHistMan, fConfigAddJSONHistograms.value.c_str()); // ad-hoc histograms via JSON
     VarManager::SetUseVars(fHistMan->GetUsedVars());                                       // provide the list of required variables so that VarManager knows what to fill
     fOutputList.setObject(fHistMan->GetMainHistogramList());
+    fTrackHistHandles = GetPairHistHandles(fHistMan, fTrackHistNames);
+    fMuonHistHandles = GetPairHistHandles(fHistMan, fMuonHistNames);
+    fTrackMuonHistHandles = GetPairHistHandles(fHistMan, fTrackMuonHistNames);
   }
 
   // Template function to run same event pairing (barrel-barrel, muon-muon, barrel-muon)
@@ -1365,15 +1427,10 @@ struct AnalysisSameEventPairing {
     }
 
     TString cutNames = fConfigTrackCuts.value;
-    std::vector<std::vector<TString>> histNames = fTrackHistNames;
-    if constexpr (TPairType == pairTypeMuMu) {
+    if constexpr (TPairType == pairTypeMuMu || TPairType == pairTypeEMu) {
       cutNames = fConfigMuonCuts.value;
-      histNames = fMuonHistNames;
-    }
-    if constexpr (TPairType == pairTypeEMu) {
-      cutNames = fConfigMuonCuts.value;
-      histNames = fTrackMuonHistNames;
     }
+    const auto& histHandles = TPairType == pairTypeMuMu ? fMuonHistHandles : (TPairType == pairTypeEMu ? fTrackMuonHistHandles : fTrackHistHandles);
     std::unique_ptr<TObjArray> objArray(cutNames.Tokenize(","));
     int ncuts = objArray->GetEntries();
 
@@ -1606,9 +1663,9 @@ struct AnalysisSameEventPairing {
       for (int icut = 0; icut < ncuts; icut++) {
         if (twoTrackFilter & (static_cast<uint32_t>(1) << icut)) {
           if (t1.sign() * t2.sign() < 0) {
-            fHistMan->FillHistClass(histNames[iCut][0].Data(), VarManager::fgValues);
+            fHistMan->FillHistClass(histHandles[iCut][0], VarManager::fgValues);
             if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-              fHistMan->FillHistClass(Form("%s_unambiguous", histNames[iCut][0].Data()), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[iCut][3], VarManager::fgValues);
             }
             if (useMiniTree.fConfigMiniTree) {
               // By default (kPt1, kEta1, kPhi1) are for the positive charge
@@ -1628,14 +1685,14 @@ struct AnalysisSameEventPairing {
             }
           } else {
             if (t1.sign() > 0) {
-              fHistMan->FillHistClass(histNames[iCut][1].Data(), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[iCut][1], VarManager::fgValues);
               if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                fHistMan->FillHistClass(Form("%s_unambiguous", histNames[iCut][1].Data()), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[iCut][4], VarManager::fgValues);
               }
             } else {
-              fHistMan->FillHistClass(histNames[iCut][2].Data(), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[iCut][2], VarManager::fgValues);
               if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                fHistMan->FillHistClass(Form("%s_unambiguous", histNames[iCut][2].Data()), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[iCut][5], VarManager::fgValues);
               }
             }
           }
@@ -1645,20 +1702,20 @@ struct AnalysisSameEventPairing {
             if (!(cut.IsSelected(VarManager::fgValues))) // apply pair cuts
               continue;
             if (t1.sign() * t2.sign() < 0) {
-              fHistMan->FillHistClass(histNames[iCut][0].Data(), VarManager::fgValues);
+              fHistMan->FillHistClass(histHandles[iCut][0], VarManager::fgValues);
               if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                fHistMan->FillHistClass(Form("%s_unambiguous", histNames[iCut][0].Data()), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[iCut][3], VarManager::fgValues);
               }
             } else {
               if (t1.sign() > 0) {
-                fHistMan->FillHistClass(histNames[iCut][1].Data(), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[iCut][1], VarManager::fgValues);
                 if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                  fHistMan->FillHistClass(Form("%s_unambiguous", histNames[iCut][1].Data()), VarManager::fgValues);
+                  fHistMan->FillHistClass(histHandles[iCut][4], VarManager::fgValues);
                 }
               } else {
-                fHistMan->FillHistClass(histNames[iCut][2].Data(), VarManager::fgValues);
+                fHistMan->FillHistClass(histHandles[iCut][2], VarManager::fgValues);
                 if (fConfigAmbiguousHist && !(t1.isAmbiguous() || t2.isAmbiguous())) {
-                  fHistMan->FillHistClass(Form("%s_unambiguous", histNames[iCut][2].Data()), VarManager::fgValues);
+                  fHistMan->FillHistClass(histHandles[iCut][5], VarManager::fgValues);
                 }
               }
             }
@@ -1901,6 +1958,12 @@ struct AnalysisDileptonHadron {
   float* fValuesDilepton;
   float* fValuesHadron;
   HistogramManager* fHistMan;
+  // fill handles of the histogram classes
+  int fHistDileptons = HistogramManager::kNothing;
+  int fHistInvMass = HistogramManager::kNothing;
+  int fHistCorrelation = HistogramManager::kNothing;
+  int fHistInvMassME = HistogramManager::kNothing;
+  int fHistCorrelationME = HistogramManager::kNothing;
 
   // NOTE: the barrel track filter is shared between the filters for dilepton electron candidates (first n-bits)
   //       and the associated hadrons (n+1 bit) --> see the barrel track selection task
@@ -1934,6 +1997,11 @@ struct AnalysisDileptonHadron {
 
     VarManager::SetUseVars(fHistMan->GetUsedVars());
     fOutputList.setObject(fHistMan->GetMainHistogramList());
+    fHistDileptons = fHistMan->GetHistClassHandle("DileptonsSelected");
+    fHistInvMass = fHistMan->GetHistClassHandle("DileptonHadronInvMass");
+    fHistCorrelation = fHistMan->GetHistClassHandle("DileptonHadronCorrelationSE");
+    fHistInvMassME = fHistMan->GetHistClassHandle("DileptonHadronInvMassME");
+    fHistCorrelationME = fHistMan->GetHistClassHandle("DileptonHadronCorrelationME");
 
     TString configCutNamesStr = fConfigTrackCuts.value;
     if (!configCutNamesStr.IsNull()) {
@@ -1992,7 +2060,7 @@ struct AnalysisDileptonHadron {
     // loop once over dileptons for QA purposes
     for (auto dilepton : dileptons) {
       VarManager::FillTrack<fgDileptonFillMap>(dilepton, fValuesDilepton);
-      fHistMan->FillHistClass("DileptonsSelected", fValuesDilepton);
+      fHistMan->FillHistClass(fHistDileptons, fValuesDilepton);
 
       // get the index of the electron legs
       int indexLepton1 = dilepton.index0Id();
@@ -2031,8 +2099,8 @@ struct AnalysisDileptonHadron {
 
         VarManager::FillDileptonHadron(dilepton, hadron, fValuesHadron);
         // VarManager::FillDileptonTrackVertexing<TCandidateType, TEventFillMap, TTrackFillMap>(event, lepton1, lepton2, hadron, fValuesHadron);
-        fHistMan->FillHistClass("DileptonHadronInvMass", fValuesHadron);
-        fHistMan->FillHistClass("DileptonHadronCorrelationSE", fValuesHadron);
+        fHistMan->FillHistClass(fHistInvMass, fValuesHadron);
+        fHistMan->FillHistClass(fHistCorrelation, fValuesHadron);
         // table to be written out for ML analysis
         BmesonsTable(fValuesHadron[VarManager::kPairMass], fValuesHadron[VarManager::kPairPt], fValuesHadron[VarManager::kVertexingLxy], fValuesHadron[VarManager::kVertexingLxyz], fValuesHadron[VarManager::kVertexingLz], fValuesHadron[VarManager::kVertexingTauxy], fValuesHadron[VarManager::kVertexingTauz], fValuesHadron[VarManager::kCosPointingAngle], fValuesHadron[VarManager::kVertexingChi2PCA]);
       }
@@ -2070,8 +2138,8 @@ struct AnalysisDileptonHadron {
           }
 
           VarManager::FillDileptonHadron(dilepton, track, VarManager::fgValues);
-          fHistMan->FillHistClass("DileptonHadronInvMassME", VarManager::fgValues);
-          fHistMan->FillHistClass("DileptonHadronCorrelationME", VarManager::fgValues);
+          fHistMan->FillHistClass(fHistInvMassME, VarManager::fgValues);
+          fHistMan->FillHistClass(fHistCorrelationME, VarManager::fgValues);
         } // end for (track)
       } // end for (dilepton)
 
@@ -2119,6 +2187,8 @@ struct AnalysisDileptonTrackTrack {
   AnalysisCompositeCut fDileptonCut;
   std::vector<TString> fQuadrupletCutNames;
   std::vector<AnalysisCompositeCut> fQuadrupletCuts;
+  int fHistPairs = HistogramManager::kNothing;      // fill handle of the dilepton histograms
+  std::vector<std::array<int, 4>> fHistQuadruplets; // fill handles of the SEPM, SEMP, SEPP and SEMM histograms of each quadruplet cut
 
   void init(o2::framework::InitContext& context)
   {
@@ -2166,6 +2236,13 @@ struct AnalysisDileptonTrackTrack {
 
     VarManager::SetUseVars(fHistMan->GetUsedVars());
     fOutputList.setObject(fHistMan->GetMainHistogramList());
+    fHistPairs = fHistMan->GetHistClassHandle(Form("Pairs_%s", fDileptonCut.GetName()));
+    for (const auto& cutName : fQuadrupletCutNames) {
+      fHistQuadruplets.push_back({fHistMan->GetHistClassHandle(Form("QuadrupletSEPM_%s", cutName.Data())),
+                                  fHistMan->GetHistClassHandle(Form("QuadrupletSEMP_%s", cutName.Data())),
+                                  fHistMan->GetHistClassHandle(Form("QuadrupletSEPP_%s", cutName.Data())),
+                                  fHistMan->GetHistClassHandle(Form("QuadrupletSEMM_%s", cutName.Data()))});
+    }
   }
   // Template function to run pair - track - track combinations
   template <int TCandidateType, uint32_t TEventFillMap, uint32_t TTrackFillMap, typename TEvent, typename TTracks>
@@ -2203,7 +2280,7 @@ struct AnalysisDileptonTrackTrack {
       if (!fDileptonCut.IsSelected(fValuesQuadruplet))
         continue;
 
-      fHistMan->FillHistClass(Form("Pairs_%s", fDileptonCut.GetName()), fValuesQuadruplet);
+      fHistMan->FillHistClass(fHistPairs, fValuesQuadruplet);
 
       // get the index of the electron legs
       int indexLepton1 = dilepton.index0Id();
@@ -2249,19 +2326,19 @@ struct AnalysisDileptonTrackTrack {
             CutDecision |= (1 << iCut);
             if (fIsSameTrackCut) {
               if (t1.sign() * t2.sign() < 0) {
-                fHistMan->FillHistClass(Form("QuadrupletSEPM_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+                fHistMan->FillHistClass(fHistQuadruplets[iCut][0], fValuesQuadruplet);
               }
             } else {
               if ((t1.sign() < 0) && (t2.sign() > 0)) {
-                fHistMan->FillHistClass(Form("QuadrupletSEMP_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+                fHistMan->FillHistClass(fHistQuadruplets[iCut][1], fValuesQuadruplet);
               } else if ((t1.sign() > 0) && (t2.sign() < 0)) {
-                fHistMan->FillHistClass(Form("QuadrupletSEPM_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+                fHistMan->FillHistClass(fHistQuadruplets[iCut][0], fValuesQuadruplet);
               }
             }
             if ((t1.sign() > 0) && (t2.sign() > 0)) {
-              fHistMan->FillHistClass(Form("QuadrupletSEPP_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+              fHistMan->FillHistClass(fHistQuadruplets[iCut][2], fValuesQuadruplet);
             } else if ((t1.sign() < 0) && (t2.sign() < 0)) {
-              fHistMan->FillHistClass(Form("QuadrupletSEMM_%s", fQuadrupletCutNames[iCut].Data()), fValuesQuadruplet);
+              fHistMan->FillHistClass(fHistQuadruplets[iCut][3], fValuesQuadruplet);
             }
           }
         } // loop over dilepton-track-track cuts
@@ -2315,6 +2392,26 @@ WorkflowSpec defineDataProcessing(ConfigContext const& cfgc)
     adaptAnalysisTask<AnalysisDileptonTrackTrack>(cfgc)};
 }
 
+std::vector<std::vector<int>> GetPairHistHandles(HistogramManager* histMan, const std::vector<std::vector<TString>>& histNames)
+{
+  //
+  // resolve the pair histogram classes once, such that no class name is composed or looked up in the pairing loops
+  // NOTE: classes which are not defined (e.g. the "_unambiguous" ones if not requested) get the kNothing handle and are not filled
+  //
+  std::vector<std::vector<int>> handles;
+  for (const auto& names : histNames) {
+    std::vector<int> cutHandles;
+    for (const auto& name : names) {
+      cutHandles.push_back(histMan->GetHistClassHandle(name.Data()));
+    }
+    for (const auto& name : names) {
+      cutHandles.push_back(histMan->GetHistClassHandle(Form("%s_unambiguous", name.Data())));
+    }
+    handles.push_back(cutHandles);
+  }
+  return handles;
+}
+
 void DefineHistograms(HistogramManager* histMan, TString histClasses, Configurable<std::string> configVar)
 {
   //
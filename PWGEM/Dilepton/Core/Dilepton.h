@@ -569,6 +569,8 @@ struct Dilepton {
 
     used_trackIds_per_col.clear();
     used_trackIds_per_col.shrink_to_fit();
+    is_track_used.clear();
+    is_track_used.shrink_to_fit();
     map_mixed_eventId_to_globalBC.clear();
 
     delete h2sp_resolution;
@@ -1196,8 +1198,7 @@ struct Dilepton {
       std::pair<int, int> key_df_collision = std::make_pair(ndf, collision.globalIndex());
 
       if constexpr (pairtype == o2::aod::pwgem::dilepton::utils::pairutil::DileptonPairType::kDielectron) {
-        if (std::find(used_trackIds_per_col.begin(), used_trackIds_per_col.end(), t1.globalIndex()) == used_trackIds_per_col.end()) {
-          used_trackIds_per_col.emplace_back(t1.globalIndex());
+        if (markTrackAsUsed(t1.globalIndex())) {
           if (cfgDoMix) {
             if (t1.sign() > 0) {
               emh_pos->AddTrackToEventPool(key_df_collision, o2::aod::pwgem::dilepton::utils::EMTrack(t1.pt(), t1.eta(), t1.phi(), leptonM1, t1.sign(), t1.dcaXY(), t1.dcaZ(), t1.cYY(), t1.cZY(), t1.cZZ()));
@@ -1206,8 +1207,7 @@ struct Dilepton {
             }
           }
         }
-        if (std::find(used_trackIds_per_col.begin(), used_trackIds_per_col.end(), t2.globalIndex()) == used_trackIds_per_col.end()) {
-          used_trackIds_per_col.emplace_back(t2.globalIndex());
+        if (markTrackAsUsed(t2.globalIndex())) {
           if (cfgDoMix) {
             if (t2.sign() > 0) {
               emh_pos->AddTrackToEventPool(key_df_collision, o2::aod::pwgem::dilepton::utils::EMTrack(t2.pt(), t2.eta(), t2.phi(), leptonM2, t2.sign(), t2.dcaXY(), t2.dcaZ(), t2.cYY(), t2.cZY(), t2.cZZ()));
@@ -1217,8 +1217,7 @@ struct Dilepton {
           }
         }
       } else if (pairtype == o2::aod::pwgem::dilepton::utils::pairutil::DileptonPairType::kDimuon) {
-        if (std::find(used_trackIds_per_col.begin(), used_trackIds_per_col.end(), t1.globalIndex()) == used_trackIds_per_col.end()) {
-          used_trackIds_per_col.emplace_back(t1.globalIndex());
+        if (markTrackAsUsed(t1.globalIndex())) {
           if (cfgDoMix) {
             if (t1.sign() > 0) {
               emh_pos->AddTrackToEventPool(key_df_collision, o2::aod::pwgem::dilepton::utils::EMFwdTrack(t1.pt(), t1.eta(), t1.phi(), leptonM1, t1.sign(), t1.fwdDcaX(), t1.fwdDcaY(), t1.cXXatDCA(), t1.cXYatDCA(), t1.cYYatDCA()));
@@ -1227,8 +1226,7 @@ struct Dilepton {
             }
           }
         }
-        if (std::find(used_trackIds_per_col.begin(), used_trackIds_per_col.end(), t2.globalIndex()) == used_trackIds_per_col.end()) {
-          used_trackIds_per_col.emplace_back(t2.globalIndex());
+        if (markTrackAsUsed(t2.globalIndex())) {
           if (cfgDoMix) {
             if (t2.sign() > 0) {
               emh_pos->AddTrackToEventPool(key_df_collision, o2::aod::pwgem::dilepton::utils::EMFwdTrack(t2.pt(), t2.eta(), t2.phi(), leptonM2, t2.sign(), t2.fwdDcaX(), t2.fwdDcaY(), t2.cXXatDCA(), t2.cXYatDCA(), t2.cYYatDCA()));
@@ -1290,9 +1288,32 @@ struct Dilepton {
   std::map<std::pair<int, int>, uint64_t> map_mixed_eventId_to_globalBC;
   std::unordered_map<int, bool> map_best_match_globalmuon;
 
-  std::vector<int> used_trackIds_per_col;
+  std::vector<int> used_trackIds_per_col; // tracks stored for event mixing in the current collision
+  std::vector<bool> is_track_used;        // flag per track global index, reset at the end of each collision
   int ndf = 0;
 
+  // returns true if the track was not used in the current collision yet
+  bool markTrackAsUsed(int trackId)
+  {
+    if (trackId >= static_cast<int>(is_track_used.size())) {
+      is_track_used.resize(trackId + 1, false);
+    }
+    if (is_track_used[trackId]) {
+      return false;
+    }
+    is_track_used[trackId] = true;
+    used_trackIds_per_col.emplace_back(trackId);
+    return true;
+  }
+
+  void resetUsedTracks()
+  {
+    for (const auto& trackId : used_trackIds_per_col) {
+      is_track_used[trackId] = false;
+    }
+    used_trackIds_per_col.clear(); // keep the capacity for the next collisions
+  }
+
   template <bool isTriggerAnalysis, typename TCollisions, typename TLeptons, typename TPresilce, typename TCut, typename TAllTracks>
   void runPairing(TCollisions const& collisions, TLeptons const& posTracks, TLeptons const& negTracks, TPresilce const& perCollision, TCut const& cut, TAllTracks const& tracks)
   {
@@ -1431,8 +1452,7 @@ struct Dilepton {
           nlsmm++;
         }
       }
-      used_trackIds_per_col.clear();
-      used_trackIds_per_col.shrink_to_fit();
+      resetUsedTracks();
 
       if (!cfgDoMix || !(nuls > 0 || nlspp > 0 || nlsmm > 0)) {
         continue;
@@ -1576,11 +1596,23 @@ struct Dilepton {
   }
 
   std::map<std::pair<int, int>, float> map_weight; // <posId, negId> -> float
+  std::vector<std::pair<int, int>> passed_pairIds; // pairs passing the cuts in the current DF
+  std::vector<uint64_t> passed_pairKeys;           // sorted keys of passed_pairIds, for the lookup of ambiguous pairs
+
+  static uint64_t getPairKey(int trackId1, int trackId2)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(trackId1)) << 32) | static_cast<uint32_t>(trackId2);
+  }
+
+  bool isPassedPair(int trackId1, int trackId2) const
+  {
+    return std::binary_search(passed_pairKeys.begin(), passed_pairKeys.end(), getPairKey(trackId1, trackId2));
+  }
+
   template <bool isTriggerAnalysis, typename TCollisions, typename TLeptons, typename TPresilce, typename TCut, typename TAllTracks>
-  void fillPairWeightMap(TCollisions const& collisions, TLeptons const& posTracks, TLeptons const& negTracks, TPresilce const& perCollision, TCut const& cut, TAllTracks const& tracks)
+  void fillPairWeightMap(TCollisions const& collisions, TLeptons const& /*posTracks*/, TLeptons const& /*negTracks*/, TPresilce const& perCollision, TCut const& cut, TAllTracks const& tracks)
   {
-    std::vector<std::pair<int, int>> passed_pairIds;
-    passed_pairIds.reserve(posTracks.size() * negTracks.size());
+    passed_pairIds.clear();
 
     for (const auto& collision : collisions) {
       initCCDB<isTriggerAnalysis>(collision);
@@ -1648,6 +1680,12 @@ struct Dilepton {
       }
     } // end of collision loop
 
+    passed_pairKeys.clear();
+    for (const auto& pairId : passed_pairIds) {
+      passed_pairKeys.emplace_back(getPairKey(pairId.first, pairId.second));
+    }
+    std::sort(passed_pairKeys.begin(), passed_pairKeys.end());
+
     if constexpr (pairtype == o2::aod::pwgem::dilepton::utils::pairutil::DileptonPairType::kDielectron) {
       for (const auto& pairId : passed_pairIds) {
         auto t1 = tracks.rawIteratorAt(std::get<0>(pairId));
@@ -1656,7 +1694,7 @@ struct Dilepton {
         float n = 1.f; // include myself.
         for (const auto& ambId1 : t1.ambiguousElectronsIds()) {
           for (const auto& ambId2 : t2.ambiguousElectronsIds()) {
-            if (std::find(passed_pairIds.begin(), passed_pairIds.end(), std::make_pair(ambId1, ambId2)) != passed_pairIds.end()) {
+            if (isPassedPair(ambId1, ambId2)) {
               n += 1.f;
             }
           }
@@ -1671,7 +1709,7 @@ struct Dilepton {
         float n = 1.f; // include myself.
         for (const auto& ambId1 : t1.ambiguousMuonsIds()) {
           for (const auto& ambId2 : t2.ambiguousMuonsIds()) {
-            if (std::find(passed_pairIds.begin(), passed_pairIds.end(), std::make_pair(ambId1, ambId2)) != passed_pairIds.end()) {
+            if (isPassedPair(ambId1, ambId2)) {
               n += 1.f;
             }
           }
@@ -1679,8 +1717,8 @@ struct Dilepton {
         map_weight[pairId] = 1.f / n;
       } // end of passed_pairIds loop
     }
-    passed_pairIds.clear();
-    passed_pairIds.shrink_to_fit();
+    passed_pairIds.clear(); // keep the capacity for the next DFs
+    passed_pairKeys.clear();
   }
 
   void processAnalysis(FilteredMyCollisions const& collisions, Types const&... args)
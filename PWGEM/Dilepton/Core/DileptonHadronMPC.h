@@ -1265,9 +1265,9 @@ struct DileptonHadronMPC {
         if (cfgDoLS) {
           // for LS++ and hadron mix
           for (size_t i1 = 0; i1 < selected_posTracks_in_this_event.size(); i1++) {
-            auto pos1 = selected_posTracks_in_this_event[i1];
+            const auto& pos1 = selected_posTracks_in_this_event[i1];
             for (size_t i2 = i1 + 1; i2 < selected_posTracks_in_this_event.size(); i2++) {
-              auto pos2 = selected_posTracks_in_this_event[i2];
+              const auto& pos2 = selected_posTracks_in_this_event[i2];
 
               for (const auto& mix_dfId_collisionId : collisionIds_in_mixing_pool_hadron) {
                 int mix_dfId = mix_dfId_collisionId.first;
@@ -1294,9 +1294,9 @@ struct DileptonHadronMPC {
 
           // for LS-- and hadron mix
           for (size_t i1 = 0; i1 < selected_negTracks_in_this_event.size(); i1++) {
-            auto neg1 = selected_negTracks_in_this_event[i1];
+            const auto& neg1 = selected_negTracks_in_this_event[i1];
             for (size_t i2 = i1 + 1; i2 < selected_negTracks_in_this_event.size(); i2++) {
-              auto neg2 = selected_negTracks_in_this_event[i2];
+              const auto& neg2 = selected_negTracks_in_this_event[i2];
 
               for (const auto& mix_dfId_collisionId : collisionIds_in_mixing_pool_hadron) {
                 int mix_dfId = mix_dfId_collisionId.first;
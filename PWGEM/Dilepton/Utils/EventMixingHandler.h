@@ -15,67 +15,161 @@
 #ifndef PWGEM_DILEPTON_UTILS_EVENTMIXINGHANDLER_H_
 #define PWGEM_DILEPTON_UTILS_EVENTMIXINGHANDLER_H_
 
-#include <map>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace o2::aod::pwgem::dilepton::utils
 {
-template <typename T, typename U, typename V>
-class EventMixingHandler
-{
- public:
-  EventMixingHandler()
+// hash of tuple-like keys, e.g. <zbin, centbin, epbin, occbin> or <df index, global collision index>
+struct EventMixingKeyHash {
+  template <typename TKey>
+  std::size_t operator()(const TKey& key) const
   {
-    fNdepth = 0;
-    fMapMixBins.clear();
-    fMap_Tracks_per_collision.clear();
+    std::size_t seed = 0;
+    std::apply([&seed](const auto&... values) { (combine(seed, values), ...); }, key);
+    return seed;
   }
 
-  explicit EventMixingHandler(int ndepth)
+  template <typename TValue>
+  static void combine(std::size_t& seed, const TValue& value)
   {
-    fNdepth = ndepth;
-    fMapMixBins.clear();
-    fMap_Tracks_per_collision.clear();
+    seed ^= std::hash<TValue>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
   }
+};
 
-  ~EventMixingHandler()
-  {
-    fMapMixBins.clear();
-    fMap_Tracks_per_collision.clear();
-  }
+// The pool of each mixing bin keeps the last fNdepth collisions, from the oldest to the newest.
+// The tracks of each collision are stored in a slot, which is recycled together with its capacity once the collision leaves the pool,
+// so that the memory is bounded by the number of bins times the depth of event mixing.
+// The spans returned by the getters stay valid until the next call to AddTrackToEventPool() or AddCollisionIdAtLast().
+template <typename T, typename U, typename V>
+class EventMixingHandler
+{
+ public:
+  EventMixingHandler() = default;
+
+  explicit EventMixingHandler(int ndepth) : fNdepth(ndepth) {}
+
+  ~EventMixingHandler() = default;
 
   void SetNdepth(int ndepth) { fNdepth = ndepth; }
 
   void ReserveNTracksPerCollision(U key_df_collision, int ntrack)
   {
-    fMap_Tracks_per_collision[key_df_collision].reserve(ntrack);
+    getTracksToFill(key_df_collision).reserve(ntrack);
   }
 
   void AddTrackToEventPool(U key_df_collision, V obj)
   {
-    fMap_Tracks_per_collision[key_df_collision].emplace_back(obj);
+    getTracksToFill(key_df_collision).emplace_back(obj);
   }
 
-  std::vector<U> GetCollisionIdsFromEventPool(T key_bin) { return fMapMixBins[key_bin]; }
-  std::vector<V> GetTracksPerCollision(T key_bin, int index) { return fMap_Tracks_per_collision[fMapMixBins[key_bin][index]]; }
-  std::vector<V> GetTracksPerCollision(U key_df_collision) { return fMap_Tracks_per_collision[key_df_collision]; }
+  std::span<const U> GetCollisionIdsFromEventPool(T key_bin) const
+  {
+    auto bin = fMapMixBins.find(key_bin);
+    if (bin == fMapMixBins.end()) {
+      return {};
+    }
+    return bin->second;
+  }
+
+  std::span<const V> GetTracksPerCollision(T key_bin, int index) const { return GetTracksPerCollision(GetCollisionIdsFromEventPool(key_bin)[index]); }
+
+  std::span<const V> GetTracksPerCollision(U key_df_collision) const
+  {
+    auto slot = fMapSlotPerCollision.find(key_df_collision);
+    if (slot == fMapSlotPerCollision.end()) {
+      return {};
+    }
+    return fSlots[slot->second].tracks;
+  }
 
   // call this function at the end of collision loop
   void AddCollisionIdAtLast(T key_bin, U key_df_collision)
   {
-    // LOGF(info, "fMapMixBins[key_bin].size() = %d", fMapMixBins[key_bin].size());
-    if (static_cast<int>(fMapMixBins[key_bin].size()) >= fNdepth) {
-      fMap_Tracks_per_collision[fMapMixBins[key_bin][0]].clear();
-      fMap_Tracks_per_collision[fMapMixBins[key_bin][0]].shrink_to_fit();
-      fMapMixBins[key_bin].erase(fMapMixBins[key_bin].begin());
+    auto slot = fMapSlotPerCollision.find(key_df_collision);
+    if (slot != fMapSlotPerCollision.end()) {
+      if (fNdepth < 1) {
+        releaseSlot(slot->second);
+        return;
+      }
+      fSlots[slot->second].isInPool = true;
+    }
+    if (fNdepth < 1) {
+      return;
+    }
+
+    auto& pool = fMapMixBins[key_bin];
+    if (static_cast<int>(pool.size()) >= fNdepth) {
+      auto oldest = fMapSlotPerCollision.find(pool.front());
+      if (oldest != fMapSlotPerCollision.end()) {
+        releaseSlot(oldest->second);
+      }
+      // shift the pool by one collision, the capacity is never exceeded
+      for (std::size_t i = 1; i < pool.size(); i++) {
+        pool[i - 1] = pool[i];
+      }
+      pool.back() = key_df_collision;
+    } else {
+      pool.reserve(fNdepth);
+      pool.emplace_back(key_df_collision);
     }
-    fMapMixBins[key_bin].emplace_back(key_df_collision);
   }
 
  private:
-  int fNdepth;                                           // depth of event mixing
-  std::map<T, std::vector<U>> fMapMixBins;               // map : e.g. <zbin, centbin, epbin> -> pair<df index, global collision index>
-  std::map<U, std::vector<V>> fMap_Tracks_per_collision; // map : e.g. pair<df index, global collision index> -> track array
+  struct Slot {
+    U key_df_collision{};  // collision to which the tracks belong
+    std::vector<V> tracks; // tracks of the collision
+    bool isInPool = false; // whether the collision was added to a pool
+  };
+
+  int fNdepth = 0;                                                       // depth of event mixing
+  std::unordered_map<T, std::vector<U>, EventMixingKeyHash> fMapMixBins; // map : e.g. <zbin, centbin, epbin> -> pair<df index, global collision index>
+  std::unordered_map<U, int, EventMixingKeyHash> fMapSlotPerCollision;   // map : e.g. pair<df index, global collision index> -> index of the slot in fSlots
+  std::vector<Slot> fSlots;                                              // track arrays
+  std::vector<int> fFreeSlots;                                           // indices of the slots which can be recycled
+  int fPendingSlot = -1;                                                 // slot of the collision being filled, if not yet added to a pool
+
+  std::vector<V>& getTracksToFill(const U& key_df_collision)
+  {
+    auto slot = fMapSlotPerCollision.find(key_df_collision);
+    if (slot != fMapSlotPerCollision.end()) {
+      return fSlots[slot->second].tracks;
+    }
+
+    // tracks of the previous collision which was not added to a pool are never used for mixing
+    if (fPendingSlot >= 0 && !fSlots[fPendingSlot].isInPool) {
+      releaseSlot(fPendingSlot);
+    }
+
+    int index = -1;
+    if (!fFreeSlots.empty()) {
+      index = fFreeSlots.back();
+      fFreeSlots.pop_back();
+    } else {
+      index = static_cast<int>(fSlots.size());
+      fSlots.emplace_back();
+    }
+    fSlots[index].key_df_collision = key_df_collision;
+    fMapSlotPerCollision.emplace(key_df_collision, index);
+    fPendingSlot = index;
+    return fSlots[index].tracks;
+  }
+
+  void releaseSlot(int index)
+  {
+    fMapSlotPerCollision.erase(fSlots[index].key_df_collision);
+    fSlots[index].tracks.clear(); // keep the capacity for the next collisions
+    fSlots[index].isInPool = false;
+    fFreeSlots.emplace_back(index);
+    if (fPendingSlot == index) {
+      fPendingSlot = -1;
+    }
+  }
 };
 } // namespace o2::aod::pwgem::dilepton::utils
 #endif // PWGEM_DILEPTON_UTILS_EVENTMIXINGHANDLER_H_
@@ -92,6 +92,7 @@ struct HfCandidateSelectorD0 {
   Configurable<int> nClassesMl{"nClassesMl", static_cast<int>(hf_cuts_ml::NCutScores), "Number of classes in ML model"};
   Configurable<bool> enableDebugMl{"enableDebugMl", false, "Flag to enable histograms to monitor BDT application"};
   Configurable<std::vector<std::string>> namesInputFeatures{"namesInputFeatures", std::vector<std::string>{"feature1", "feature2"}, "Names of ML model input features"};
+  Configurable<bool> useNativeTreeEnsembleMl{"useNativeTreeEnsembleMl", false, "Flag to evaluate supported BDT models natively instead of with ONNX Runtime (checked against ONNX Runtime at initialisation)"};
   // CCDB configuration
   Configurable<std::string> ccdbUrl{"ccdbUrl", "http://alice-ccdb.cern.ch", "url of the ccdb repository"};
   Configurable<std::vector<std::string>> modelPathsCCDB{"modelPathsCCDB", std::vector<std::string>{"EventFiltering/PWGHF/BDTD0"}, "Paths of models on CCDB"};
@@ -148,7 +149,7 @@ struct HfCandidateSelectorD0 {
         hfMlResponse.setModelPathsLocal(onnxFileNames);
       }
       hfMlResponse.cacheInputFeaturesIndices(namesInputFeatures);
-      hfMlResponse.init();
+      hfMlResponse.init(false, 0, useNativeTreeEnsembleMl);
     }
   }
 
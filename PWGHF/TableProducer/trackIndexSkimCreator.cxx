@@ -66,6 +66,7 @@
 #include <Framework/Logger.h>
 #include <Framework/runDataProcessing.h>
 #include <MathUtils/BetheBlochAleph.h>
+#include <MathUtils/Primitive2D.h>
 #include <ReconstructionDataFormats/Track.h>
 #include <ReconstructionDataFormats/Vertex.h> // for PV refit
 
@@ -78,6 +79,7 @@
 
 #include <algorithm> // std::find
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -298,6 +300,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
     Configurable<bool> doPvRefit{"doPvRefit", false, "do PV refit excluding the considered track"};
     Configurable<bool> fillHistograms{"fillHistograms", true, "fill histograms"};
     Configurable<bool> debugPvRefit{"debugPvRefit", false, "debug lines for primary vertex refit"};
+    Configurable<bool> doPvRefitDowndate{"doPvRefitDowndate", false, "remove the track from the fitted PV with a linearised Kalman downdate instead of refitting the PV for each track"};
     // Configurable<double> bz{"bz", 5., "bz field"};
     // quality cut
     Configurable<bool> doCutQuality{"doCutQuality", true, "apply quality cuts"};
@@ -357,6 +360,23 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
   o2::base::Propagator::MatCorrType noMatCorr = o2::base::Propagator::MatCorrType::USEMatCorrNONE;
   int runNumber{};
 
+  /// linearised contribution of a PV contributor to the vertex fit, used to remove it from the fitted vertex
+  struct PvContribution {
+    std::array<double, 6> jacobian{}; // derivatives of the (y, z) residuals in the track frame w.r.t. the vertex (x, y, z)
+    std::array<double, 2> residual{}; // (y, z) residuals of the track w.r.t. the fitted vertex
+    std::array<double, 3> covYZ{};    // covariance of the (y, z) residuals
+    bool isValid{false};
+  };
+
+  // PV refit inputs of the current collision, prepared once and shared by all its tracks
+  o2::vertexing::PVertexer vertexer;
+  o2::dataformats::VertexBase primVtx;
+  std::vector<int64_t> vecPvContributorGlobId{};
+  std::vector<o2::track::TrackParCov> vecPvContributorTrackParCov{};
+  std::vector<bool> vecPvRefitContributorUsed{};
+  std::vector<PvContribution> vecPvContribution{};
+  bool pvRefitDoable{false};
+
   using TracksWithSelAndDca = soa::Join<aod::TracksWCovDcaExtra, aod::TrackSelection>;
   using TracksWithSelAndDcaAndPidTpc = soa::Join<aod::TracksWCovDcaExtra, aod::TrackSelection, aod::pidTPCFullPr, aod::pidTPCFullKa, aod::pidTPCFullDe, aod::pidTPCFullTr, aod::pidTPCFullHe>;
   using TracksWithSelAndDcaAndPidTof = soa::Join<aod::TracksWCovDcaExtra, aod::TrackSelection, aod::pidTOFFullPr, aod::pidTOFFullKa, aod::pidTOFFullDe, aod::pidTOFFullTr, aod::pidTOFFullHe>;
@@ -454,6 +474,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
 
     // Needed for PV refitting
     if (config.doPvRefit) {
+      o2::conf::ConfigurableParam::updateFromString("pvertexer.useMeanVertexConstraint=false"); /// remove diamond constraint (let's keep it at the moment...)
       if (config.fillHistograms) {
         const AxisSpec axisCollisionX{100, -20.f, 20.f, "X (cm)"};
         const AxisSpec axisCollisionY{100, -20.f, 20.f, "Y (cm)"};
@@ -936,26 +957,24 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
     }
   }
 
-  /// Method for the PV refit and DCA recalculation for tracks with a collision assigned
+  /// Method to prepare the PV refit of a collision, done once for all its tracks
   /// \param collision is a collision
-  /// \param bcWithTimeStamps is a table of bunch crossing joined with timestamps used to query the CCDB for B and material budget
-  /// \param vecPvContributorGlobId is a vector containing the global ID of PV contributors for the current collision
-  /// \param vecPvContributorTrackParCov is a vector containing the TrackParCov of PV contributors for the current collision
-  /// \param trackToRemove is the track to be removed, if contributor, from the PV refit
-  /// \param pvCoord is an array containing the coordinates of the refitted PV
-  /// \param pvCovMatrix is an array containing the covariance matrix values of the refitted PV
-  /// \param dcaXYdcaZ is an array containing the dcaXY and dcaZ of trackToRemove with respect to the refitted PV
-  template <typename TTrack>
-  void performPvRefitTrack(aod::Collision const& collision,
-                           aod::BCsWithTimestamps const&,
-                           std::vector<int64_t> const& vecPvContributorGlobId,
-                           std::vector<o2::track::TrackParCov> const& vecPvContributorTrackParCov,
-                           TTrack const& trackToRemove,
-                           std::array<float, 3>& pvCoord,
-                           std::array<float, 6>& pvCovMatrix,
-                           std::array<float, 2>& dcaXYdcaZ)
+  /// \param pvContrCollision are the PV contributors of this collision
+  template <typename GroupedPvContributors>
+  void preparePvRefit(aod::Collision const& collision,
+                      GroupedPvContributors const& pvContrCollision)
   {
-    std::vector<bool> vecPvRefitContributorUsed(vecPvContributorGlobId.size(), true);
+    /// retrieve PV contributors for the current collision
+    vecPvContributorGlobId.clear();
+    vecPvContributorTrackParCov.clear();
+    for (const auto& contributor : pvContrCollision) {
+      vecPvContributorGlobId.push_back(contributor.globalIndex());
+      vecPvContributorTrackParCov.push_back(getTrackParCov(contributor));
+    }
+    vecPvRefitContributorUsed.assign(vecPvContributorGlobId.size(), true);
+    if (config.debugPvRefit) {
+      LOG(info) << "### vecPvContributorGlobId.size()=" << vecPvContributorGlobId.size() << ", vecPvContributorTrackParCov.size()=" << vecPvContributorTrackParCov.size() << ", N. original contributors=" << collision.numContrib();
+    }
 
     /// Prepare the vertex refitting
     // set the magnetic field from CCDB
@@ -987,26 +1006,126 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
     }*/
 
     // build the VertexBase to initialize the vertexer
-    o2::dataformats::VertexBase primVtx;
     primVtx.setX(collision.posX());
     primVtx.setY(collision.posY());
     primVtx.setZ(collision.posZ());
     primVtx.setCov(collision.covXX(), collision.covXY(), collision.covYY(), collision.covXZ(), collision.covYZ(), collision.covZZ());
     // configure PVertexer
-    o2::vertexing::PVertexer vertexer;
-    o2::conf::ConfigurableParam::updateFromString("pvertexer.useMeanVertexConstraint=false"); /// remove diamond constraint (let's keep it at the moment...)
     vertexer.init();
-    const bool pvRefitDoable = vertexer.prepareVertexRefit(vecPvContributorTrackParCov, primVtx);
+    pvRefitDoable = vertexer.prepareVertexRefit(vecPvContributorTrackParCov, primVtx);
     if (!pvRefitDoable) {
       LOG(info) << "Not enough tracks accepted for the refit";
-      if (config.doPvRefit && config.fillHistograms) {
-        registry.fill(HIST("PvRefit/hNContribPvRefitNotDoable"), collision.numContrib());
-      }
     }
     if (config.debugPvRefit) {
       LOG(info) << "prepareVertexRefit = " << pvRefitDoable << " Ncontrib= " << vecPvContributorTrackParCov.size() << " Ntracks= " << collision.numContrib() << " Vtx= " << primVtx.asString();
     }
 
+    if (config.doPvRefitDowndate && pvRefitDoable) {
+      /// linearise the contributions of the tracks at their point of closest approach to the fitted vertex
+      vecPvContribution.assign(vecPvContributorTrackParCov.size(), PvContribution{});
+      for (auto iContributor{0u}; iContributor < vecPvContributorTrackParCov.size(); ++iContributor) {
+        auto trackParCov = vecPvContributorTrackParCov[iContributor];
+        auto& contribution = vecPvContribution[iContributor];
+        if (!o2::base::Propagator::Instance()->propagateToDCABxByBz(primVtx, trackParCov, 2.f, noMatCorr)) {
+          continue;
+        }
+        const double cosPhi = std::sqrt((1. - trackParCov.getSnp()) * (1. + trackParCov.getSnp()));
+        const double tgPhi = trackParCov.getSnp() / cosPhi;
+        const double tgLambda = trackParCov.getTgl() / cosPhi;
+        const double cosAlpha = std::cos(trackParCov.getAlpha());
+        const double sinAlpha = std::sin(trackParCov.getAlpha());
+        const double xVtx = cosAlpha * primVtx.getX() + sinAlpha * primVtx.getY(); // vertex in the track frame
+        const double yVtx = -sinAlpha * primVtx.getX() + cosAlpha * primVtx.getY();
+        contribution.jacobian = {tgPhi * cosAlpha + sinAlpha, tgPhi * sinAlpha - cosAlpha, 0., tgLambda * cosAlpha, tgLambda * sinAlpha, -1.};
+        contribution.residual = {trackParCov.getY() + tgPhi * (xVtx - trackParCov.getX()) - yVtx, trackParCov.getZ() + tgLambda * (xVtx - trackParCov.getX()) - primVtx.getZ()};
+        contribution.covYZ = {trackParCov.getSigmaY2(), trackParCov.getSigmaZY(), trackParCov.getSigmaZ2()};
+        contribution.isValid = true;
+      }
+    }
+  }
+
+  /// Method to remove a track from the fitted PV with a linearised Kalman downdate
+  /// \param contribution is the linearised contribution of the track to the PV fit
+  /// \param primVtxRefitted is the PV without the track
+  /// \return false if the PV covariance matrix without the track is not positive definite
+  bool downdatePv(PvContribution const& contribution, o2::dataformats::VertexBase& primVtxRefitted)
+  {
+    // covariance of the fitted vertex: xx, xy, xz, yy, yz, zz
+    const std::array<double, 6> cov{primVtx.getSigmaX2(), primVtx.getSigmaXY(), primVtx.getSigmaXZ(), primVtx.getSigmaY2(), primVtx.getSigmaYZ(), primVtx.getSigmaZ2()};
+    auto covAt = [&cov](int i, int j) {
+      constexpr int Index[3][3] = {{0, 1, 2}, {1, 3, 4}, {2, 4, 5}};
+      return cov[Index[i][j]];
+    };
+    const auto& jac = contribution.jacobian;
+    // C J^T (3x2)
+    std::array<std::array<double, 2>, 3> covJt{};
+    for (int i = 0; i < 3; ++i) {
+      for (int k = 0; k < 2; ++k) {
+        covJt[i][k] = covAt(i, 0) * jac[3 * k] + covAt(i, 1) * jac[3 * k + 1] + covAt(i, 2) * jac[3 * k + 2];
+      }
+    }
+    // S = V - J C J^T, the covariance of the residuals after the removal of the track
+    const double s00 = contribution.covYZ[0] - (jac[0] * covJt[0][0] + jac[1] * covJt[1][0] + jac[2] * covJt[2][0]);
+    const double s01 = contribution.covYZ[1] - (jac[0] * covJt[0][1] + jac[1] * covJt[1][1] + jac[2] * covJt[2][1]);
+    const double s11 = contribution.covYZ[2] - (jac[3] * covJt[0][1] + jac[4] * covJt[1][1] + jac[5] * covJt[2][1]);
+    const double detS = s00 * s11 - s01 * s01;
+    const double detV = contribution.covYZ[0] * contribution.covYZ[2] - contribution.covYZ[1] * contribution.covYZ[1];
+    if (detS <= 0. || s00 <= 0. || detV <= 0.) {
+      return false;
+    }
+    // C' = C + C J^T S^-1 J C
+    const std::array<std::array<double, 2>, 2> sInv{{{s11 / detS, -s01 / detS}, {-s01 / detS, s00 / detS}}};
+    std::array<double, 6> covNew{};
+    int iCov = 0;
+    for (int i = 0; i < 3; ++i) {
+      for (int j = i; j < 3; ++j) {
+        double update = 0.;
+        for (int k = 0; k < 2; ++k) {
+          for (int l = 0; l < 2; ++l) {
+            update += covJt[i][k] * sInv[k][l] * covJt[j][l];
+          }
+        }
+        covNew[iCov++] = covAt(i, j) + update;
+      }
+    }
+    // x' = x + C' J^T V^-1 r
+    const std::array<double, 2> vInvRes{(contribution.covYZ[2] * contribution.residual[0] - contribution.covYZ[1] * contribution.residual[1]) / detV,
+                                        (contribution.covYZ[0] * contribution.residual[1] - contribution.covYZ[1] * contribution.residual[0]) / detV};
+    std::array<double, 3> jtVInvRes{};
+    for (int i = 0; i < 3; ++i) {
+      jtVInvRes[i] = jac[i] * vInvRes[0] + jac[3 + i] * vInvRes[1];
+    }
+    auto covNewAt = [&covNew](int i, int j) {
+      constexpr int Index[3][3] = {{0, 1, 2}, {1, 3, 4}, {2, 4, 5}};
+      return covNew[Index[i][j]];
+    };
+    std::array<double, 3> pos{primVtx.getX(), primVtx.getY(), primVtx.getZ()};
+    for (int i = 0; i < 3; ++i) {
+      pos[i] += covNewAt(i, 0) * jtVInvRes[0] + covNewAt(i, 1) * jtVInvRes[1] + covNewAt(i, 2) * jtVInvRes[2];
+    }
+    primVtxRefitted.setX(pos[0]);
+    primVtxRefitted.setY(pos[1]);
+    primVtxRefitted.setZ(pos[2]);
+    primVtxRefitted.setCov(covNew[0], covNew[1], covNew[3], covNew[2], covNew[4], covNew[5]);
+    return true;
+  }
+
+  /// Method for the PV refit and DCA recalculation for tracks with a collision assigned, using the PV refit inputs prepared by preparePvRefit
+  /// \param collision is a collision
+  /// \param trackToRemove is the track to be removed, if contributor, from the PV refit
+  /// \param pvCoord is an array containing the coordinates of the refitted PV
+  /// \param pvCovMatrix is an array containing the covariance matrix values of the refitted PV
+  /// \param dcaXYdcaZ is an array containing the dcaXY and dcaZ of trackToRemove with respect to the refitted PV
+  template <typename TTrack>
+  void performPvRefitTrack(aod::Collision const& collision,
+                           TTrack const& trackToRemove,
+                           std::array<float, 3>& pvCoord,
+                           std::array<float, 6>& pvCovMatrix,
+                           std::array<float, 2>& dcaXYdcaZ)
+  {
+    if (!pvRefitDoable && config.doPvRefit && config.fillHistograms) {
+      registry.fill(HIST("PvRefit/hNContribPvRefitNotDoable"), collision.numContrib());
+    }
     if (config.fillHistograms) {
       registry.fill(HIST("PvRefit/hVerticesPerTrack"), 1);
       if (pvRefitDoable) {
@@ -1024,42 +1143,55 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
         /// this track contributed to the PV fit: let's do the refit without it
         const int entry = std::distance(vecPvContributorGlobId.begin(), trackIterator);
 
-        vecPvRefitContributorUsed[entry] = false; /// remove the track from the PV refitting
+        o2::dataformats::VertexBase primVtxRefitted;
+        int nContribRefitted = static_cast<int>(vecPvContributorGlobId.size()) - 1;
+        if (config.doPvRefitDowndate) {
+          recalcImpPar = vecPvContribution[entry].isValid && downdatePv(vecPvContribution[entry], primVtxRefitted);
+          if (!recalcImpPar && config.debugPvRefit) {
+            LOG(info) << "---> PV downdate failed for track with global index " << static_cast<int>(trackToRemove.globalIndex());
+          }
+        } else {
+          vecPvRefitContributorUsed[entry] = false; /// remove the track from the PV refitting
 
-        const auto primVtxRefitted = vertexer.refitVertex(vecPvRefitContributorUsed, primVtx); // vertex refit
-        // LOG(info) << "refit " << cnt << "/" << ntr << " result = " << primVtxRefitted.asString();
-        if (config.debugPvRefit) {
-          LOG(info) << "refit for track with global index " << static_cast<int>(trackToRemove.globalIndex()) << " " << primVtxRefitted.asString();
-        }
-        if (primVtxRefitted.getChi2() < 0) {
+          const auto primVtxRefittedFull = vertexer.refitVertex(vecPvRefitContributorUsed, primVtx); // vertex refit
+          // LOG(info) << "refit " << cnt << "/" << ntr << " result = " << primVtxRefittedFull.asString();
           if (config.debugPvRefit) {
-            LOG(info) << "---> Refitted vertex has bad chi2 = " << primVtxRefitted.getChi2();
+            LOG(info) << "refit for track with global index " << static_cast<int>(trackToRemove.globalIndex()) << " " << primVtxRefittedFull.asString();
+          }
+          if (primVtxRefittedFull.getChi2() < 0) {
+            if (config.debugPvRefit) {
+              LOG(info) << "---> Refitted vertex has bad chi2 = " << primVtxRefittedFull.getChi2();
+            }
+            if (config.fillHistograms) {
+              registry.fill(HIST("PvRefit/hPvRefitXChi2Minus1"), primVtxRefittedFull.getX(), collision.posX());
+              registry.fill(HIST("PvRefit/hPvRefitYChi2Minus1"), primVtxRefittedFull.getY(), collision.posY());
+              registry.fill(HIST("PvRefit/hPvRefitZChi2Minus1"), primVtxRefittedFull.getZ(), collision.posZ());
+              registry.fill(HIST("PvRefit/hNContribPvRefitChi2Minus1"), collision.numContrib());
+            }
+            recalcImpPar = false;
           }
           if (config.fillHistograms) {
-            registry.fill(HIST("PvRefit/hPvRefitXChi2Minus1"), primVtxRefitted.getX(), collision.posX());
-            registry.fill(HIST("PvRefit/hPvRefitYChi2Minus1"), primVtxRefitted.getY(), collision.posY());
-            registry.fill(HIST("PvRefit/hPvRefitZChi2Minus1"), primVtxRefitted.getZ(), collision.posZ());
-            registry.fill(HIST("PvRefit/hNContribPvRefitChi2Minus1"), collision.numContrib());
+            registry.fill(HIST("PvRefit/hChi2vsNContrib"), primVtxRefittedFull.getNContributors(), primVtxRefittedFull.getChi2());
           }
-          recalcImpPar = false;
-        } else if (config.fillHistograms) {
-          registry.fill(HIST("PvRefit/hVerticesPerTrack"), 3);
-        }
-        if (config.fillHistograms) {
-          registry.fill(HIST("PvRefit/hChi2vsNContrib"), primVtxRefitted.getNContributors(), primVtxRefitted.getChi2());
-        }
 
-        vecPvRefitContributorUsed[entry] = true; /// restore the track for the next PV refitting (probably not necessary here)
+          vecPvRefitContributorUsed[entry] = true; /// restore the track for the next PV refitting
+
+          primVtxRefitted = primVtxRefittedFull;
+          nContribRefitted = primVtxRefittedFull.getNContributors();
+        }
 
         if (recalcImpPar) {
+          if (config.fillHistograms) {
+            registry.fill(HIST("PvRefit/hVerticesPerTrack"), 3);
+          }
           // fill the histograms for refitted PV with good Chi2
           const double deltaX = primVtx.getX() - primVtxRefitted.getX();
           const double deltaY = primVtx.getY() - primVtxRefitted.getY();
           const double deltaZ = primVtx.getZ() - primVtxRefitted.getZ();
           if (config.fillHistograms) {
-            registry.fill(HIST("PvRefit/hPvDeltaXvsNContrib"), primVtxRefitted.getNContributors(), deltaX);
-            registry.fill(HIST("PvRefit/hPvDeltaYvsNContrib"), primVtxRefitted.getNContributors(), deltaY);
-            registry.fill(HIST("PvRefit/hPvDeltaZvsNContrib"), primVtxRefitted.getNContributors(), deltaZ);
+            registry.fill(HIST("PvRefit/hPvDeltaXvsNContrib"), nContribRefitted, deltaX);
+            registry.fill(HIST("PvRefit/hPvDeltaYvsNContrib"), nContribRefitted, deltaY);
+            registry.fill(HIST("PvRefit/hPvDeltaZvsNContrib"), nContribRefitted, deltaZ);
           }
 
           // fill the newly calculated PV
@@ -1068,8 +1200,6 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
           primVtxBaseRecalc.setZ(primVtxRefitted.getZ());
           primVtxBaseRecalc.setCov(primVtxRefitted.getSigmaX2(), primVtxRefitted.getSigmaXY(), primVtxRefitted.getSigmaY2(), primVtxRefitted.getSigmaXZ(), primVtxRefitted.getSigmaYZ(), primVtxRefitted.getSigmaZ2());
         }
-
-        // cnt++;
       }
     } /// end 'if (doPvRefit && pvRefitDoable)'
 
@@ -1123,7 +1253,6 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
   /// \param collision is the collision iterator
   /// \param trackIndicesCollision are the track indices associated to this collision (from track-to-collision-associator)
   /// \param pvContrCollision are the PV contributors of this collision
-  /// \param bcWithTimeStamps is the bc with timestamp for PVrefit
   /// \param pvRefitDcaPerTrack is a vector to be filled with track dcas after PV refit
   /// \param pvRefitPvCoordPerTrack is a vector to be filled with PV coordinates after PV refit
   /// \param pvRefitPvCovMatrixPerTrack is a vector to be filled with PV coordinate covariances after PV refit
@@ -1132,13 +1261,13 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
                        TTracks const& tracks,
                        GroupedTrackIndices const& trackIndicesCollision,
                        GroupedPvContributors const& pvContrCollision,
-                       aod::BCsWithTimestamps const& bcWithTimeStamps,
                        std::vector<std::array<float, 2>>& pvRefitDcaPerTrack,
                        std::vector<std::array<float, 3>>& pvRefitPvCoordPerTrack,
                        std::vector<std::array<float, 6>>& pvRefitPvCovMatrixPerTrack)
   {
     const auto thisCollId = collision.globalIndex();
     auto tracksWithItsPid = soa::Attach<TTracks, aod::pidits::ITSNSigmaDe, aod::pidits::ITSNSigmaTr, aod::pidits::ITSNSigmaHe, aod::pidits::ITSNSigmaAl>(tracks);
+    bool isPvRefitPrepared = false;
 
     for (const auto& trackId : trackIndicesCollision) {
       int statusProng = BIT(CandidateType::NCandidateTypes) - 1; // all bits on
@@ -1157,20 +1286,16 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
         pvRefitPvCoord = {collision.posX(), collision.posY(), collision.posZ()};
         pvRefitPvCovMatrix = {collision.covXX(), collision.covXY(), collision.covYY(), collision.covXZ(), collision.covYZ(), collision.covZZ()};
 
-        /// retrieve PV contributors for the current collision
-        std::vector<int64_t> vecPvContributorGlobId{};
-        std::vector<o2::track::TrackParCov> vecPvContributorTrackParCov{};
-
-        for (const auto& contributor : pvContrCollision) {
-          vecPvContributorGlobId.push_back(contributor.globalIndex());
-          vecPvContributorTrackParCov.push_back(getTrackParCov(contributor));
+        /// retrieve PV contributors and prepare the PV refit once per collision
+        if (!isPvRefitPrepared) {
+          preparePvRefit(collision, pvContrCollision);
+          isPvRefitPrepared = true;
         }
         if (config.debugPvRefit) {
-          LOG(info) << "### vecPvContributorGlobId.size()=" << vecPvContributorGlobId.size() << ", vecPvContributorTrackParCov.size()=" << vecPvContributorTrackParCov.size() << ", N. original contributors=" << collision.numContrib();
           /// Perform the PV refit only for tracks with an assigned collision
           LOG(info) << "[BEFORE performPvRefitTrack] track.collision().globalIndex(): " << collision.globalIndex();
         }
-        performPvRefitTrack(collision, bcWithTimeStamps, vecPvContributorGlobId, vecPvContributorTrackParCov, track, pvRefitPvCoord, pvRefitPvCovMatrix, pvRefitDcaXYDcaZ);
+        performPvRefitTrack(collision, track, pvRefitPvCoord, pvRefitPvCovMatrix, pvRefitDcaXYDcaZ);
         // we subtract the offset since trackIdx is the global index referred to the total track table
         const auto trackIdx = track.globalIndex();
         pvRefitDcaPerTrack[trackIdx] = pvRefitDcaXYDcaZ;
@@ -1222,7 +1347,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
   void processNoPid(aod::Collisions const& collisions,
                     TrackAssoc const& trackIndices,
                     TracksWithSelAndDca const& tracks,
-                    aod::BCsWithTimestamps const& bcWithTimeStamps)
+                    aod::BCsWithTimestamps const&)
   {
     rowSelectedTrack.reserve(tracks.size());
     // prepare vectors to cache quantities needed for PV refit
@@ -1241,7 +1366,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
       const auto thisCollId = collision.globalIndex();
       const auto groupedTrackIndices = trackIndices.sliceBy(trackIndicesPerCollision, thisCollId);
       const auto pvContrCollision = pvContributors->sliceByCached(aod::track::collisionId, thisCollId, cache);
-      runTagSelTracks<NoPid>(collision, tracks, groupedTrackIndices, pvContrCollision, bcWithTimeStamps, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
+      runTagSelTracks<NoPid>(collision, tracks, groupedTrackIndices, pvContrCollision, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
     }
 
     if (config.doPvRefit) { /// fill table with PV refit info (it has to be filled per track and not track index)
@@ -1253,7 +1378,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
   void processProtonPidTpc(aod::Collisions const& collisions,
                            TrackAssoc const& trackIndices,
                            TracksWithSelAndDcaAndPidTpc const& tracks,
-                           aod::BCsWithTimestamps const& bcWithTimeStamps)
+                           aod::BCsWithTimestamps const&)
   {
     rowSelectedTrack.reserve(tracks.size());
     // prepare vectors to cache quantities needed for PV refit
@@ -1272,7 +1397,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
       const auto thisCollId = collision.globalIndex();
       const auto groupedTrackIndices = trackIndices.sliceBy(trackIndicesPerCollision, thisCollId);
       const auto pvContrCollision = pvContributorsWithPidTpc->sliceByCached(aod::track::collisionId, thisCollId, cache);
-      runTagSelTracks<PidTpcOnly>(collision, tracks, groupedTrackIndices, pvContrCollision, bcWithTimeStamps, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
+      runTagSelTracks<PidTpcOnly>(collision, tracks, groupedTrackIndices, pvContrCollision, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
     }
 
     if (config.doPvRefit) { /// fill table with PV refit info (it has to be filled per track and not track index)
@@ -1284,7 +1409,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
   void processProtonPidTof(aod::Collisions const& collisions,
                            TrackAssoc const& trackIndices,
                            TracksWithSelAndDcaAndPidTof const& tracks,
-                           aod::BCsWithTimestamps const& bcWithTimeStamps)
+                           aod::BCsWithTimestamps const&)
   {
     rowSelectedTrack.reserve(tracks.size());
     // prepare vectors to cache quantities needed for PV refit
@@ -1303,7 +1428,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
       const auto thisCollId = collision.globalIndex();
       const auto groupedTrackIndices = trackIndices.sliceBy(trackIndicesPerCollision, thisCollId);
       const auto pvContrCollision = pvContributorsWithPidTof->sliceByCached(aod::track::collisionId, thisCollId, cache);
-      runTagSelTracks<PidTofOnly>(collision, tracks, groupedTrackIndices, pvContrCollision, bcWithTimeStamps, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
+      runTagSelTracks<PidTofOnly>(collision, tracks, groupedTrackIndices, pvContrCollision, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
     }
 
     if (config.doPvRefit) { /// fill table with PV refit info (it has to be filled per track and not track index)
@@ -1315,7 +1440,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
   void processProtonPidTpcOrTof(aod::Collisions const& collisions,
                                 TrackAssoc const& trackIndices,
                                 TracksWithSelAndDcaAndPidTpcTof const& tracks,
-                                aod::BCsWithTimestamps const& bcWithTimeStamps)
+                                aod::BCsWithTimestamps const&)
   {
     rowSelectedTrack.reserve(tracks.size());
     // prepare vectors to cache quantities needed for PV refit
@@ -1334,7 +1459,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
       const auto thisCollId = collision.globalIndex();
       const auto groupedTrackIndices = trackIndices.sliceBy(trackIndicesPerCollision, thisCollId);
       const auto pvContrCollision = pvContributorsWithPidTpcTof->sliceByCached(aod::track::collisionId, thisCollId, cache);
-      runTagSelTracks<PidTpcOrTof>(collision, tracks, groupedTrackIndices, pvContrCollision, bcWithTimeStamps, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
+      runTagSelTracks<PidTpcOrTof>(collision, tracks, groupedTrackIndices, pvContrCollision, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
     }
 
     if (config.doPvRefit) { /// fill table with PV refit info (it has to be filled per track and not track index)
@@ -1346,7 +1471,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
   void processProtonPidTpcAndTof(aod::Collisions const& collisions,
                                  TrackAssoc const& trackIndices,
                                  TracksWithSelAndDcaAndPidTpcTof const& tracks,
-                                 aod::BCsWithTimestamps const& bcWithTimeStamps)
+                                 aod::BCsWithTimestamps const&)
   {
     rowSelectedTrack.reserve(tracks.size());
     // prepare vectors to cache quantities needed for PV refit
@@ -1365,7 +1490,7 @@ struct HfTrackIndexSkimCreatorTagSelTracks {
       const auto thisCollId = collision.globalIndex();
       const auto groupedTrackIndices = trackIndices.sliceBy(trackIndicesPerCollision, thisCollId);
       const auto pvContrCollision = pvContributorsWithPidTpcTof->sliceByCached(aod::track::collisionId, thisCollId, cache);
-      runTagSelTracks<PidTpcAndTof>(collision, tracks, groupedTrackIndices, pvContrCollision, bcWithTimeStamps, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
+      runTagSelTracks<PidTpcAndTof>(collision, tracks, groupedTrackIndices, pvContrCollision, pvRefitDcaPerTrack, pvRefitPvCoordPerTrack, pvRefitPvCovMatrixPerTrack);
     }
 
     if (config.doPvRefit) { /// fill table with PV refit info (it has to be filled per track and not track index)
@@ -1412,6 +1537,7 @@ struct HfTrackIndexSkimCreator {
     Configurable<bool> useWeightedFinalPCA{"useWeightedFinalPCA", false, "Recalculate vertex position using track covariances, effective only if useAbsDCA is true"};
     Configurable<double> maxR{"maxR", 200., "reject PCA's above this radius"};
     Configurable<double> maxDZIni{"maxDZIni", 4., "reject (if>0) PCA candidate if tracks DZ exceeds threshold"};
+    Configurable<double> maxDXYIni{"maxDXYIni", 4., "reject (if>0) PCA candidate if tracks DXY exceeds threshold"};
     Configurable<double> minParamChange{"minParamChange", 1.e-3, "stop iterations if largest change of any X is smaller than this"};
     Configurable<double> minRelChi2Change{"minRelChi2Change", 0.9, "stop iterations if chi2/chi2old > this"};
     // CCDB
@@ -1484,6 +1610,16 @@ struct HfTrackIndexSkimCreator {
   SliceCache cache;
   o2::vertexing::DCAFitterN<2> df2; // 2-prong vertex fitter
   o2::vertexing::DCAFitterN<3> df3; // 3-prong vertex fitter
+
+  /// track parameters w.r.t. the current collision, computed once per collision and shared by all the track combinations
+  struct TrackParsForVertexing {
+    o2::track::TrackParCov trackParVar{};
+    std::array<float, 3> pVec{};
+    std::array<float, 2> dcaInfo{};
+    o2::math_utils::CircleXYf_t circle{}; // projection of the track helix on the transverse plane
+  };
+  std::vector<TrackParsForVertexing> trackParsPos{};
+  std::vector<TrackParsForVertexing> trackParsNeg{};
   // Needed for PV refitting
   Service<o2::ccdb::BasicCCDBManager> ccdb{};
   o2::base::MatLayerCylSet* lut{};
@@ -1587,6 +1723,7 @@ struct HfTrackIndexSkimCreator {
     df2.setPropagateToPCA(config.propagateToPCA);
     df2.setMaxR(config.maxR);
     df2.setMaxDZIni(config.maxDZIni);
+    df2.setMaxDXYIni(config.maxDXYIni);
     df2.setMinParamChange(config.minParamChange);
     df2.setMinRelChi2Change(config.minRelChi2Change);
     df2.setUseAbsDCA(config.useAbsDCA);
@@ -1595,6 +1732,7 @@ struct HfTrackIndexSkimCreator {
     df3.setPropagateToPCA(config.propagateToPCA);
     df3.setMaxR(config.maxR);
     df3.setMaxDZIni(config.maxDZIni);
+    df3.setMaxDXYIni(config.maxDXYIni);
     df3.setMinParamChange(config.minParamChange);
     df3.setMinRelChi2Change(config.minRelChi2Change);
     df3.setUseAbsDCA(config.useAbsDCA);
@@ -2309,6 +2447,43 @@ struct HfTrackIndexSkimCreator {
 
   } /// end of performPvRefitCandProngs function
 
+  /// Method to compute the parameters w.r.t. the collision of the tracks used in the combinatorics
+  /// \param collision is the collision
+  /// \param trackIndices are the track indices associated to the collision
+  /// \param trackPars is the vector filled with the track parameters, in the same order as trackIndices
+  template <typename TTracks, typename TTrackIndices>
+  void fillTrackParsForVertexing(SelectedCollisions::iterator const& collision, TTrackIndices const& trackIndices, std::vector<TrackParsForVertexing>& trackPars)
+  {
+    trackPars.clear();
+    const auto bz = o2::base::Propagator::Instance()->getNominalBz();
+    for (const auto& trackIndex : trackIndices) {
+      const auto track = trackIndex.template track_as<TTracks>();
+      auto& pars = trackPars.emplace_back(TrackParsForVertexing{getTrackParCov(track), track.pVector(), {track.dcaXY(), track.dcaZ()}});
+      if (collision.globalIndex() != track.collisionId()) { // this is not the "default" collision for this track, we have to re-propagate it
+        o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, pars.trackParVar, 2.f, noMatCorr, &pars.dcaInfo);
+        getPxPyPz(pars.trackParVar, pars.pVec);
+      }
+      float sna{}, csa{};
+      pars.trackParVar.getCircleParams(bz, pars.circle, sna, csa);
+    }
+  }
+
+  /// Method to check if the helices of two tracks get close enough in the transverse plane for the DCAFitter to seed their vertex
+  /// The DCAFitter applies the same maxDXYIni check to the first two tracks also for 3-prongs, so the vertex fit of incompatible pairs cannot succeed
+  /// \param circle0 is the projection of the first helix on the transverse plane
+  /// \param circle1 is the projection of the second helix on the transverse plane
+  /// \return true if the distance between the two circles does not exceed maxDXYIni
+  bool areHelicesCloseInXY(o2::math_utils::CircleXYf_t const& circle0, o2::math_utils::CircleXYf_t const& circle1)
+  {
+    constexpr float ToleranceDXY = 1.e-3f; // cm, keeps the check conservative w.r.t. rounding differences with the fitter
+    if (config.maxDXYIni <= 0.) {
+      return true;
+    }
+    const float distCentres = std::hypot(circle1.xC - circle0.xC, circle1.yC - circle0.yC);
+    const float distXY = std::max(distCentres - (circle0.rC + circle1.rC), std::abs(circle0.rC - circle1.rC) - distCentres); // > 0 only if the circles do not cross
+    return distXY <= config.maxDXYIni + ToleranceDXY;
+  }
+
   template <bool DoPvRefit, bool UsePidForHfFiltersBdt, typename TTracks>
   void run2And3Prongs(SelectedCollisions const& collisions,
                       aod::BCsWithTimestamps const& bcWithTimeStamps,
@@ -2405,8 +2580,11 @@ struct HfTrackIndexSkimCreator {
       const auto groupedTrackIndicesNeg1 = negativeFor2And3Prongs->sliceByCached(aod::track::collisionId, collision.globalIndex(), cache);
       std::optional<decltype(positiveSoftPions->sliceByCached(aod::track::collisionId, 0, cache))> groupedTrackIndicesSoftPionsPos;
       std::optional<decltype(negativeSoftPions->sliceByCached(aod::track::collisionId, 0, cache))> groupedTrackIndicesSoftPionsNeg;
+      fillTrackParsForVertexing<TTracks>(collision, groupedTrackIndicesPos1, trackParsPos);
+      fillTrackParsForVertexing<TTracks>(collision, groupedTrackIndicesNeg1, trackParsNeg);
       int lastFilledD0 = -1; // index to be filled in table for D* mesons
-      for (auto trackIndexPos1 = groupedTrackIndicesPos1.begin(); trackIndexPos1 != groupedTrackIndicesPos1.end(); ++trackIndexPos1) {
+      int iPos1 = 0;
+      for (auto trackIndexPos1 = groupedTrackIndicesPos1.begin(); trackIndexPos1 != groupedTrackIndicesPos1.end(); ++trackIndexPos1, ++iPos1) {
         const auto trackPos1 = trackIndexPos1.template track_as<TTracks>();
 
         // retrieve the selection flag that corresponds to this collision
@@ -2414,16 +2592,14 @@ struct HfTrackIndexSkimCreator {
         const bool sel2ProngStatusPos = TESTBIT(isSelProngPos1, CandidateType::Cand2Prong);
         const bool sel3ProngStatusPos1 = TESTBIT(isSelProngPos1, CandidateType::Cand3Prong);
 
-        auto trackParVarPos1 = getTrackParCov(trackPos1);
-        std::array pVecTrackPos1{trackPos1.pVector()};
-        std::array dcaInfoPos1{trackPos1.dcaXY(), trackPos1.dcaZ()};
-        if (thisCollId != trackPos1.collisionId()) { // this is not the "default" collision for this track, we have to re-propagate it
-          o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarPos1, 2.f, noMatCorr, &dcaInfoPos1);
-          getPxPyPz(trackParVarPos1, pVecTrackPos1);
-        }
+        // track parameters w.r.t. this collision
+        const auto& trackParVarPos1 = trackParsPos[iPos1].trackParVar;
+        const auto& pVecTrackPos1 = trackParsPos[iPos1].pVec;
+        const auto& dcaInfoPos1 = trackParsPos[iPos1].dcaInfo;
 
         // first loop over negative tracks
-        for (auto trackIndexNeg1 = groupedTrackIndicesNeg1.begin(); trackIndexNeg1 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg1) {
+        int iNeg1 = 0;
+        for (auto trackIndexNeg1 = groupedTrackIndicesNeg1.begin(); trackIndexNeg1 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg1, ++iNeg1) {
           const auto trackNeg1 = trackIndexNeg1.template track_as<TTracks>();
 
           // retrieve the selection flag that corresponds to this collision
@@ -2431,13 +2607,13 @@ struct HfTrackIndexSkimCreator {
           const bool sel2ProngStatusNeg = TESTBIT(isSelProngNeg1, CandidateType::Cand2Prong);
           const bool sel3ProngStatusNeg1 = TESTBIT(isSelProngNeg1, CandidateType::Cand3Prong);
 
-          auto trackParVarNeg1 = getTrackParCov(trackNeg1);
-          std::array pVecTrackNeg1{trackNeg1.pVector()};
-          std::array dcaInfoNeg1{trackNeg1.dcaXY(), trackNeg1.dcaZ()};
-          if (thisCollId != trackNeg1.collisionId()) { // this is not the "default" collision for this track, we have to re-propagate it
-            o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarNeg1, 2.f, noMatCorr, &dcaInfoNeg1);
-            getPxPyPz(trackParVarNeg1, pVecTrackNeg1);
-          }
+          // track parameters w.r.t. this collision
+          const auto& trackParVarNeg1 = trackParsNeg[iNeg1].trackParVar;
+          const auto& pVecTrackNeg1 = trackParsNeg[iNeg1].pVec;
+          const auto& dcaInfoNeg1 = trackParsNeg[iNeg1].dcaInfo;
+
+          // the fitter cannot find any 2- or 3-prong vertex seeded by this pair if the helices are too far apart in the transverse plane
+          const bool areHelicesClose = areHelicesCloseInXY(trackParsPos[iPos1].circle, trackParsNeg[iNeg1].circle);
 
           uint isSelected2ProngCand = n2ProngBit; // bitmap for checking status of two-prong candidates (1 is true, 0 is rejected)
 
@@ -2455,7 +2631,7 @@ struct HfTrackIndexSkimCreator {
 
           // 2-prong vertex reconstruction
           float pt2Prong{-1.};
-          bool is2ProngCandidateGoodFor3Prong{sel3ProngStatusPos1 && sel3ProngStatusNeg1};
+          bool is2ProngCandidateGoodFor3Prong{sel3ProngStatusPos1 && sel3ProngStatusNeg1 && areHelicesClose};
           int nVtxFrom2ProngFitter = 0;
           if (sel2ProngStatusPos && sel2ProngStatusNeg) {
 
@@ -2463,7 +2639,7 @@ struct HfTrackIndexSkimCreator {
             // TODO: in case of PV refit, the single-track DCA is calculated wrt two different PV vertices (only 1 track excluded)
             applyPreselection2Prong(pVecTrackPos1, pVecTrackNeg1, dcaInfoPos1[0], dcaInfoNeg1[0], cutStatus2Prong, whichHypo2Prong, isSelected2ProngCand, pt2Prong);
 
-            if (isSelected2ProngCand > 0) {
+            if (isSelected2ProngCand > 0 && areHelicesClose) {
               // secondary vertex reconstruction and further 2-prong selections
               try {
                 nVtxFrom2ProngFitter = df2.process(trackParVarPos1, trackParVarNeg1);
@@ -2646,7 +2822,8 @@ struct HfTrackIndexSkimCreator {
 
           if (config.do3Prong && is2ProngCandidateGoodFor3Prong) { // if 3 prongs are enabled and the first 2 tracks are selected for the 3-prong channels
             // second loop over positive tracks
-            for (auto trackIndexPos2 = trackIndexPos1 + 1; trackIndexPos2 != groupedTrackIndicesPos1.end(); ++trackIndexPos2) {
+            int iPos2 = iPos1 + 1;
+            for (auto trackIndexPos2 = trackIndexPos1 + 1; trackIndexPos2 != groupedTrackIndicesPos1.end(); ++trackIndexPos2, ++iPos2) {
 
               uint isSelected3ProngCand = n3ProngBit;
               if (!TESTBIT(trackIndexPos2.isSelProng(), CandidateType::Cand3Prong)) { // continue immediately
@@ -2665,16 +2842,12 @@ struct HfTrackIndexSkimCreator {
 
               const auto trackPos2 = trackIndexPos2.template track_as<TTracks>();
 
-              auto trackParVarPos2 = getTrackParCov(trackPos2);
-              std::array dcaInfoPos2{trackPos2.dcaXY(), trackPos2.dcaZ()};
+              const auto& trackParVarPos2 = trackParsPos[iPos2].trackParVar;
+              const auto& dcaInfoPos2 = trackParsPos[iPos2].dcaInfo;
 
               // preselection of 3-prong candidates
               if (isSelected3ProngCand) {
-                std::array pVecTrackPos2{trackPos2.pVector()};
-                if (thisCollId != trackPos2.collisionId()) { // this is not the "default" collision for this track and we still did not re-propagate it, we have to re-propagate it
-                  o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarPos2, 2.f, noMatCorr, &dcaInfoPos2);
-                  getPxPyPz(trackParVarPos2, pVecTrackPos2);
-                }
+                const auto& pVecTrackPos2 = trackParsPos[iPos2].pVec;
 
                 if (config.debug) {
                   for (int iDecay3P = 0; iDecay3P < kN3ProngDecays; iDecay3P++) {
@@ -2921,7 +3094,8 @@ struct HfTrackIndexSkimCreator {
             }
 
             // second loop over negative tracks
-            for (auto trackIndexNeg2 = trackIndexNeg1 + 1; trackIndexNeg2 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg2) {
+            int iNeg2 = iNeg1 + 1;
+            for (auto trackIndexNeg2 = trackIndexNeg1 + 1; trackIndexNeg2 != groupedTrackIndicesNeg1.end(); ++trackIndexNeg2, ++iNeg2) {
 
               int isSelected3ProngCand = n3ProngBit;
               if (!TESTBIT(trackIndexNeg2.isSelProng(), CandidateType::Cand3Prong)) { // continue immediately
@@ -2939,16 +3113,12 @@ struct HfTrackIndexSkimCreator {
               }
 
               auto trackNeg2 = trackIndexNeg2.template track_as<TTracks>();
-              auto trackParVarNeg2 = getTrackParCov(trackNeg2);
-              std::array dcaInfoNeg2{trackNeg2.dcaXY(), trackNeg2.dcaZ()};
+              const auto& trackParVarNeg2 = trackParsNeg[iNeg2].trackParVar;
+              const auto& dcaInfoNeg2 = trackParsNeg[iNeg2].dcaInfo;
 
               // preselection of 3-prong candidates
               if (isSelected3ProngCand) {
-                std::array pVecTrackNeg2{trackNeg2.pVector()};
-                if (thisCollId != trackNeg2.collisionId()) { // this is not the "default" collision for this track and we still did not re-propagate it, we have to re-propagate it
-                  o2::base::Propagator::Instance()->propagateToDCABxByBz({collision.posX(), collision.posY(), collision.posZ()}, trackParVarNeg2, 2.f, noMatCorr, &dcaInfoNeg2);
-                  getPxPyPz(trackParVarNeg2, pVecTrackNeg2);
-                }
+                const auto& pVecTrackNeg2 = trackParsNeg[iNeg2].pVec;
 
                 if (config.debug) {
                   for (int iDecay3P = 0; iDecay3P < kN3ProngDecays; iDecay3P++) {
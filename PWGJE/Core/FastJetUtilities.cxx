@@ -17,19 +17,5 @@
 
 void fastjetutilities::setFastJetUserInfo(std::vector<fastjet::PseudoJet>& constituents, int index, JetConstituentStatus status)
 {
-  fastjet_user_info* user_info = new fastjet_user_info(status, index); // FIXME: can setting this as a pointer be avoided?
-  constituents.back().set_user_info(user_info);
-  if (index != invalidIndex) { // FIXME: in principle needed for constituent subtraction, particularly when clusters are added to the subtraction. However since the HF particle is not subtracted then we dont need to check for it in this manner
-    int i = index;
-    if (status == JetConstituentStatus::track) {
-      i = i + 1;
-    }
-    if (status == JetConstituentStatus::cluster) {
-      i = -1 * (i + 1);
-    }
-    if (status == JetConstituentStatus::candidate) {
-      i = 0;
-    }
-    constituents.back().set_user_index(i); // FIXME: needed for constituent subtraction, but need to be quite careful to make sure indices dont overlap between tracks, clusters and HF candidates. Current solution might not be optimal
-  }
+  constituents.back().set_user_index(getUserIndex(index, status)); // unique for tracks, clusters and candidates, also used to identify the particles after constituent subtraction
 }
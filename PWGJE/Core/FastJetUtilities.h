@@ -36,32 +36,45 @@ enum class JetConstituentStatus {
 namespace fastjetutilities
 {
 
-// Class defined to store additional info which is passed to the FastJet object
-class fastjet_user_info : public fastjet::PseudoJet::UserInfoBase
+// The status and the index of each particle passed to fastjet are encoded in the user index of its pseudojet, so that no user info object has to be allocated for each particle.
+// user index = index * nStatusCodes + status code. The code of the invalid status is also the one of the default user index (-1) of pseudojets which were not filled here, e.g. ghosts
+constexpr int nStatusCodes = 4;
+constexpr int invalidStatusCode = nStatusCodes - 1;
+
+inline int getUserIndex(int index, JetConstituentStatus status)
 {
-  JetConstituentStatus status; // the status of each particle (Options are: TrueParticle (final state particles in generator event which arent special), HFParticle (heavy-flavour particle of interest in generator event), ThermalParticle (particles belonging to the thermal backgound), DecaySisterParticle (other particles poduced in the decay resulting in a non-prompt heavy-flavour particle of interest))
-  int index;                   // a number unique to each particle in the event
-
- public:
-  fastjet_user_info()
-  {
-    status = JetConstituentStatus::invalidStatus;
-    index = -9;
-  }
-  fastjet_user_info(JetConstituentStatus _status, int _index)
-  {
-    status = _status;
-    index = _index;
-  }
-  ~fastjet_user_info() = default;
-  void setStatus(JetConstituentStatus set) { status = set; }
-  void setIndex(int set) { index = set; }
-  JetConstituentStatus getStatus() const { return status; }
-  int getIndex() const { return index; }
-};
+  return index * nStatusCodes + (status == JetConstituentStatus::invalidStatus ? invalidStatusCode : static_cast<int>(status));
+}
+
+inline int getStatusCode(int userIndex)
+{
+  int statusCode = userIndex % nStatusCodes;
+  return statusCode < 0 ? statusCode + nStatusCodes : statusCode;
+}
+
+/**
+ * returns the status of a constituent, as set by the fill functions
+ *
+ * @param constituent pseudojet of the constituent
+ */
+inline JetConstituentStatus getConstituentStatus(const fastjet::PseudoJet& constituent)
+{
+  int statusCode = getStatusCode(constituent.user_index());
+  return statusCode == invalidStatusCode ? JetConstituentStatus::invalidStatus : static_cast<JetConstituentStatus>(statusCode);
+}
+
+/**
+ * returns the index of a constituent, as set by the fill functions
+ *
+ * @param constituent pseudojet of the constituent
+ */
+inline int getConstituentIndex(const fastjet::PseudoJet& constituent)
+{
+  return (constituent.user_index() - getStatusCode(constituent.user_index())) / nStatusCodes;
+}
 
 /**
- * Set the fastjet_user_info object when filling the jet constituents.
+ * Set the status and index of the last filled jet constituent.
  *
  * @param constituents vector of constituents to be clustered.
  * @param index global index of constituent
@@ -16,11 +16,15 @@
 
 #include "PWGJE/Core/JetFinder.h"
 
+#include <fastjet/ClusterSequence.hh>
+#include <fastjet/ClusterSequenceActiveAreaExplicitGhosts.hh>
 #include <fastjet/ClusterSequenceArea.hh>
 #include <fastjet/JetDefinition.hh>
 #include <fastjet/PseudoJet.hh>
 #include <fastjet/Selector.hh>
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 /// Sets the jet finding parameters
@@ -38,7 +42,7 @@ void JetFinder::setParams()
   }
   float jetRForClustering = isReclustering ? 5.0 * jetR : jetR;
 
-  selGhosts = fastjet::SelectorRapRange(etaMin, etaMax) && fastjet::SelectorPhiRange(phiMin, phiMax); // note that this is rapidity not eta but since ghosts are effectively massless this is ok
+  selGhosts = fastjet::SelectorRapRange(etaMin, etaMax) && fastjet::SelectorPhiRange(phiMin, phiMax) && selGhostRegion; // note that this is rapidity not eta but since ghosts are effectively massless this is ok
   // ghostAreaSpec=fastjet::GhostedAreaSpec(selGhosts,ghostRepeatN,ghostArea,gridScatter,ktScatter,ghostktMean);
   ghostAreaSpec = fastjet::GhostedAreaSpec(selGhosts, ghostRepeatN, ghostArea, gridScatter, ktScatter, ghostktMean);
   jetDef = fastjet::JetDefinition(fastjet::antikt_algorithm, jetRForClustering, recombScheme, strategy);
@@ -65,3 +69,66 @@ fastjet::ClusterSequenceArea JetFinder::findJets(std::vector<fastjet::PseudoJet>
   jets = fastjet::sorted_by_pt(jets);
   return clusterSeq;
 }
+
+/// Performs jet finding for several jet radii on the same input particles
+/// \note with active areas and one ghost repetition the ghosts are generated once and shared by all radii,
+///       and for the Cambridge/Aachen algorithm the jets of all radii are taken from the clustering history at the largest radius
+/// \param inputParticles vector of input particles/tracks
+/// \param jetRadii jet radii
+/// \param jets vector of jets to be filled for each radius
+/// \param clusterSeqs cluster sequences which own the jets, to be kept alive as long as the jets are used
+void JetFinder::findJets(std::vector<fastjet::PseudoJet>& inputParticles, std::vector<double> const& jetRadii, std::vector<std::vector<fastjet::PseudoJet>>& jets, std::vector<std::unique_ptr<fastjet::ClusterSequence>>& clusterSeqs)
+{
+  jets.clear();
+  jets.resize(jetRadii.size());
+  clusterSeqs.clear();
+  if (jetRadii.empty()) {
+    return;
+  }
+
+  bool sharedGhosts = (areaType == fastjet::active_area || areaType == fastjet::active_area_explicit_ghosts) && ghostRepeatN == 1;
+  if (!sharedGhosts) { // independent clustering for each radius, as in the single radius case
+    for (std::size_t iR = 0; iR < jetRadii.size(); iR++) {
+      jetR = jetRadii[iR];
+      setParams();
+      auto clusterSeq = std::make_unique<fastjet::ClusterSequenceArea>(inputParticles, jetDef, areaDef);
+      jets[iR] = fastjet::sorted_by_pt(selJets(clusterSeq->inclusive_jets()));
+      clusterSeqs.push_back(std::move(clusterSeq));
+    }
+    return;
+  }
+
+  // the ghosts only depend on the acceptance, not on the radius
+  setParams();
+  std::vector<fastjet::PseudoJet> ghosts;
+  ghostAreaSpec.add_ghosts(ghosts);
+  double actualGhostArea = ghostAreaSpec.actual_ghost_area();
+
+  if (algorithm == fastjet::cambridge_algorithm) {
+    // C/A merges pairs in the order of their distance and stops at the radius, so the inclusive jets at a smaller radius r
+    // are the exclusive jets of the clustering at the largest radius R with dcut = (r/R)^2
+    double maxR = *std::max_element(jetRadii.begin(), jetRadii.end());
+    jetR = maxR;
+    setParams();
+    auto clusterSeq = std::make_unique<fastjet::ClusterSequenceActiveAreaExplicitGhosts>(inputParticles, jetDef, ghosts, actualGhostArea);
+    for (std::size_t iR = 0; iR < jetRadii.size(); iR++) {
+      jetR = jetRadii[iR];
+      setParams(); // jet selection depends on the radius
+      if (jetR < maxR) {
+        jets[iR] = fastjet::sorted_by_pt((selNoGhosts && selJets)(clusterSeq->exclusive_jets((jetR / maxR) * (jetR / maxR))));
+      } else {
+        jets[iR] = fastjet::sorted_by_pt((selNoGhosts && selJets)(clusterSeq->inclusive_jets()));
+      }
+    }
+    clusterSeqs.push_back(std::move(clusterSeq));
+    return;
+  }
+
+  for (std::size_t iR = 0; iR < jetRadii.size(); iR++) {
+    jetR = jetRadii[iR];
+    setParams();
+    auto clusterSeq = std::make_unique<fastjet::ClusterSequenceActiveAreaExplicitGhosts>(inputParticles, jetDef, ghosts, actualGhostArea);
+    jets[iR] = fastjet::sorted_by_pt((selNoGhosts && selJets)(clusterSeq->inclusive_jets()));
+    clusterSeqs.push_back(std::move(clusterSeq));
+  }
+}
@@ -19,6 +19,7 @@
 #define PWGJE_CORE_JETFINDER_H_
 
 #include <fastjet/AreaDefinition.hh>
+#include <fastjet/ClusterSequence.hh>
 #include <fastjet/ClusterSequenceArea.hh>
 #include <fastjet/GhostedAreaSpec.hh>
 #include <fastjet/JetDefinition.hh>
@@ -27,6 +28,7 @@
 
 #include <Rtypes.h>
 
+#include <memory>
 #include <vector>
 
 #include <math.h>
@@ -80,6 +82,7 @@ class JetFinder
   fastjet::AreaDefinition areaDef;
   fastjet::Selector selJets;
   fastjet::Selector selGhosts;
+  fastjet::Selector selGhostRegion = fastjet::SelectorIdentity(); // optional restriction of the ghosts within the acceptance, e.g. to the neighbourhood of a candidate
   double fastjetExtraParam = -99.0;
 
   /// Sets the jet finding parameters
@@ -92,6 +95,18 @@ class JetFinder
   /// \return ClusterSequenceArea object needed to access constituents
   fastjet::ClusterSequenceArea findJets(std::vector<fastjet::PseudoJet>& inputParticles, std::vector<fastjet::PseudoJet>& jets); // ideally find a way of passing the cluster sequence as a reeference
 
+  /// Performs jet finding for several jet radii on the same input particles
+  /// \note with active areas and one ghost repetition the ghosts are generated once and shared by all radii,
+  ///       and for the Cambridge/Aachen algorithm the jets of all radii are taken from the clustering history at the largest radius.
+  ///       The jets of the shared clusterings can contain ghosts in their constituents, which can be removed with selNoGhosts
+  /// \param inputParticles vector of input particles/tracks
+  /// \param jetRadii jet radii
+  /// \param jets vector of jets to be filled for each radius
+  /// \param clusterSeqs cluster sequences which own the jets, to be kept alive as long as the jets are used
+  void findJets(std::vector<fastjet::PseudoJet>& inputParticles, std::vector<double> const& jetRadii, std::vector<std::vector<fastjet::PseudoJet>>& jets, std::vector<std::unique_ptr<fastjet::ClusterSequence>>& clusterSeqs);
+
+  fastjet::Selector selNoGhosts = !fastjet::SelectorIsPureGhost();
+
  private:
   ClassDefNV(JetFinder, 1);
 };
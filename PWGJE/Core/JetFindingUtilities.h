@@ -31,10 +31,13 @@
 
 #include <THn.h>
 
-#include <fastjet/ClusterSequenceArea.hh>
+#include <fastjet/ClusterSequence.hh>
 #include <fastjet/PseudoJet.hh>
+#include <fastjet/Selector.hh>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -213,6 +216,102 @@ bool analyseCandidateMC(std::vector<fastjet::PseudoJet>& inputParticles, T const
   return analyseCandidate(inputParticles, candidate, candPtMin, candPtMax, candYMin, candYMax);
 }
 
+/**
+ * Adds the tracks of an event, which were filled once for all candidates of the event, to a fastjet inputParticles list excluding the daughters of a candidate
+ *
+ * @param inputParticles fastjet container
+ * @param eventParticles selected tracks of the event, filled with analyseTracks without candidate
+ * @param candidate hf candidate
+ */
+template <typename T>
+void analyseEventTracks(std::vector<fastjet::PseudoJet>& inputParticles, std::vector<fastjet::PseudoJet> const& eventParticles, T const& candidate)
+{
+  struct TrackIndex { // the daughter checks only need the global index of the track
+    int index;
+    int globalIndex() const { return index; }
+  };
+  for (const auto& particle : eventParticles) {
+    TrackIndex track{fastjetutilities::getConstituentIndex(particle)};
+    if (!jetcandidateutilities::isDaughterTrack(track, candidate)) {
+      inputParticles.push_back(particle);
+    }
+  }
+}
+
+/**
+ * Selects the input particles which can be clustered together with a candidate.
+ * Starting from the candidate, all particles within the given distance in rapidity and azimuth of the rapidity-azimuth box spanned
+ * by the selected particles are added, until no particle is added anymore.
+ * This is an approximation of the clustering of the whole event, meant for anti-kT with twice the largest jet radius as distance:
+ * the jets containing the candidate only differ if recombined pseudojets leave the box of their constituents, which the E-scheme
+ * allows for massive pseudojets. It is not valid for kT and C/A, where the ghosts and soft particles can chain the clustering over
+ * larger distances. Only the jets containing the candidate can be used: the ghosts for the area calculation are restricted to the
+ * same region via jetFinder.selGhostRegion, so that the areas of the other jets at the edge of the region are clipped.
+ *
+ * @param inputParticles fastjet container, with the candidate as first entry
+ * @param localParticles fastjet container filled with the selected particles
+ * @param distance maximum distance of a selected particle to the box of the already selected particles
+ * @param jetFinder JetFinder object whose ghost region is set
+ */
+inline void selectCandidateNeighbourhood(std::vector<fastjet::PseudoJet> const& inputParticles, std::vector<fastjet::PseudoJet>& localParticles, double distance, JetFinder& jetFinder)
+{
+  localParticles.clear();
+  jetFinder.selGhostRegion = fastjet::SelectorIdentity();
+  if (inputParticles.empty()) {
+    return;
+  }
+  const auto& candidate = inputParticles[0];
+  double candidateRap = candidate.rap();
+  double candidatePhi = candidate.phi();
+
+  std::vector<char> isSelected(inputParticles.size(), 0);
+  isSelected[0] = 1;
+  double rapMin = candidateRap, rapMax = candidateRap;
+  double deltaPhiMin = 0., deltaPhiMax = 0.;
+  bool isFullAzimuth = false;
+  bool isAdded = true;
+  while (isAdded) {
+    isAdded = false;
+    for (std::size_t i = 1; i < inputParticles.size(); i++) {
+      if (isSelected[i]) {
+        continue;
+      }
+      double rap = inputParticles[i].rap();
+      if (rap < rapMin - distance || rap > rapMax + distance) {
+        continue;
+      }
+      double deltaPhi = inputParticles[i].delta_phi_to(candidate); // in [-pi, pi)
+      if (!isFullAzimuth) {
+        if (deltaPhi < deltaPhiMin - distance) { // the box can extend beyond +-pi
+          deltaPhi += 2. * M_PI;
+        } else if (deltaPhi > deltaPhiMax + distance) {
+          deltaPhi -= 2. * M_PI;
+        }
+        if (deltaPhi < deltaPhiMin - distance || deltaPhi > deltaPhiMax + distance) {
+          continue;
+        }
+        deltaPhiMin = std::min(deltaPhiMin, deltaPhi);
+        deltaPhiMax = std::max(deltaPhiMax, deltaPhi);
+        isFullAzimuth = (deltaPhiMax - deltaPhiMin + 2. * distance >= 2. * M_PI);
+      }
+      rapMin = std::min(rapMin, rap);
+      rapMax = std::max(rapMax, rap);
+      isSelected[i] = 1;
+      isAdded = true;
+    }
+  }
+
+  for (std::size_t i = 0; i < inputParticles.size(); i++) {
+    if (isSelected[i]) {
+      localParticles.push_back(inputParticles[i]);
+    }
+  }
+  jetFinder.selGhostRegion = fastjet::SelectorRapRange(rapMin - distance, rapMax + distance);
+  if (!isFullAzimuth) {
+    jetFinder.selGhostRegion &= fastjet::SelectorPhiRange(candidatePhi + deltaPhiMin - distance, candidatePhi + deltaPhiMax + distance);
+  }
+}
+
 /**
  * Adds hf candidates to a fastjet inputParticles list (for data)
  *
@@ -283,44 +382,53 @@ void findJets(JetFinder& jetFinder, std::vector<fastjet::PseudoJet>& inputPartic
   auto jetRValues = static_cast<std::vector<double>>(jetRadius);
   jetFinder.jetPtMin = jetPtMin;
   jetFinder.jetPtMax = jetPtMax;
-  for (auto R : jetRValues) {
-    jetFinder.jetR = R;
-    std::vector<fastjet::PseudoJet> jets;
-    fastjet::ClusterSequenceArea clusterSeq(jetFinder.findJets(inputParticles, jets));
-    for (const auto& jet : jets) {
+  std::vector<std::vector<fastjet::PseudoJet>> jetsPerRadius;
+  std::vector<std::unique_ptr<fastjet::ClusterSequence>> clusterSeqs;
+  jetFinder.findJets(inputParticles, jetRValues, jetsPerRadius, clusterSeqs); // all radii at once, sharing the ghosts
+  std::vector<fastjet::PseudoJet> jetConstituents; // reused for all jets of the event
+  std::vector<int> tracks;
+  std::vector<int> cands;
+  std::vector<int> clusters;
+  for (std::size_t iR = 0; iR < jetRValues.size(); iR++) {
+    auto R = jetRValues[iR];
+    for (const auto& jet : jetsPerRadius[iR]) {
       if (jet.has_area() && jet.area() < jetAreaFractionMin * M_PI * R * R) {
         continue;
       }
       if (fillThnSparse) {
         thnSparseJet->Fill(R, jet.pt(), jet.eta(), jet.phi()); // important for normalisation in V0Jet analyses to store all jets, including those that aren't V0s
       }
-      if (doCandidateJetFinding) {
-        bool isCandidateJet = false;
-        for (const auto& constituent : jet.constituents()) {
-          JetConstituentStatus constituentStatus = constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus();
-          if (constituentStatus == JetConstituentStatus::candidate) { // note currently we cannot run V0 and HF in the same jet. If we ever need to we can seperate the loops
-            isCandidateJet = true;
-            break;
-          }
-        }
-        if (!isCandidateJet) {
+      jetConstituents.clear();
+      bool isCandidateJet = false;
+      for (const auto& constituent : jet.constituents()) {
+        JetConstituentStatus constituentStatus = fastjetutilities::getConstituentStatus(constituent);
+        if (constituentStatus == JetConstituentStatus::invalidStatus) { // ghosts
           continue;
         }
+        if (constituentStatus == JetConstituentStatus::candidate) { // note currently we cannot run V0 and HF in the same jet. If we ever need to we can seperate the loops
+          isCandidateJet = true;
+        }
+        jetConstituents.push_back(constituent);
+      }
+      if (doCandidateJetFinding && !isCandidateJet) {
+        continue;
       }
-      std::vector<int> tracks;
-      std::vector<int> cands;
-      std::vector<int> clusters;
+      tracks.clear();
+      cands.clear();
+      clusters.clear();
       jetsTable(collision.globalIndex(), jet.pt(), jet.eta(), jet.phi(),
                 jet.E(), jet.rapidity(), jet.m(), jet.has_area() ? jet.area() : 0., std::round(R * 100));
-      for (const auto& constituent : sorted_by_pt(jet.constituents())) {
-        if (constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus() == JetConstituentStatus::track) {
-          tracks.push_back(constituent.template user_info<fastjetutilities::fastjet_user_info>().getIndex());
+      std::sort(jetConstituents.begin(), jetConstituents.end(), [](const fastjet::PseudoJet& a, const fastjet::PseudoJet& b) { return a.kt2() > b.kt2(); }); // same ordering as sorted_by_pt
+      for (const auto& constituent : jetConstituents) {
+        JetConstituentStatus constituentStatus = fastjetutilities::getConstituentStatus(constituent);
+        if (constituentStatus == JetConstituentStatus::track) {
+          tracks.push_back(fastjetutilities::getConstituentIndex(constituent));
         }
-        if (constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus() == JetConstituentStatus::cluster) {
-          clusters.push_back(constituent.template user_info<fastjetutilities::fastjet_user_info>().getIndex());
+        if (constituentStatus == JetConstituentStatus::cluster) {
+          clusters.push_back(fastjetutilities::getConstituentIndex(constituent));
         }
-        if (constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus() == JetConstituentStatus::candidate) {
-          cands.push_back(constituent.template user_info<fastjetutilities::fastjet_user_info>().getIndex());
+        if (constituentStatus == JetConstituentStatus::candidate) {
+          cands.push_back(fastjetutilities::getConstituentIndex(constituent));
         }
       }
       constituentsTable(jetsTable.lastIndex(), tracks, clusters, cands);
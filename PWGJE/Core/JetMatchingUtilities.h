@@ -34,10 +34,13 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <numeric>
 #include <ostream>
 #include <stdexcept>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <math.h>
@@ -433,6 +436,47 @@ auto constexpr getConstituentId(T const& track)
   }
 }
 
+/**
+ * adds the pT of the base candidates which are matched to the tag candidates
+ */
+template <bool jetsBaseIsMc, bool jetsTagIsMc, typename U, typename P, typename R, typename S>
+void addCandidatePtSum(float& ptSum, U const& candidatesBase, P const& candidatesTag, R const& fullTracksBase, S const& fullTracksTag)
+{
+  if constexpr (jetsTagIsMc) {
+    for (auto const& candidateBase : candidatesBase) {
+      if (jetcandidateutilities::isMatchedCandidate(candidateBase)) {
+        const auto candidateBaseMcId = jetcandidateutilities::matchedParticleId(candidateBase, fullTracksBase, fullTracksTag);
+        for (auto const& candidateTag : candidatesTag) {
+          const auto candidateTagId = candidateTag.mcParticleId();
+          if (candidateBaseMcId == candidateTagId) {
+            ptSum += candidateBase.pt();
+          }
+        }
+      }
+    }
+  } else if constexpr (jetsBaseIsMc) {
+    for (auto const& candidateTag : candidatesTag) {
+      if (jetcandidateutilities::isMatchedCandidate(candidateTag)) {
+        const auto candidateTagMcId = jetcandidateutilities::matchedParticleId(candidateTag, fullTracksTag, fullTracksBase);
+        for (auto const& candidateBase : candidatesBase) {
+          const auto candidateBaseId = candidateBase.mcParticleId();
+          if (candidateTagMcId == candidateBaseId) {
+            ptSum += candidateTag.pt();
+          }
+        }
+      }
+    }
+  } else {
+    for (auto const& candidateBase : candidatesBase) {
+      for (auto const& candidateTag : candidatesTag) {
+        if (candidateBase.globalIndex() == candidateTag.globalIndex()) {
+          ptSum += candidateBase.pt();
+        }
+      }
+    }
+  }
+}
+
 template <bool isEMCAL, bool isCandidate, bool jetsBaseIsMc, bool jetsTagIsMc, typename T, typename U, typename V, typename O, typename P, typename Q, typename R, typename S>
 float getPtSum(T const& tracksBase, U const& candidatesBase, V const& clustersBase, O const& tracksTag, P const& candidatesTag, Q const& clustersTag, R const& fullTracksBase, S const& fullTracksTag)
 {
@@ -492,39 +536,7 @@ float getPtSum(T const& tracksBase, U const& candidatesBase, V const& clustersBa
     }
   }
   if constexpr (isCandidate) {
-    if constexpr (jetsTagIsMc) {
-      for (auto const& candidateBase : candidatesBase) {
-        if (jetcandidateutilities::isMatchedCandidate(candidateBase)) {
-          const auto candidateBaseMcId = jetcandidateutilities::matchedParticleId(candidateBase, fullTracksBase, fullTracksTag);
-          for (auto const& candidateTag : candidatesTag) {
-            const auto candidateTagId = candidateTag.mcParticleId();
-            if (candidateBaseMcId == candidateTagId) {
-              ptSum += candidateBase.pt();
-            }
-          }
-        }
-      }
-    } else if constexpr (jetsBaseIsMc) {
-      for (auto const& candidateTag : candidatesTag) {
-        if (jetcandidateutilities::isMatchedCandidate(candidateTag)) {
-          const auto candidateTagMcId = jetcandidateutilities::matchedParticleId(candidateTag, fullTracksTag, fullTracksBase);
-          for (auto const& candidateBase : candidatesBase) {
-            const auto candidateBaseId = candidateBase.mcParticleId();
-            if (candidateTagMcId == candidateBaseId) {
-              ptSum += candidateTag.pt();
-            }
-          }
-        }
-      }
-    } else {
-      for (auto const& candidateBase : candidatesBase) {
-        for (auto const& candidateTag : candidatesTag) {
-          if (candidateBase.globalIndex() == candidateTag.globalIndex()) {
-            ptSum += candidateBase.pt();
-          }
-        }
-      }
-    }
+    addCandidatePtSum<jetsBaseIsMc, jetsTagIsMc>(ptSum, candidatesBase, candidatesTag, fullTracksBase, fullTracksTag);
   }
   return ptSum;
 }
@@ -543,9 +555,110 @@ auto getConstituents(T const& jet, U const& /*constituents*/)
   }
 }
 
+/**
+ * index of the jets of a collision containing each constituent, built once per collision and shared by all jet pairs.
+ * The jets of a constituent are kept in a list linked through the entries, so that no container is allocated per constituent
+ */
+class ConstituentJetIndex
+{
+ public:
+  void clear()
+  {
+    firstEntry.clear();
+    entries.clear();
+  }
+
+  // the jets have to be added one after the other, a constituent is only added once per jet
+  void add(int64_t constituentId, int jetIndex)
+  {
+    auto [iterator, isNew] = firstEntry.try_emplace(constituentId, static_cast<int>(entries.size()));
+    if (isNew) {
+      entries.emplace_back(jetIndex, -1);
+      return;
+    }
+    if (entries[iterator->second].first == jetIndex) {
+      return;
+    }
+    entries.emplace_back(jetIndex, iterator->second);
+    iterator->second = static_cast<int>(entries.size()) - 1;
+  }
+
+  template <typename F>
+  void forEachJet(int64_t constituentId, F&& function) const
+  {
+    auto iterator = firstEntry.find(constituentId);
+    if (iterator == firstEntry.end()) {
+      return;
+    }
+    for (int iEntry = iterator->second; iEntry != -1; iEntry = entries[iEntry].second) {
+      function(entries[iEntry].first);
+    }
+  }
+
+ private:
+  std::unordered_map<int64_t, int> firstEntry; // constituent id -> last added entry
+  std::vector<std::pair<int, int>> entries;    // jet index, previous entry of the same constituent
+};
+
+// pt matching of the base jets to the tag jets for track and candidate constituents. The shared track pt of a base jet with all tag jets is obtained in one pass over its tracks
+template <bool isCandidate, bool jetsBaseIsMc, bool jetsTagIsMc, typename T, typename U, typename V, typename M, typename O, typename P>
+void MatchPtIndexed(T const& jetsBasePerCollision, U const& jetsTagPerCollision, std::vector<std::vector<int>>& baseToTagMatchingPt, V const& tracksBase, M const& candidatesBase, O const& tracksTag, P const& candidatesTag, float minPtFraction)
+{
+  ConstituentJetIndex tagJetsPerConstituent;
+  std::vector<int> jetsTagR;
+  for (const auto& jetTag : jetsTagPerCollision) {
+    int iJetTag = static_cast<int>(jetsTagR.size());
+    jetsTagR.push_back(static_cast<int>(std::round(jetTag.r())));
+    for (const auto& trackTag : getConstituents(jetTag, tracksTag)) {
+      auto trackTagId = getConstituentId<jetsBaseIsMc>(trackTag);
+      if (trackTagId != -1) {
+        tagJetsPerConstituent.add(trackTagId, iJetTag);
+      }
+    }
+  }
+
+  std::vector<float> ptSums(jetsTagR.size());
+  for (const auto& jetBase : jetsBasePerCollision) {
+    int jetBaseR = static_cast<int>(std::round(jetBase.r()));
+    std::fill(ptSums.begin(), ptSums.end(), 0.f);
+    for (const auto& trackBase : getConstituents(jetBase, tracksBase)) {
+      auto trackBaseId = getConstituentId<jetsTagIsMc>(trackBase);
+      if (trackBaseId == -1) {
+        continue;
+      }
+      tagJetsPerConstituent.forEachJet(trackBaseId, [&](int iJetTag) {
+        if (jetsTagR[iJetTag] == jetBaseR) {
+          ptSums[iJetTag] += trackBase.pt();
+        }
+      });
+    }
+    int iJetTag = 0;
+    for (const auto& jetTag : jetsTagPerCollision) {
+      float ptSum = ptSums[iJetTag++];
+      if (std::round(jetBase.r()) != std::round(jetTag.r())) {
+        continue;
+      }
+      if constexpr (isCandidate) {
+        addCandidatePtSum<jetsBaseIsMc, jetsTagIsMc>(ptSum, getConstituents(jetBase, candidatesBase), getConstituents(jetTag, candidatesTag), tracksBase, tracksTag);
+      }
+      if (ptSum > jetBase.pt() * minPtFraction) {
+        baseToTagMatchingPt[jetBase.globalIndex()].push_back(jetTag.globalIndex());
+      }
+    }
+  }
+}
+
 template <bool jetsBaseIsMc, bool jetsTagIsMc, typename T, typename U, typename V, typename M, typename N, typename O, typename P, typename Q>
 void MatchPt(T const& jetsBasePerCollision, U const& jetsTagPerCollision, std::vector<std::vector<int>>& baseToTagMatchingPt, std::vector<std::vector<int>>& tagToBaseMatchingPt, V const& tracksBase, M const& candidatesBase, N const& clustersBase, O const& tracksTag, P const& candidatesTag, Q const& clustersTag, float minPtFraction)
 {
+  constexpr bool IsEMCAL{jetfindingutilities::isEMCALClusterTable<N>() || jetfindingutilities::isEMCALClusterTable<Q>()};
+  constexpr bool IsCandidate{(jetcandidateutilities::isCandidateTable<M>() || jetcandidateutilities::isCandidateMcTable<M>()) && (jetcandidateutilities::isCandidateTable<P>() || jetcandidateutilities::isCandidateMcTable<P>())};
+  if constexpr (!IsEMCAL) {
+    MatchPtIndexed<IsCandidate, jetsBaseIsMc, jetsTagIsMc>(jetsBasePerCollision, jetsTagPerCollision, baseToTagMatchingPt, tracksBase, candidatesBase, tracksTag, candidatesTag, minPtFraction);
+    MatchPtIndexed<IsCandidate, jetsTagIsMc, jetsBaseIsMc>(jetsTagPerCollision, jetsBasePerCollision, tagToBaseMatchingPt, tracksTag, candidatesTag, tracksBase, candidatesBase, minPtFraction);
+    return;
+  }
+  // with EMCal clusters the tracks already matched to the tag tracks are excluded from the cluster matching of each jet pair
   float ptSumBase;
   float ptSumTag;
   for (const auto& jetBase : jetsBasePerCollision) {
@@ -560,8 +673,6 @@ void MatchPt(T const& jetsBasePerCollision, U const& jetsTagPerCollision, std::v
       auto jetTagClusters = getConstituents(jetTag, clustersTag);
       auto jetTagCandidates = getConstituents(jetTag, candidatesTag);
 
-      constexpr bool IsEMCAL{jetfindingutilities::isEMCALClusterTable<N>() || jetfindingutilities::isEMCALClusterTable<Q>()};
-      constexpr bool IsCandidate{(jetcandidateutilities::isCandidateTable<M>() || jetcandidateutilities::isCandidateMcTable<M>()) && (jetcandidateutilities::isCandidateTable<P>() || jetcandidateutilities::isCandidateMcTable<P>())};
       ptSumBase = getPtSum<IsEMCAL, IsCandidate, jetsBaseIsMc, jetsTagIsMc>(jetBaseTracks, jetBaseCandidates, jetBaseClusters, jetTagTracks, jetTagCandidates, jetTagClusters, tracksBase, tracksTag);
       ptSumTag = getPtSum<IsEMCAL, IsCandidate, jetsTagIsMc, jetsBaseIsMc>(jetTagTracks, jetTagCandidates, jetTagClusters, jetBaseTracks, jetBaseCandidates, jetBaseClusters, tracksTag, tracksBase);
       if (ptSumBase > jetBase.pt() * minPtFraction) {
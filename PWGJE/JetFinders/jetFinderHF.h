@@ -32,6 +32,7 @@
 #include <Framework/HistogramRegistry.h>
 #include <Framework/HistogramSpec.h>
 #include <Framework/InitContext.h>
+#include <Framework/Logger.h>
 #include <Framework/O2DatabasePDGPlugin.h>
 #include <Framework/runDataProcessing.h> // IWYU pragma: export
 
@@ -40,7 +41,10 @@
 
 #include <fastjet/JetDefinition.hh>
 #include <fastjet/PseudoJet.hh>
+#include <fastjet/Selector.hh>
 
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -115,6 +119,7 @@ struct JetFinderHFTask {
   o2::framework::Configurable<int> jetPtBinWidth{"jetPtBinWidth", 5, "used to define the width of the jetPt bins for the THnSparse"};
   o2::framework::Configurable<bool> fillTHnSparse{"fillTHnSparse", false, "switch to fill the THnSparse"};
   o2::framework::Configurable<double> jetExtraParam{"jetExtraParam", -99.0, "sets the _extra_param in fastjet"};
+  o2::framework::Configurable<bool> doLocalCandidateClustering{"doLocalCandidateClustering", false, "cluster only the neighbourhood of each candidate, within twice the largest jet radius, instead of the whole event. Only for anti-kT, ignored if fillTHnSparse is set as the THnSparse is filled from the clustering of the whole event"};
 
   o2::framework::Service<o2::framework::O2DatabasePDG> pdgDatabase;
   int trackSelection = -1;
@@ -123,6 +128,10 @@ struct JetFinderHFTask {
 
   JetFinder jetFinder;
   std::vector<fastjet::PseudoJet> inputParticles;
+  std::vector<fastjet::PseudoJet> eventParticles; // selected tracks of the event, shared by all its candidates
+  std::vector<fastjet::PseudoJet> localParticles; // neighbourhood of the candidate
+  double maxJetRadius = 0.;
+  bool isLocalCandidateClustering = false; // doLocalCandidateClustering, if compatible with the other settings
 
   std::vector<int> triggerMaskBits;
 
@@ -166,7 +175,13 @@ struct JetFinderHFTask {
     }
     jetFinder.fastjetExtraParam = jetExtraParam;
 
+    isLocalCandidateClustering = doLocalCandidateClustering && !fillTHnSparse && jetFinder.algorithm == fastjet::antikt_algorithm;
+    if (doLocalCandidateClustering && !isLocalCandidateClustering) {
+      LOGF(info, "doLocalCandidateClustering requires the anti-kT algorithm and fillTHnSparse disabled, the whole event is clustered");
+    }
+
     auto jetRadiiBins = (std::vector<double>)jetRadius;
+    maxJetRadius = *std::max_element(jetRadiiBins.begin(), jetRadiiBins.end());
     if (jetRadiiBins.size() > 1) {
       jetRadiiBins.push_back(jetRadiiBins[jetRadiiBins.size() - 1] + (TMath::Abs(jetRadiiBins[jetRadiiBins.size() - 1] - jetRadiiBins[jetRadiiBins.size() - 2])));
     } else {
@@ -210,6 +225,28 @@ struct JetFinderHFTask {
   o2::framework::PresliceOptional<o2::soa::Filtered<JetTracksSubTable>> perDielectronCandidate = o2::aod::bkgdielectron::candidateId;
   o2::framework::PresliceOptional<o2::soa::Filtered<JetTracksSubTable>> perDielectronMcCandidate = o2::aod::bkgdielectronmc::candidateId;
 
+  // fills the selected tracks of the event once, the daughters of each candidate are removed in analyseCharged
+  template <typename T>
+  void fillEventTracks(T const& tracks)
+  {
+    eventParticles.clear();
+    jetfindingutilities::analyseTracks<T, typename T::iterator>(eventParticles, tracks, trackSelection);
+  }
+
+  // clusters the input particles of a candidate, with the candidate as first input particle, and fills the jets containing the candidate
+  // the THnSparse is only filled from the clustering of the whole event, which contains all jets of the event
+  template <typename T, typename M, typename N>
+  void findCandidateJets(T const& collision, M& jetsTableInput, N& constituentsTableInput, std::shared_ptr<THn> thnSparseJet, float minJetPt, float maxJetPt)
+  {
+    if (!isLocalCandidateClustering) {
+      jetfindingutilities::findJets(jetFinder, inputParticles, minJetPt, maxJetPt, jetRadius, jetAreaFractionMin, collision, jetsTableInput, constituentsTableInput, thnSparseJet, fillTHnSparse, true);
+      return;
+    }
+    jetfindingutilities::selectCandidateNeighbourhood(inputParticles, localParticles, 2. * maxJetRadius, jetFinder);
+    jetfindingutilities::findJets(jetFinder, localParticles, minJetPt, maxJetPt, jetRadius, jetAreaFractionMin, collision, jetsTableInput, constituentsTableInput, thnSparseJet, false, true);
+    jetFinder.selGhostRegion = fastjet::SelectorIdentity();
+  }
+
   // function that generalically processes Data and reco level events
   template <bool isMC, bool isEvtWiseSub, typename T, typename U, typename V, typename M, typename N, typename O>
   void analyseCharged(T const& collision, U const& tracks, V const& candidate, M& jetsTableInput, N& constituentsTableInput, O& /*originalTracks*/, float minJetPt, float maxJetPt)
@@ -231,9 +268,9 @@ struct JetFinderHFTask {
     if constexpr (isEvtWiseSub) {
       jetfindingutilities::analyseTracks<U, typename U::iterator>(inputParticles, tracks, trackSelection);
     } else {
-      jetfindingutilities::analyseTracks(inputParticles, tracks, trackSelection, &candidate);
+      jetfindingutilities::analyseEventTracks(inputParticles, eventParticles, candidate); // tracks are filled once per event in fillEventTracks
     }
-    jetfindingutilities::findJets(jetFinder, inputParticles, minJetPt, maxJetPt, jetRadius, jetAreaFractionMin, collision, jetsTableInput, constituentsTableInput, registry.get<THn>(HIST("hJet")), fillTHnSparse, true);
+    findCandidateJets(collision, jetsTableInput, constituentsTableInput, registry.get<THn>(HIST("hJet")), minJetPt, maxJetPt);
   }
 
   // function that generalically processes gen level events
@@ -257,7 +294,7 @@ struct JetFinderHFTask {
     } else {
       jetfindingutilities::analyseParticles<true>(inputParticles, particleSelection, jetTypeParticleLevel, particles, pdgDatabase, &candidate);
     }
-    jetfindingutilities::findJets(jetFinder, inputParticles, minJetPt, maxJetPt, jetRadius, jetAreaFractionMin, mcCollision, jetsTableInput, constituentsTableInput, registry.get<THn>(HIST("hJetMCP")), fillTHnSparse, true);
+    findCandidateJets(mcCollision, jetsTableInput, constituentsTableInput, registry.get<THn>(HIST("hJetMCP")), minJetPt, maxJetPt);
   }
 
   void processDummy(o2::aod::JetCollisions const&)
@@ -267,6 +304,7 @@ struct JetFinderHFTask {
 
   void processChargedJetsData(o2::soa::Filtered<o2::aod::JetCollisions>::iterator const& collision, o2::soa::Filtered<o2::aod::JetTracks> const& tracks, CandidateTableData const& candidates)
   {
+    fillEventTracks(tracks);
     for (typename CandidateTableData::iterator const& candidate : candidates) { // why can the type not be auto?  try const auto
       analyseCharged<false, false>(collision, tracks, candidate, jetsTable, constituentsTable, tracks, jetPtMin, jetPtMax);
     }
@@ -283,6 +321,7 @@ struct JetFinderHFTask {
 
   void processChargedJetsMCD(o2::soa::Filtered<o2::aod::JetCollisions>::iterator const& collision, o2::soa::Filtered<o2::aod::JetTracks> const& tracks, CandidateTableMCD const& candidates)
   {
+    fillEventTracks(tracks);
     for (typename CandidateTableMCD::iterator const& candidate : candidates) {
       analyseCharged<true, false>(collision, tracks, candidate, jetsTable, constituentsTable, tracks, jetPtMin, jetPtMax);
     }
@@ -187,8 +187,8 @@ struct JetFormationTimeReclustering {
       std::vector<int32_t> candidates;
       std::vector<int32_t> clusters;
       for (const auto& constituent : sorted_by_pt(parentSubJet2.constituents())) {
-        if (constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus() == JetConstituentStatus::track) {
-          tracks.push_back(constituent.template user_info<fastjetutilities::fastjet_user_info>().getIndex());
+        if (fastjetutilities::getConstituentStatus(constituent) == JetConstituentStatus::track) {
+          tracks.push_back(fastjetutilities::getConstituentIndex(constituent));
         }
       }
       splittingTable(jet.globalIndex(), tracks, clusters, candidates, parentSubJet2.perp(), parentSubJet2.eta(), parentSubJet2.phi(), 0);
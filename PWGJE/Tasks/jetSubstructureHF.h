@@ -196,7 +196,7 @@ struct JetSubstructureHFTask {
 
       int nHFInSubjet1 = 0;
       for (auto& subjet1Constituent : parentSubJet1.constituents()) {
-        if (subjet1Constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus() == JetConstituentStatus::candidate) {
+        if (fastjetutilities::getConstituentStatus(subjet1Constituent) == JetConstituentStatus::candidate) {
           nHFInSubjet1++;
         }
       }
@@ -218,11 +218,11 @@ struct JetSubstructureHFTask {
       std::vector<int32_t> candidates;
       std::vector<int32_t> clusters;
       for (const auto& constituent : sorted_by_pt(parentSubJet2.constituents())) {
-        if (constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus() == JetConstituentStatus::track) {
-          tracks.push_back(constituent.template user_info<fastjetutilities::fastjet_user_info>().getIndex());
+        if (fastjetutilities::getConstituentStatus(constituent) == JetConstituentStatus::track) {
+          tracks.push_back(fastjetutilities::getConstituentIndex(constituent));
         }
-        if (constituent.template user_info<fastjetutilities::fastjet_user_info>().getStatus() == JetConstituentStatus::candidate) {
-          candidates.push_back(constituent.template user_info<fastjetutilities::fastjet_user_info>().getIndex());
+        if (fastjetutilities::getConstituentStatus(constituent) == JetConstituentStatus::candidate) {
+          candidates.push_back(fastjetutilities::getConstituentIndex(constituent));
         }
       }
       splittingTable(jet.globalIndex(), tracks, clusters, candidates, parentSubJet2.perp(), parentSubJet2.eta(), parentSubJet2.phi(), 0);
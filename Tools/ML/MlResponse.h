@@ -17,16 +17,22 @@
 #ifndef TOOLS_ML_MLRESPONSE_H_
 #define TOOLS_ML_MLRESPONSE_H_
 
+#include "Tools/ML/TreeEnsembleModel.h"
 #include "Tools/ML/model.h"
 
 #include <CCDB/CcdbApi.h>
 #include <Framework/Array2D.h>
 #include <Framework/Logger.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <map>
+#include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace o2
@@ -148,13 +154,21 @@ class MlResponse
   /// Initialize class instance (initialize OnnxModels)
   /// \param enableOptimizations is a switch to enable optimizations
   /// \param threads is the number of active threads
-  void init(bool enableOptimizations = false, int threads = 0)
+  /// \param useNativeTreeEnsemble is a switch to evaluate the supported BDT models with the native tree-ensemble evaluation instead of ONNX Runtime
+  void init(bool enableOptimizations = false, int threads = 0, bool useNativeTreeEnsemble = false)
   {
     uint8_t counterModel{0};
     for (const auto& path : mPaths) {
       mModels[counterModel].initModel(path, enableOptimizations, threads);
       ++counterModel;
     }
+    mNativeModels = std::vector<o2::ml::TreeEnsembleModel>(mPaths.size());
+    mUseNativeModel = std::vector<bool>(mPaths.size(), false);
+    if (useNativeTreeEnsemble) {
+      for (std::size_t iModel{0}; iModel < mPaths.size(); ++iModel) {
+        mUseNativeModel[iModel] = initNativeModel(iModel);
+      }
+    }
   }
 
   /// Method to translate configurable input-feature strings into integers
@@ -178,20 +192,9 @@ class MlResponse
   template <typename T1, typename T2>
   std::vector<TypeOutputScore> getModelOutput(T1& input, const T2& nModel)
   {
-    if (nModel < 0 || static_cast<std::size_t>(nModel) >= mModels.size()) {
-      LOG(fatal) << "Model index " << nModel << " is out of range! The number of initialised models is " << mModels.size() << ". Please check your configurables.";
-    }
-
-    const int numInputNodes = mModels[nModel].getNumInputNodes();
-    const int numInputFeatures = static_cast<int>(input.size());
-
-    // Check that the number of input nodes in the model is equal to the number of input features, except for the case where the model input is dynamic (numInputNodes == -1)
-    if (numInputNodes != numInputFeatures && numInputNodes >= 0) {
-      LOG(fatal) << "Number of input nodes in the model " << mPaths[nModel] << " is different from the number of input features to be tested (" << numInputNodes << " vs " << numInputFeatures << ")";
-    }
-
-    TypeOutputScore* outputPtr = mModels[nModel].template evalModel<TypeOutputScore>(input);
-    return std::vector<TypeOutputScore>{outputPtr, outputPtr + mNClasses};
+    std::vector<TypeOutputScore> output;
+    fillModelOutput(input, nModel, output);
+    return output;
   }
 
   /// ML selections
@@ -202,21 +205,8 @@ class MlResponse
   bool isSelectedMl(T1& input, const T2& candVar)
   {
     int nModel = findBin(candVar);
-    auto output = getModelOutput(input, nModel);
-    uint8_t iClass{0};
-    for (const auto& outputValue : output) {
-      uint8_t dir = mCutDir.at(iClass);
-      if (dir != o2::cuts_ml::CutDirection::CutNot) {
-        if (dir == o2::cuts_ml::CutDirection::CutGreater && outputValue > mCuts.get(nModel, iClass)) {
-          return false;
-        }
-        if (dir == o2::cuts_ml::CutDirection::CutSmaller && outputValue < mCuts.get(nModel, iClass)) {
-          return false;
-        }
-      }
-      ++iClass;
-    }
-    return true;
+    fillModelOutput(input, nModel, mOutput);
+    return isSelectedScores(mOutput, nModel);
   }
 
   /// ML selections
@@ -228,21 +218,8 @@ class MlResponse
   bool isSelectedMl(T1& input, const T2& candVar, std::vector<TypeOutputScore>& output)
   {
     int nModel = findBin(candVar);
-    output = getModelOutput(input, nModel);
-    uint8_t iClass{0};
-    for (const auto& outputValue : output) {
-      uint8_t dir = mCutDir.at(iClass);
-      if (dir != o2::cuts_ml::CutDirection::CutNot) {
-        if (dir == o2::cuts_ml::CutDirection::CutGreater && outputValue > mCuts.get(nModel, iClass)) {
-          return false;
-        }
-        if (dir == o2::cuts_ml::CutDirection::CutSmaller && outputValue < mCuts.get(nModel, iClass)) {
-          return false;
-        }
-      }
-      ++iClass;
-    }
-    return true;
+    fillModelOutput(input, nModel, output);
+    return isSelectedScores(output, nModel);
   }
 
   /// ML selections
@@ -258,21 +235,80 @@ class MlResponse
       LOG(fatal) << "2D ML selection called on a class not configured for 2D bins";
     }
     int nModel = findBin2D(candVar1, candVar2);
-    output = getModelOutput(input, nModel);
-    uint8_t iClass{0};
-    for (const auto& outputValue : output) {
-      uint8_t dir = mCutDir.at(iClass);
-      if (dir != o2::cuts_ml::CutDirection::CutNot) {
-        if (dir == o2::cuts_ml::CutDirection::CutGreater && outputValue > mCuts.get(nModel, iClass)) {
-          return false;
-        }
-        if (dir == o2::cuts_ml::CutDirection::CutSmaller && outputValue < mCuts.get(nModel, iClass)) {
-          return false;
+    fillModelOutput(input, nModel, output);
+    return isSelectedScores(output, nModel);
+  }
+
+  /// Add a candidate to the inference batch of the model selected by the candidate variable
+  /// \param input is the input features
+  /// \param candVar is the variable value (e.g. pT) used to select which model to use
+  /// \return index of the candidate in the batch, used to retrieve its output after evaluateBatch()
+  template <typename T1, typename T2>
+  std::size_t addToBatch(const T1& input, const T2& candVar)
+  {
+    return addToBatchOfModel(input, findBin(candVar));
+  }
+
+  /// Add a candidate to the inference batch of the model selected by the candidate variables
+  /// \param input is the input features
+  /// \param candVar1 is the first variable value (e.g. pT) used to select which model to use
+  /// \param candVar2 is the second variable value (e.g. multiplicity) used to select which model to use
+  /// \return index of the candidate in the batch, used to retrieve its output after evaluateBatch()
+  template <typename T1, typename T2, typename T3>
+  std::size_t addToBatch(const T1& input, const T2& candVar1, const T3& candVar2)
+  {
+    return addToBatchOfModel(input, findBin2D(candVar1, candVar2));
+  }
+
+  /// Evaluate the candidates added to the batch, with one inference per model
+  void evaluateBatch()
+  {
+    for (std::size_t iModel{0}; iModel < mBatchNEntries.size(); ++iModel) {
+      if (mBatchNEntries[iModel] == 0) {
+        continue;
+      }
+      if (mUseNativeModel[iModel]) {
+        if (!mNativeModels[iModel].evalModelBatch(mBatchInputs[iModel], mBatchNEntries[iModel], mBatchOutputs[iModel])) {
+          LOG(fatal) << "Native batched inference of the model " << mPaths[iModel] << " failed!";
         }
+      } else if (!mModels[iModel].template evalModelBatch<TypeOutputScore>(mBatchInputs[iModel], mBatchNEntries[iModel], mBatchOutputs[iModel])) {
+        LOG(fatal) << "Batched inference of the model " << mPaths[iModel] << " failed!";
+      }
+      if (mBatchOutputs[iModel].size() != mBatchNEntries[iModel] * mNClasses) {
+        LOG(fatal) << "Output size of the model " << mPaths[iModel] << " (" << mBatchOutputs[iModel].size() << ") different from the expected one (" << mBatchNEntries[iModel] * mNClasses << ")!";
       }
-      ++iClass;
     }
-    return true;
+  }
+
+  /// Get the model predictions of a candidate of the evaluated batch
+  /// \param iCandidate is the index of the candidate returned by addToBatch()
+  /// \return pointer to the model prediction for each class, valid until the next call of clearBatch()
+  const TypeOutputScore* getBatchOutput(const std::size_t iCandidate) const
+  {
+    const auto& [nModel, iEntry] = mBatchCandidates[iCandidate];
+    return mBatchOutputs[nModel].data() + iEntry * mNClasses;
+  }
+
+  /// ML selections of a candidate of the evaluated batch
+  /// \param iCandidate is the index of the candidate returned by addToBatch()
+  /// \param output is a container to be filled with model output
+  /// \return boolean telling if model predictions pass the cuts
+  bool isSelectedMlBatch(const std::size_t iCandidate, std::vector<TypeOutputScore>& output)
+  {
+    const TypeOutputScore* scores = getBatchOutput(iCandidate);
+    output.assign(scores, scores + mNClasses);
+    return isSelectedScores(output, mBatchCandidates[iCandidate].first);
+  }
+
+  /// Remove all the candidates from the batch, keeping the buffers allocated for the next one
+  void clearBatch()
+  {
+    for (std::size_t iModel{0}; iModel < mBatchNEntries.size(); ++iModel) {
+      mBatchInputs[iModel].clear();
+      mBatchOutputs[iModel].clear();
+      mBatchNEntries[iModel] = 0;
+    }
+    mBatchCandidates.clear();
   }
 
  protected:
@@ -290,9 +326,172 @@ class MlResponse
   uint8_t mNVar2Bins = 1;                                 // number of bins of the second variable (e.g. multiplicity) used to select which model to use
   bool mUse2DBinning = false;                             // switch to enable/disable 2D binning
 
+  // buffers for the batched inference, their capacity is kept between batches
+  std::vector<std::vector<TypeOutputScore>> mBatchInputs;    // input features of the batched candidates, stored contiguously for each model
+  std::vector<std::vector<TypeOutputScore>> mBatchOutputs;   // model predictions of the batched candidates, stored contiguously for each model
+  std::vector<std::size_t> mBatchNEntries;                   // number of batched candidates for each model
+  std::vector<std::pair<int, std::size_t>> mBatchCandidates; // model index and position in the batch of the model for each batched candidate
+
+  // native evaluation of the BDT models, used instead of ONNX Runtime when enabled and validated at initialisation
+  std::vector<o2::ml::TreeEnsembleModel> mNativeModels; // TreeEnsembleModel objects, one for each bin
+  std::vector<bool> mUseNativeModel;                    // switch to use the native evaluation, one for each bin
+  std::vector<TypeOutputScore> mOutput;                 // model prediction of a single candidate, reused between candidates
+
   virtual void setAvailableInputFeatures() {} // method to fill the map of available input features
 
  private:
+  /// Applies the cuts on the model scores
+  /// \param output is the model prediction for each class
+  /// \param nModel is the model index
+  /// \return boolean telling if model predictions pass the cuts
+  bool isSelectedScores(const std::vector<TypeOutputScore>& output, const int nModel)
+  {
+    uint8_t iClass{0};
+    for (const auto& outputValue : output) {
+      uint8_t dir = mCutDir.at(iClass);
+      if (dir != o2::cuts_ml::CutDirection::CutNot) {
+        if (dir == o2::cuts_ml::CutDirection::CutGreater && outputValue > mCuts.get(nModel, iClass)) {
+          return false;
+        }
+        if (dir == o2::cuts_ml::CutDirection::CutSmaller && outputValue < mCuts.get(nModel, iClass)) {
+          return false;
+        }
+      }
+      ++iClass;
+    }
+    return true;
+  }
+
+  /// Fills the model predictions of a candidate
+  /// \param input a vector containing the values of features used in the model
+  /// \param nModel is the model index
+  /// \param output is a container to be filled with the model prediction for each class (its capacity is reused)
+  template <typename T1, typename T2>
+  void fillModelOutput(T1& input, const T2& nModel, std::vector<TypeOutputScore>& output)
+  {
+    if (nModel < 0 || static_cast<std::size_t>(nModel) >= mModels.size()) {
+      LOG(fatal) << "Model index " << nModel << " is out of range! The number of initialised models is " << mModels.size() << ". Please check your configurables.";
+    }
+
+    const int numInputNodes = mModels[nModel].getNumInputNodes();
+    const int numInputFeatures = static_cast<int>(input.size());
+
+    // Check that the number of input nodes in the model is equal to the number of input features, except for the case where the model input is dynamic (numInputNodes == -1)
+    if (numInputNodes != numInputFeatures && numInputNodes >= 0) {
+      LOG(fatal) << "Number of input nodes in the model " << mPaths[nModel] << " is different from the number of input features to be tested (" << numInputNodes << " vs " << numInputFeatures << ")";
+    }
+
+    if (mUseNativeModel[nModel]) {
+      if (!mNativeModels[nModel].evalModelBatch(std::data(input), 1, input.size(), output)) {
+        LOG(fatal) << "Number of input features (" << numInputFeatures << ") smaller than the one used in the trees of the model " << mPaths[nModel] << " (" << mNativeModels[nModel].getNumUsedFeatures() << ")";
+      }
+      return;
+    }
+
+    TypeOutputScore* outputPtr = mModels[nModel].template evalModel<TypeOutputScore>(input);
+    if (outputPtr == nullptr) {
+      LOG(fatal) << "Inference of the model " << mPaths[nModel] << " failed!";
+    }
+    output.assign(outputPtr, outputPtr + mNClasses);
+  }
+
+  /// Loads a model for the native tree-ensemble evaluation and checks its predictions against ONNX Runtime
+  /// \param iModel is the model index
+  /// \return true if the native evaluation can be used for the model
+  bool initNativeModel(const std::size_t iModel)
+  {
+    constexpr std::size_t NTestEntries{256};        // number of test inputs
+    constexpr unsigned int TestSeed{12345};         // seed of the test inputs, fixed to have a reproducible check
+    constexpr TypeOutputScore MaxScoreDiff{1.e-5f}; // maximum tolerated difference between native and ONNX Runtime scores
+
+    auto& nativeModel = mNativeModels[iModel];
+    if (!nativeModel.initModel(mPaths[iModel])) {
+      LOG(info) << "Model " << mPaths[iModel] << " evaluated with ONNX Runtime";
+      return false;
+    }
+    if (nativeModel.getNumClasses() != mNClasses) {
+      LOG(info) << "Number of classes of the model " << mPaths[iModel] << " (" << nativeModel.getNumClasses() << ") different from the expected one (" << static_cast<int>(mNClasses) << "), model evaluated with ONNX Runtime";
+      return false;
+    }
+
+    // test inputs taken on the thresholds of the trees or between them, to explore all the branches
+    const auto thresholds = nativeModel.getFeatureThresholds();
+    const int numInputNodes = mModels[iModel].getNumInputNodes();
+    const std::size_t nFeatures = numInputNodes >= 0 ? static_cast<std::size_t>(numInputNodes) : thresholds.size();
+    std::mt19937 generator(TestSeed);
+    std::vector<TypeOutputScore> testInputs(NTestEntries * nFeatures, 0);
+    for (std::size_t iEntry{0}; iEntry < NTestEntries; ++iEntry) {
+      for (std::size_t iFeature{0}; iFeature < std::min(nFeatures, thresholds.size()); ++iFeature) {
+        const auto& featureThresholds = thresholds[iFeature];
+        if (featureThresholds.empty()) {
+          continue;
+        }
+        // odd values: on a threshold, even values: below, between or above the thresholds
+        const std::size_t iValue = std::uniform_int_distribution<std::size_t>(0, 2 * featureThresholds.size())(generator);
+        float value{0.f};
+        if (iValue % 2 == 1) {
+          value = featureThresholds[iValue / 2];
+        } else if (iValue == 0) {
+          value = featureThresholds.front() - 1.f - std::abs(featureThresholds.front());
+        } else if (iValue / 2 == featureThresholds.size()) {
+          value = featureThresholds.back() + 1.f + std::abs(featureThresholds.back());
+        } else {
+          value = 0.5f * (featureThresholds[iValue / 2 - 1] + featureThresholds[iValue / 2]);
+        }
+        testInputs[iEntry * nFeatures + iFeature] = value;
+      }
+    }
+
+    std::vector<TypeOutputScore> outputOnnx, outputNative;
+    if (!mModels[iModel].template evalModelBatch<TypeOutputScore>(testInputs, NTestEntries, outputOnnx)) {
+      LOG(info) << "Inference of the model " << mPaths[iModel] << " with ONNX Runtime failed, model evaluated with ONNX Runtime";
+      return false;
+    }
+    if (!nativeModel.evalModelBatch(testInputs, NTestEntries, outputNative)) {
+      LOG(info) << "The " << nFeatures << " input features are fewer than the " << nativeModel.getNumUsedFeatures() << " used in the trees of the model " << mPaths[iModel] << ", model evaluated with ONNX Runtime";
+      return false;
+    }
+    if (outputOnnx.size() != outputNative.size()) {
+      LOG(info) << "Output size of the native evaluation of the model " << mPaths[iModel] << " (" << outputNative.size() << ") different from the ONNX Runtime one (" << outputOnnx.size() << "), model evaluated with ONNX Runtime";
+      return false;
+    }
+    TypeOutputScore maxDiff{0};
+    for (std::size_t iOutput{0}; iOutput < outputOnnx.size(); ++iOutput) {
+      maxDiff = std::max(maxDiff, static_cast<TypeOutputScore>(std::abs(outputOnnx[iOutput] - outputNative[iOutput])));
+    }
+    if (!(maxDiff <= MaxScoreDiff)) {
+      LOG(warning) << "Maximum difference between native and ONNX Runtime scores of the model " << mPaths[iModel] << " = " << maxDiff << " above tolerance, model evaluated with ONNX Runtime";
+      return false;
+    }
+    LOG(info) << "Model " << mPaths[iModel] << " evaluated natively (maximum difference with ONNX Runtime scores on " << NTestEntries << " test inputs = " << maxDiff << ")";
+    return true;
+  }
+
+  /// Adds a candidate to the inference batch of a model
+  /// \param input is the input features
+  /// \param nModel is the model index
+  /// \return index of the candidate in the batch
+  template <typename T>
+  std::size_t addToBatchOfModel(const T& input, const int nModel)
+  {
+    if (nModel < 0 || static_cast<std::size_t>(nModel) >= mModels.size()) {
+      LOG(fatal) << "Model index " << nModel << " is out of range! The number of initialised models is " << mModels.size() << ". Please check your configurables.";
+    }
+    const int numInputNodes = mModels[nModel].getNumInputNodes();
+    const int numInputFeatures = static_cast<int>(input.size());
+    if (numInputNodes != numInputFeatures && numInputNodes >= 0) {
+      LOG(fatal) << "Number of input nodes in the model " << mPaths[nModel] << " is different from the number of input features to be tested (" << numInputNodes << " vs " << numInputFeatures << ")";
+    }
+    if (mBatchNEntries.size() != mModels.size()) {
+      mBatchInputs.resize(mModels.size());
+      mBatchOutputs.resize(mModels.size());
+      mBatchNEntries.resize(mModels.size(), 0);
+    }
+    mBatchInputs[nModel].insert(mBatchInputs[nModel].end(), std::begin(input), std::end(input));
+    mBatchCandidates.emplace_back(nModel, mBatchNEntries[nModel]++);
+    return mBatchCandidates.size() - 1;
+  }
+
   /// Finds matching bin in mBinsLimits
   /// \param value e.g. pT
   /// \return index of the matching bin, used to access mModels
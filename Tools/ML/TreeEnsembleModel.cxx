@@ -0,0 +1,540 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file     TreeEnsembleModel.cxx
+///
+/// \brief    Native evaluation of tree-ensemble classifiers (BDTs) stored in ONNX files
+///
+
+#include "Tools/ML/TreeEnsembleModel.h"
+
+#include <Framework/Logger.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/// Minimal reader of the protobuf wire format, enough to decode the fields of the ONNX messages needed for tree ensembles
+class ProtoReader
+{
+ public:
+  ProtoReader(const char* begin, const char* end) : mPos(begin), mEnd(end) {}
+
+  bool atEnd() const { return mPos >= mEnd || !mIsValid; }
+  bool isValid() const { return mIsValid; }
+
+  /// Read the key of the next field
+  /// \return false at the end of the message
+  bool nextField(uint32_t& fieldNumber, uint32_t& wireType)
+  {
+    if (atEnd()) {
+      return false;
+    }
+    const uint64_t key = readVarint();
+    fieldNumber = static_cast<uint32_t>(key >> 3);
+    wireType = static_cast<uint32_t>(key & 0x7);
+    return mIsValid;
+  }
+
+  uint64_t readVarint()
+  {
+    uint64_t value{0};
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (mPos >= mEnd) {
+        break;
+      }
+      const auto byte = static_cast<uint8_t>(*mPos++);
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) {
+        return value;
+      }
+    }
+    mIsValid = false;
+    return 0;
+  }
+
+  float readFloat()
+  {
+    float value{0.f};
+    if (mEnd - mPos < static_cast<std::ptrdiff_t>(sizeof(float))) {
+      mIsValid = false;
+      return value;
+    }
+    std::memcpy(&value, mPos, sizeof(float)); // little endian, as the protobuf wire format
+    mPos += sizeof(float);
+    return value;
+  }
+
+  /// Read a length-delimited field (string, bytes, sub-message or packed repeated field)
+  ProtoReader readSubMessage()
+  {
+    const uint64_t length = readVarint();
+    if (!mIsValid || length > static_cast<uint64_t>(mEnd - mPos)) {
+      mIsValid = false;
+      return {mEnd, mEnd};
+    }
+    ProtoReader sub{mPos, mPos + length};
+    mPos += length;
+    return sub;
+  }
+
+  std::string readString()
+  {
+    const ProtoReader sub = readSubMessage();
+    return {sub.mPos, sub.mEnd};
+  }
+
+  void skipField(const uint32_t wireType)
+  {
+    switch (wireType) {
+      case 0: // varint
+        readVarint();
+        break;
+      case 1: // 64-bit
+        mPos += 8;
+        break;
+      case 2: // length-delimited
+        readSubMessage();
+        break;
+      case 5: // 32-bit
+        mPos += 4;
+        break;
+      default: // groups are not used in ONNX
+        mIsValid = false;
+        break;
+    }
+    if (mPos > mEnd) {
+      mIsValid = false;
+    }
+  }
+
+  /// Read a repeated int64 field, which can be either packed or not
+  void readRepeatedInt(const uint32_t wireType, std::vector<int64_t>& values)
+  {
+    if (wireType == 2) {
+      ProtoReader packed = readSubMessage();
+      while (!packed.atEnd()) {
+        values.push_back(static_cast<int64_t>(packed.readVarint()));
+      }
+      mIsValid = mIsValid && packed.isValid();
+    } else {
+      values.push_back(static_cast<int64_t>(readVarint()));
+    }
+  }
+
+  /// Read a repeated float field, which can be either packed or not
+  void readRepeatedFloat(const uint32_t wireType, std::vector<float>& values)
+  {
+    if (wireType == 2) {
+      ProtoReader packed = readSubMessage();
+      while (!packed.atEnd()) {
+        values.push_back(packed.readFloat());
+      }
+      mIsValid = mIsValid && packed.isValid();
+    } else {
+      values.push_back(readFloat());
+    }
+  }
+
+ private:
+  const char* mPos;
+  const char* mEnd;
+  bool mIsValid{true};
+};
+
+/// Attributes of an ONNX node
+struct OnnxAttributes {
+  std::map<std::string, std::vector<int64_t>> ints;
+  std::map<std::string, std::vector<float>> floats;
+  std::map<std::string, std::vector<std::string>> strings;
+};
+
+/// Content of an ONNX node
+struct OnnxNode {
+  std::string opType;
+  std::vector<std::string> outputs;
+  OnnxAttributes attributes;
+};
+
+// field numbers of the ONNX messages (onnx.proto)
+constexpr uint32_t FieldModelGraph = 7;
+constexpr uint32_t FieldGraphNode = 1;
+constexpr uint32_t FieldGraphInput = 11;
+constexpr uint32_t FieldGraphOutput = 12;
+constexpr uint32_t FieldNodeOutput = 2;
+constexpr uint32_t FieldNodeOpType = 4;
+constexpr uint32_t FieldNodeAttribute = 5;
+constexpr uint32_t FieldAttributeName = 1;
+constexpr uint32_t FieldAttributeFloat = 2;
+constexpr uint32_t FieldAttributeInt = 3;
+constexpr uint32_t FieldAttributeString = 4;
+constexpr uint32_t FieldAttributeFloats = 7;
+constexpr uint32_t FieldAttributeInts = 8;
+constexpr uint32_t FieldAttributeStrings = 9;
+constexpr uint32_t FieldValueInfoName = 1;
+constexpr uint32_t FieldValueInfoType = 2;
+constexpr uint32_t FieldTypeTensor = 1;
+constexpr uint32_t FieldTensorTypeShape = 2;
+constexpr uint32_t FieldShapeDim = 1;
+constexpr uint32_t FieldDimValue = 1;
+
+void readAttribute(ProtoReader reader, OnnxAttributes& attributes)
+{
+  std::string name;
+  std::vector<int64_t> ints;
+  std::vector<float> floats;
+  std::vector<std::string> strings;
+  uint32_t field{0}, wireType{0};
+  while (reader.nextField(field, wireType)) {
+    if (field == FieldAttributeName && wireType == 2) {
+      name = reader.readString();
+    } else if ((field == FieldAttributeInt || field == FieldAttributeInts) && wireType != 5) {
+      reader.readRepeatedInt(wireType, ints);
+    } else if (field == FieldAttributeFloat || field == FieldAttributeFloats) {
+      reader.readRepeatedFloat(wireType, floats);
+    } else if ((field == FieldAttributeString || field == FieldAttributeStrings) && wireType == 2) {
+      strings.push_back(reader.readString());
+    } else {
+      reader.skipField(wireType);
+    }
+  }
+  if (!ints.empty()) {
+    attributes.ints[name] = std::move(ints);
+  }
+  if (!floats.empty()) {
+    attributes.floats[name] = std::move(floats);
+  }
+  if (!strings.empty()) {
+    attributes.strings[name] = std::move(strings);
+  }
+}
+
+OnnxNode readNode(ProtoReader reader)
+{
+  OnnxNode node;
+  uint32_t field{0}, wireType{0};
+  while (reader.nextField(field, wireType)) {
+    if (field == FieldNodeOutput && wireType == 2) {
+      node.outputs.push_back(reader.readString());
+    } else if (field == FieldNodeOpType && wireType == 2) {
+      node.opType = reader.readString();
+    } else if (field == FieldNodeAttribute && wireType == 2) {
+      readAttribute(reader.readSubMessage(), node.attributes);
+    } else {
+      reader.skipField(wireType);
+    }
+  }
+  return node;
+}
+
+/// Read name and second dimension (number of features) of a graph input or output
+/// \return second dimension of the tensor, -1 if not fixed
+int64_t readValueInfo(ProtoReader reader, std::string& name)
+{
+  int64_t nFeatures{-1};
+  uint32_t field{0}, wireType{0};
+  while (reader.nextField(field, wireType)) {
+    if (field == FieldValueInfoName && wireType == 2) {
+      name = reader.readString();
+    } else if (field == FieldValueInfoType && wireType == 2) {
+      ProtoReader type = reader.readSubMessage();
+      while (type.nextField(field, wireType)) {
+        if (field != FieldTypeTensor || wireType != 2) {
+          type.skipField(wireType);
+          continue;
+        }
+        ProtoReader tensor = type.readSubMessage();
+        while (tensor.nextField(field, wireType)) {
+          if (field != FieldTensorTypeShape || wireType != 2) {
+            tensor.skipField(wireType);
+            continue;
+          }
+          ProtoReader shape = tensor.readSubMessage();
+          int iDim{0};
+          while (shape.nextField(field, wireType)) {
+            if (field != FieldShapeDim || wireType != 2) {
+              shape.skipField(wireType);
+              continue;
+            }
+            ProtoReader dim = shape.readSubMessage();
+            while (dim.nextField(field, wireType)) {
+              if (field == FieldDimValue && wireType == 0) {
+                const auto dimValue = static_cast<int64_t>(dim.readVarint());
+                if (iDim == 1) {
+                  nFeatures = dimValue;
+                }
+              } else {
+                dim.skipField(wireType);
+              }
+            }
+            ++iDim;
+          }
+        }
+      }
+    } else {
+      reader.skipField(wireType);
+    }
+  }
+  return nFeatures;
+}
+} // namespace
+
+namespace o2
+{
+
+namespace ml
+{
+
+bool TreeEnsembleModel::initModel(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    LOG(error) << "Cannot open the model file " << path;
+    return false;
+  }
+  const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+  // decode the graph of the model
+  std::vector<OnnxNode> nodes;
+  std::vector<std::string> graphOutputs;
+  int64_t nFeatures{-1};
+  bool isGraphValid{true};
+  ProtoReader model{content.data(), content.data() + content.size()};
+  uint32_t field{0}, wireType{0};
+  while (model.nextField(field, wireType)) {
+    if (field != FieldModelGraph || wireType != 2) {
+      model.skipField(wireType);
+      continue;
+    }
+    ProtoReader graph = model.readSubMessage();
+    while (graph.nextField(field, wireType)) {
+      if (field == FieldGraphNode && wireType == 2) {
+        nodes.push_back(readNode(graph.readSubMessage()));
+      } else if (field == FieldGraphInput && wireType == 2) {
+        std::string name;
+        nFeatures = readValueInfo(graph.readSubMessage(), name);
+      } else if (field == FieldGraphOutput && wireType == 2) {
+        readValueInfo(graph.readSubMessage(), graphOutputs.emplace_back());
+      } else {
+        graph.skipField(wireType);
+      }
+    }
+    isGraphValid = isGraphValid && graph.isValid();
+  }
+  if (!model.isValid() || !isGraphValid || nodes.empty()) {
+    LOG(error) << "Cannot decode the ONNX model " << path;
+    return false;
+  }
+
+  // the model has to be a single tree-ensemble classifier, whose probabilities are the last output of the graph (as used by MlResponse)
+  const OnnxNode* classifier{nullptr};
+  for (const auto& node : nodes) {
+    if (node.opType == "TreeEnsembleClassifier" && classifier == nullptr) {
+      classifier = &node;
+    } else if (node.opType != "Identity") {
+      LOG(info) << "Node " << node.opType << " of the model " << path << " not supported by the native tree-ensemble evaluation";
+      return false;
+    }
+  }
+  if (classifier == nullptr || classifier->outputs.size() < 2 || graphOutputs.empty() || classifier->outputs[1] != graphOutputs.back()) {
+    LOG(info) << "The model " << path << " is not a tree-ensemble classifier supported by the native evaluation";
+    return false;
+  }
+
+  auto& ints = classifier->attributes.ints;
+  auto& floats = classifier->attributes.floats;
+  auto& strings = classifier->attributes.strings;
+  auto getInts = [&ints](const std::string& name) -> const std::vector<int64_t>& {
+    static const std::vector<int64_t> empty{};
+    const auto it = ints.find(name);
+    return it != ints.end() ? it->second : empty;
+  };
+  auto getFloats = [&floats](const std::string& name) -> const std::vector<float>& {
+    static const std::vector<float> empty{};
+    const auto it = floats.find(name);
+    return it != floats.end() ? it->second : empty;
+  };
+  auto getStrings = [&strings](const std::string& name) -> const std::vector<std::string>& {
+    static const std::vector<std::string> empty{};
+    const auto it = strings.find(name);
+    return it != strings.end() ? it->second : empty;
+  };
+
+  const auto& treeIds = getInts("nodes_treeids");
+  const auto& nodeIds = getInts("nodes_nodeids");
+  const auto& featureIds = getInts("nodes_featureids");
+  const auto& values = getFloats("nodes_values");
+  const auto& modes = getStrings("nodes_modes");
+  const auto& trueIds = getInts("nodes_truenodeids");
+  const auto& falseIds = getInts("nodes_falsenodeids");
+  const auto& missingTracksTrue = getInts("nodes_missing_value_tracks_true");
+  const auto& classTreeIds = getInts("class_treeids");
+  const auto& classNodeIds = getInts("class_nodeids");
+  const auto& classIds = getInts("class_ids");
+  const auto& classWeights = getFloats("class_weights");
+  const auto& baseValues = getFloats("base_values");
+  const auto& postTransform = getStrings("post_transform");
+  const std::size_t nClasses = std::max(getInts("classlabels_int64s").size(), getStrings("classlabels_strings").size());
+
+  const std::size_t nNodes = nodeIds.size();
+  if (nNodes == 0 || treeIds.size() != nNodes || featureIds.size() != nNodes || values.size() != nNodes || modes.size() != nNodes || trueIds.size() != nNodes || falseIds.size() != nNodes ||
+      (!missingTracksTrue.empty() && missingTracksTrue.size() != nNodes) ||
+      classNodeIds.size() != classTreeIds.size() || classIds.size() != classTreeIds.size() || classWeights.size() != classTreeIds.size()) {
+    LOG(info) << "Inconsistent or unsupported (e.g. tensor) node attributes in the model " << path << ", native tree-ensemble evaluation not possible";
+    return false;
+  }
+  // the binary case has a special treatment of the scores in ONNX, not implemented here
+  if (nClasses < 3) { // o2-linter: disable="magic-number" (binary classifiers)
+    LOG(info) << "Binary classifier " << path << " not supported by the native tree-ensemble evaluation";
+    return false;
+  }
+  if (!baseValues.empty() && baseValues.size() != nClasses) {
+    LOG(info) << "Unexpected number of base values in the model " << path;
+    return false;
+  }
+  const std::string postTransformName = postTransform.empty() ? "NONE" : postTransform.front();
+  if (postTransformName == "NONE") {
+    mPostTransform = None;
+  } else if (postTransformName == "LOGISTIC") {
+    mPostTransform = Logistic;
+  } else if (postTransformName == "SOFTMAX") {
+    mPostTransform = Softmax;
+  } else if (postTransformName == "SOFTMAX_ZERO") {
+    mPostTransform = SoftmaxZero;
+  } else {
+    LOG(info) << "Post transform " << postTransformName << " of the model " << path << " not supported by the native tree-ensemble evaluation";
+    return false;
+  }
+
+  // flatten the trees: nodes are stored in the order of the attributes, with the children referenced by their index
+  mNodes.assign(nNodes, Node{});
+  mTreeRoots.clear();
+  // the nodes of each tree have to be consecutive and listed in the order of their ids, as assumed by ONNX Runtime
+  std::map<std::pair<int64_t, int64_t>, int32_t> nodeIndices; // (tree id, node id) -> index in mNodes
+  std::size_t firstNodeOfTree{0};
+  for (std::size_t iNode = 0; iNode < nNodes; ++iNode) {
+    if (iNode > 0 && treeIds[iNode] != treeIds[iNode - 1]) {
+      firstNodeOfTree = iNode;
+    }
+    if (nodeIds[iNode] != static_cast<int64_t>(iNode - firstNodeOfTree)) {
+      LOG(info) << "Nodes of the tree " << treeIds[iNode] << " of the model " << path << " not ordered by id, native tree-ensemble evaluation not possible";
+      return false;
+    }
+    if (!nodeIndices.emplace(std::make_pair(treeIds[iNode], nodeIds[iNode]), static_cast<int32_t>(iNode)).second) {
+      LOG(info) << "Duplicated node in the model " << path;
+      return false;
+    }
+  }
+  std::vector<bool> isChild(nNodes, false);
+  std::vector<int32_t> leafIds(nNodes, -1);
+  int32_t nLeaves{0};
+  int64_t maxFeatureId{-1};
+  for (std::size_t iNode = 0; iNode < nNodes; ++iNode) {
+    Node& node = mNodes[iNode];
+    const auto& mode = modes[iNode];
+    if (mode == "LEAF") {
+      node.mode = Leaf;
+      node.featureOrLeafId = leafIds[iNode] = nLeaves++;
+      continue;
+    }
+    if (mode == "BRANCH_LEQ") {
+      node.mode = BranchLeq;
+    } else if (mode == "BRANCH_LT") {
+      node.mode = BranchLt;
+    } else if (mode == "BRANCH_GTE") {
+      node.mode = BranchGte;
+    } else if (mode == "BRANCH_GT") {
+      node.mode = BranchGt;
+    } else if (mode == "BRANCH_EQ") {
+      node.mode = BranchEq;
+    } else if (mode == "BRANCH_NEQ") {
+      node.mode = BranchNeq;
+    } else {
+      LOG(info) << "Node mode " << mode << " of the model " << path << " not supported by the native tree-ensemble evaluation";
+      return false;
+    }
+    const auto itTrue = nodeIndices.find({treeIds[iNode], trueIds[iNode]});
+    const auto itFalse = nodeIndices.find({treeIds[iNode], falseIds[iNode]});
+    if (itTrue == nodeIndices.end() || itFalse == nodeIndices.end() || featureIds[iNode] < 0) {
+      LOG(info) << "Inconsistent node in the model " << path;
+      return false;
+    }
+    node.threshold = values[iNode];
+    node.featureOrLeafId = static_cast<int32_t>(featureIds[iNode]);
+    node.trueChild = itTrue->second;
+    node.falseChild = itFalse->second;
+    node.isMissingTrackTrue = !missingTracksTrue.empty() && missingTracksTrue[iNode] != 0;
+    isChild[node.trueChild] = isChild[node.falseChild] = true;
+    maxFeatureId = std::max(maxFeatureId, featureIds[iNode]);
+  }
+  for (std::size_t iNode = 0; iNode < nNodes; ++iNode) {
+    if (!isChild[iNode]) {
+      mTreeRoots.push_back(static_cast<int32_t>(iNode));
+    }
+  }
+
+  // class weights of the leaves, summed if a leaf has several weights for the same class
+  mNClasses = static_cast<int>(nClasses);
+  mLeafWeights.assign(static_cast<std::size_t>(nLeaves) * nClasses, 0.f);
+  for (std::size_t iWeight = 0; iWeight < classWeights.size(); ++iWeight) {
+    const auto it = nodeIndices.find({classTreeIds[iWeight], classNodeIds[iWeight]});
+    if (it == nodeIndices.end() || leafIds[it->second] < 0 || classIds[iWeight] < 0 || classIds[iWeight] >= mNClasses) {
+      LOG(info) << "Inconsistent class weight in the model " << path;
+      return false;
+    }
+    mLeafWeights[static_cast<std::size_t>(leafIds[it->second]) * nClasses + classIds[iWeight]] += classWeights[iWeight];
+  }
+  mBaseValues = baseValues.empty() ? std::vector<float>(nClasses, 0.f) : baseValues;
+
+  if (nFeatures >= 0 && maxFeatureId >= nFeatures) {
+    LOG(info) << "Feature index " << maxFeatureId << " out of the " << nFeatures << " input features of the model " << path;
+    return false;
+  }
+  mNFeatures = static_cast<int>(nFeatures);
+  mNUsedFeatures = static_cast<std::size_t>(maxFeatureId + 1);
+
+  LOG(info) << "--- Native tree-ensemble model ---";
+  LOG(info) << "Model " << path << ": " << mTreeRoots.size() << " trees, " << mNodes.size() << " nodes, " << mNFeatures << " input features, " << mNClasses << " classes, post transform " << postTransformName;
+  return true;
+}
+
+std::vector<std::vector<float>> TreeEnsembleModel::getFeatureThresholds() const
+{
+  std::vector<std::vector<float>> thresholds;
+  for (const auto& node : mNodes) {
+    if (node.mode == Leaf) {
+      continue;
+    }
+    if (static_cast<std::size_t>(node.featureOrLeafId) >= thresholds.size()) {
+      thresholds.resize(node.featureOrLeafId + 1);
+    }
+    thresholds[node.featureOrLeafId].push_back(node.threshold);
+  }
+  for (auto& featureThresholds : thresholds) {
+    std::sort(featureThresholds.begin(), featureThresholds.end());
+    featureThresholds.erase(std::unique(featureThresholds.begin(), featureThresholds.end()), featureThresholds.end());
+  }
+  return thresholds;
+}
+
+} // namespace ml
+
+} // namespace o2
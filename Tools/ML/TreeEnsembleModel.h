@@ -0,0 +1,216 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// \file     TreeEnsembleModel.h
+///
+/// \brief    Native evaluation of tree-ensemble classifiers (BDTs) stored in ONNX files
+///
+/// The TreeEnsembleClassifier node of the ONNX graph is loaded into a flat array of nodes,
+/// which is walked tree by tree for a whole batch of entries, so that each tree stays in cache.
+/// Only multi-class models made of a single TreeEnsembleClassifier node, with the nodes of each tree listed
+/// in the order of their ids (as written by the converters), are supported.
+/// initModel() returns false for the other models, which have to be evaluated with ONNX Runtime.
+///
+
+#ifndef TOOLS_ML_TREEENSEMBLEMODEL_H_
+#define TOOLS_ML_TREEENSEMBLEMODEL_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace o2
+{
+
+namespace ml
+{
+
+class TreeEnsembleModel
+{
+
+ public:
+  TreeEnsembleModel() = default;
+  ~TreeEnsembleModel() = default;
+
+  /// Load the tree ensemble from an ONNX file
+  /// \return false if the file cannot be read or the model is not supported
+  bool initModel(const std::string& path);
+
+  /// Evaluate the model on a batch of entries
+  /// \param input contiguous buffer with the input features of all the entries, one row of nFeatures values per entry
+  /// \param nEntries number of entries in the batch
+  /// \param nFeatures number of input features of each entry
+  /// \param output buffer filled with the class probabilities, one row of getNumClasses() values per entry (its capacity is kept between calls)
+  /// \return false if the entries have fewer features than used in the trees
+  /// \note The scores are accumulated in the output buffer, the model itself is not modified and can be shared between threads
+  template <typename TInput, typename TOutput>
+  bool evalModelBatch(const TInput* input, const std::size_t nEntries, const std::size_t nFeatures, std::vector<TOutput>& output) const
+  {
+    if (nFeatures < mNUsedFeatures) {
+      output.clear();
+      return false;
+    }
+    const std::size_t nClasses = mNClasses;
+    output.assign(nEntries * nClasses, TOutput{0});
+    for (const auto root : mTreeRoots) {
+      for (std::size_t iEntry = 0; iEntry < nEntries; ++iEntry) {
+        const float* leafWeights = findLeafWeights(root, input + iEntry * nFeatures);
+        TOutput* scores = output.data() + iEntry * nClasses;
+        for (std::size_t iClass = 0; iClass < nClasses; ++iClass) {
+          scores[iClass] += leafWeights[iClass];
+        }
+      }
+    }
+    for (std::size_t iEntry = 0; iEntry < nEntries; ++iEntry) {
+      TOutput* scores = output.data() + iEntry * nClasses;
+      for (std::size_t iClass = 0; iClass < nClasses; ++iClass) {
+        scores[iClass] += mBaseValues[iClass];
+      }
+      applyPostTransform(scores);
+    }
+    return true;
+  }
+
+  template <typename T>
+  bool evalModelBatch(const std::vector<T>& input, const std::size_t nEntries, std::vector<T>& output) const
+  {
+    if (nEntries == 0) {
+      output.clear();
+      return true;
+    }
+    return evalModelBatch(input.data(), nEntries, input.size() / nEntries, output);
+  }
+
+  // Getters
+  int getNumInputNodes() const { return mNFeatures; }
+  std::size_t getNumUsedFeatures() const { return mNUsedFeatures; }
+  int getNumClasses() const { return mNClasses; }
+  std::size_t getNumTrees() const { return mTreeRoots.size(); }
+  std::size_t getNumNodes() const { return mNodes.size(); }
+  /// Thresholds used in the nodes of the trees for each feature, e.g. to build test inputs exploring all the branches
+  std::vector<std::vector<float>> getFeatureThresholds() const;
+
+ private:
+  enum NodeMode : uint8_t {
+    BranchLeq = 0,
+    BranchLt,
+    BranchGte,
+    BranchGt,
+    BranchEq,
+    BranchNeq,
+    Leaf
+  };
+
+  enum PostTransform : uint8_t {
+    None = 0,
+    Logistic,
+    Softmax,
+    SoftmaxZero
+  };
+
+  struct Node {
+    float threshold{0.f};
+    int32_t featureOrLeafId{0}; // index of the tested feature, or of the leaf weights for leaves
+    int32_t trueChild{-1};      // index in mNodes of the child for a fulfilled condition
+    int32_t falseChild{-1};     // index in mNodes of the child for a failed condition
+    NodeMode mode{Leaf};
+    bool isMissingTrackTrue{false}; // NaN values follow the true branch
+  };
+
+  std::vector<Node> mNodes;        // nodes of all the trees
+  std::vector<int32_t> mTreeRoots; // index in mNodes of the root of each tree
+  std::vector<float> mLeafWeights; // class weights of the leaves, mNClasses values per leaf
+  std::vector<float> mBaseValues;  // score offset of each class
+  PostTransform mPostTransform{None};
+  int mNClasses{0};
+  int mNFeatures{-1};            // -1 if the number of input features is not fixed in the model
+  std::size_t mNUsedFeatures{0}; // highest feature index used in the trees + 1, i.e. minimum number of input features of an entry
+
+  /// Walk a tree down to its leaf for an entry
+  /// \return pointer to the class weights of the leaf
+  template <typename T>
+  const float* findLeafWeights(int32_t iNode, const T* features) const
+  {
+    while (mNodes[iNode].mode != Leaf) {
+      const Node& node = mNodes[iNode];
+      const float value = static_cast<float>(features[node.featureOrLeafId]);
+      bool isTrue{false};
+      switch (node.mode) {
+        case BranchLeq:
+          isTrue = value <= node.threshold;
+          break;
+        case BranchLt:
+          isTrue = value < node.threshold;
+          break;
+        case BranchGte:
+          isTrue = value >= node.threshold;
+          break;
+        case BranchGt:
+          isTrue = value > node.threshold;
+          break;
+        case BranchEq:
+          isTrue = value == node.threshold;
+          break;
+        case BranchNeq:
+          isTrue = value != node.threshold;
+          break;
+        default:
+          break;
+      }
+      iNode = (isTrue || (node.isMissingTrackTrue && std::isnan(value))) ? node.trueChild : node.falseChild;
+    }
+    return mLeafWeights.data() + static_cast<std::size_t>(mNodes[iNode].featureOrLeafId) * mNClasses;
+  }
+
+  /// Transform the raw scores of an entry into probabilities, with the same definitions as in ONNX Runtime
+  template <typename T>
+  void applyPostTransform(T* scores) const
+  {
+    switch (mPostTransform) {
+      case Logistic:
+        for (int iClass = 0; iClass < mNClasses; ++iClass) {
+          const T value = T{1} / (T{1} + std::exp(-std::abs(scores[iClass])));
+          scores[iClass] = scores[iClass] < T{0} ? T{1} - value : value;
+        }
+        break;
+      case Softmax:
+      case SoftmaxZero: {
+        constexpr T ZeroScore{1.e-7f}; // scores considered as zero in SOFTMAX_ZERO
+        const T maxScore = *std::max_element(scores, scores + mNClasses);
+        T sum{0};
+        for (int iClass = 0; iClass < mNClasses; ++iClass) {
+          if (mPostTransform == SoftmaxZero && std::abs(scores[iClass]) <= ZeroScore) {
+            scores[iClass] = T{0};
+            continue;
+          }
+          scores[iClass] = std::exp(scores[iClass] - maxScore);
+          sum += scores[iClass];
+        }
+        for (int iClass = 0; iClass < mNClasses; ++iClass) {
+          scores[iClass] = sum > T{0} ? scores[iClass] / sum : T{0};
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+};
+
+} // namespace ml
+
+} // namespace o2
+
+#endif // TOOLS_ML_TREEENSEMBLEMODEL_H_
@@ -104,6 +104,7 @@ void OnnxModel::initModel(const std::string& localPath, const bool enableOptimiz
   for (std::size_t i = 0; i < mSession->GetOutputCount(); ++i) {
     mOutputShapes.emplace_back(mSession->GetOutputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape());
   }
+  cacheNodeNames();
   LOG(info) << "Input Nodes:";
   for (std::size_t i = 0; i < mInputNames.size(); i++) {
     LOG(info) << "\t" << mInputNames[i] << " : " << printShape(mInputShapes[i]);
@@ -122,6 +123,45 @@ void OnnxModel::initModel(const std::string& localPath, const bool enableOptimiz
   LOG(info) << "--- Model initialized! ---";
 }
 
+void OnnxModel::cacheNodeNames()
+{
+  mInputNamesChar.clear();
+  for (const auto& name : mInputNames) {
+    mInputNamesChar.push_back(name.c_str());
+  }
+  mOutputNamesChar.clear();
+  for (const auto& name : mOutputNames) {
+    mOutputNamesChar.push_back(name.c_str());
+  }
+}
+
+bool OnnxModel::runSession(std::vector<Ort::Value>& input)
+{
+  // the cached pointers have to follow the names if the model was moved after its initialisation
+  if (mInputNamesChar.empty() || mInputNamesChar.front() != mInputNames.front().c_str() || mOutputNamesChar.front() != mOutputNames.front().c_str()) {
+    cacheNodeNames();
+  }
+
+  try {
+    mOutputTensors = mSession->Run(mRunOptions, mInputNamesChar.data(), input.data(), input.size(), mOutputNamesChar.data(), mOutputNamesChar.size());
+    LOG(debug) << "Number of output tensors: " << mOutputTensors.size();
+    if (mOutputTensors.size() != mOutputNames.size()) {
+      LOG(fatal) << "Number of output tensors: " << mOutputTensors.size() << " does not agree with the model specified size: " << mOutputNames.size();
+    }
+    for (std::size_t i = 0; i < mOutputTensors.size(); i++) {
+      LOG(debug) << "Output tensor shape: " << printShape(mOutputTensors[i].GetTensorTypeAndShapeInfo().GetShape());
+      if ((mOutputTensors[i].GetTensorTypeAndShapeInfo().GetShape() != mOutputShapes[i]) && (mOutputShapes[i][0] != -1)) {
+        LOG(fatal) << "Shape of tensor " << i << " does not agree with model specification! Output: " << printShape(mOutputTensors[i].GetTensorTypeAndShapeInfo().GetShape()) << " model: " << printShape(mOutputShapes[i]);
+      }
+    }
+    return true;
+  } catch (const Ort::Exception& exception) {
+    LOG(error) << "Error running model inference: " << exception.what();
+  }
+  mOutputTensors.clear();
+  return false;
+}
+
 void OnnxModel::setActiveThreads(const int threads)
 {
   activeThreads = threads;
@@ -26,10 +26,10 @@
 #include <onnxruntime_cxx_api.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -51,38 +51,17 @@ class OnnxModel
   void initModel(const std::string&, const bool = false, const int = 0, const uint64_t = 0, const uint64_t = 0);
 
   // template methods -- best to define them in header
+  /// \return pointer to the values of the last output tensor, valid until the next evaluation of the model (nullptr if the inference failed)
   template <typename T>
   T* evalModel(std::vector<Ort::Value>& input)
   {
     LOG(debug) << "Input tensor shape: " << printShape(input[0].GetTensorTypeAndShapeInfo().GetShape());
     // assert(input[0].GetTensorTypeAndShapeInfo().GetShape() == getNumInputNodes()); --> Fails build in debug mode, TODO: assertion should be checked somehow
 
-    try {
-      const Ort::RunOptions runOptions;
-      std::vector<const char*> inputNamesChar(mInputNames.size(), nullptr);
-      std::transform(std::begin(mInputNames), std::end(mInputNames), std::begin(inputNamesChar),
-                     [&](const std::string& str) { return str.c_str(); });
-
-      std::vector<const char*> outputNamesChar(mOutputNames.size(), nullptr);
-      std::transform(std::begin(mOutputNames), std::end(mOutputNames), std::begin(outputNamesChar),
-                     [&](const std::string& str) { return str.c_str(); });
-      auto outputTensors = mSession->Run(runOptions, inputNamesChar.data(), input.data(), input.size(), outputNamesChar.data(), outputNamesChar.size());
-      LOG(debug) << "Number of output tensors: " << outputTensors.size();
-      if (outputTensors.size() != mOutputNames.size()) {
-        LOG(fatal) << "Number of output tensors: " << outputTensors.size() << " does not agree with the model specified size: " << mOutputNames.size();
-      }
-      for (std::size_t i = 0; i < outputTensors.size(); i++) {
-        LOG(debug) << "Output tensor shape: " << printShape(outputTensors[i].GetTensorTypeAndShapeInfo().GetShape());
-        if ((outputTensors[i].GetTensorTypeAndShapeInfo().GetShape() != mOutputShapes[i]) && (mOutputShapes[i][0] != -1)) {
-          LOG(fatal) << "Shape of tensor " << i << " does not agree with model specification! Output: " << printShape(outputTensors[i].GetTensorTypeAndShapeInfo().GetShape()) << " model: " << printShape(mOutputShapes[i]);
-        }
-      }
-      T* outputValues = outputTensors.back().GetTensorMutableData<T>();
-      return outputValues;
-    } catch (const Ort::Exception& exception) {
-      LOG(error) << "Error running model inference: " << exception.what();
+    if (!runSession(input)) {
+      return nullptr;
     }
-    return nullptr;
+    return mOutputTensors.back().GetTensorMutableData<T>();
   }
 
   template <typename T>
@@ -92,21 +71,57 @@ class OnnxModel
     assert(size % mInputShapes[0][1] == 0);
     std::vector<int64_t> inputShape{size / mInputShapes[0][1], mInputShapes[0][1]};
     std::vector<Ort::Value> inputTensors;
-    Ort::MemoryInfo memInfo =
-      Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
-    inputTensors.emplace_back(Ort::Value::CreateTensor<T>(memInfo, input.data(), size, inputShape.data(), inputShape.size()));
+    inputTensors.emplace_back(Ort::Value::CreateTensor<T>(mMemoryInfo, input.data(), size, inputShape.data(), inputShape.size()));
     LOG(debug) << "Input shape calculated from vector: " << printShape(inputShape);
     return evalModel<T>(inputTensors);
   }
 
+  /// Evaluate the model on a batch of entries with a single inference
+  /// \param input contiguous buffer with the input features of all the entries, one row of features per entry
+  /// \param nEntries number of entries in the batch
+  /// \param output buffer filled with the values of the last output tensor, one row per entry (its capacity is kept between calls)
+  /// \return false if the inference failed
+  /// \note Models with a fixed batch size are evaluated in batches of this size, the last one padded with zeros
+  template <typename T>
+  bool evalModelBatch(std::vector<T>& input, const std::size_t nEntries, std::vector<T>& output)
+  {
+    output.clear();
+    if (nEntries == 0) {
+      return true;
+    }
+    const int64_t nFeatures = static_cast<int64_t>(input.size() / nEntries);
+    assert(input.size() == nEntries * nFeatures);
+    const int64_t fixedBatchSize = mInputShapes[0][0]; // -1 for dynamic batch size
+    const int64_t batchSize = fixedBatchSize > 0 ? fixedBatchSize : static_cast<int64_t>(nEntries);
+    const std::array<int64_t, 2> inputShape{batchSize, nFeatures};
+    std::vector<T> paddedInput;
+    for (int64_t iFirstEntry = 0; iFirstEntry < static_cast<int64_t>(nEntries); iFirstEntry += batchSize) {
+      const int64_t nEntriesInBatch = std::min(batchSize, static_cast<int64_t>(nEntries) - iFirstEntry);
+      T* batchInput = input.data() + iFirstEntry * nFeatures;
+      if (nEntriesInBatch < batchSize) { // the input buffer is not large enough for a full batch
+        paddedInput.assign(batchSize * nFeatures, T{0});
+        std::copy_n(batchInput, nEntriesInBatch * nFeatures, paddedInput.data());
+        batchInput = paddedInput.data();
+      }
+      std::vector<Ort::Value> inputTensors;
+      inputTensors.emplace_back(Ort::Value::CreateTensor<T>(mMemoryInfo, batchInput, batchSize * nFeatures, inputShape.data(), inputShape.size()));
+      if (!runSession(inputTensors)) {
+        return false;
+      }
+      const auto& outputTensor = mOutputTensors.back();
+      const T* outputValues = outputTensor.GetTensorData<T>();
+      const std::size_t nOutputsPerEntry = outputTensor.GetTensorTypeAndShapeInfo().GetElementCount() / batchSize;
+      output.insert(output.end(), outputValues, outputValues + nEntriesInBatch * nOutputsPerEntry); // the outputs of the padding are dropped
+    }
+    return true;
+  }
+
   // For 2D inputs
   template <typename T>
   T* evalModel(std::vector<std::vector<T>>& input)
   {
     std::vector<Ort::Value> inputTensors;
 
-    Ort::MemoryInfo memInfo = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
-
     for (std::size_t iinput = 0; iinput < input.size(); iinput++) {
       [[maybe_unused]] int totalSize = 1;
       int64_t size = input[iinput].size();
@@ -120,7 +135,7 @@ class OnnxModel
         inputShape.push_back(mInputShapes[iinput][idim]);
       }
 
-      inputTensors.emplace_back(Ort::Value::CreateTensor<T>(memInfo, input[iinput].data(), size, inputShape.data(), inputShape.size()));
+      inputTensors.emplace_back(Ort::Value::CreateTensor<T>(mMemoryInfo, input[iinput].data(), size, inputShape.data(), inputShape.size()));
     }
 
     return evalModel<T>(inputTensors);
@@ -157,6 +172,13 @@ class OnnxModel
   std::vector<std::string> mOutputNames;
   std::vector<std::vector<int64_t>> mOutputShapes;
 
+  // Inference buffers, cached to avoid allocations at each evaluation
+  Ort::MemoryInfo mMemoryInfo = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
+  Ort::RunOptions mRunOptions;
+  std::vector<const char*> mInputNamesChar;
+  std::vector<const char*> mOutputNamesChar;
+  std::vector<Ort::Value> mOutputTensors; // output of the last evaluation
+
   // Environment settings
   std::string modelPath;
   int activeThreads = 0;
@@ -166,6 +188,9 @@ class OnnxModel
   // Internal function for printing the shape of tensors
   std::string printShape(const std::vector<int64_t>&);
   bool checkHyperloop(const bool = true);
+  // Internal function running the inference, the output is stored in mOutputTensors
+  bool runSession(std::vector<Ort::Value>&);
+  void cacheNodeNames();
 };
 
 } // namespace ml
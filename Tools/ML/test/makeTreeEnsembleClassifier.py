@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+
+# Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+# See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+# All rights not expressly granted are reserved.
+#
+# This software is distributed under the terms of the GNU General Public
+# License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+#
+# In applying this license CERN does not waive the privileges and immunities
+# granted to it by virtue of its status as an Intergovernmental Organization
+# or submit itself to any jurisdiction.
+
+"""
+Write the ONNX model used by testTreeEnsembleModel: a 3-class TreeEnsembleClassifier with 4 input features,
+3 trees using all the branch modes, NaN values tracked to the true branch, base values and a SOFTMAX post transform.
+
+Usage: makeTreeEnsembleClassifier.py [output file, default treeEnsembleClassifier.onnx]
+"""
+
+import sys
+
+import onnx
+from onnx import TensorProto, helper
+
+# (tree id, node id, mode, feature id, threshold, true node id, false node id, missing value tracks true)
+# the nodes are listed in the order of their ids in each tree, as written by the converters and expected by ONNX Runtime
+NODES = [
+    (0, 0, "BRANCH_LEQ", 0, 0.5, 1, 2, 1),
+    (0, 1, "BRANCH_LT", 1, -1.0, 3, 4, 0),
+    (0, 2, "LEAF", 0, 0.0, 0, 0, 0),
+    (0, 3, "LEAF", 0, 0.0, 0, 0, 0),
+    (0, 4, "LEAF", 0, 0.0, 0, 0, 0),
+    (1, 0, "BRANCH_GTE", 2, 2.0, 1, 2, 0),
+    (1, 1, "BRANCH_GT", 3, 0.0, 3, 4, 1),
+    (1, 2, "BRANCH_EQ", 0, 1.0, 5, 6, 0),
+    (1, 3, "LEAF", 0, 0.0, 0, 0, 0),
+    (1, 4, "LEAF", 0, 0.0, 0, 0, 0),
+    (1, 5, "LEAF", 0, 0.0, 0, 0, 0),
+    (1, 6, "LEAF", 0, 0.0, 0, 0, 0),
+    (2, 0, "BRANCH_NEQ", 3, 0.25, 1, 2, 0),
+    (2, 1, "BRANCH_LEQ", 1, 3.0, 3, 4, 0),
+    (2, 2, "LEAF", 0, 0.0, 0, 0, 0),
+    (2, 3, "LEAF", 0, 0.0, 0, 0, 0),
+    (2, 4, "LEAF", 0, 0.0, 0, 0, 0),
+]
+
+# class weights of the leaves: (tree id, node id) -> weight of each class
+LEAF_WEIGHTS = {
+    (0, 2): [0.8, -0.3, 0.1],
+    (0, 3): [-0.5, 0.6, 0.2],
+    (0, 4): [0.1, 0.1, -0.7],
+    (1, 3): [0.4, 0.0, -0.2],
+    (1, 4): [-0.1, 0.9, 0.3],
+    (1, 5): [1.2, -0.4, 0.0],
+    (1, 6): [0.0, 0.25, 0.5],
+    (2, 2): [-0.3, -0.3, 0.9],
+    (2, 3): [0.6, 0.2, -0.1],
+    (2, 4): [0.05, -0.6, 0.35],
+}
+
+N_FEATURES = 4
+N_CLASSES = 3
+
+
+def make_model():
+    """Build the model"""
+    class_tree_ids, class_node_ids, class_ids, class_weights = [], [], [], []
+    for (tree_id, node_id), weights in LEAF_WEIGHTS.items():
+        for class_id, weight in enumerate(weights):
+            class_tree_ids.append(tree_id)
+            class_node_ids.append(node_id)
+            class_ids.append(class_id)
+            class_weights.append(weight)
+
+    classifier = helper.make_node(
+        "TreeEnsembleClassifier",
+        inputs=["input"],
+        outputs=["label", "probabilities"],
+        domain="ai.onnx.ml",
+        nodes_treeids=[node[0] for node in NODES],
+        nodes_nodeids=[node[1] for node in NODES],
+        nodes_modes=[node[2] for node in NODES],
+        nodes_featureids=[node[3] for node in NODES],
+        nodes_values=[node[4] for node in NODES],
+        nodes_truenodeids=[node[5] for node in NODES],
+        nodes_falsenodeids=[node[6] for node in NODES],
+        nodes_missing_value_tracks_true=[node[7] for node in NODES],
+        class_treeids=class_tree_ids,
+        class_nodeids=class_node_ids,
+        class_ids=class_ids,
+        class_weights=class_weights,
+        classlabels_int64s=list(range(N_CLASSES)),
+        base_values=[0.1, -0.2, 0.05],
+        post_transform="SOFTMAX",
+    )
+    graph = helper.make_graph(
+        [classifier],
+        "treeEnsembleClassifier",
+        [helper.make_tensor_value_info("input", TensorProto.FLOAT, [None, N_FEATURES])],
+        [
+            helper.make_tensor_value_info("label", TensorProto.INT64, [None]),
+            helper.make_tensor_value_info("probabilities", TensorProto.FLOAT, [None, N_CLASSES]),
+        ],
+    )
+    model = helper.make_model(
+        graph, opset_imports=[helper.make_opsetid("", 13), helper.make_opsetid("ai.onnx.ml", 3)], ir_version=8
+    )
+    onnx.checker.check_model(model)
+    return model
+
+
+if __name__ == "__main__":
+    onnx.save(make_model(), sys.argv[1] if len(sys.argv) > 1 else "treeEnsembleClassifier.onnx")
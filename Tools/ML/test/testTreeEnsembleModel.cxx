@@ -0,0 +1,118 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+//
+/// \file testTreeEnsembleModel.cxx
+/// \brief Check that TreeEnsembleModel gives the same scores as ONNX Runtime
+//
+// The model given as argument (treeEnsembleClassifier.onnx, written by makeTreeEnsembleClassifier.py) is evaluated
+// with both backends on random entries whose features are taken on the thresholds of the trees, between them, outside
+// of them or NaN. The program returns 1 if the scores differ by more than 1e-5.
+//
+
+#include "Tools/ML/TreeEnsembleModel.h"
+#include "Tools/ML/model.h"
+
+#include <Framework/Logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+  constexpr std::size_t NEntries{4096};
+  constexpr float MaxScoreDiff{1.e-5f};
+  constexpr int NClasses{3};
+  constexpr int NFeatures{4};
+
+  if (argc < 2) {
+    LOG(error) << "Usage: " << argv[0] << " <ONNX file of the tree-ensemble classifier>";
+    return 1;
+  }
+  const std::string path{argv[1]};
+
+  o2::ml::OnnxModel onnxModel;
+  onnxModel.initModel(path);
+  o2::ml::TreeEnsembleModel nativeModel;
+  if (!nativeModel.initModel(path)) {
+    LOG(error) << "Model " << path << " not supported by the native tree-ensemble evaluation";
+    return 1;
+  }
+  if (nativeModel.getNumClasses() != NClasses || nativeModel.getNumInputNodes() != NFeatures || nativeModel.getNumUsedFeatures() != NFeatures) {
+    LOG(error) << "Unexpected model: " << nativeModel.getNumClasses() << " classes, " << nativeModel.getNumInputNodes() << " input features, " << nativeModel.getNumUsedFeatures() << " used features";
+    return 1;
+  }
+
+  // features on the thresholds (odd values), below, between or above them (even values) or NaN
+  const auto thresholds = nativeModel.getFeatureThresholds();
+  std::mt19937 generator(12345);
+  std::vector<float> input(NEntries * NFeatures, 0.f);
+  for (std::size_t iEntry = 0; iEntry < NEntries; ++iEntry) {
+    for (std::size_t iFeature = 0; iFeature < thresholds.size(); ++iFeature) {
+      const auto& featureThresholds = thresholds[iFeature];
+      const std::size_t iValue = std::uniform_int_distribution<std::size_t>(0, 2 * featureThresholds.size() + 1)(generator);
+      float& value = input[iEntry * NFeatures + iFeature];
+      if (iValue == 2 * featureThresholds.size() + 1) {
+        value = std::numeric_limits<float>::quiet_NaN();
+      } else if (iValue % 2 == 1) {
+        value = featureThresholds[iValue / 2];
+      } else if (iValue == 0) {
+        value = featureThresholds.front() - 1.f;
+      } else if (iValue / 2 == featureThresholds.size()) {
+        value = featureThresholds.back() + 1.f;
+      } else {
+        value = 0.5f * (featureThresholds[iValue / 2 - 1] + featureThresholds[iValue / 2]);
+      }
+    }
+  }
+
+  std::vector<float> outputOnnx, outputNative;
+  if (!onnxModel.evalModelBatch<float>(input, NEntries, outputOnnx)) {
+    LOG(error) << "Inference of the model " << path << " with ONNX Runtime failed";
+    return 1;
+  }
+  if (!nativeModel.evalModelBatch(input, NEntries, outputNative)) {
+    LOG(error) << "Native inference of the model " << path << " failed";
+    return 1;
+  }
+  if (outputNative.size() != NEntries * NClasses || outputOnnx.size() != outputNative.size()) {
+    LOG(error) << "Output sizes differ: " << outputOnnx.size() << " with ONNX Runtime, " << outputNative.size() << " with the native evaluation";
+    return 1;
+  }
+  int nFailures{0};
+  for (std::size_t iOutput = 0; iOutput < outputNative.size(); ++iOutput) {
+    if (!(std::abs(outputOnnx[iOutput] - outputNative[iOutput]) <= MaxScoreDiff)) {
+      if (nFailures++ < 10) { // o2-linter: disable="magic-number" (number of printed failures)
+        const std::size_t iEntry = iOutput / NClasses;
+        LOG(error) << "Entry " << iEntry << " (" << input[iEntry * NFeatures] << ", " << input[iEntry * NFeatures + 1] << ", " << input[iEntry * NFeatures + 2] << ", " << input[iEntry * NFeatures + 3]
+                   << "), class " << iOutput % NClasses << ": score " << outputNative[iOutput] << " instead of " << outputOnnx[iOutput];
+      }
+    }
+  }
+
+  // entries with fewer features than used in the trees have to be rejected
+  std::vector<float> shortInput(NFeatures - 1, 0.f);
+  if (nativeModel.evalModelBatch(shortInput.data(), 1, shortInput.size(), outputNative)) {
+    LOG(error) << "Entry with " << shortInput.size() << " features evaluated by a model using " << nativeModel.getNumUsedFeatures();
+    ++nFailures;
+  }
+
+  if (nFailures > 0) {
+    LOG(error) << nFailures << " failures";
+    return 1;
+  }
+  LOG(info) << "Native and ONNX Runtime scores of " << NEntries << " entries agree";
+  return 0;
+}